@@ -1,8 +1,8 @@
 /******************************************************************************/
 /*                                                                            */
 /* kernel/config.h                                                            */
-/*                                                                 2023/01/04 */
-/* Copyright (C) 2018-2023 Mochi.                                             */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2018-2026 Mochi.                                             */
 /*                                                                            */
 /******************************************************************************/
 #ifndef __KERNEL_CONFIG_H__
@@ -29,6 +29,16 @@
 /** tick間隔(hz) */
 #define MK_CONFIG_TICK_HZ ( 100 )
 
+/*--------*/
+/* タイマ */
+/*--------*/
+/** ドライバプロセスのタイマスラック初期値[us] */
+#define MK_CONFIG_TIMER_SLACK_DRIVER ( 50 )
+/** サーバプロセスのタイマスラック初期値[us] */
+#define MK_CONFIG_TIMER_SLACK_SERVER ( 1000 )
+/** ユーザプロセスのタイマスラック初期値[us] */
+#define MK_CONFIG_TIMER_SLACK_USER   ( 5000 )
+
 /*------------*/
 /* 割込み番号 */
 /*------------*/
@@ -50,6 +60,42 @@
 #define MK_CONFIG_INTNO_THREAD    ( 0x37 )
 /** タスク管理割込み番号 */
 #define MK_CONFIG_INTNO_TASK      ( 0x38 )
+/** イベント待ち合わせ割込み番号 */
+#define MK_CONFIG_INTNO_EVENT     ( 0x39 )
+/** 通知割込み番号 */
+#define MK_CONFIG_INTNO_NOTIFY    ( 0x3A )
+/** 出版購読割込み番号 */
+#define MK_CONFIG_INTNO_PUBSUB    ( 0x3B )
+/** エンドポイント割込み番号 */
+#define MK_CONFIG_INTNO_ENDPOINT  ( 0x3C )
+/** システムコール割込み番号 */
+#define MK_CONFIG_INTNO_SYSCALL   ( 0x3D )
+
+/*----------------------*/
+/* メッセージパッシング */
+/*----------------------*/
+/** メッセージキュー最大メッセージ数初期値 */
+#define MK_CONFIG_MSG_QUEUE_NUM   ( 256 )
+/** メッセージキュー最大サイズ初期値 */
+#define MK_CONFIG_MSG_QUEUE_SIZE  ( 262144 )
+/** トラフィック統計エントリ数(2のべき乗) */
+#define MK_CONFIG_MSG_TRAFFIC_NUM ( 256 )
+
+/*----------*/
+/* 出版購読 */
+/*----------*/
+/** 出版購読グループ数 */
+#define MK_CONFIG_PUB_GRP_NUM     ( 64 )
+/** 出版購読グループ毎最大購読タスク数 */
+#define MK_CONFIG_PUB_MEMBER_NUM  ( 64 )
+
+/*----------------*/
+/* エンドポイント */
+/*----------------*/
+/** エンドポイント最大数 */
+#define MK_CONFIG_EP_NUM          ( 1024 )
+/** エンドポイント毎最大メッセージ数 */
+#define MK_CONFIG_EP_QUEUE_NUM    ( 256 )
 
 /*--------------*/
 /* タスク名管理 */
@@ -0,0 +1,58 @@
+/******************************************************************************/
+/*                                                                            */
+/* kernel/endpoint.h                                                          */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2026 Mochi.                                                  */
+/*                                                                            */
+/******************************************************************************/
+#ifndef __KERNEL_ENDPOINT_H__
+#define __KERNEL_ENDPOINT_H__
+/******************************************************************************/
+/* インクルード                                                               */
+/******************************************************************************/
+/* 標準ヘッダ */
+#include <stddef.h>
+#include <stdint.h>
+
+/* カーネルヘッダ */
+#include "config.h"
+#include "message.h"
+#include "types.h"
+
+
+/******************************************************************************/
+/* 定義                                                                       */
+/******************************************************************************/
+/** エンドポイント割込み番号 */
+#define MK_EP_INTNO MK_CONFIG_INTNO_ENDPOINT
+
+/** エンドポイントID */
+typedef uint32_t MkEpId_t;
+
+/** エンドポイントID無効値 */
+#define MK_EPID_NULL            ( UINT32_MAX )
+
+/* 機能ID */
+#define MK_EP_FUNCID_CREATE     ( 0x00000001 )  /**< エンドポイント生成 */
+#define MK_EP_FUNCID_DELETE     ( 0x00000002 )  /**< エンドポイント削除 */
+#define MK_EP_FUNCID_SEND       ( 0x00000003 )  /**< メッセージ送信     */
+#define MK_EP_FUNCID_RECEIVE    ( 0x00000004 )  /**< メッセージ受信     */
+#define MK_EP_FUNCID_GET_STAT   ( 0x00000005 )  /**< キュー統計取得     */
+
+/** エンドポイントパラメータ */
+typedef struct {
+    uint32_t         funcId;        /**< 機能ID                       */
+    MkRet_t          ret;           /**< 戻り値                       */
+    MkErr_t          err;           /**< エラー内容                   */
+    MkEpId_t         epId;          /**< エンドポイントID             */
+    MkTaskId_t       src;           /**< 受信メッセージ送信元タスクID */
+    void             *pMsg;         /**< 送信メッセージ/受信バッファ  */
+    size_t           bufferSize;    /**< 受信バッファサイズ           */
+    size_t           size;          /**< 送信/受信メッセージサイズ    */
+    uint32_t         timeout;       /**< タイムアウト時間(μ秒)       */
+    MkMsgQueueStat_t *pStat;        /**< キュー統計格納先             */
+} MkEpParam_t;
+
+
+/******************************************************************************/
+#endif
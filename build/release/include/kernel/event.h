@@ -0,0 +1,54 @@
+/******************************************************************************/
+/*                                                                            */
+/* kernel/event.h                                                             */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2026 Mochi.                                                  */
+/*                                                                            */
+/******************************************************************************/
+#ifndef __KERNEL_EVENT_H__
+#define __KERNEL_EVENT_H__
+/******************************************************************************/
+/* インクルード                                                               */
+/******************************************************************************/
+/* 標準ヘッダ */
+#include <stdint.h>
+
+/* カーネルヘッダ */
+#include "config.h"
+#include "types.h"
+
+
+/******************************************************************************/
+/* 定義                                                                       */
+/******************************************************************************/
+/** イベント待ち合わせ割込み番号 */
+#define MK_EVENT_INTNO MK_CONFIG_INTNO_EVENT
+
+/** 受信待ちメッセージ送信元タスク数最大 */
+#define MK_EVENT_SRC_NUM        ( 8 )
+
+/* 機能ID */
+#define MK_EVENT_FUNCID_WAIT    ( 0x00000001 )  /**< イベント待ち合わせ */
+
+/* イベント */
+#define MK_EVENT_MSG            ( 0x00000001 )  /**< メッセージ受信     */
+#define MK_EVENT_INT            ( 0x00000002 )  /**< ハードウェア割込み */
+#define MK_EVENT_TIMER          ( 0x00000004 )  /**< タイマ満了         */
+#define MK_EVENT_NTF            ( 0x00000008 )  /**< 通知               */
+
+/** イベント待ち合わせパラメータ */
+typedef struct {
+    uint32_t   funcId;                      /**< 機能ID                   */
+    MkRet_t    ret;                         /**< 戻り値                   */
+    MkErr_t    err;                         /**< エラー内容               */
+    uint32_t   events;                      /**< 待ち合わせイベント       */
+    uint32_t   srcNum;                      /**< 受信待ち送信元タスク数   */
+    MkTaskId_t src[ MK_EVENT_SRC_NUM ];     /**< 受信待ち送信元タスクID   */
+    uint32_t   timeout;                     /**< タイマ満了時間(μ秒)     */
+    uint32_t   occurred;                    /**< 発生イベント             */
+    uint32_t   intList;                     /**< 割込み発生IRQリスト      */
+} MkEventParam_t;
+
+
+/******************************************************************************/
+#endif
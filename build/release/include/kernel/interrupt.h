@@ -1,8 +1,8 @@
 /******************************************************************************/
 /*                                                                            */
 /* kernel/interrupt.h                                                         */
-/*                                                                 2019/08/30 */
-/* Copyright (C) 2018-2019 Mochi.                                             */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2018-2026 Mochi.                                             */
 /*                                                                            */
 /******************************************************************************/
 #ifndef __KERNEL_INTERRUPT_H__
@@ -30,16 +30,36 @@
 #define MK_INT_FUNCID_COMPLETE         ( 0x00000004 )   /**< 割込み完了       */
 #define MK_INT_FUNCID_ENABLE           ( 0x00000005 )   /**< 割込み有効化     */
 #define MK_INT_FUNCID_DISABLE          ( 0x00000006 )   /**< 割込み無効化     */
+#define MK_INT_FUNCID_SET_COALESCE     ( 0x00000007 )   /**< 割込み合体設定   */
+#define MK_INT_FUNCID_CLAIM            ( 0x00000008 )   /**< 割込みクレーム   */
+
+/** 割込み完了フラグ(クレーム) */
+#define MK_INT_COMPLETE_CLAIM ( 0x00000001 )
+
+/** IRQ数 */
+#define MK_INT_IRQ_NUM ( 24 )
+
+/** IRQ毎割込み発生情報 */
+typedef struct {
+    uint32_t count;     /**< 割込み発生回数    */
+    uint32_t reserved;  /**< 予約              */
+    uint64_t firstTsc;  /**< 初回割込み発生TSC */
+    uint64_t lastTsc;   /**< 最終割込み発生TSC */
+} MkIntInfo_t;
 
 /** ハードウェア割込み制御パラメータ */
 typedef struct {
-    uint32_t funcId;    /**< 機能ID           */
-    MkRet_t  ret;       /**< 戻り値           */
-    MkErr_t  err;       /**< エラー内容       */
+    uint32_t    funcId; /**< 機能ID           */
+    MkRet_t     ret;    /**< 戻り値           */
+    MkErr_t     err;    /**< エラー内容       */
     union {
         uint8_t  irqNo; /**< IRQ番号          */
         uint32_t flag;  /**< 割込み発生フラグ */
     };
+    uint32_t    count;  /**< 合体割込み回数   */
+    uint32_t    usec;   /**< 合体待ち時間[us] */
+    MkIntInfo_t *pInfo; /**< 割込み発生情報   */
+    uint32_t    *pSeen; /**< 確認済み発生回数 */
 } MkIntParam_t;
 
 
@@ -1,8 +1,8 @@
 /******************************************************************************/
 /*                                                                            */
 /* kernel/message.h                                                           */
-/*                                                                 2020/04/30 */
-/* Copyright (C) 2018-2020 Mochi.                                             */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2018-2026 Mochi.                                             */
 /*                                                                            */
 /******************************************************************************/
 #ifndef __KERNEL_MESSAGE_H__
@@ -29,9 +29,28 @@
 #define MK_MSG_SIZE_MAX         ( 24576 )
 
 /* 機能ID */
-#define MK_MSG_FUNCID_RECEIVE   ( 0x00000001 )  /**< メッセージ受信                   */
-#define MK_MSG_FUNCID_SEND      ( 0x00000002 )  /**< メッセージ送信(ブロッキング)     */
-#define MK_MSG_FUNCID_SEND_NB   ( 0x00000003 )  /**< メッセージ送信(ノンブロッキング) */
+#define MK_MSG_FUNCID_RECEIVE      ( 0x00000001 )  /**< メッセージ受信                   */
+#define MK_MSG_FUNCID_SEND         ( 0x00000002 )  /**< メッセージ送信(ブロッキング)     */
+#define MK_MSG_FUNCID_SEND_NB      ( 0x00000003 )  /**< メッセージ送信(ノンブロッキング) */
+#define MK_MSG_FUNCID_SET_LIMIT    ( 0x00000004 )  /**< メッセージキュー上限設定         */
+#define MK_MSG_FUNCID_GET_STAT     ( 0x00000005 )  /**< メッセージキュー統計取得         */
+#define MK_MSG_FUNCID_SET_MODE     ( 0x00000006 )  /**< メッセージ受信モード設定         */
+#define MK_MSG_FUNCID_GET_TRAFFIC  ( 0x00000007 )  /**< トラフィック統計取得             */
+#define MK_MSG_FUNCID_DUMP_TRAFFIC ( 0x00000008 )  /**< トラフィック統計ログ出力         */
+
+/* 送信フラグ */
+#define MK_MSG_FLAG_NONE        ( 0x00000000 )  /**< フラグ無し           */
+#define MK_MSG_FLAG_URGENT      ( 0x00000001 )  /**< 緊急メッセージ       */
+#define MK_MSG_FLAG_NB          ( 0x00000002 )  /**< ノンブロッキング送信 */
+
+/* レーン */
+#define MK_MSG_LANE_URGENT      ( 0 )           /**< 緊急レーン */
+#define MK_MSG_LANE_NORMAL      ( 1 )           /**< 通常レーン */
+#define MK_MSG_LANE_NUM         ( 2 )           /**< レーン数   */
+
+/* 受信モード */
+#define MK_MSG_MODE_FIFO        ( 0 )           /**< 到着順               */
+#define MK_MSG_MODE_RR          ( 1 )           /**< 送信元ラウンドロビン */
 
 /** メッセージ受信パラメータ */
 typedef struct {
@@ -46,18 +65,62 @@ typedef struct {
     MkTaskId_t dst;             /**< 送信先タスクID       */
     void       *pMsg;           /**< 送信メッセージ格納先 */
     size_t     size;            /**< 送信メッセージサイズ */
+    uint32_t   flags;           /**< 送信フラグ           */
 } MkMsgParamSend_t;
 
+/** メッセージキュー上限設定パラメータ */
+typedef struct {
+    uint32_t num;               /**< 最大メッセージ数     */
+    size_t   size;              /**< 最大サイズ           */
+} MkMsgParamLimit_t;
+
+/** メッセージキュー統計 */
+typedef struct {
+    uint32_t num;                           /**< メッセージ数             */
+    size_t   size;                          /**< メッセージサイズ合計     */
+    uint32_t hwmNum;                        /**< メッセージ数最大記録     */
+    size_t   hwmSize;                       /**< メッセージサイズ最大記録 */
+    uint32_t limitNum;                      /**< 最大メッセージ数         */
+    size_t   limitSize;                     /**< 最大サイズ               */
+    uint32_t fullCnt;                       /**< キュー満杯発生回数       */
+    uint32_t laneNum[ MK_MSG_LANE_NUM ];    /**< レーン別メッセージ数     */
+    uint32_t laneCnt[ MK_MSG_LANE_NUM ];    /**< レーン別受付回数         */
+} MkMsgQueueStat_t;
+
+/** メッセージトラフィック統計 */
+typedef struct {
+    MkTaskId_t src;                         /**< 送信元タスクID               */
+    MkTaskId_t dst;                         /**< 送信先タスクID               */
+    uint32_t   num;                         /**< 送信メッセージ数             */
+    uint32_t   blockNum;                    /**< ブロッキング送信数           */
+    uint32_t   nbNum;                       /**< ノンブロッキング送信数       */
+    uint32_t   recvNum;                     /**< 受信メッセージ数             */
+    uint64_t   size;                        /**< 送信メッセージサイズ合計     */
+    uint64_t   latencySum;                  /**< 送信-受信間TSC差合計         */
+    uint32_t   latencyMax;                  /**< 送信-受信間TSC差最大         */
+} MkMsgTraffic_t;
+
+/** トラフィック統計取得パラメータ */
+typedef struct {
+    MkMsgTraffic_t *pBuffer;                /**< 統計格納先                   */
+    uint32_t       num;                     /**< 格納先/取得エントリ数        */
+    uint32_t       lost;                    /**< 記録不可回数                 */
+} MkMsgParamTraffic_t;
+
 /** メッセージパッシングパラメータ */
 typedef struct {
-    uint32_t funcId;            /**< 機能ID                   */
-    MkRet_t  ret;               /**< 戻り値                   */
-    MkErr_t  err;               /**< エラー内容               */
-    union {                     /*----------------------------*/
-        MkMsgParamRecv_t recv;  /**< メッセージ受信パラメータ */
-        MkMsgParamSend_t send;  /**< メッセージ送信パラメータ */
-    };                          /*----------------------------*/
-    uint32_t timeout;           /**< タイムアウト時間         */
+    uint32_t funcId;                    /**< 機能ID                   */
+    MkRet_t  ret;                       /**< 戻り値                   */
+    MkErr_t  err;                       /**< エラー内容               */
+    union {                             /*----------------------------*/
+        MkMsgParamRecv_t    recv;       /**< メッセージ受信パラメータ */
+        MkMsgParamSend_t    send;       /**< メッセージ送信パラメータ */
+        MkMsgParamLimit_t   limit;      /**< キュー上限設定パラメータ */
+        MkMsgQueueStat_t    *pStat;     /**< キュー統計格納先         */
+        uint32_t            mode;       /**< 受信モード               */
+        MkMsgParamTraffic_t traffic;    /**< トラフィック統計取得     */
+    };                                  /*----------------------------*/
+    uint32_t timeout;                   /**< タイムアウト時間         */
 } MkMsgParam_t;
 
 
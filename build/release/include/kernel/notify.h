@@ -0,0 +1,43 @@
+/******************************************************************************/
+/*                                                                            */
+/* kernel/notify.h                                                            */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2026 Mochi.                                                  */
+/*                                                                            */
+/******************************************************************************/
+#ifndef __KERNEL_NOTIFY_H__
+#define __KERNEL_NOTIFY_H__
+/******************************************************************************/
+/* インクルード                                                               */
+/******************************************************************************/
+/* 標準ヘッダ */
+#include <stdint.h>
+
+/* カーネルヘッダ */
+#include "config.h"
+#include "types.h"
+
+
+/******************************************************************************/
+/* 定義                                                                       */
+/******************************************************************************/
+/** 通知割込み番号 */
+#define MK_NTF_INTNO MK_CONFIG_INTNO_NOTIFY
+
+/* 機能ID */
+#define MK_NTF_FUNCID_SEND  ( 0x00000001 )  /**< 通知送信       */
+#define MK_NTF_FUNCID_WAIT  ( 0x00000002 )  /**< 通知待ち合わせ */
+
+/** 通知パラメータ */
+typedef struct {
+    uint32_t   funcId;      /**< 機能ID                   */
+    MkRet_t    ret;         /**< 戻り値                   */
+    MkErr_t    err;         /**< エラー内容               */
+    MkTaskId_t dst;         /**< 送信先タスクID           */
+    uint32_t   bits;        /**< 通知ビット               */
+    uint32_t   timeout;     /**< タイムアウト時間(μ秒)   */
+} MkNtfParam_t;
+
+
+/******************************************************************************/
+#endif
@@ -0,0 +1,46 @@
+/******************************************************************************/
+/*                                                                            */
+/* kernel/pubsub.h                                                            */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2026 Mochi.                                                  */
+/*                                                                            */
+/******************************************************************************/
+#ifndef __KERNEL_PUBSUB_H__
+#define __KERNEL_PUBSUB_H__
+/******************************************************************************/
+/* インクルード                                                               */
+/******************************************************************************/
+/* 標準ヘッダ */
+#include <stddef.h>
+#include <stdint.h>
+
+/* カーネルヘッダ */
+#include "config.h"
+#include "types.h"
+
+
+/******************************************************************************/
+/* 定義                                                                       */
+/******************************************************************************/
+/** 出版購読割込み番号 */
+#define MK_PUB_INTNO MK_CONFIG_INTNO_PUBSUB
+
+/* 機能ID */
+#define MK_PUB_FUNCID_SUBSCRIBE     ( 0x00000001 )  /**< 購読開始 */
+#define MK_PUB_FUNCID_UNSUBSCRIBE   ( 0x00000002 )  /**< 購読終了 */
+#define MK_PUB_FUNCID_PUBLISH       ( 0x00000003 )  /**< 出版     */
+
+/** 出版購読パラメータ */
+typedef struct {
+    uint32_t funcId;    /**< 機能ID           */
+    MkRet_t  ret;       /**< 戻り値           */
+    MkErr_t  err;       /**< エラー内容       */
+    uint32_t grpId;     /**< グループID       */
+    void     *pMsg;     /**< メッセージ       */
+    size_t   size;      /**< メッセージサイズ */
+    uint32_t num;       /**< 配信数           */
+} MkPubParam_t;
+
+
+/******************************************************************************/
+#endif
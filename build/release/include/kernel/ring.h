@@ -0,0 +1,78 @@
+/******************************************************************************/
+/*                                                                            */
+/* kernel/ring.h                                                              */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2026 Mochi.                                                  */
+/*                                                                            */
+/******************************************************************************/
+#ifndef __KERNEL_RING_H__
+#define __KERNEL_RING_H__
+/******************************************************************************/
+/* インクルード                                                               */
+/******************************************************************************/
+/* 標準ヘッダ */
+#include <stdint.h>
+
+/* カーネルヘッダ */
+#include "syscall.h"
+#include "types.h"
+
+
+/******************************************************************************/
+/* 定義                                                                       */
+/******************************************************************************/
+/** リングエントリ数(2のべき乗) */
+#define MK_RING_ENTRY_NUM ( 64 )
+/** リングインデックスマスク */
+#define MK_RING_MASK      ( MK_RING_ENTRY_NUM - 1 )
+
+/**
+ * 投入キューエントリ
+ *
+ * noにはブロックしないレジスタ渡し形式のシステムコール番号を指定し、arg[0]～
+ * arg[2]はEBX,ESI,EDIの入力値として扱う。指定可能なシステムコールは以下とし、
+ * それ以外はMK_ERR_PARAMで完了する。
+ *  - MK_SYSCALL_MSG_SEND_NB
+ *  - MK_SYSCALL_IOPORT_IN_BYTE/WORD/DWORD
+ *  - MK_SYSCALL_IOPORT_OUT_BYTE/WORD/DWORD
+ *  - MK_SYSCALL_TASK_GET_ID
+ *  - MK_SYSCALL_INT_COMPLETE
+ *  - MK_SYSCALL_TIMER_START/STOP
+ */
+typedef struct {
+    uint32_t no;            /**< システムコール番号 */
+    uint32_t userData;      /**< ユーザデータ       */
+    uint32_t arg[ 3 ];      /**< 引数1～3           */
+} MkRingSqe_t;
+
+/**
+ * 完了キューエントリ
+ *
+ * ret,errはEAX,EBXの出力値、valueはESIの出力値を格納する。
+ */
+typedef struct {
+    uint32_t userData;      /**< ユーザデータ */
+    MkRet_t  ret;           /**< 戻り値       */
+    MkErr_t  err;           /**< エラー内容   */
+    uint32_t value;         /**< 出力値       */
+} MkRingCqe_t;
+
+/**
+ * システムコールリング
+ *
+ * プロセスのユーザ領域に配置し、投入キューと完了キューで構成する。各インデッ
+ * クスはラップアラウンドする通し番号とし、エントリ位置はMK_RING_MASKでマスク
+ * して求める。sqTail,cqHeadはユーザが、sqHead,cqTailはカーネルが更新する。
+ */
+typedef struct {
+    volatile uint32_t sqHead;                   /**< 投入キュー先頭 */
+    volatile uint32_t sqTail;                   /**< 投入キュー末尾 */
+    volatile uint32_t cqHead;                   /**< 完了キュー先頭 */
+    volatile uint32_t cqTail;                   /**< 完了キュー末尾 */
+    MkRingSqe_t       sq[ MK_RING_ENTRY_NUM ];  /**< 投入キュー     */
+    MkRingCqe_t       cq[ MK_RING_ENTRY_NUM ];  /**< 完了キュー     */
+} MkRing_t;
+
+
+/******************************************************************************/
+#endif
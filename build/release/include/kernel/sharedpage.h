@@ -0,0 +1,69 @@
+/******************************************************************************/
+/*                                                                            */
+/* kernel/sharedpage.h                                                        */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2026 Mochi.                                                  */
+/*                                                                            */
+/******************************************************************************/
+#ifndef __KERNEL_SHAREDPAGE_H__
+#define __KERNEL_SHAREDPAGE_H__
+/******************************************************************************/
+/* インクルード                                                               */
+/******************************************************************************/
+/* 標準ヘッダ */
+#include <stdint.h>
+
+/* カーネルヘッダ */
+#include "interrupt.h"
+#include "types.h"
+
+
+/******************************************************************************/
+/* 定義                                                                       */
+/******************************************************************************/
+/** 共有ページ仮想アドレス */
+#define MK_SHAREDPAGE_ADDR ( 0xBFFF7000 )
+/** 共有ページサイズ */
+#define MK_SHAREDPAGE_SIZE ( 0x00001000 )
+/** 割込み状態エントリ数 */
+#define MK_SHAREDPAGE_INT_NUM ( 32 )
+
+/**
+ * 割込み状態
+ *
+ * ハードウェア割込みを監視するタスク毎にカーネルが割り当てる。割込み発生回数
+ * はエントリ割当て時に0とし、監視中IRQのハードウェア割込み発生毎にカーネルが
+ * インクリメントする。割込み合体条件は適用しない。
+ */
+typedef struct {
+    MkTaskId_t        taskId;                   /**< 割当て先タスクID */
+    volatile uint32_t count[ MK_INT_IRQ_NUM ];  /**< 割込み発生回数   */
+} MkSharedInt_t;
+
+/**
+ * 共有ページ
+ *
+ * カーネルが更新し、全プロセスに読込専用でマッピングする。実行中タスク情報は
+ * タスクスイッチ毎に切替先タスクの値に更新する。tick情報と時刻情報はseqが奇
+ * 数の間は更新中を示し、読込前後でseqが一致しない場合は読み直す。
+ *
+ * 単調増加時刻はTSC値からtscBaseを減じてtscHzで換算する。tscHzが0の場合は
+ * tickカウンタで換算する。実時刻は単調増加時刻にrealBaseを加算する。
+ */
+typedef struct {
+    MkTaskId_t        taskId;   /**< 実行中タスクID               */
+    MkPid_t           pid;      /**< 実行中プロセスID             */
+    volatile uint32_t seq;      /**< 更新シーケンス番号           */
+    uint32_t          tickHz;   /**< tick周波数[Hz]               */
+    uint64_t          tick;     /**< tickカウンタ                 */
+    uint64_t          tickTsc;  /**< 最終tick時TSC値              */
+    uint64_t          tscHz;    /**< TSC周波数[Hz](0:無効)        */
+    uint64_t          tscBase;  /**< 単調増加時刻0時のTSC値       */
+    uint64_t          realBase; /**< 単調増加時刻0時の実時刻[ns]  */
+    /** 割込み状態 */
+    MkSharedInt_t     intState[ MK_SHAREDPAGE_INT_NUM ];
+} MkSharedPage_t;
+
+
+/******************************************************************************/
+#endif
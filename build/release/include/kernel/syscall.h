@@ -0,0 +1,110 @@
+/******************************************************************************/
+/*                                                                            */
+/* kernel/syscall.h                                                           */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2026 Mochi.                                                  */
+/*                                                                            */
+/******************************************************************************/
+#ifndef __KERNEL_SYSCALL_H__
+#define __KERNEL_SYSCALL_H__
+/******************************************************************************/
+/* インクルード                                                               */
+/******************************************************************************/
+/* 標準ヘッダ */
+#include <stdint.h>
+
+/* カーネルヘッダ */
+#include "config.h"
+
+
+/******************************************************************************/
+/* 定義                                                                       */
+/******************************************************************************/
+/** システムコール割込み番号 */
+#define MK_SYSCALL_INTNO MK_CONFIG_INTNO_SYSCALL
+
+/* システムコール形式 */
+#define MK_SYSCALL_TYPE_NONE  ( 0 ) /**< 未定義                 */
+#define MK_SYSCALL_TYPE_PARAM ( 1 ) /**< パラメータブロック渡し */
+#define MK_SYSCALL_TYPE_REG   ( 2 ) /**< レジスタ渡し           */
+
+/*
+ * システムコール呼出し規約
+ *
+ * システムコール割込み番号のint命令またはSYSENTER命令で呼び出す。ECXレジス
+ * タとEDXレジスタは破壊される。
+ *
+ * パラメータブロック渡し
+ *  入力: EAX=システムコール番号, ESI=パラメータアドレス
+ *  出力: パラメータブロック
+ *
+ * レジスタ渡し
+ *  入力: EAX=システムコール番号, EBX=引数1, ESI=引数2, EDI=引数3
+ *  出力: EAX=戻り値, EBX=エラー内容, ESI=出力値1, EDI=出力値2
+ */
+
+/**
+ * システムコールテーブル
+ *
+ * _ENTRY( 名前, 番号, 形式, 転送先割込み番号 )
+ *
+ * カーネルのディスパッチテーブルとlibmkのシステムコール番号は本テーブルから
+ * 生成する。パラメータブロック渡しのシステムコールは転送先割込み番号の割込み
+ * ハンドラに転送する。
+ */
+#define MK_SYSCALL_TABLE( _ENTRY )                                             \
+    /*----------------------------------------------------------------------*/ \
+    /* パラメータブロック渡し                                               */ \
+    /*----------------------------------------------------------------------*/ \
+    _ENTRY( MSG,              0x01, PARAM, MK_CONFIG_INTNO_MESSAGE   )         \
+    _ENTRY( IOPORT,           0x02, PARAM, MK_CONFIG_INTNO_IOPORT    )         \
+    _ENTRY( IOMEM,            0x03, PARAM, MK_CONFIG_INTNO_IOMEM     )         \
+    _ENTRY( INT,              0x04, PARAM, MK_CONFIG_INTNO_INTERRUPT )         \
+    _ENTRY( TIMER,            0x05, PARAM, MK_CONFIG_INTNO_TIMER     )         \
+    _ENTRY( PROC,             0x06, PARAM, MK_CONFIG_INTNO_PROC      )         \
+    _ENTRY( TASKNAME,         0x07, PARAM, MK_CONFIG_INTNO_TASKNAME  )         \
+    _ENTRY( THREAD,           0x08, PARAM, MK_CONFIG_INTNO_THREAD    )         \
+    _ENTRY( TASK,             0x09, PARAM, MK_CONFIG_INTNO_TASK      )         \
+    _ENTRY( EVENT,            0x0A, PARAM, MK_CONFIG_INTNO_EVENT     )         \
+    _ENTRY( NTF,              0x0B, PARAM, MK_CONFIG_INTNO_NOTIFY    )         \
+    _ENTRY( PUB,              0x0C, PARAM, MK_CONFIG_INTNO_PUBSUB    )         \
+    _ENTRY( EP,               0x0D, PARAM, MK_CONFIG_INTNO_ENDPOINT  )         \
+    /*----------------------------------------------------------------------*/ \
+    /* レジスタ渡し                                                         */ \
+    /*----------------------------------------------------------------------*/ \
+    _ENTRY( MSG_RECEIVE,      0x10, REG,   0                         )         \
+    _ENTRY( MSG_SEND,         0x11, REG,   0                         )         \
+    _ENTRY( MSG_SEND_NB,      0x12, REG,   0                         )         \
+    _ENTRY( IOPORT_IN_BYTE,   0x13, REG,   0                         )         \
+    _ENTRY( IOPORT_IN_WORD,   0x14, REG,   0                         )         \
+    _ENTRY( IOPORT_IN_DWORD,  0x15, REG,   0                         )         \
+    _ENTRY( IOPORT_OUT_BYTE,  0x16, REG,   0                         )         \
+    _ENTRY( IOPORT_OUT_WORD,  0x17, REG,   0                         )         \
+    _ENTRY( IOPORT_OUT_DWORD, 0x18, REG,   0                         )         \
+    _ENTRY( TASK_GET_ID,      0x19, REG,   0                         )         \
+    _ENTRY( TIMER_SLEEP,      0x1A, REG,   0                         )         \
+    _ENTRY( INT_COMPLETE,     0x1B, REG,   0                         )         \
+    _ENTRY( RING_ENTER,       0x1C, REG,   0                         )         \
+    _ENTRY( SYSSTAT_GET,      0x1D, REG,   0                         )         \
+    _ENTRY( SYSSTAT_DUMP,     0x1E, REG,   0                         )         \
+    _ENTRY( INTSTAT_GET,      0x1F, REG,   0                         )         \
+    _ENTRY( TIMERSTAT_GET,    0x20, REG,   0                         )         \
+    _ENTRY( TIMER_SET_SLACK,  0x21, REG,   0                         )         \
+    _ENTRY( TIMER_START,      0x22, REG,   0                         )         \
+    _ENTRY( TIMER_STOP,       0x23, REG,   0                         )
+
+/** システムコール数 */
+#define MK_SYSCALL_NUM ( 0x24 )
+
+/** システムコール番号定義マクロ */
+#define MK_SYSCALL_NO( _NAME, _NO, _TYPE, _INTNO ) \
+    MK_SYSCALL_##_NAME = ( _NO ),
+
+/** システムコール番号 */
+enum {
+    MK_SYSCALL_TABLE( MK_SYSCALL_NO )
+};
+
+
+/******************************************************************************/
+#endif
@@ -0,0 +1,86 @@
+/******************************************************************************/
+/*                                                                            */
+/* kernel/sysstat.h                                                           */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2026 Mochi.                                                  */
+/*                                                                            */
+/******************************************************************************/
+#ifndef __KERNEL_SYSSTAT_H__
+#define __KERNEL_SYSSTAT_H__
+/******************************************************************************/
+/* インクルード                                                               */
+/******************************************************************************/
+/* 標準ヘッダ */
+#include <stdint.h>
+
+
+/******************************************************************************/
+/* 定義                                                                       */
+/******************************************************************************/
+/** プロセスタイプ数(MK_PROC_TYPE_KERNEL～MK_PROC_TYPE_USER) */
+#define MK_SYSSTAT_PROCTYPE_NUM ( 4 )
+/** 機能ID数(機能ID無しのシステムコールは0を使用) */
+#define MK_SYSSTAT_FUNCID_NUM   ( 16 )
+/** 処理時間ヒストグラムビン数 */
+#define MK_SYSSTAT_BIN_NUM      ( 24 )
+/** 処理時間ヒストグラム最小ビンシフト数 */
+#define MK_SYSSTAT_BIN_SHIFT    ( 6 )
+
+/**
+ * システムコール統計
+ *
+ * 処理時間はTSC差で計測し、ブロック中の時間を含む。ヒストグラムのビンnは処理
+ * 時間が2^(n+MK_SYSSTAT_BIN_SHIFT)以上2^(n+MK_SYSSTAT_BIN_SHIFT+1)未満の呼出
+ * し回数を示す。ただし、ビン0は下限無し、最終ビンは上限無しとする。
+ */
+typedef struct {
+    uint32_t count;                         /**< 呼出し回数           */
+    uint32_t max;                           /**< 処理時間最大         */
+    uint64_t total;                         /**< 処理時間合計         */
+    uint32_t bin[ MK_SYSSTAT_BIN_NUM ];     /**< 処理時間ヒストグラム */
+} MkSysStat_t;
+
+/* 割込み遅延区間 */
+#define MK_INTSTAT_STAGE_WAKE   ( 0 )   /**< 割込み発生→スケジュール開始     */
+#define MK_INTSTAT_STAGE_SWITCH ( 1 )   /**< スケジュール開始→タスクスイッチ */
+#define MK_INTSTAT_STAGE_RETURN ( 2 )   /**< タスクスイッチ→ユーザモード復帰 */
+#define MK_INTSTAT_STAGE_TOTAL  ( 3 )   /**< 割込み発生→ユーザモード復帰     */
+/** 割込み遅延区間数 */
+#define MK_INTSTAT_STAGE_NUM    ( 4 )
+
+/**
+ * 割込み遅延統計
+ *
+ * ハードウェア割込み発生から割込み待ち合わせ中のドライバタスクがユーザモード
+ * に復帰するまでの遅延をTSC差で計測する。ヒストグラムはMkSysStat_tと同じビン
+ * 構成とする。
+ */
+typedef struct {
+    uint32_t count;                         /**< 計測回数         */
+    uint32_t min;                           /**< 遅延最小         */
+    uint32_t max;                           /**< 遅延最大         */
+    uint32_t reserved;                      /**< 予約             */
+    uint64_t total;                         /**< 遅延合計         */
+    uint32_t bin[ MK_SYSSTAT_BIN_NUM ];     /**< 遅延ヒストグラム */
+} MkIntStat_t;
+
+/**
+ * タイマ合体統計
+ *
+ * 満了処理回数は満了したタイマが有った割込みの回数を示し、合体満了タイマ数は
+ * 1回の満了処理で2個目以降に満了したタイマの数を示す。繰延べタイマ数はスラッ
+ * クの範囲内でLAPICタイマ割込みを使用せず次のtick割込みで満了させたタイマの
+ * 数を示す。
+ */
+typedef struct {
+    uint32_t tickWakeup;    /**< tick割込み満了処理回数          */
+    uint32_t hresWakeup;    /**< LAPICタイマ割込み満了処理回数   */
+    uint32_t hresSpurious;  /**< 満了タイマ無しLAPICタイマ割込み */
+    uint32_t expire;        /**< 満了タイマ数                    */
+    uint32_t coalesce;      /**< 合体満了タイマ数                */
+    uint32_t defer;         /**< tick繰延べタイマ数              */
+} MkTimerStat_t;
+
+
+/******************************************************************************/
+#endif
@@ -1,8 +1,8 @@
 /******************************************************************************/
 /*                                                                            */
 /* kernel/timer.h                                                             */
-/*                                                                 2019/07/28 */
-/* Copyright (C) 2018-2019 Mochi.                                             */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2018-2026 Mochi.                                             */
 /*                                                                            */
 /******************************************************************************/
 #ifndef __KERNEL_TIMER_H__
@@ -26,14 +26,58 @@
 #define MK_TIMER_INTNO MK_CONFIG_INTNO_TIMER
 
 /* 機能ID */
-#define MK_TIMER_FUNCID_SLEEP     ( 0x00000001 )    /**< スリープ */
+#define MK_TIMER_FUNCID_SLEEP       ( 0x00000001 )  /**< スリープ         */
+#define MK_TIMER_FUNCID_SLEEP_UNTIL ( 0x00000002 )  /**< 時刻指定スリープ */
+#define MK_TIMER_FUNCID_START       ( 0x00000003 )  /**< タイマ開始       */
+#define MK_TIMER_FUNCID_STOP        ( 0x00000004 )  /**< タイマ停止       */
+
+/* タイマ種別 */
+#define MK_TIMER_TYPE_ONESHOT       ( 0 )           /**< ワンショット */
+#define MK_TIMER_TYPE_REPEAT        ( 1 )           /**< 繰り返し     */
+
+/* 満了通知方法 */
+#define MK_TIMER_NOTIFY_NTF         ( 0 )           /**< 通知         */
+#define MK_TIMER_NOTIFY_MSG         ( 1 )           /**< メッセージ   */
+
+/**
+ * レジスタ渡しタイマ開始(MK_SYSCALL_TIMER_START)のモード値
+ *
+ * ESIの下位16ビットにタイマ種別、上位16ビットに満了通知方法を設定する。
+ */
+#define MK_TIMER_REG_MODE( _TYPE, _NOTIFY ) \
+    ( ( ( _TYPE ) & 0xFFFF ) | ( ( _NOTIFY ) << 16 ) )
+/** モード値からのタイマ種別取得 */
+#define MK_TIMER_REG_TYPE( _MODE )   ( ( _MODE ) & 0xFFFF )
+/** モード値からの満了通知方法取得 */
+#define MK_TIMER_REG_NOTIFY( _MODE ) ( ( _MODE ) >> 16 )
+
+/**
+ * タイマ満了メッセージ
+ *
+ * MK_TIMER_NOTIFY_MSGのタイマ満了毎に、タイマを開始したタスクに自タスクを送
+ * 信元として送信する。メッセージキューが満杯で送信できなかった満了の回数と、
+ * 処理遅延により見逃した繰り返しタイマの満了回数をoverrunに設定し、送信でき
+ * た時点で0に戻す。
+ */
+typedef struct {
+    uint32_t timerId;   /**< タイマID           */
+    uint32_t overrun;   /**< 未送信満了回数     */
+} MkTimerMsg_t;
+
+/** スラック初期値(プロセスタイプ毎の既定値) */
+#define MK_TIMER_SLACK_DEFAULT ( UINT32_MAX )
 
 /** タイマパラメータ */
 typedef struct {
-    uint32_t funcId;    /**< 機能ID         */
-    MkRet_t  ret;       /**< 戻り値         */
-    MkErr_t  err;       /**< エラー内容     */
-    uint32_t usec;      /**< タイマ値(μ秒) */
+    uint32_t funcId;    /**< 機能ID                     */
+    MkRet_t  ret;       /**< 戻り値                     */
+    MkErr_t  err;       /**< エラー内容                 */
+    uint32_t usec;      /**< タイマ値(μ秒)             */
+    uint64_t nsec;      /**< 満了時刻(単調増加時刻[ns]) */
+    uint32_t type;      /**< タイマ種別                 */
+    uint32_t notify;    /**< 満了通知方法               */
+    uint32_t bits;      /**< 通知ビット                 */
+    uint32_t timerId;   /**< タイマID                   */
 } MkTimerParam_t;
 
 
@@ -1,8 +1,8 @@
 /******************************************************************************/
 /*                                                                            */
 /* kernel/types.h                                                             */
-/*                                                                 2021/04/27 */
-/* Copyright (C) 2018-2021 Mochi.                                             */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2018-2026 Mochi.                                             */
 /*                                                                            */
 /******************************************************************************/
 #ifndef __KERNEL_TYPES_H_
@@ -95,6 +95,7 @@ typedef int32_t MkRet_t;
 #define MK_ERR_REGISTERED    ( 0x0000000B ) /**< 登録済み               */
 #define MK_ERR_NO_RESOURCE   ( 0x0000000C ) /**< リソース不足           */
 #define MK_ERR_TIMEOUT       ( 0x0000000D ) /**< タイムアウト           */
+#define MK_ERR_QUEUE_FULL    ( 0x0000000E ) /**< キュー満杯             */
 
 /** エラー型 */
 typedef uint32_t MkErr_t;
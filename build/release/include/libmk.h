@@ -1,8 +1,8 @@
 /******************************************************************************/
 /*                                                                            */
 /* libmk.h                                                                    */
-/*                                                                 2025/04/02 */
-/* Copyright (C) 2018-2025 Mochi.                                             */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2018-2026 Mochi.                                             */
 /*                                                                            */
 /******************************************************************************/
 #ifndef __LIBMK_H__
@@ -15,10 +15,17 @@
 
 /* カーネルヘッダ */
 #include <kernel/config.h>
+#include <kernel/endpoint.h>
+#include <kernel/event.h>
 #include <kernel/interrupt.h>
 #include <kernel/iomem.h>
 #include <kernel/ioport.h>
 #include <kernel/message.h>
+#include <kernel/notify.h>
+#include <kernel/pubsub.h>
+#include <kernel/ring.h>
+#include <kernel/sharedpage.h>
+#include <kernel/sysstat.h>
 #include <kernel/task.h>
 #include <kernel/taskname.h>
 #include <kernel/timer.h>
@@ -58,9 +65,51 @@
 /******************************************************************************/
 /* ライブラリ関数プロトタイプ宣言                                             */
 /******************************************************************************/
+/*----------------*/
+/* エンドポイント */
+/*----------------*/
+/* エンドポイント生成 */
+extern MkRet_t LibMkEpCreate( MkEpId_t *pEpId,
+                              MkErr_t  *pErr   );
+/* エンドポイント削除 */
+extern MkRet_t LibMkEpDelete( MkEpId_t epId,
+                              MkErr_t  *pErr );
+/* エンドポイントキュー統計取得 */
+extern MkRet_t LibMkEpGetStat( MkEpId_t         epId,
+                               MkMsgQueueStat_t *pStat,
+                               MkErr_t          *pErr   );
+/* エンドポイントメッセージ受信 */
+extern MkRet_t LibMkEpReceive( MkEpId_t   epId,
+                               void       *pBuffer,
+                               size_t     bufferSize,
+                               MkTaskId_t *pSrcTaskId,
+                               size_t     *pRecvSize,
+                               uint32_t   timeout,
+                               MkErr_t    *pErr        );
+/* エンドポイントメッセージ送信 */
+extern MkRet_t LibMkEpSend( MkEpId_t epId,
+                            void     *pMsg,
+                            size_t   size,
+                            MkErr_t  *pErr );
+
+/*--------------------*/
+/* イベント待ち合わせ */
+/*--------------------*/
+/* イベント待ち合わせ */
+extern MkRet_t LibMkEventWait( uint32_t   events,
+                               MkTaskId_t *pSrc,
+                               uint32_t   srcNum,
+                               uint32_t   timeout,
+                               uint32_t   *pOccurred,
+                               uint32_t   *pIntList,
+                               MkErr_t    *pErr       );
+
 /*--------------------*/
 /* ハードウェア割込み */
 /*--------------------*/
+/* ハードウェア割込みクレーム */
+extern MkRet_t LibMkIntClaim( uint8_t irqNo,
+                              MkErr_t *pErr  );
 /* ハードウェア割込み処理完了 */
 extern MkRet_t LibMkIntComplete( uint8_t irqNo,
                                  MkErr_t *pErr  );
@@ -70,6 +119,14 @@ extern MkRet_t LibMkIntDisable( uint8_t irqNo,
 /* ハードウェア割込み有効化 */
 extern MkRet_t LibMkIntEnable( uint8_t irqNo,
                                MkErr_t *pErr  );
+/* ハードウェア割込み確認 */
+extern MkRet_t LibMkIntPoll( uint32_t *pIntList,
+                             MkErr_t  *pErr      );
+/* ハードウェア割込み合体設定 */
+extern MkRet_t LibMkIntSetCoalesce( uint8_t  irqNo,
+                                    uint32_t count,
+                                    uint32_t usec,
+                                    MkErr_t  *pErr  );
 /* ハードウェア割込み監視開始 */
 extern MkRet_t LibMkIntStartMonitoring( uint8_t irqNo,
                                         MkErr_t *pErr  );
@@ -79,6 +136,10 @@ extern MkRet_t LibMkIntStopMonitoring( uint8_t irqNo,
 /* ハードウェア割込み待ち合わせ */
 extern MkRet_t LibMkIntWait( uint32_t *pIntList,
                              MkErr_t  *pErr      );
+/* ハードウェア割込み待ち合わせ(発生情報取得) */
+extern MkRet_t LibMkIntWaitInfo( uint32_t    *pIntList,
+                                 MkIntInfo_t *pInfo,
+                                 MkErr_t     *pErr      );
 
 /*-----------*/
 /* I/Oメモリ */
@@ -129,6 +190,16 @@ extern MkRet_t LibMkIoPortOutWord( uint16_t portNo,
 /*----------------------*/
 /* メッセージパッシング */
 /*----------------------*/
+/* トラフィック統計ログ出力 */
+extern MkRet_t LibMkMsgDumpTraffic( MkErr_t *pErr );
+/* メッセージキュー統計取得 */
+extern MkRet_t LibMkMsgGetQueueStat( MkMsgQueueStat_t *pStat,
+                                     MkErr_t          *pErr   );
+/* トラフィック統計取得 */
+extern MkRet_t LibMkMsgGetTraffic( MkMsgTraffic_t *pBuffer,
+                                   uint32_t       *pNum,
+                                   uint32_t       *pLost,
+                                   MkErr_t        *pErr     );
 /* メッセージ受信 */
 extern MkRet_t LibMkMsgReceive( MkTaskId_t recvTaskId,
                                 void       *pBuffer,
@@ -142,11 +213,52 @@ extern MkRet_t LibMkMsgSend( MkTaskId_t dst,
                              void       *pMsg,
                              size_t     msgSize,
                              MkErr_t    *pErr    );
+/* メッセージ送信(フラグ指定) */
+extern MkRet_t LibMkMsgSendEx( MkTaskId_t dst,
+                               void       *pMsg,
+                               size_t     msgSize,
+                               uint32_t   flags,
+                               MkErr_t    *pErr    );
 /* メッセージ送信(ノンブロッキング) */
 extern MkRet_t LibMkMsgSendNB( MkTaskId_t dst,
                                void       *pMsg,
                                size_t     msgSize,
                                MkErr_t    *pErr    );
+/* メッセージキュー上限設定 */
+extern MkRet_t LibMkMsgSetQueueLimit( uint32_t num,
+                                      size_t   size,
+                                      MkErr_t  *pErr );
+/* メッセージ受信モード設定 */
+extern MkRet_t LibMkMsgSetRecvMode( uint32_t mode,
+                                    MkErr_t  *pErr );
+
+/*------*/
+/* 通知 */
+/*------*/
+/* 通知送信 */
+extern MkRet_t LibMkNtfSend( MkTaskId_t dst,
+                             uint32_t   bits,
+                             MkErr_t    *pErr );
+/* 通知待ち合わせ */
+extern MkRet_t LibMkNtfWait( uint32_t timeout,
+                             uint32_t *pBits,
+                             MkErr_t  *pErr   );
+
+/*----------*/
+/* 出版購読 */
+/*----------*/
+/* 出版 */
+extern MkRet_t LibMkPubPublish( uint32_t grpId,
+                                void     *pMsg,
+                                size_t   size,
+                                uint32_t *pNum,
+                                MkErr_t  *pErr  );
+/* 購読開始 */
+extern MkRet_t LibMkPubSubscribe( uint32_t grpId,
+                                  MkErr_t  *pErr  );
+/* 購読終了 */
+extern MkRet_t LibMkPubUnsubscribe( uint32_t grpId,
+                                    MkErr_t  *pErr  );
 
 /*--------------*/
 /* プロセス管理 */
@@ -154,11 +266,55 @@ extern MkRet_t LibMkMsgSendNB( MkTaskId_t dst,
 /* プロセス複製 */
 extern MkRet_t LibMkProcFork( MkPid_t *pPid,
                               MkErr_t *pErr  );
+/* プロセスID取得 */
+extern MkRet_t LibMkProcGetPid( MkPid_t *pPid,
+                                MkErr_t *pErr  );
 /* ブレイクポイント設定 */
 extern MkRet_t LibMkProcSetBreakPoint( int32_t quantity,
                                        void    *ppBreakPoint,
                                        MkErr_t *pErr          );
 
+/*----------------------*/
+/* システムコールリング */
+/*----------------------*/
+/* リング投入 */
+extern MkRet_t LibMkRingEnter( MkRing_t *pRing,
+                               uint32_t *pNum,
+                               MkErr_t  *pErr   );
+/* リング初期化 */
+extern MkRet_t LibMkRingInit( MkRing_t *pRing,
+                              MkErr_t  *pErr   );
+/* 完了キュー取出し */
+extern MkRet_t LibMkRingPop( MkRing_t    *pRing,
+                             MkRingCqe_t *pCqe,
+                             MkErr_t     *pErr   );
+/* 投入キュー追加 */
+extern MkRet_t LibMkRingPush( MkRing_t *pRing,
+                              uint32_t no,
+                              uint32_t arg1,
+                              uint32_t arg2,
+                              uint32_t arg3,
+                              uint32_t userData,
+                              MkErr_t  *pErr     );
+
+/*--------------------*/
+/* システムコール統計 */
+/*--------------------*/
+/* システムコール統計ログ出力 */
+extern MkRet_t LibMkSysStatDump( MkErr_t *pErr );
+/* システムコール統計取得 */
+extern MkRet_t LibMkSysStatGet( uint32_t    no,
+                                uint32_t    funcId,
+                                MkSysStat_t *pStat,
+                                MkErr_t     *pErr   );
+/* 割込み遅延統計取得 */
+extern MkRet_t LibMkSysStatGetInt( uint8_t     irqNo,
+                                   MkIntStat_t *pStat,
+                                   MkErr_t     *pErr   );
+/* タイマ合体統計取得 */
+extern MkRet_t LibMkSysStatGetTimer( MkTimerStat_t *pStat,
+                                     MkErr_t       *pErr   );
+
 /*------------*/
 /* タスク管理 */
 /*------------*/
@@ -182,9 +338,34 @@ extern MkRet_t MkTaskNameUnregister( MkErr_t *pErr );
 /*--------*/
 /* タイマ */
 /*--------*/
+/* 単調増加時刻取得 */
+extern MkRet_t LibMkTimerGetNsec( uint64_t *pNsec,
+                                  MkErr_t  *pErr   );
+/* 実時刻取得 */
+extern MkRet_t LibMkTimerGetRealNsec( uint64_t *pNsec,
+                                      MkErr_t  *pErr   );
+/* tickカウンタ取得 */
+extern MkRet_t LibMkTimerGetTick( uint64_t *pTick,
+                                  MkErr_t  *pErr   );
+/* スラック設定 */
+extern MkRet_t LibMkTimerSetSlack( uint32_t usec,
+                                   MkErr_t  *pErr );
 /* スリープ */
 extern MkRet_t LibMkTimerSleep( uint32_t usec,
                                 MkErr_t  *pErr );
+/* 時刻指定スリープ */
+extern MkRet_t LibMkTimerSleepUntil( uint64_t nsec,
+                                     MkErr_t  *pErr );
+/* タイマ開始 */
+extern MkRet_t LibMkTimerStart( uint32_t usec,
+                                uint32_t type,
+                                uint32_t notify,
+                                uint32_t bits,
+                                uint32_t *pTimerId,
+                                MkErr_t  *pErr      );
+/* タイマ停止 */
+extern MkRet_t LibMkTimerStop( uint32_t timerId,
+                               MkErr_t  *pErr    );
 
 /*----------*/
 /* スレッド */
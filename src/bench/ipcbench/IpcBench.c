@@ -0,0 +1,466 @@
+/******************************************************************************/
+/*                                                                            */
+/* src/bench/ipcbench/IpcBench.c                                              */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2026 Mochi.                                                  */
+/*                                                                            */
+/******************************************************************************/
+/******************************************************************************/
+/* インクルード                                                               */
+/******************************************************************************/
+/* 標準ヘッダ */
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+/* カーネルヘッダ */
+#include <libmk.h>
+
+/* 共通ヘッダ */
+#include <hardware/IA32/IA32Instruction.h>
+
+/* モジュールヘッダ */
+#include "IpcBench.h"
+
+
+/******************************************************************************/
+/* 定義                                                                       */
+/******************************************************************************/
+/** 受信タイムアウト時間[us] */
+#define RECV_TIMEOUT        ( 1000000 )
+
+/** 滞留待ちポーリング間隔[us] */
+#define POLL_INTERVAL       ( 10000 )
+
+/** スループット計測メッセージサイズ数 */
+#define SIZE_NUM            ( 7 )
+
+
+/******************************************************************************/
+/* ローカル関数宣言                                                           */
+/******************************************************************************/
+/* ファンイン計測 */
+static void BenchFanIn( void );
+/* 条件付き受信計測 */
+static void BenchFiltered( void );
+/* ピンポン計測 */
+static void BenchPingPong( const char *pName,
+                           uint32_t   cmd,
+                           bool       nb,
+                           uint32_t   timeout );
+/* スループット計測 */
+static void BenchThroughput( size_t size );
+/* ワーカコマンド送信 */
+static void SendCmd( uint32_t idx,
+                     uint32_t cmd,
+                     uint32_t num,
+                     size_t   size );
+
+
+/******************************************************************************/
+/* グローバル変数定義                                                         */
+/******************************************************************************/
+/** メインスレッドタスクID */
+MkTaskId_t gIpcBenchMainTaskId;
+
+
+/******************************************************************************/
+/* 静的グローバル変数定義                                                     */
+/******************************************************************************/
+/** ワーカスレッドタスクID */
+static MkTaskId_t gWorkerTaskId[ IPCBENCH_WORKER_NUM ];
+
+/** ワーカスレッドスタック */
+static uint8_t gStack[ IPCBENCH_WORKER_NUM ][ IPCBENCH_STACK_SIZE ]
+    __attribute__ ( ( aligned ( 16 ) ) );
+
+/** メッセージバッファ */
+static uint8_t gBuffer[ MK_MSG_SIZE_MAX ];
+
+/** スループット計測メッセージサイズ */
+static const size_t gSizeTbl[ SIZE_NUM ] =
+    { 16, 64, 256, 1024, 4096, 16384, MK_MSG_SIZE_MAX };
+
+
+/******************************************************************************/
+/* グローバル関数定義                                                         */
+/******************************************************************************/
+/******************************************************************************/
+/**
+ * @brief       IPCベンチマークメイン
+ * @details     ワーカスレッドを生成し、各IPC計測とタイマ計測を実行して結果を
+ *              シリアルポートに出力した後、QEMUを終了する。
+ */
+/******************************************************************************/
+void IpcBenchMain( void )
+{
+    MkRet_t  ret;   /* 戻り値       */
+    uint32_t idx;   /* インデックス */
+
+    /* 初期化 */
+    ret = MK_RET_FAILURE;
+    idx = 0;
+
+    IpcBenchOutStr( "ipcbench,start\n" );
+
+    /* タスクID取得 */
+    ret = LibMkTaskGetId( &gIpcBenchMainTaskId, NULL );
+
+    /* 取得結果判定 */
+    if ( ret != MK_RET_SUCCESS ) {
+        /* 失敗 */
+
+        IpcBenchOutStr( "ipcbench,error,taskid\n" );
+        IpcBenchOutExit( 1 );
+
+        while ( true ) {
+            LibMkTimerSleep( RECV_TIMEOUT, NULL );
+        }
+    }
+
+    /* ワーカスレッド毎に繰り返す */
+    for ( idx = 0; idx < IPCBENCH_WORKER_NUM; idx++ ) {
+        /* スレッド生成 */
+        ret = LibMkThreadCreate( IpcBenchWorkerMain,        /* エントリ関数 */
+                                 ( void * ) idx,            /* 引数         */
+                                 gStack[ idx ],             /* スタック     */
+                                 IPCBENCH_STACK_SIZE,       /* スタック長   */
+                                 &gWorkerTaskId[ idx ],     /* タスクID     */
+                                 NULL                   );  /* エラー内容   */
+
+        /* 生成結果判定 */
+        if ( ret != MK_RET_SUCCESS ) {
+            /* 失敗 */
+
+            IpcBenchOutStr( "ipcbench,error,thread\n" );
+            IpcBenchOutExit( 1 );
+
+            while ( true ) {
+                LibMkTimerSleep( RECV_TIMEOUT, NULL );
+            }
+        }
+    }
+
+    /* ピンポン計測 */
+    BenchPingPong( "pingpong-blk", IPCBENCH_CMD_ECHO,    false, 0            );
+    BenchPingPong( "pingpong-nb",  IPCBENCH_CMD_ECHO_NB, true,  0            );
+    BenchPingPong( "recv-timeout", IPCBENCH_CMD_ECHO_NB, true,  RECV_TIMEOUT );
+
+    /* メッセージサイズ毎に繰り返す */
+    for ( idx = 0; idx < SIZE_NUM; idx++ ) {
+        /* スループット計測 */
+        BenchThroughput( gSizeTbl[ idx ] );
+    }
+
+    /* ファンイン計測 */
+    BenchFanIn();
+
+    /* 条件付き受信計測 */
+    BenchFiltered();
+
+    /* タイマベンチマーク */
+    IpcBenchTimerRun();
+
+    IpcBenchOutStr( "ipcbench,done\n" );
+
+    /* QEMU終了 */
+    IpcBenchOutExit( 0 );
+
+    /* QEMU外で実行された場合 */
+    while ( true ) {
+        LibMkTimerSleep( RECV_TIMEOUT, NULL );
+    }
+}
+
+
+/******************************************************************************/
+/* ローカル関数定義                                                           */
+/******************************************************************************/
+/******************************************************************************/
+/**
+ * @brief       ファンイン計測
+ * @details     全ワーカスレッドからの同時ブロッキング送信をメインスレッドで受
+ *              信し、1メッセージ当たりのサイクル数を計測する。
+ */
+/******************************************************************************/
+static void BenchFanIn( void )
+{
+    uint32_t idx;       /* インデックス */
+    uint64_t start;     /* 計測開始TSC  */
+    uint64_t end;       /* 計測終了TSC  */
+
+    /* 初期化 */
+    idx   = 0;
+    start = IA32InstructionRdtsc();
+    end   = 0;
+
+    /* ワーカスレッド毎に繰り返す */
+    for ( idx = 0; idx < IPCBENCH_WORKER_NUM; idx++ ) {
+        /* 送信コマンド送信 */
+        SendCmd( idx,
+                 IPCBENCH_CMD_SOURCE,
+                 IPCBENCH_ITER_NUM,
+                 IPCBENCH_SMALL_SIZE  );
+    }
+
+    /* 受信メッセージ毎に繰り返す */
+    for ( idx = 0; idx < IPCBENCH_ITER_NUM * IPCBENCH_WORKER_NUM; idx++ ) {
+        /* メッセージ受信 */
+        LibMkMsgReceive( MK_TASKID_NULL,        /* 受信待ちタスクID */
+                         gBuffer,               /* バッファ         */
+                         sizeof ( gBuffer ),    /* バッファサイズ   */
+                         NULL,                  /* 送信元タスクID   */
+                         NULL,                  /* 受信サイズ       */
+                         0,                     /* タイムアウト     */
+                         NULL               );  /* エラー内容       */
+    }
+
+    end = IA32InstructionRdtsc();
+
+    /* 結果出力 */
+    IpcBenchOutResult( "fanin",
+                       IPCBENCH_WORKER_NUM,
+                       IPCBENCH_ITER_NUM * IPCBENCH_WORKER_NUM,
+                       end - start                              );
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       条件付き受信計測
+ * @details     ワーカスレッド0からのメッセージを受信キューに滞留させた状態で、
+ *              ワーカスレッド1からのメッセージを送信元指定で受信し、1メッセー
+ *              ジ当たりのサイクル数を計測する。計測後に滞留メッセージを全て受
+ *              信する。
+ */
+/******************************************************************************/
+static void BenchFiltered( void )
+{
+    uint32_t         idx;       /* インデックス   */
+    uint64_t         start;     /* 計測開始TSC    */
+    uint64_t         end;       /* 計測終了TSC    */
+    MkMsgQueueStat_t stat;      /* キュー統計     */
+
+    /* 初期化 */
+    idx   = 0;
+    start = 0;
+    end   = 0;
+
+    /* 滞留メッセージ送信コマンド送信 */
+    SendCmd( 0,
+             IPCBENCH_CMD_SOURCE_NB,
+             IPCBENCH_BACKLOG_NUM,
+             IPCBENCH_SMALL_SIZE     );
+
+    /* 滞留待ち */
+    do {
+        LibMkTimerSleep( POLL_INTERVAL, NULL );
+        LibMkMsgGetQueueStat( &stat, NULL );
+    } while ( stat.num < IPCBENCH_BACKLOG_NUM );
+
+    start = IA32InstructionRdtsc();
+
+    /* 送信コマンド送信 */
+    SendCmd( 1,
+             IPCBENCH_CMD_SOURCE,
+             IPCBENCH_ITER_NUM,
+             IPCBENCH_SMALL_SIZE  );
+
+    /* 受信メッセージ毎に繰り返す */
+    for ( idx = 0; idx < IPCBENCH_ITER_NUM; idx++ ) {
+        /* メッセージ受信 */
+        LibMkMsgReceive( gWorkerTaskId[ 1 ],    /* 受信待ちタスクID */
+                         gBuffer,               /* バッファ         */
+                         sizeof ( gBuffer ),    /* バッファサイズ   */
+                         NULL,                  /* 送信元タスクID   */
+                         NULL,                  /* 受信サイズ       */
+                         0,                     /* タイムアウト     */
+                         NULL               );  /* エラー内容       */
+    }
+
+    end = IA32InstructionRdtsc();
+
+    /* 結果出力 */
+    IpcBenchOutResult( "filtered",
+                       IPCBENCH_BACKLOG_NUM,
+                       IPCBENCH_ITER_NUM,
+                       end - start           );
+
+    /* 滞留メッセージ毎に繰り返す */
+    for ( idx = 0; idx < IPCBENCH_BACKLOG_NUM; idx++ ) {
+        /* メッセージ受信 */
+        LibMkMsgReceive( gWorkerTaskId[ 0 ],    /* 受信待ちタスクID */
+                         gBuffer,               /* バッファ         */
+                         sizeof ( gBuffer ),    /* バッファサイズ   */
+                         NULL,                  /* 送信元タスクID   */
+                         NULL,                  /* 受信サイズ       */
+                         0,                     /* タイムアウト     */
+                         NULL               );  /* エラー内容       */
+    }
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       ピンポン計測
+ * @details     ワーカスレッド0との間で小メッセージを往復させ、1往復当たりのサ
+ *              イクル数を計測する。
+ *
+ * @param[in]   *pName  計測名
+ * @param[in]   cmd     ワーカコマンド
+ *                  - IPCBENCH_CMD_ECHO    ブロッキング返送
+ *                  - IPCBENCH_CMD_ECHO_NB ノンブロッキング返送
+ * @param[in]   nb      メインスレッドの送信方式
+ *                  - false ブロッキング送信
+ *                  - true  ノンブロッキング送信
+ * @param[in]   timeout 受信タイムアウト時間[us]
+ */
+/******************************************************************************/
+static void BenchPingPong( const char *pName,
+                           uint32_t   cmd,
+                           bool       nb,
+                           uint32_t   timeout )
+{
+    uint32_t idx;       /* インデックス */
+    uint64_t start;     /* 計測開始TSC  */
+    uint64_t end;       /* 計測終了TSC  */
+
+    /* 初期化 */
+    idx   = 0;
+    start = 0;
+    end   = 0;
+
+    /* 返送コマンド送信 */
+    SendCmd( 0, cmd, IPCBENCH_ITER_NUM, IPCBENCH_SMALL_SIZE );
+
+    start = IA32InstructionRdtsc();
+
+    /* 往復回数毎に繰り返す */
+    for ( idx = 0; idx < IPCBENCH_ITER_NUM; idx++ ) {
+        /* 送信方式判定 */
+        if ( nb != false ) {
+            /* ノンブロッキング */
+
+            /* メッセージ送信 */
+            LibMkMsgSendNB( gWorkerTaskId[ 0 ],
+                            gBuffer,
+                            IPCBENCH_SMALL_SIZE,
+                            NULL                 );
+
+        } else {
+            /* ブロッキング */
+
+            /* メッセージ送信 */
+            LibMkMsgSend( gWorkerTaskId[ 0 ],
+                          gBuffer,
+                          IPCBENCH_SMALL_SIZE,
+                          NULL                 );
+        }
+
+        /* メッセージ受信 */
+        LibMkMsgReceive( gWorkerTaskId[ 0 ],    /* 受信待ちタスクID */
+                         gBuffer,               /* バッファ         */
+                         sizeof ( gBuffer ),    /* バッファサイズ   */
+                         NULL,                  /* 送信元タスクID   */
+                         NULL,                  /* 受信サイズ       */
+                         timeout,               /* タイムアウト     */
+                         NULL               );  /* エラー内容       */
+    }
+
+    end = IA32InstructionRdtsc();
+
+    /* 結果出力 */
+    IpcBenchOutResult( pName,
+                       IPCBENCH_SMALL_SIZE,
+                       IPCBENCH_ITER_NUM,
+                       end - start          );
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       スループット計測
+ * @details     ワーカスレッド0に指定サイズのメッセージをブロッキング送信し、
+ *              全メッセージの受信完了通知までの1メッセージ当たりのサイクル数
+ *              を計測する。
+ *
+ * @param[in]   size メッセージサイズ
+ */
+/******************************************************************************/
+static void BenchThroughput( size_t size )
+{
+    uint32_t idx;       /* インデックス */
+    uint64_t start;     /* 計測開始TSC  */
+    uint64_t end;       /* 計測終了TSC  */
+
+    /* 初期化 */
+    idx   = 0;
+    start = 0;
+    end   = 0;
+
+    /* 受信コマンド送信 */
+    SendCmd( 0, IPCBENCH_CMD_SINK, IPCBENCH_ITER_NUM, size );
+
+    start = IA32InstructionRdtsc();
+
+    /* 送信回数毎に繰り返す */
+    for ( idx = 0; idx < IPCBENCH_ITER_NUM; idx++ ) {
+        /* メッセージ送信 */
+        LibMkMsgSend( gWorkerTaskId[ 0 ], gBuffer, size, NULL );
+    }
+
+    /* 完了通知受信 */
+    LibMkMsgReceive( gWorkerTaskId[ 0 ],    /* 受信待ちタスクID */
+                     gBuffer,               /* バッファ         */
+                     sizeof ( gBuffer ),    /* バッファサイズ   */
+                     NULL,                  /* 送信元タスクID   */
+                     NULL,                  /* 受信サイズ       */
+                     0,                     /* タイムアウト     */
+                     NULL               );  /* エラー内容       */
+
+    end = IA32InstructionRdtsc();
+
+    /* 結果出力 */
+    IpcBenchOutResult( "throughput", size, IPCBENCH_ITER_NUM, end - start );
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       ワーカコマンド送信
+ * @details     指定したワーカスレッドにコマンドを送信する。
+ *
+ * @param[in]   idx  ワーカ番号
+ * @param[in]   cmd  コマンド
+ * @param[in]   num  メッセージ数
+ * @param[in]   size メッセージサイズ
+ */
+/******************************************************************************/
+static void SendCmd( uint32_t idx,
+                     uint32_t cmd,
+                     uint32_t num,
+                     size_t   size )
+{
+    IpcBenchCmd_t msg;  /* コマンドメッセージ */
+
+    /* コマンド設定 */
+    msg.cmd  = cmd;
+    msg.num  = num;
+    msg.size = size;
+
+    /* コマンド送信 */
+    LibMkMsgSend( gWorkerTaskId[ idx ], &msg, sizeof ( msg ), NULL );
+
+    return;
+}
+
+
+/******************************************************************************/
@@ -0,0 +1,87 @@
+/******************************************************************************/
+/*                                                                            */
+/* src/bench/ipcbench/IpcBench.h                                              */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2026 Mochi.                                                  */
+/*                                                                            */
+/******************************************************************************/
+#ifndef IPCBENCH_H
+#define IPCBENCH_H
+/******************************************************************************/
+/* インクルード                                                               */
+/******************************************************************************/
+/* 標準ヘッダ */
+#include <stddef.h>
+#include <stdint.h>
+
+/* カーネルヘッダ */
+#include <kernel/types.h>
+
+
+/******************************************************************************/
+/* 定義                                                                       */
+/******************************************************************************/
+/** 計測繰り返し回数 */
+#define IPCBENCH_ITER_NUM       ( 1000 )
+/** ワーカスレッド数 */
+#define IPCBENCH_WORKER_NUM     ( 3 )
+/** ワーカスレッドスタックサイズ */
+#define IPCBENCH_STACK_SIZE     ( 8192 )
+/** 条件付き受信時の滞留メッセージ数 */
+#define IPCBENCH_BACKLOG_NUM    ( 128 )
+/** 小メッセージサイズ */
+#define IPCBENCH_SMALL_SIZE     ( 8 )
+
+/* ワーカコマンド */
+#define IPCBENCH_CMD_ECHO       ( 1 )   /**< 返送(ブロッキング)     */
+#define IPCBENCH_CMD_ECHO_NB    ( 2 )   /**< 返送(ノンブロッキング) */
+#define IPCBENCH_CMD_SINK       ( 3 )   /**< 受信後完了通知         */
+#define IPCBENCH_CMD_SOURCE     ( 4 )   /**< 送信(ブロッキング)     */
+#define IPCBENCH_CMD_SOURCE_NB  ( 5 )   /**< 送信(ノンブロッキング) */
+
+/** ワーカコマンドメッセージ */
+typedef struct {
+    uint32_t cmd;       /**< コマンド         */
+    uint32_t num;       /**< メッセージ数     */
+    size_t   size;      /**< メッセージサイズ */
+} IpcBenchCmd_t;
+
+
+/******************************************************************************/
+/* グローバル変数宣言                                                         */
+/******************************************************************************/
+/** メインスレッドタスクID */
+extern MkTaskId_t gIpcBenchMainTaskId;
+
+
+/******************************************************************************/
+/* グローバル関数プロトタイプ宣言                                             */
+/******************************************************************************/
+/*---------------*/
+/* IpcBenchOut.c */
+/*---------------*/
+/* QEMU終了 */
+extern void IpcBenchOutExit( uint8_t code );
+/* 計測結果出力 */
+extern void IpcBenchOutResult( const char *pName,
+                               uint32_t   param,
+                               uint32_t   num,
+                               uint64_t   cycles );
+/* 文字列出力 */
+extern void IpcBenchOutStr( const char *pStr );
+
+/*-----------------*/
+/* IpcBenchTimer.c */
+/*-----------------*/
+/* タイマベンチマーク */
+extern void IpcBenchTimerRun( void );
+
+/*------------------*/
+/* IpcBenchWorker.c */
+/*------------------*/
+/* ワーカスレッドメイン */
+extern void IpcBenchWorkerMain( void *pArg );
+
+
+/******************************************************************************/
+#endif
@@ -0,0 +1,182 @@
+/******************************************************************************/
+/*                                                                            */
+/* src/bench/ipcbench/IpcBenchOut.c                                           */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2026 Mochi.                                                  */
+/*                                                                            */
+/******************************************************************************/
+/******************************************************************************/
+/* インクルード                                                               */
+/******************************************************************************/
+/* 標準ヘッダ */
+#include <stdint.h>
+
+/* カーネルヘッダ */
+#include <libmk.h>
+
+/* モジュールヘッダ */
+#include "IpcBench.h"
+
+
+/******************************************************************************/
+/* 定義                                                                       */
+/******************************************************************************/
+/* シリアルポート(COM1) */
+#define COM1_THR            ( 0x03F8 )  /**< 送信保持レジスタ   */
+#define COM1_LSR            ( 0x03FD )  /**< ラインステータス   */
+#define COM1_LSR_THRE       ( 0x20 )    /**< 送信保持レジスタ空 */
+
+/** QEMU isa-debug-exitポート */
+#define QEMU_DEBUG_EXIT     ( 0x00F4 )
+
+/** 数値文字列最大長 */
+#define NUM_STR_LEN         ( 21 )
+
+
+/******************************************************************************/
+/* ローカル関数宣言                                                           */
+/******************************************************************************/
+/* 1文字出力 */
+static void OutChar( char c );
+/* 数値出力 */
+static void OutNum( uint64_t value );
+
+
+/******************************************************************************/
+/* グローバル関数定義                                                         */
+/******************************************************************************/
+/******************************************************************************/
+/**
+ * @brief       QEMU終了
+ * @details     QEMUのisa-debug-exitデバイスに終了コードを書き込む。QEMUは
+ *              (code << 1) | 1を終了ステータスとして終了する。デバイスが無い
+ *              場合は何もしない。
+ *
+ * @param[in]   code 終了コード
+ */
+/******************************************************************************/
+void IpcBenchOutExit( uint8_t code )
+{
+    /* 終了コード出力 */
+    LibMkIoPortOutByte( QEMU_DEBUG_EXIT, &code, 1, NULL );
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       計測結果出力
+ * @details     計測結果を1行のCSV形式でシリアルポートに出力する。
+ *              "ipcbench,<名前>,<パラメータ>,<回数>,<総サイクル>,<サイクル/回>"
+ *
+ * @param[in]   *pName 計測名
+ * @param[in]   param  計測パラメータ
+ * @param[in]   num    計測回数
+ * @param[in]   cycles 総TSCサイクル
+ */
+/******************************************************************************/
+void IpcBenchOutResult( const char *pName,
+                        uint32_t   param,
+                        uint32_t   num,
+                        uint64_t   cycles )
+{
+    IpcBenchOutStr( "ipcbench," );
+    IpcBenchOutStr( pName );
+    OutChar( ',' );
+    OutNum( param );
+    OutChar( ',' );
+    OutNum( num );
+    OutChar( ',' );
+    OutNum( cycles );
+    OutChar( ',' );
+    OutNum( ( num != 0 ) ? ( cycles / num ) : 0 );
+    OutChar( '\n' );
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       文字列出力
+ * @details     文字列をシリアルポートに出力する。
+ *
+ * @param[in]   *pStr 文字列
+ */
+/******************************************************************************/
+void IpcBenchOutStr( const char *pStr )
+{
+    /* 終端まで繰り返す */
+    while ( *pStr != '\0' ) {
+        /* 1文字出力 */
+        OutChar( *pStr );
+        pStr++;
+    }
+
+    return;
+}
+
+
+/******************************************************************************/
+/* ローカル関数定義                                                           */
+/******************************************************************************/
+/******************************************************************************/
+/**
+ * @brief       1文字出力
+ * @details     送信保持レジスタが空くまで待ち合わせた後、1文字出力する。
+ *
+ * @param[in]   c 文字
+ */
+/******************************************************************************/
+static void OutChar( char c )
+{
+    uint8_t lsr;    /* ラインステータス */
+
+    /* 初期化 */
+    lsr = 0;
+
+    /* 送信保持レジスタ空き待ち */
+    do {
+        LibMkIoPortInByte( COM1_LSR, &lsr, 1, NULL );
+    } while ( ( lsr & COM1_LSR_THRE ) == 0 );
+
+    /* 1文字出力 */
+    LibMkIoPortOutByte( COM1_THR, &c, 1, NULL );
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       数値出力
+ * @details     符号無し整数を10進数文字列で出力する。
+ *
+ * @param[in]   value 数値
+ */
+/******************************************************************************/
+static void OutNum( uint64_t value )
+{
+    char     str[ NUM_STR_LEN ];    /* 数値文字列   */
+    uint32_t idx;                   /* インデックス */
+
+    /* 初期化 */
+    idx                    = NUM_STR_LEN - 1;
+    str[ NUM_STR_LEN - 1 ] = '\0';
+
+    /* 桁毎に繰り返す */
+    do {
+        idx--;
+        str[ idx ] = '0' + ( char ) ( value % 10 );
+        value     /= 10;
+    } while ( value != 0 );
+
+    /* 文字列出力 */
+    IpcBenchOutStr( &str[ idx ] );
+
+    return;
+}
+
+
+/******************************************************************************/
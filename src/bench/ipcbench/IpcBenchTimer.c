@@ -0,0 +1,330 @@
+/******************************************************************************/
+/*                                                                            */
+/* src/bench/ipcbench/IpcBenchTimer.c                                         */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2026 Mochi.                                                  */
+/*                                                                            */
+/******************************************************************************/
+/******************************************************************************/
+/* インクルード                                                               */
+/******************************************************************************/
+/* 標準ヘッダ */
+#include <stdbool.h>
+#include <stdint.h>
+
+/* カーネルヘッダ */
+#include <libmk.h>
+
+/* 共通ヘッダ */
+#include <hardware/IA32/IA32Instruction.h>
+
+/* モジュールヘッダ */
+#include "IpcBench.h"
+
+
+/******************************************************************************/
+/* 定義                                                                       */
+/******************************************************************************/
+/** タイマ数 */
+#define TIMER_NUM           ( 10000 )
+
+/** 挿入計測タイマ値刻み[us] */
+#define INSERT_STEP         ( 10000 )
+/** 挿入計測タイマ値種類数(タイマホイール2階層分のtick数) */
+#define INSERT_SPREAD       ( 4096 )
+
+/** 満了計測タイマ値[us] */
+#define EXPIRE_USEC         ( 100000 )
+/** 満了計測後の待ち合わせ余裕[ns] */
+#define EXPIRE_MARGIN       ( 50000000 )
+
+/** 時刻確認間隔(スピン回数) */
+#define POLL_SPIN_NUM       ( 4096 )
+/** 割込み処理とみなすTSC差閾値 */
+#define GAP_THRESHOLD       ( 2000 )
+
+/** 満了通知ビット */
+#define NOTIFY_BIT          ( 0x00000001 )
+
+
+/******************************************************************************/
+/* ローカル関数宣言                                                           */
+/******************************************************************************/
+/* タイマ満了計測 */
+static void BenchExpire( void );
+/* タイマ挿入/停止計測 */
+static void BenchInsert( void );
+/* タイマ一括開始 */
+static bool StartAll( bool spread );
+/* タイマ一括停止 */
+static void StopAll( uint32_t num );
+
+
+/******************************************************************************/
+/* 静的グローバル変数定義                                                     */
+/******************************************************************************/
+/** タイマID */
+static uint32_t gTimerId[ TIMER_NUM ];
+
+
+/******************************************************************************/
+/* グローバル関数定義                                                         */
+/******************************************************************************/
+/******************************************************************************/
+/**
+ * @brief       タイマベンチマーク
+ * @details     TIMER_NUM個のユーザタイマを用いて、タイマホイールへの挿入と停
+ *              止、および同一tickでの一括満了を計測する。
+ */
+/******************************************************************************/
+void IpcBenchTimerRun( void )
+{
+    /* タイマ挿入/停止計測 */
+    BenchInsert();
+
+    /* タイマ満了計測 */
+    BenchExpire();
+
+    return;
+}
+
+
+/******************************************************************************/
+/* ローカル関数定義                                                           */
+/******************************************************************************/
+/******************************************************************************/
+/**
+ * @brief       タイマ満了計測
+ * @details     同一のタイマ値でTIMER_NUM個のタイマを開始し、全タイマの満了ま
+ *              でTSCを連続して読み出す。連続した読出し間のTSC差が閾値を超えた
+ *              区間を満了処理を含む割込み処理時間とみなして合計する。パラメー
+ *              タには満了処理を行った割込みの回数を出力する(統計無効時は0)。
+ */
+/******************************************************************************/
+static void BenchExpire( void )
+{
+    bool          valid;    /* 統計有効     */
+    MkRet_t       ret;      /* 戻り値       */
+    uint32_t      spin;     /* スピン回数   */
+    uint32_t      wakeup;   /* 満了処理回数 */
+    uint64_t      prev;     /* 前回TSC      */
+    uint64_t      now;      /* 今回TSC      */
+    uint64_t      cycles;   /* 割込みTSC    */
+    uint64_t      nsec;     /* 単調増加時刻 */
+    uint64_t      end;      /* 計測終了時刻 */
+    MkTimerStat_t before;   /* 計測前統計   */
+    MkTimerStat_t after;    /* 計測後統計   */
+
+    /* 初期化 */
+    valid  = false;
+    ret    = MK_RET_FAILURE;
+    spin   = 0;
+    wakeup = 0;
+    prev   = 0;
+    now    = 0;
+    cycles = 0;
+    nsec   = 0;
+    end    = 0;
+
+    /* 計測前統計取得 */
+    ret = LibMkSysStatGetTimer( &before, NULL );
+
+    /* 取得結果判定 */
+    if ( ret == MK_RET_SUCCESS ) {
+        /* 成功 */
+
+        valid = true;
+    }
+
+    /* タイマ一括開始 */
+    if ( StartAll( false ) == false ) {
+        /* 失敗 */
+
+        return;
+    }
+
+    /* 計測終了時刻設定 */
+    LibMkTimerGetNsec( &nsec, NULL );
+    end  = nsec + ( uint64_t ) EXPIRE_USEC * 1000 + EXPIRE_MARGIN;
+    prev = IA32InstructionRdtsc();
+
+    /* 計測終了時刻まで繰り返す */
+    while ( nsec < end ) {
+        now = IA32InstructionRdtsc();
+
+        /* TSC差判定 */
+        if ( ( now - prev ) > GAP_THRESHOLD ) {
+            /* 割込み処理 */
+
+            cycles += now - prev;
+        }
+
+        prev = now;
+        spin++;
+
+        /* 時刻確認判定 */
+        if ( ( spin % POLL_SPIN_NUM ) == 0 ) {
+            /* 確認 */
+
+            LibMkTimerGetNsec( &nsec, NULL );
+
+            /* システムコール時間を除外 */
+            prev = IA32InstructionRdtsc();
+        }
+    }
+
+    /* 計測後統計取得 */
+    ret = LibMkSysStatGetTimer( &after, NULL );
+
+    /* 統計有効判定 */
+    if ( ( valid != false          ) &&
+         ( ret   == MK_RET_SUCCESS )    ) {
+        /* 有効 */
+
+        wakeup = ( after.tickWakeup - before.tickWakeup ) +
+                 ( after.hresWakeup - before.hresWakeup );
+    }
+
+    /* 結果出力 */
+    IpcBenchOutResult( "timer-expire", wakeup, TIMER_NUM, cycles );
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       タイマ挿入/停止計測
+ * @details     タイマ値をINSERT_SPREAD種類に分散させてTIMER_NUM個のタイマを開
+ *              始し、1タイマ当たりの開始サイクル数を計測する。続けて全タイマ
+ *              を停止し、1タイマ当たりの停止サイクル数を計測する。何れもシス
+ *              テムコールのオーバヘッドを含む。
+ */
+/******************************************************************************/
+static void BenchInsert( void )
+{
+    uint64_t start;     /* 計測開始TSC */
+    uint64_t end;       /* 計測終了TSC */
+
+    /* 初期化 */
+    start = IA32InstructionRdtsc();
+    end   = 0;
+
+    /* タイマ一括開始 */
+    if ( StartAll( true ) == false ) {
+        /* 失敗 */
+
+        return;
+    }
+
+    end = IA32InstructionRdtsc();
+
+    /* 結果出力 */
+    IpcBenchOutResult( "timer-insert",
+                       INSERT_SPREAD,
+                       TIMER_NUM,
+                       end - start    );
+
+    start = IA32InstructionRdtsc();
+
+    /* タイマ一括停止 */
+    StopAll( TIMER_NUM );
+
+    end = IA32InstructionRdtsc();
+
+    /* 結果出力 */
+    IpcBenchOutResult( "timer-cancel",
+                       INSERT_SPREAD,
+                       TIMER_NUM,
+                       end - start    );
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       タイマ一括開始
+ * @details     TIMER_NUM個のワンショットタイマを開始する。開始に失敗した場合
+ *              は開始済みのタイマを停止してエラーを出力する。
+ *
+ * @param[in]   spread タイマ値分散有無
+ *                  - true  INSERT_STEP刻みでINSERT_SPREAD種類に分散
+ *                  - false 全てEXPIRE_USEC
+ *
+ * @return      開始結果を返す。
+ * @retval      true  成功
+ * @retval      false 失敗
+ */
+/******************************************************************************/
+static bool StartAll( bool spread )
+{
+    MkRet_t  ret;   /* 戻り値       */
+    uint32_t idx;   /* インデックス */
+    uint32_t usec;  /* タイマ値     */
+
+    /* 初期化 */
+    ret  = MK_RET_FAILURE;
+    idx  = 0;
+    usec = EXPIRE_USEC;
+
+    /* タイマ毎に繰り返す */
+    for ( idx = 0; idx < TIMER_NUM; idx++ ) {
+        /* タイマ値分散判定 */
+        if ( spread != false ) {
+            /* 分散 */
+
+            usec = ( ( idx % INSERT_SPREAD ) + 1 ) * INSERT_STEP;
+        }
+
+        /* タイマ開始 */
+        ret = LibMkTimerStart( usec,                    /* タイマ値     */
+                               MK_TIMER_TYPE_ONESHOT,   /* タイマ種別   */
+                               MK_TIMER_NOTIFY_NTF,     /* 満了通知方法 */
+                               NOTIFY_BIT,              /* 通知ビット   */
+                               &gTimerId[ idx ],        /* タイマID     */
+                               NULL                  ); /* エラー内容   */
+
+        /* 開始結果判定 */
+        if ( ret != MK_RET_SUCCESS ) {
+            /* 失敗 */
+
+            IpcBenchOutStr( "ipcbench,error,timer\n" );
+
+            /* 開始済みタイマ停止 */
+            StopAll( idx );
+
+            return false;
+        }
+    }
+
+    return true;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       タイマ一括停止
+ * @details     先頭から指定数のタイマを停止する。
+ *
+ * @param[in]   num タイマ数
+ */
+/******************************************************************************/
+static void StopAll( uint32_t num )
+{
+    uint32_t idx;   /* インデックス */
+
+    /* 初期化 */
+    idx = 0;
+
+    /* タイマ毎に繰り返す */
+    for ( idx = 0; idx < num; idx++ ) {
+        /* タイマ停止 */
+        LibMkTimerStop( gTimerId[ idx ], NULL );
+    }
+
+    return;
+}
+
+
+/******************************************************************************/
@@ -0,0 +1,245 @@
+/******************************************************************************/
+/*                                                                            */
+/* src/bench/ipcbench/IpcBenchWorker.c                                        */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2026 Mochi.                                                  */
+/*                                                                            */
+/******************************************************************************/
+/******************************************************************************/
+/* インクルード                                                               */
+/******************************************************************************/
+/* 標準ヘッダ */
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+/* カーネルヘッダ */
+#include <libmk.h>
+
+/* モジュールヘッダ */
+#include "IpcBench.h"
+
+
+/******************************************************************************/
+/* ローカル関数宣言                                                           */
+/******************************************************************************/
+/* 返送 */
+static void DoEcho( uint8_t  *pBuffer,
+                    uint32_t num,
+                    uint32_t cmd      );
+/* 受信 */
+static void DoSink( uint8_t  *pBuffer,
+                    uint32_t num      );
+/* 送信 */
+static void DoSource( uint8_t  *pBuffer,
+                      uint32_t num,
+                      size_t   size,
+                      uint32_t cmd      );
+
+
+/******************************************************************************/
+/* 静的グローバル変数定義                                                     */
+/******************************************************************************/
+/** ワーカスレッド毎メッセージバッファ */
+static uint8_t gBuffer[ IPCBENCH_WORKER_NUM ][ MK_MSG_SIZE_MAX ];
+
+
+/******************************************************************************/
+/* グローバル関数定義                                                         */
+/******************************************************************************/
+/******************************************************************************/
+/**
+ * @brief       ワーカスレッドメイン
+ * @details     メインスレッドからコマンドを受信し、コマンドに応じたメッセージ
+ *              送受信を繰り返す。
+ *
+ * @param[in]   *pArg ワーカ番号
+ */
+/******************************************************************************/
+void IpcBenchWorkerMain( void *pArg )
+{
+    uint8_t       *pBuffer; /* メッセージバッファ */
+    MkRet_t       ret;      /* 戻り値             */
+    IpcBenchCmd_t cmd;      /* コマンド           */
+
+    /* 初期化 */
+    pBuffer = gBuffer[ ( uint32_t ) pArg ];
+    ret     = MK_RET_FAILURE;
+
+    /* メインループ */
+    while ( true ) {
+        /* コマンド受信 */
+        ret = LibMkMsgReceive( gIpcBenchMainTaskId,     /* 受信待ちタスクID */
+                               &cmd,                    /* バッファ         */
+                               sizeof ( cmd ),          /* バッファサイズ   */
+                               NULL,                    /* 送信元タスクID   */
+                               NULL,                    /* 受信サイズ       */
+                               0,                       /* タイムアウト     */
+                               NULL                 );  /* エラー内容       */
+
+        /* 受信結果判定 */
+        if ( ret != MK_RET_SUCCESS ) {
+            /* 失敗 */
+            continue;
+        }
+
+        /* コマンド判定 */
+        if ( ( cmd.cmd == IPCBENCH_CMD_ECHO    ) ||
+             ( cmd.cmd == IPCBENCH_CMD_ECHO_NB )    ) {
+            /* 返送 */
+
+            DoEcho( pBuffer, cmd.num, cmd.cmd );
+
+        } else if ( cmd.cmd == IPCBENCH_CMD_SINK ) {
+            /* 受信 */
+
+            DoSink( pBuffer, cmd.num );
+
+        } else if ( ( cmd.cmd == IPCBENCH_CMD_SOURCE    ) ||
+                    ( cmd.cmd == IPCBENCH_CMD_SOURCE_NB )    ) {
+            /* 送信 */
+
+            DoSource( pBuffer, cmd.num, cmd.size, cmd.cmd );
+        }
+    }
+}
+
+
+/******************************************************************************/
+/* ローカル関数定義                                                           */
+/******************************************************************************/
+/******************************************************************************/
+/**
+ * @brief       返送
+ * @details     メインスレッドから受信したメッセージを指定回数返送する。
+ *
+ * @param[in]   *pBuffer メッセージバッファ
+ * @param[in]   num      返送回数
+ * @param[in]   cmd      コマンド
+ *                  - IPCBENCH_CMD_ECHO    ブロッキング送信
+ *                  - IPCBENCH_CMD_ECHO_NB ノンブロッキング送信
+ */
+/******************************************************************************/
+static void DoEcho( uint8_t  *pBuffer,
+                    uint32_t num,
+                    uint32_t cmd      )
+{
+    size_t   size;  /* 受信サイズ   */
+    uint32_t idx;   /* インデックス */
+
+    /* 初期化 */
+    size = 0;
+    idx  = 0;
+
+    /* 返送回数毎に繰り返す */
+    for ( idx = 0; idx < num; idx++ ) {
+        /* メッセージ受信 */
+        LibMkMsgReceive( gIpcBenchMainTaskId,   /* 受信待ちタスクID */
+                         pBuffer,               /* バッファ         */
+                         MK_MSG_SIZE_MAX,       /* バッファサイズ   */
+                         NULL,                  /* 送信元タスクID   */
+                         &size,                 /* 受信サイズ       */
+                         0,                     /* タイムアウト     */
+                         NULL               );  /* エラー内容       */
+
+        /* コマンド判定 */
+        if ( cmd == IPCBENCH_CMD_ECHO ) {
+            /* ブロッキング */
+
+            /* メッセージ送信 */
+            LibMkMsgSend( gIpcBenchMainTaskId, pBuffer, size, NULL );
+
+        } else {
+            /* ノンブロッキング */
+
+            /* メッセージ送信 */
+            LibMkMsgSendNB( gIpcBenchMainTaskId, pBuffer, size, NULL );
+        }
+    }
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       受信
+ * @details     メインスレッドから指定回数メッセージを受信した後、完了通知メッ
+ *              セージを送信する。
+ *
+ * @param[in]   *pBuffer メッセージバッファ
+ * @param[in]   num      受信回数
+ */
+/******************************************************************************/
+static void DoSink( uint8_t  *pBuffer,
+                    uint32_t num      )
+{
+    uint32_t idx;   /* インデックス */
+
+    /* 初期化 */
+    idx = 0;
+
+    /* 受信回数毎に繰り返す */
+    for ( idx = 0; idx < num; idx++ ) {
+        /* メッセージ受信 */
+        LibMkMsgReceive( gIpcBenchMainTaskId,   /* 受信待ちタスクID */
+                         pBuffer,               /* バッファ         */
+                         MK_MSG_SIZE_MAX,       /* バッファサイズ   */
+                         NULL,                  /* 送信元タスクID   */
+                         NULL,                  /* 受信サイズ       */
+                         0,                     /* タイムアウト     */
+                         NULL               );  /* エラー内容       */
+    }
+
+    /* 完了通知 */
+    LibMkMsgSend( gIpcBenchMainTaskId, pBuffer, IPCBENCH_SMALL_SIZE, NULL );
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       送信
+ * @details     メインスレッドに指定サイズのメッセージを指定回数送信する。
+ *
+ * @param[in]   *pBuffer メッセージバッファ
+ * @param[in]   num      送信回数
+ * @param[in]   size     メッセージサイズ
+ * @param[in]   cmd      コマンド
+ *                  - IPCBENCH_CMD_SOURCE    ブロッキング送信
+ *                  - IPCBENCH_CMD_SOURCE_NB ノンブロッキング送信
+ */
+/******************************************************************************/
+static void DoSource( uint8_t  *pBuffer,
+                      uint32_t num,
+                      size_t   size,
+                      uint32_t cmd      )
+{
+    uint32_t idx;   /* インデックス */
+
+    /* 初期化 */
+    idx = 0;
+
+    /* 送信回数毎に繰り返す */
+    for ( idx = 0; idx < num; idx++ ) {
+        /* コマンド判定 */
+        if ( cmd == IPCBENCH_CMD_SOURCE ) {
+            /* ブロッキング */
+
+            /* メッセージ送信 */
+            LibMkMsgSend( gIpcBenchMainTaskId, pBuffer, size, NULL );
+
+        } else {
+            /* ノンブロッキング */
+
+            /* メッセージ送信 */
+            LibMkMsgSendNB( gIpcBenchMainTaskId, pBuffer, size, NULL );
+        }
+    }
+
+    return;
+}
+
+
+/******************************************************************************/
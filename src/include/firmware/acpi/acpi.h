@@ -0,0 +1,111 @@
+/******************************************************************************/
+/*                                                                            */
+/* src/include/firmware/acpi/acpi.h                                           */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2026 Mochi.                                                  */
+/*                                                                            */
+/******************************************************************************/
+#ifndef ACPI_H
+#define ACPI_H
+/******************************************************************************/
+/* インクルード                                                               */
+/******************************************************************************/
+/* 標準ヘッダ */
+#include <stdint.h>
+
+
+/******************************************************************************/
+/* 定義                                                                       */
+/******************************************************************************/
+/* RSDP探索範囲 */
+#define ACPI_RSDP_EBDA_SEG_ADDR ( 0x0000040E )  /**< EBDAセグメント格納アドレス */
+#define ACPI_RSDP_EBDA_SIZE     ( 0x00000400 )  /**< EBDA探索サイズ             */
+#define ACPI_RSDP_BIOS_ADDR     ( 0x000E0000 )  /**< BIOS領域探索先頭アドレス   */
+#define ACPI_RSDP_BIOS_SIZE     ( 0x00020000 )  /**< BIOS領域探索サイズ         */
+#define ACPI_RSDP_ALIGN         ( 16 )          /**< RSDPアライメント           */
+
+/* シグネチャ */
+#define ACPI_SIG_RSDP           "RSD PTR "      /**< RSDPシグネチャ */
+#define ACPI_SIG_MADT           "APIC"          /**< MADTシグネチャ */
+
+/* MADTフラグ */
+#define ACPI_MADT_PCAT_COMPAT   ( 0x00000001 )  /**< 8259A互換PIC実装 */
+
+/* MADTエントリタイプ */
+#define ACPI_MADT_TYPE_LAPIC    ( 0 )           /**< ローカルAPIC       */
+#define ACPI_MADT_TYPE_IOAPIC   ( 1 )           /**< I/O APIC           */
+#define ACPI_MADT_TYPE_ISO      ( 2 )           /**< 割込みソース上書き */
+
+/* MPS INTIフラグ */
+#define ACPI_MPS_INTI_POL_MASK  ( 0x0003 )      /**< 極性マスク                 */
+#define ACPI_MPS_INTI_POL_BUS   ( 0x0000 )      /**< 極性：バス規定             */
+#define ACPI_MPS_INTI_POL_HIGH  ( 0x0001 )      /**< 極性：アクティブHigh       */
+#define ACPI_MPS_INTI_POL_LOW   ( 0x0003 )      /**< 極性：アクティブLow        */
+#define ACPI_MPS_INTI_TRG_MASK  ( 0x000C )      /**< トリガモードマスク         */
+#define ACPI_MPS_INTI_TRG_BUS   ( 0x0000 )      /**< トリガモード：バス規定     */
+#define ACPI_MPS_INTI_TRG_EDGE  ( 0x0004 )      /**< トリガモード：エッジ       */
+#define ACPI_MPS_INTI_TRG_LEVEL ( 0x000C )      /**< トリガモード：レベル       */
+
+/** RSDP(Root System Description Pointer) */
+typedef struct {
+    char     signature[ 8 ];    /**< シグネチャ           */
+    uint8_t  checksum;          /**< チェックサム         */
+    char     oemId[ 6 ];        /**< OEM ID               */
+    uint8_t  revision;          /**< リビジョン           */
+    uint32_t rsdtAddr;          /**< RSDT物理アドレス     */
+} __attribute__( ( packed ) ) AcpiRsdp_t;
+
+/** システム記述テーブルヘッダ */
+typedef struct {
+    char     signature[ 4 ];    /**< シグネチャ           */
+    uint32_t length;            /**< テーブル長           */
+    uint8_t  revision;          /**< リビジョン           */
+    uint8_t  checksum;          /**< チェックサム         */
+    char     oemId[ 6 ];        /**< OEM ID               */
+    char     oemTableId[ 8 ];   /**< OEMテーブルID        */
+    uint32_t oemRevision;       /**< OEMリビジョン        */
+    uint32_t creatorId;         /**< 作成者ID             */
+    uint32_t creatorRevision;   /**< 作成者リビジョン     */
+} __attribute__( ( packed ) ) AcpiSdtHdr_t;
+
+/** RSDT(Root System Description Table) */
+typedef struct {
+    AcpiSdtHdr_t header;        /**< ヘッダ               */
+    uint32_t     entry[];       /**< テーブル物理アドレス */
+} __attribute__( ( packed ) ) AcpiRsdt_t;
+
+/** MADT(Multiple APIC Description Table) */
+typedef struct {
+    AcpiSdtHdr_t header;        /**< ヘッダ                     */
+    uint32_t     lapicAddr;     /**< ローカルAPIC物理アドレス   */
+    uint32_t     flags;         /**< フラグ                     */
+    uint8_t      entry[];       /**< 割込みコントローラ構造体   */
+} __attribute__( ( packed ) ) AcpiMadt_t;
+
+/** MADTエントリヘッダ */
+typedef struct {
+    uint8_t type;               /**< エントリタイプ       */
+    uint8_t length;             /**< エントリ長           */
+} __attribute__( ( packed ) ) AcpiMadtHdr_t;
+
+/** MADT I/O APICエントリ */
+typedef struct {
+    AcpiMadtHdr_t header;       /**< エントリヘッダ           */
+    uint8_t       ioapicId;     /**< I/O APIC ID              */
+    uint8_t       reserved;     /**< 予約                     */
+    uint32_t      ioapicAddr;   /**< I/O APIC物理アドレス     */
+    uint32_t      gsiBase;      /**< GSIベース                */
+} __attribute__( ( packed ) ) AcpiMadtIoapic_t;
+
+/** MADT割込みソース上書きエントリ */
+typedef struct {
+    AcpiMadtHdr_t header;       /**< エントリヘッダ             */
+    uint8_t       bus;          /**< バス(0:ISA)                */
+    uint8_t       source;       /**< ソース(ISA IRQ番号)        */
+    uint32_t      gsi;          /**< GSI                        */
+    uint16_t      flags;        /**< MPS INTIフラグ             */
+} __attribute__( ( packed ) ) AcpiMadtIso_t;
+
+
+/******************************************************************************/
+#endif
@@ -0,0 +1,81 @@
+/******************************************************************************/
+/*                                                                            */
+/* src/include/hardware/APIC/APIC.h                                           */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2026 Mochi.                                                  */
+/*                                                                            */
+/******************************************************************************/
+#ifndef APIC_H
+#define APIC_H
+/******************************************************************************/
+/* 定義                                                                       */
+/******************************************************************************/
+/* ローカルAPICレジスタオフセット定義 */
+#define APIC_LAPIC_REG_ID      ( 0x020 )    /**< ローカルAPIC IDレジスタ        */
+#define APIC_LAPIC_REG_VER     ( 0x030 )    /**< バージョンレジスタ             */
+#define APIC_LAPIC_REG_TPR     ( 0x080 )    /**< タスク優先度レジスタ           */
+#define APIC_LAPIC_REG_EOI     ( 0x0B0 )    /**< EOIレジスタ                    */
+#define APIC_LAPIC_REG_SVR     ( 0x0F0 )    /**< スプリアス割込みベクタレジスタ */
+#define APIC_LAPIC_REG_ESR     ( 0x280 )    /**< エラーステータスレジスタ       */
+#define APIC_LAPIC_REG_LVT_TMR ( 0x320 )    /**< LVTタイマレジスタ              */
+#define APIC_LAPIC_REG_LVT_LI0 ( 0x350 )    /**< LVT LINT0レジスタ              */
+#define APIC_LAPIC_REG_LVT_LI1 ( 0x360 )    /**< LVT LINT1レジスタ              */
+#define APIC_LAPIC_REG_LVT_ERR ( 0x370 )    /**< LVTエラーレジスタ              */
+#define APIC_LAPIC_REG_TMR_ICR ( 0x380 )    /**< タイマ初期カウントレジスタ     */
+#define APIC_LAPIC_REG_TMR_CCR ( 0x390 )    /**< タイマ現在カウントレジスタ     */
+#define APIC_LAPIC_REG_TMR_DCR ( 0x3E0 )    /**< タイマ分周設定レジスタ         */
+
+/* ローカルAPIC IDレジスタビット定義 */
+#define APIC_LAPIC_ID_SHIFT    ( 24 )           /**< ローカルAPIC IDシフト数 */
+
+/* スプリアス割込みベクタレジスタビット定義 */
+#define APIC_LAPIC_SVR_EN      ( 0x00000100 )   /**< APICソフトウェア有効 */
+
+/* LVTレジスタビット定義 */
+#define APIC_LAPIC_LVT_DM_NMI       ( 0x00000400 )  /**< 配送モード：NMI         */
+#define APIC_LAPIC_LVT_DM_EXT       ( 0x00000700 )  /**< 配送モード：ExtINT      */
+#define APIC_LAPIC_LVT_MASK         ( 0x00010000 )  /**< マスク                  */
+#define APIC_LAPIC_LVT_TMR_ONESHOT  ( 0x00000000 )  /**< タイマ：ワンショット    */
+#define APIC_LAPIC_LVT_TMR_DEADLINE ( 0x00040000 )  /**< タイマ：TSCデッドライン */
+
+/* タイマ分周設定レジスタ定義 */
+#define APIC_LAPIC_TMR_DCR_DIV1     ( 0x0000000B )  /**< 1分周 */
+
+/** ローカルAPICレジスタ領域サイズ */
+#define APIC_LAPIC_SIZE        ( 0x00001000 )
+
+/* I/O APICレジスタオフセット定義 */
+#define APIC_IOAPIC_IOREGSEL   ( 0x00 )     /**< レジスタ選択レジスタ */
+#define APIC_IOAPIC_IOWIN      ( 0x10 )     /**< データレジスタ       */
+
+/* I/O APICレジスタ番号定義 */
+#define APIC_IOAPIC_REG_ID     ( 0x00 )     /**< I/O APIC IDレジスタ          */
+#define APIC_IOAPIC_REG_VER    ( 0x01 )     /**< バージョンレジスタ           */
+#define APIC_IOAPIC_REG_REDTBL ( 0x10 )     /**< リダイレクションテーブル先頭 */
+
+/** I/O APICリダイレクションテーブル下位レジスタ番号 */
+#define APIC_IOAPIC_REDTBL_LOW( _PIN )  \
+    ( APIC_IOAPIC_REG_REDTBL + ( _PIN ) * 2     )
+/** I/O APICリダイレクションテーブル上位レジスタ番号 */
+#define APIC_IOAPIC_REDTBL_HIGH( _PIN ) \
+    ( APIC_IOAPIC_REG_REDTBL + ( _PIN ) * 2 + 1 )
+
+/** I/O APIC最大リダイレクションエントリ番号取得 */
+#define APIC_IOAPIC_VER_MRE( _VER ) ( ( ( _VER ) >> 16 ) & 0xFF )
+
+/* I/O APICリダイレクションテーブルビット定義 */
+#define APIC_IOAPIC_RTE_DM_FIXED  ( 0x00000000 )    /**< 配送モード：固定           */
+#define APIC_IOAPIC_RTE_DST_PHYS  ( 0x00000000 )    /**< 宛先モード：物理           */
+#define APIC_IOAPIC_RTE_POL_HIGH  ( 0x00000000 )    /**< 極性：アクティブHigh       */
+#define APIC_IOAPIC_RTE_POL_LOW   ( 0x00002000 )    /**< 極性：アクティブLow        */
+#define APIC_IOAPIC_RTE_TRG_EDGE  ( 0x00000000 )    /**< トリガ：エッジ             */
+#define APIC_IOAPIC_RTE_TRG_LEVEL ( 0x00008000 )    /**< トリガ：レベル             */
+#define APIC_IOAPIC_RTE_MASK      ( 0x00010000 )    /**< マスク                     */
+#define APIC_IOAPIC_RTE_DST_SHIFT ( 24 )            /**< 宛先(上位レジスタ)シフト数 */
+
+/** I/O APICレジスタ領域サイズ */
+#define APIC_IOAPIC_SIZE          ( 0x00001000 )
+
+
+/******************************************************************************/
+#endif
@@ -1,8 +1,8 @@
 /******************************************************************************/
 /*                                                                            */
 /* src/kernel/include/hardware/I8254/I8254.h                                  */
-/*                                                                 2019/07/23 */
-/* Copyright (C) 2016-2019 Mochi.                                             */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2016-2026 Mochi.                                             */
 /*                                                                            */
 /******************************************************************************/
 #ifndef I8254_H
@@ -15,6 +15,12 @@
 #define I8254_PORT_CNTR1     ( 0x41 )   /**< PITカウンタ1レジスタ          */
 #define I8254_PORT_CNTR2     ( 0x42 )   /**< PITカウンタ2レジスタ          */
 #define I8254_PORT_CTRLW     ( 0x43 )   /**< PITコントロールワードレジスタ */
+#define I8254_PORT_NMISC     ( 0x61 )   /**< NMIステータス/制御レジスタ    */
+
+/* NMIステータス/制御レジスタビット定義 */
+#define I8254_NMISC_GATE2    ( 0x01 )   /**< カウンタ2ゲート */
+#define I8254_NMISC_SPKR     ( 0x02 )   /**< スピーカ出力    */
+#define I8254_NMISC_OUT2     ( 0x20 )   /**< カウンタ2出力   */
 
 /* コントロールワードレジスタビット定義 */
 #define I8254_CTRLW_SC_CNTR0 ( 0x00 )   /**< 制御カウンタ：カウンタ0        */
@@ -1,8 +1,8 @@
 /******************************************************************************/
 /*                                                                            */
 /* src/kernel/include/hardware/I8259A/I8259A.h                                */
-/*                                                                 2019/07/23 */
-/* Copyright (C) 2016-2019 Mochi.                                             */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2016-2026 Mochi.                                             */
 /*                                                                            */
 /******************************************************************************/
 #ifndef I8259A_H
@@ -28,6 +28,10 @@
 #define I8259A_S_PORT_OCW2 ( 0xA0 ) /**< PIC2スレーブOCW2ポート番号 */
 #define I8259A_S_PORT_OCW3 ( 0xA0 ) /**< PIC2スレーブOCW3ポート番号 */
 
+/* ELCR I/Oポート定義 */
+#define I8259A_M_PORT_ELCR ( 0x4D0 )    /**< PIC1マスタELCRポート番号   */
+#define I8259A_S_PORT_ELCR ( 0x4D1 )    /**< PIC2スレーブELCRポート番号 */
+
 /* OCW1レジスタビット定義 */
 #define I8259A_OCW1_M0     ( 0x01 ) /**< OCW1レジスタIR0マスク */
 #define I8259A_OCW1_M1     ( 0x02 ) /**< OCW1レジスタIR1マスク */
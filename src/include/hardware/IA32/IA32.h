@@ -1,8 +1,8 @@
 /******************************************************************************/
 /*                                                                            */
 /* src/kernel/include/hardware/IA32/IA32.h                                    */
-/*                                                                 2019/07/23 */
-/* Copyright (C) 2016-2018 Mochi.                                             */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2016-2026 Mochi.                                             */
 /*                                                                            */
 /******************************************************************************/
 #ifndef IA32_H
@@ -64,6 +64,26 @@
 #define IA32_CR0_MP ( 0x00000002 )  /** モニタコプロセッサ       */
 #define IA32_CR0_PE ( 0x00000001 )  /** 保護イネーブル           */
 
+/* CPUID(EAX=1)EDX機能フラグ */
+#define IA32_CPUID_1_EDX_TSC  ( 0x00000010 )    /**< タイムスタンプカウンタ */
+#define IA32_CPUID_1_EDX_MSR  ( 0x00000020 )    /**< MSR                    */
+#define IA32_CPUID_1_EDX_APIC ( 0x00000200 )    /**< ローカルAPIC           */
+#define IA32_CPUID_1_EDX_SEP  ( 0x00000800 )    /**< SYSENTER/SYSEXIT       */
+
+/* CPUID(EAX=1)ECX機能フラグ */
+#define IA32_CPUID_1_ECX_TSCDL ( 0x01000000 )   /**< TSCデッドライン */
+
+/* MSR */
+#define IA32_MSR_APIC_BASE    ( 0x0000001B )    /**< APICベース   */
+#define IA32_MSR_SYSENTER_CS  ( 0x00000174 )    /**< SYSENTER CS  */
+#define IA32_MSR_SYSENTER_ESP ( 0x00000175 )    /**< SYSENTER ESP */
+#define IA32_MSR_SYSENTER_EIP ( 0x00000176 )    /**< SYSENTER EIP */
+#define IA32_MSR_TSC_DEADLINE ( 0x000006E0 )    /**< TSCデッドライン */
+
+/* APICベースMSRビット定義 */
+#define IA32_APIC_BASE_EN   ( 0x00000800 )  /**< APICグローバル有効 */
+#define IA32_APIC_BASE_ADDR ( 0xFFFFF000 )  /**< APICベースアドレス */
+
 /** 通常エラーコード */
 typedef struct {
     uint16_t ext  :1;       /**< 外部イベントフラグ             */
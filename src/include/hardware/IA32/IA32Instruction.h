@@ -1,8 +1,8 @@
 /******************************************************************************/
 /*                                                                            */
 /* src/kernel/include/hardware/IA32/IA32Instruction.h                         */
-/*                                                                 2025/03/30 */
-/* Copyright (C) 2016-2025 Mochi.                                             */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2016-2026 Mochi.                                             */
 /*                                                                            */
 /******************************************************************************/
 #ifndef IA32_INSTRUCTION_H
@@ -41,6 +41,32 @@ static inline void IA32InstructionAddEsp( int32_t value )
 }
 
 
+/******************************************************************************/
+/**
+ * @brief       bsf命令実行
+ * @details     指定した値の最下位のセットビットのビット番号を返す。
+ *
+ * @param[in]   value 値(0以外)
+ *
+ * @return      ビット番号を返す。
+ *
+ * @attention   値が0の場合、戻り値は不定となる。
+ */
+/******************************************************************************/
+static inline uint32_t IA32InstructionBsf( uint32_t value )
+{
+    uint32_t index; /* ビット番号 */
+
+    /* bsf命令実行 */
+    __asm__ __volatile__ ( "bsf %0, %1"
+                           : "=r" ( index )     /* output : index */
+                           : "rm" ( value )     /* input  : value */
+                           : "cc"            );
+
+    return index;
+}
+
+
 /******************************************************************************/
 /**
  * @brief       call命令実行
@@ -75,6 +101,38 @@ static inline void IA32InstructionCli( void )
 }
 
 
+/******************************************************************************/
+/**
+ * @brief       cpuid命令実行
+ * @details     指定した機能番号でcpuid命令を実行し、各レジスタ値を返す。
+ *
+ * @param[in]   leaf  機能番号(EAX)
+ * @param[out]  *pEax EAXレジスタ値
+ * @param[out]  *pEbx EBXレジスタ値
+ * @param[out]  *pEcx ECXレジスタ値
+ * @param[out]  *pEdx EDXレジスタ値
+ */
+/******************************************************************************/
+static inline void IA32InstructionCpuid( uint32_t leaf,
+                                         uint32_t *pEax,
+                                         uint32_t *pEbx,
+                                         uint32_t *pEcx,
+                                         uint32_t *pEdx )
+{
+    /* cpuid命令実行 */
+    __asm__ __volatile__ ( "cpuid"
+                           : "=a" ( *pEax ),    /* output : eax */
+                             "=b" ( *pEbx ),    /* output : ebx */
+                             "=c" ( *pEcx ),    /* output : ecx */
+                             "=d" ( *pEdx )     /* output : edx */
+                           : "a"  ( leaf  ),    /* input  : eax */
+                             "c"  ( 0     )     /* input  : ecx */
+                           :                 );
+
+    return;
+}
+
+
 /******************************************************************************/
 /**
  * @brief       ebpレジスタ値取得
@@ -628,6 +686,56 @@ static inline void IA32InstructionPushGs( void )
 }
 
 
+/******************************************************************************/
+/**
+ * @brief       rdmsr命令実行
+ * @details     指定したMSRの値を読み込む。
+ *
+ * @param[in]   msr MSR番号
+ *
+ * @return      MSR値
+ */
+/******************************************************************************/
+static inline uint64_t IA32InstructionRdmsr( uint32_t msr )
+{
+    uint32_t low;   /* 下位32bit */
+    uint32_t high;  /* 上位32bit */
+
+    /* rdmsr命令実行 */
+    __asm__ __volatile__ ( "rdmsr"
+                           : "=a" ( low  ),     /* output : eax */
+                             "=d" ( high )      /* output : edx */
+                           : "c"  ( msr  )      /* input  : ecx */
+                           :                 );
+
+    return ( ( ( uint64_t ) high ) << 32 ) | low;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       rdtsc命令実行
+ * @details     タイムスタンプカウンタの値を返す。
+ *
+ * @return      タイムスタンプカウンタ値
+ */
+/******************************************************************************/
+static inline uint64_t IA32InstructionRdtsc( void )
+{
+    uint32_t low;   /* 下位32bit */
+    uint32_t high;  /* 上位32bit */
+
+    /* rdtsc命令実行 */
+    __asm__ __volatile__ ( "rdtsc"
+                           : "=a" ( low  ),     /* output : eax */
+                             "=d" ( high )      /* output : edx */
+                           :
+                           :                 );
+
+    return ( ( ( uint64_t ) high ) << 32 ) | low;
+}
+
+
 /******************************************************************************/
 /**
  * @brief       rep insb命令実行
@@ -942,5 +1050,36 @@ static inline void IA32InstructionWbinvd( void )
 }
 
 
+/******************************************************************************/
+/**
+ * @brief       wrmsr命令実行
+ * @details     指定したMSRに値を書き込む。
+ *
+ * @param[in]   msr   MSR番号
+ * @param[in]   value 設定値
+ */
+/******************************************************************************/
+static inline void IA32InstructionWrmsr( uint32_t msr,
+                                         uint64_t value )
+{
+    uint32_t low;   /* 下位32bit */
+    uint32_t high;  /* 上位32bit */
+
+    /* 初期化 */
+    low  = ( uint32_t ) value;
+    high = ( uint32_t ) ( value >> 32 );
+
+    /* wrmsr命令実行 */
+    __asm__ __volatile__ ( "wrmsr"
+                           :
+                           : "c" ( msr  ),      /* input : ecx */
+                             "a" ( low  ),      /* input : eax */
+                             "d" ( high )       /* input : edx */
+                           :                 );
+
+    return;
+}
+
+
 /******************************************************************************/
 #endif
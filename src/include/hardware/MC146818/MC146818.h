@@ -0,0 +1,43 @@
+/******************************************************************************/
+/*                                                                            */
+/* src/include/hardware/MC146818/MC146818.h                                   */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2026 Mochi.                                                  */
+/*                                                                            */
+/******************************************************************************/
+#ifndef MC146818_H
+#define MC146818_H
+/******************************************************************************/
+/* 定義                                                                       */
+/******************************************************************************/
+/* RTCポート定義 */
+#define MC146818_PORT_INDEX  ( 0x70 )   /**< インデックスレジスタ */
+#define MC146818_PORT_DATA   ( 0x71 )   /**< データレジスタ       */
+
+/* RTCレジスタ番号定義 */
+#define MC146818_REG_SEC     ( 0x00 )   /**< 秒                  */
+#define MC146818_REG_MIN     ( 0x02 )   /**< 分                  */
+#define MC146818_REG_HOUR    ( 0x04 )   /**< 時                  */
+#define MC146818_REG_DAY     ( 0x07 )   /**< 日                  */
+#define MC146818_REG_MONTH   ( 0x08 )   /**< 月                  */
+#define MC146818_REG_YEAR    ( 0x09 )   /**< 年(下2桁)           */
+#define MC146818_REG_A       ( 0x0A )   /**< ステータスレジスタA */
+#define MC146818_REG_B       ( 0x0B )   /**< ステータスレジスタB */
+
+/* ステータスレジスタAビット定義 */
+#define MC146818_A_UIP       ( 0x80 )   /**< 更新中 */
+
+/* ステータスレジスタBビット定義 */
+#define MC146818_B_24H       ( 0x02 )   /**< 24時間表記   */
+#define MC146818_B_DM        ( 0x04 )   /**< バイナリ形式 */
+
+/** 時レジスタPMビット(12時間表記) */
+#define MC146818_HOUR_PM     ( 0x80 )
+
+/** BCD→バイナリ変換 */
+#define MC146818_BCD_TO_BIN( _BCD ) \
+    ( ( ( ( _BCD ) >> 4 ) * 10 ) + ( ( _BCD ) & 0x0F ) )
+
+
+/******************************************************************************/
+#endif
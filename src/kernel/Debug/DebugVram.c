@@ -1,8 +1,8 @@
 /******************************************************************************/
 /*                                                                            */
 /* src/kernel/Debug/DebugVram.c                                               */
-/*                                                                 2024/07/21 */
-/* Copyright (C) 2022-2024 Mochi.                                             */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2022-2026 Mochi.                                             */
 /*                                                                            */
 /******************************************************************************/
 /******************************************************************************/
@@ -82,6 +82,7 @@ static const vramConv_t gConvTbl[] = {
     { CMN_MODULE_MEMMNG_IO,      "MEM-I/O " },   /* メモリ管理(I/O)          */
     { CMN_MODULE_MEMMNG_VIRT,    "MEM-VIRT" },   /* メモリ管理(仮想)         */
     { CMN_MODULE_MEMMNG_HEAP,    "MEM-HEAP" },   /* メモリ管理(ヒープ)       */
+    { CMN_MODULE_MEMMNG_SHARE,   "MEM-SHR " },   /* メモリ管理(共有ページ)   */
     { CMN_MODULE_TASKMNG_MAIN,   "TSK-MAIN" },   /* タスク管理(メイン)       */
     { CMN_MODULE_TASKMNG_TSS,    "TSK-TSS " },   /* タスク管理(TSS)          */
     { CMN_MODULE_TASKMNG_SCHED,  "TSK-SCHD" },   /* タスク管理(スケジューラ) */
@@ -95,11 +96,21 @@ static const vramConv_t gConvTbl[] = {
     { CMN_MODULE_INTMNG_IDT,     "INT-IDT " },   /* 割込管理(IDT)            */
     { CMN_MODULE_INTMNG_HDL,     "INT-HDL " },   /* 割込管理(ハンドラ)       */
     { CMN_MODULE_INTMNG_CTRL,    "INT-CTRL" },   /* 割込管理(ハードウェア)   */
+    { CMN_MODULE_INTMNG_SYS,     "INT-SYS " },   /* 割込管理(システムコール) */
+    { CMN_MODULE_INTMNG_STAT,    "INT-STAT" },   /* 割込管理(統計)           */
+    { CMN_MODULE_INTMNG_APIC,    "INT-APIC" },   /* 割込管理(APIC)           */
+    { CMN_MODULE_INTMNG_IRQ,     "INT-IRQ " },   /* 割込管理(IRQ)            */
     { CMN_MODULE_TIMERMNG_MAIN,  "TIM-MAIN" },   /* タイマ管理(メイン)       */
     { CMN_MODULE_TIMERMNG_CTRL,  "TIM-CTRL" },   /* タイマ管理(制御)         */
     { CMN_MODULE_TIMERMNG_PIT,   "TIM-PIT " },   /* タイマ管理(PIT)          */
+    { CMN_MODULE_TIMERMNG_LAPIC, "TIM-LAPC" },   /* タイマ管理(LAPICタイマ)  */
+    { CMN_MODULE_TIMERMNG_CLOCK, "TIM-CLK " },   /* タイマ管理(時刻)         */
     { CMN_MODULE_ITCCTRL_MAIN,   "ITC-MAIN" },   /* タスク間通信制御(メイン) */
     { CMN_MODULE_ITCCTRL_MSG,    "ITC-MSG " },   /* タスク間通信制御(ﾒｯｾｰｼﾞ) */
+    { CMN_MODULE_ITCCTRL_EVENT,  "ITC-EVNT" },   /* タスク間通信制御(ｲﾍﾞﾝﾄ)  */
+    { CMN_MODULE_ITCCTRL_NTF,    "ITC-NTF " },   /* タスク間通信制御(通知)   */
+    { CMN_MODULE_ITCCTRL_PUB,    "ITC-PUB " },   /* タスク間通信制御(出版)   */
+    { CMN_MODULE_ITCCTRL_EP,     "ITC-EP  " },   /* タスク間通信制御(EP)     */
     { CMN_MODULE_IOCTRL_MAIN,    "IOC-MAIN" },   /* 入出力制御(メイン)       */
     { CMN_MODULE_IOCTRL_PORT,    "IOC-PORT" },   /* 入出力制御(I/Oポート)    */
     { CMN_MODULE_IOCTRL_MEM,     "IOC-MEM " },   /* 入出力制御(I/Oメモリ)    */
@@ -1,8 +1,8 @@
 /******************************************************************************/
 /*                                                                            */
 /* src/kernel/Initctrl/Initctrl.c                                             */
-/*                                                                 2024/06/18 */
-/* Copyright (C) 2016-2024 Mochi.                                             */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2016-2026 Mochi.                                             */
 /*                                                                            */
 /******************************************************************************/
 /******************************************************************************/
@@ -98,7 +98,7 @@ void InitctrlInit( void )
     LoadProcImg();
 
     /* 割込み有効化 */
-    IntmngPicEnable();
+    IntmngIrqEnable();
     IA32InstructionSti();
 
     DEBUG_LOG_INF( "Idle running." );
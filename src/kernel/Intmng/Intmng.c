@@ -1,8 +1,8 @@
 /******************************************************************************/
 /*                                                                            */
 /* src/kernel/Intmng/Intmng.c                                                 */
-/*                                                                 2024/06/01 */
-/* Copyright (C) 2016-2024 Mochi.                                             */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2016-2026 Mochi.                                             */
 /*                                                                            */
 /******************************************************************************/
 /******************************************************************************/
@@ -19,7 +19,9 @@
 #include "IntmngCtrl.h"
 #include "IntmngHdl.h"
 #include "IntmngIdt.h"
-#include "IntmngPic.h"
+#include "IntmngIrq.h"
+#include "IntmngStat.h"
+#include "IntmngSys.h"
 
 
 /******************************************************************************/
@@ -49,8 +51,16 @@ void IntmngInit( void )
     /* ハンドラ管理サブモジュール初期化 */
     IntmngHdlInit();
 
-    /* PIC管理サブモジュール初期化 */
-    IntmngPicInit();
+    /* システムコール管理サブモジュール初期化 */
+    IntmngSysInit();
+
+#ifdef INTMNG_STAT_ENABLE
+    /* システムコール統計サブモジュール初期化 */
+    IntmngStatInit();
+#endif
+
+    /* IRQ管理サブモジュール初期化 */
+    IntmngIrqInit();
 
     /* ハードウェア割込み制御サブモジュール初期化 */
     IntmngCtrlInit();
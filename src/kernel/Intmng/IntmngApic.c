@@ -0,0 +1,1268 @@
+/******************************************************************************/
+/*                                                                            */
+/* src/kernel/Intmng/IntmngApic.c                                             */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2026 Mochi.                                                  */
+/*                                                                            */
+/******************************************************************************/
+/******************************************************************************/
+/* インクルード                                                               */
+/******************************************************************************/
+/* 標準ヘッダ */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* ライブラリヘッダ */
+#include <MLib/MLib.h>
+#include <MLib/MLibUtil.h>
+
+/* 共通ヘッダ */
+#include <memmap.h>
+#include <firmware/acpi/acpi.h>
+#include <hardware/APIC/APIC.h>
+#include <hardware/IA32/IA32.h>
+#include <hardware/IA32/IA32Instruction.h>
+
+/* 外部モジュールヘッダ */
+#include <Cmn.h>
+#include <Debug.h>
+#include <Intmng.h>
+#include <Memmng.h>
+
+/* 内部モジュールヘッダ */
+#include "IntmngApic.h"
+
+
+/******************************************************************************/
+/* 定義                                                                       */
+/******************************************************************************/
+/* モジュールID */
+#define _MODULE_ID_ CMN_MODULE_INTMNG_APIC
+
+/* 割込みマスク状態定義 */
+#define APIC_MASK_STATE_DISABLE ( 0 )   /**< マスク無効状態 */
+#define APIC_MASK_STATE_ENABLE  ( 1 )   /**< マスク有効状態 */
+
+/** I/O APIC最大数 */
+#define IOAPIC_NUM_MAX          ( 4 )
+
+/** ローカルAPICレジスタ仮想アドレス */
+#define LAPIC_VADDR             ( MEMMAP_VADDR_KERNEL_APIC )
+/** I/O APICレジスタ仮想アドレス */
+#define IOAPIC_VADDR( _IDX )                             \
+    ( MEMMAP_VADDR_KERNEL_APIC + APIC_LAPIC_SIZE +       \
+      ( _IDX ) * APIC_IOAPIC_SIZE                      )
+
+/** ローカルAPICレジスタ */
+#define LAPIC_REG( _OFFSET )                                      \
+    ( *( ( volatile uint32_t * ) ( LAPIC_VADDR + ( _OFFSET ) ) ) )
+
+/** IRQビット */
+#define IRQ_BIT( _IRQNO )       ( 0x00000001u << ( _IRQNO ) )
+
+/** I/O APIC情報型 */
+typedef struct {
+    uint32_t addr;      /**< レジスタ仮想アドレス */
+    uint32_t gsiBase;   /**< GSIベース            */
+    uint32_t pinNum;    /**< ピン数               */
+} ioapicInfo_t;
+
+/** IRQ情報型 */
+typedef struct {
+    bool     valid;     /**< 有効フラグ                     */
+    uint8_t  ioapicIdx; /**< I/O APICインデックス           */
+    uint8_t  pin;       /**< ピン番号                       */
+    uint8_t  reserved;  /**< パディング                     */
+    uint32_t mode;      /**< リダイレクションエントリモード */
+} irqInfo_t;
+
+/** APIC管理テーブル型 */
+typedef struct {
+    uint32_t     lapicId;                   /**< ローカルAPIC ID           */
+    uint32_t     ioapicNum;                 /**< I/O APIC数                */
+    ioapicInfo_t ioapic[ IOAPIC_NUM_MAX ];  /**< I/O APIC情報              */
+    irqInfo_t    irq[ INTMNG_IRQ_NUM ];     /**< IRQ情報                   */
+    uint32_t     allow;                     /**< 許可IRQビットマップ       */
+    uint32_t     defer;                     /**< 処理委譲中IRQビットマップ */
+    uint8_t      maskState;                 /**< 割込みマスク状態          */
+    uint8_t      irqNum;                    /**< IRQ数                     */
+    bool         lapicEn;                   /**< ローカルAPIC使用有無      */
+    uint8_t      reserved;                  /**< パディング                */
+} apicTbl_t;
+
+
+/******************************************************************************/
+/* ローカル関数宣言                                                           */
+/******************************************************************************/
+/* チェックサム計算 */
+static uint8_t CalcChecksum( void   *pAddr,
+                             size_t size    );
+/* 物理アドレス範囲チェック */
+static bool CheckAddr( uint32_t addr,
+                       size_t   size  );
+/* MADT検索 */
+static AcpiMadt_t *FindMadt( void );
+/* RSDP検索 */
+static AcpiRsdp_t *FindRsdp( uint32_t addr,
+                             size_t   size  );
+/* リダイレクションエントリモード取得 */
+static uint32_t GetMode( uint16_t flags,
+                         uint32_t pol,
+                         uint32_t trg    );
+/* スプリアス割込みハンドラ */
+static void HdlSpurious( uint32_t         intNo,
+                         IntmngContext_t *pContext );
+/* I/O APIC初期化 */
+static CmnRet_t InitIoapic( AcpiMadt_t *pMadt );
+/* IRQ情報初期化 */
+static void InitIrq( AcpiMadt_t *pMadt );
+/* ローカルAPIC初期化 */
+static CmnRet_t InitLapic( AcpiMadt_t *pMadt );
+/* I/O APICレジスタ読込み */
+static uint32_t ReadIoapic( uint32_t idx,
+                            uint32_t reg  );
+/* リダイレクションエントリ設定 */
+static void SetRte( uint8_t irqNo );
+/* I/O APICレジスタ書込み */
+static void WriteIoapic( uint32_t idx,
+                         uint32_t reg,
+                         uint32_t value );
+
+
+/******************************************************************************/
+/* 変数定義                                                                   */
+/******************************************************************************/
+/** APIC管理テーブル */
+static apicTbl_t gApicTbl;
+
+
+/******************************************************************************/
+/* グローバル関数定義                                                         */
+/******************************************************************************/
+/******************************************************************************/
+/**
+ * @brief       APIC割込み許可
+ * @details     指定したIRQ番号の割込みを許可する。
+ *
+ * @param[in]   irqNo IRQ番号
+ */
+/******************************************************************************/
+void IntmngApicAllowIrq( uint8_t irqNo )
+{
+    DEBUG_LOG_TRC( "%s() start. irqNo=%u", __func__, irqNo );
+
+    /* IRQ番号チェック */
+    if ( irqNo < INTMNG_IRQ_NUM ) {
+        /* 範囲内 */
+
+        /* 許可IRQ設定 */
+        gApicTbl.allow |= IRQ_BIT( irqNo );
+
+        /* リダイレクションエントリ設定 */
+        SetRte( irqNo );
+    }
+
+    DEBUG_LOG_TRC( "%s() end.", __func__ );
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       APIC割込み処理完了
+ * @details     処理委譲中のレベルトリガIRQのマスクを解除する。
+ *
+ * @param[in]   irqNo IRQ番号
+ */
+/******************************************************************************/
+void IntmngApicComplete( uint8_t irqNo )
+{
+    /* 処理委譲中判定 */
+    if ( ( irqNo < INTMNG_IRQ_NUM                      ) &&
+         ( ( gApicTbl.defer & IRQ_BIT( irqNo ) ) != 0 )    ) {
+        /* 処理委譲中 */
+
+        /* 処理委譲解除 */
+        gApicTbl.defer &= ~IRQ_BIT( irqNo );
+
+        /* リダイレクションエントリ設定 */
+        SetRte( irqNo );
+    }
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       APIC割込み処理委譲
+ * @details     割込み処理をタスクに委譲する。レベルトリガIRQは処理完了まで
+ *              I/O APICでマスクし、ローカルAPICへEOIを通知する。ローカルAPIC
+ *              のEOIはIRQ毎に遅延できない為、マスクにより再発生を抑止する。
+ *
+ * @param[in]   irqNo IRQ番号
+ */
+/******************************************************************************/
+void IntmngApicDefer( uint8_t irqNo )
+{
+    /* トリガモード判定 */
+    if ( ( irqNo < INTMNG_IRQ_NUM                                        ) &&
+         ( ( gApicTbl.irq[ irqNo ].mode & APIC_IOAPIC_RTE_TRG_LEVEL ) != 0 )    ) {
+        /* レベルトリガ */
+
+        /* 処理委譲設定 */
+        gApicTbl.defer |= IRQ_BIT( irqNo );
+
+        /* リダイレクションエントリ設定 */
+        SetRte( irqNo );
+    }
+
+    /* EOI通知 */
+    IntmngApicEoi();
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       APIC割込み拒否
+ * @details     指定したIRQ番号の割込みを拒否する。
+ *
+ * @param[in]   irqNo IRQ番号
+ */
+/******************************************************************************/
+void IntmngApicDenyIrq( uint8_t irqNo )
+{
+    DEBUG_LOG_TRC( "%s() start. irqNo=%u", __func__, irqNo );
+
+    /* IRQ番号チェック */
+    if ( irqNo < INTMNG_IRQ_NUM ) {
+        /* 範囲内 */
+
+        /* 許可IRQ解除 */
+        gApicTbl.allow &= ~IRQ_BIT( irqNo );
+
+        /* リダイレクションエントリ設定 */
+        SetRte( irqNo );
+    }
+
+    DEBUG_LOG_TRC( "%s() end.", __func__ );
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       APIC割込み無効化
+ * @details     I/O APICの全IRQをマスクする。
+ */
+/******************************************************************************/
+void IntmngApicDisable( void )
+{
+    uint8_t irqNo;  /* IRQ番号 */
+
+    DEBUG_LOG_TRC( "%s() start.", __func__ );
+
+    /* 割込みマスク状態変更 */
+    gApicTbl.maskState = APIC_MASK_STATE_DISABLE;
+
+    /* IRQ毎に繰り返す */
+    for ( irqNo = 0; irqNo < INTMNG_IRQ_NUM; irqNo++ ) {
+        /* リダイレクションエントリ設定 */
+        SetRte( irqNo );
+    }
+
+    DEBUG_LOG_TRC( "%s() end.", __func__ );
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       APIC割込み有効化
+ * @details     I/O APICの許可IRQのマスクを解除する。
+ */
+/******************************************************************************/
+void IntmngApicEnable( void )
+{
+    uint8_t irqNo;  /* IRQ番号 */
+
+    DEBUG_LOG_TRC( "%s() start.", __func__ );
+
+    /* 割込みマスク状態変更 */
+    gApicTbl.maskState = APIC_MASK_STATE_ENABLE;
+
+    /* IRQ毎に繰り返す */
+    for ( irqNo = 0; irqNo < INTMNG_IRQ_NUM; irqNo++ ) {
+        /* リダイレクションエントリ設定 */
+        SetRte( irqNo );
+    }
+
+    DEBUG_LOG_TRC( "%s() end.", __func__ );
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       APIC割込みEOI通知
+ * @details     ローカルAPICにEOIを通知する。
+ */
+/******************************************************************************/
+void IntmngApicEoi( void )
+{
+    /* EOI通知 */
+    LAPIC_REG( APIC_LAPIC_REG_EOI ) = 0;
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       APIC IRQ数取得
+ * @details     I/O APICに接続された有効なIRQ数を取得する。
+ *
+ * @return      IRQ数を返す。
+ */
+/******************************************************************************/
+uint8_t IntmngApicGetIrqNum( void )
+{
+    return gApicTbl.irqNum;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       APIC管理初期化
+ * @details     ACPI MADTからローカルAPICとI/O APICを検出して初期化し、全IRQ
+ *              をマスクした状態でIRQ番号をベクタ番号に割り当てる。ISA IRQは
+ *              PICと同じベクタ番号を使用する。
+ *
+ * @return      処理結果を返す。
+ * @retval      CMN_SUCCESS 正常終了
+ * @retval      CMN_FAILURE 異常終了(APIC未検出)
+ */
+/******************************************************************************/
+CmnRet_t IntmngApicInit( void )
+{
+    CmnRet_t   ret;     /* 戻り値       */
+    uint32_t   eax;     /* CPUID結果EAX */
+    uint32_t   ebx;     /* CPUID結果EBX */
+    uint32_t   ecx;     /* CPUID結果ECX */
+    uint32_t   edx;     /* CPUID結果EDX */
+    AcpiMadt_t *pMadt;  /* MADT         */
+
+    /* 初期化 */
+    ret   = CMN_FAILURE;
+    eax   = 0;
+    ebx   = 0;
+    ecx   = 0;
+    edx   = 0;
+    pMadt = NULL;
+
+    DEBUG_LOG_TRC( "%s() start.", __func__ );
+
+    /* APIC管理テーブル初期化 */
+    MLibUtilSetMemory8( &gApicTbl, 0, sizeof ( gApicTbl ) );
+    gApicTbl.maskState = APIC_MASK_STATE_DISABLE;
+
+    /* CPUID取得 */
+    IA32InstructionCpuid( 1, &eax, &ebx, &ecx, &edx );
+
+    /* APIC実装判定 */
+    if ( ( edx & IA32_CPUID_1_EDX_APIC ) == 0 ) {
+        /* 未実装 */
+
+        DEBUG_LOG_TRC( "%s() end. no APIC.", __func__ );
+        return CMN_FAILURE;
+    }
+
+    /* MADT検索 */
+    pMadt = FindMadt();
+
+    /* 検索結果判定 */
+    if ( pMadt == NULL ) {
+        /* 失敗 */
+
+        DEBUG_LOG_TRC( "%s() end. no MADT.", __func__ );
+        return CMN_FAILURE;
+    }
+
+    /* I/O APIC初期化 */
+    ret = InitIoapic( pMadt );
+
+    /* 初期化結果判定 */
+    if ( ret != CMN_SUCCESS ) {
+        /* 失敗 */
+
+        DEBUG_LOG_TRC( "%s() end. ret=%d", __func__, ret );
+        return CMN_FAILURE;
+    }
+
+    /* ローカルAPIC初期化 */
+    ret = InitLapic( pMadt );
+
+    /* 初期化結果判定 */
+    if ( ret != CMN_SUCCESS ) {
+        /* 失敗 */
+
+        DEBUG_LOG_TRC( "%s() end. ret=%d", __func__, ret );
+        return CMN_FAILURE;
+    }
+
+    /* IRQ情報初期化 */
+    InitIrq( pMadt );
+
+    /* 割込み無効化 */
+    IntmngApicDisable();
+
+    /* スプリアス割込みハンドラ設定 */
+    IntmngHdlSet( INTMNG_SPURIOUS_VCTR, HdlSpurious, IA32_DESCRIPTOR_DPL_0 );
+
+    /* ローカルAPIC使用有無設定 */
+    gApicTbl.lapicEn = true;
+
+    DEBUG_LOG_INF(
+        "APIC: lapicId=%u ioapicNum=%u irqNum=%u",
+        gApicTbl.lapicId,
+        gApicTbl.ioapicNum,
+        gApicTbl.irqNum
+    );
+
+    DEBUG_LOG_TRC( "%s() end. ret=%d", __func__, CMN_SUCCESS );
+
+    return CMN_SUCCESS;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       APICレベルトリガ判定
+ * @details     指定したIRQ番号のリダイレクションエントリがレベルトリガか判定
+ *              する。
+ *
+ * @param[in]   irqNo IRQ番号
+ *
+ * @return      判定結果を返す。
+ * @retval      true  レベルトリガ
+ * @retval      false エッジトリガ
+ */
+/******************************************************************************/
+bool IntmngApicIsLevel( uint8_t irqNo )
+{
+    /* IRQ番号チェック */
+    if ( irqNo >= INTMNG_IRQ_NUM ) {
+        /* 範囲外 */
+
+        return false;
+    }
+
+    return ( gApicTbl.irq[ irqNo ].mode & APIC_IOAPIC_RTE_TRG_LEVEL ) != 0;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       ローカルAPICタイマカウント取得
+ * @details     ローカルAPICタイマの現在カウント値を取得する。
+ *
+ * @return      現在カウント値を返す。
+ */
+/******************************************************************************/
+uint32_t IntmngApicTimerGetCount( void )
+{
+    return LAPIC_REG( APIC_LAPIC_REG_TMR_CCR );
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       ローカルAPICタイマ初期化
+ * @details     ローカルAPICタイマを停止し、1分周・指定したモードで
+ *              INTMNG_LAPIC_TIMER_VCTRに割込みを発生するよう設定する。
+ *
+ * @param[in]   mode タイマモード
+ *                  - INTMNG_APIC_TIMER_ONESHOT  ワンショット
+ *                  - INTMNG_APIC_TIMER_DEADLINE TSCデッドライン
+ *
+ * @return      処理結果を返す。
+ * @retval      CMN_SUCCESS 正常終了
+ * @retval      CMN_FAILURE 異常終了(ローカルAPIC未使用)
+ */
+/******************************************************************************/
+CmnRet_t IntmngApicTimerInit( uint32_t mode )
+{
+    uint32_t lvt;   /* LVTタイマレジスタ値 */
+
+    /* 初期化 */
+    lvt = INTMNG_LAPIC_TIMER_VCTR;
+
+    /* ローカルAPIC使用有無判定 */
+    if ( gApicTbl.lapicEn == false ) {
+        /* 未使用 */
+
+        return CMN_FAILURE;
+    }
+
+    /* タイマモード判定 */
+    if ( mode == INTMNG_APIC_TIMER_DEADLINE ) {
+        /* TSCデッドライン */
+
+        lvt |= APIC_LAPIC_LVT_TMR_DEADLINE;
+
+    } else {
+        /* ワンショット */
+
+        lvt |= APIC_LAPIC_LVT_TMR_ONESHOT;
+    }
+
+    /* タイマ停止 */
+    LAPIC_REG( APIC_LAPIC_REG_TMR_ICR ) = 0;
+
+    /* タイマ設定 */
+    LAPIC_REG( APIC_LAPIC_REG_TMR_DCR ) = APIC_LAPIC_TMR_DCR_DIV1;
+    LAPIC_REG( APIC_LAPIC_REG_LVT_TMR ) = lvt;
+
+    return CMN_SUCCESS;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       ローカルAPICタイマ開始
+ * @details     ワンショットモードのローカルAPICタイマに初期カウント値を設定
+ *              してカウントを開始する。0を設定した場合はタイマを停止する。
+ *
+ * @param[in]   count 初期カウント値
+ */
+/******************************************************************************/
+void IntmngApicTimerStart( uint32_t count )
+{
+    /* 初期カウント設定 */
+    LAPIC_REG( APIC_LAPIC_REG_TMR_ICR ) = count;
+
+    return;
+}
+
+
+/******************************************************************************/
+/* ローカル関数定義                                                           */
+/******************************************************************************/
+/******************************************************************************/
+/**
+ * @brief       チェックサム計算
+ * @details     指定領域のバイト単位の総和を計算する。ACPIテーブルは総和が0と
+ *              なる。
+ *
+ * @param[in]   *pAddr 先頭アドレス
+ * @param[in]   size   サイズ
+ *
+ * @return      総和を返す。
+ */
+/******************************************************************************/
+static uint8_t CalcChecksum( void   *pAddr,
+                             size_t size    )
+{
+    size_t  idx;    /* インデックス */
+    uint8_t sum;    /* 総和         */
+
+    /* 初期化 */
+    sum = 0;
+
+    /* 1バイト毎に繰り返す */
+    for ( idx = 0; idx < size; idx++ ) {
+        /* 加算 */
+        sum += ( ( uint8_t * ) pAddr )[ idx ];
+    }
+
+    return sum;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       物理アドレス範囲チェック
+ * @details     指定した物理アドレス範囲がカーネル領域でストレートマッピング
+ *              されているかチェックする。
+ *
+ * @param[in]   addr 物理アドレス
+ * @param[in]   size サイズ
+ *
+ * @return      チェック結果を返す。
+ * @retval      true  参照可
+ * @retval      false 参照不可
+ */
+/******************************************************************************/
+static bool CheckAddr( uint32_t addr,
+                       size_t   size  )
+{
+    /* 範囲判定 */
+    if ( ( addr        >= MEMMAP_VADDR_USER ) ||
+         ( size        >  MEMMAP_VADDR_USER ) ||
+         ( addr + size >  MEMMAP_VADDR_USER )    ) {
+        /* 範囲外 */
+
+        return false;
+    }
+
+    return true;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       MADT検索
+ * @details     EBDA先頭1KiBとBIOS領域からRSDPを検索し、RSDTからMADTを検索す
+ *              る。
+ *
+ * @return      MADTを返す。
+ * @retval      NULL     未検出
+ * @retval      NULL以外 MADT
+ */
+/******************************************************************************/
+static AcpiMadt_t *FindMadt( void )
+{
+    int32_t      ret;       /* 比較結果     */
+    uint32_t     idx;       /* インデックス */
+    uint32_t     num;       /* エントリ数   */
+    uint32_t     ebda;      /* EBDAアドレス */
+    AcpiRsdp_t   *pRsdp;    /* RSDP         */
+    AcpiRsdt_t   *pRsdt;    /* RSDT         */
+    AcpiSdtHdr_t *pHdr;     /* テーブル     */
+
+    /* 初期化 */
+    ret   = 0;
+    idx   = 0;
+    num   = 0;
+    ebda  = ( ( uint32_t ) *( ( uint16_t * ) ACPI_RSDP_EBDA_SEG_ADDR ) ) << 4;
+    pRsdp = NULL;
+    pRsdt = NULL;
+    pHdr  = NULL;
+
+    /* EBDA有無判定 */
+    if ( ebda != 0 ) {
+        /* 有り */
+
+        /* EBDAからRSDP検索 */
+        pRsdp = FindRsdp( ebda, ACPI_RSDP_EBDA_SIZE );
+    }
+
+    /* 検索結果判定 */
+    if ( pRsdp == NULL ) {
+        /* 未検出 */
+
+        /* BIOS領域からRSDP検索 */
+        pRsdp = FindRsdp( ACPI_RSDP_BIOS_ADDR, ACPI_RSDP_BIOS_SIZE );
+
+        /* 検索結果判定 */
+        if ( pRsdp == NULL ) {
+            /* 未検出 */
+
+            return NULL;
+        }
+    }
+
+    /* RSDT取得 */
+    pRsdt = ( AcpiRsdt_t * ) pRsdp->rsdtAddr;
+
+    /* RSDTチェック */
+    if ( ( CheckAddr( ( uint32_t ) pRsdt, sizeof ( AcpiSdtHdr_t ) ) == false ) ||
+         ( CheckAddr( ( uint32_t ) pRsdt, pRsdt->header.length    ) == false ) ||
+         ( CalcChecksum( pRsdt, pRsdt->header.length ) != 0              )    ) {
+        /* 不正 */
+
+        return NULL;
+    }
+
+    /* エントリ数計算 */
+    num = ( pRsdt->header.length - sizeof ( AcpiSdtHdr_t ) ) /
+          sizeof ( uint32_t );
+
+    /* エントリ毎に繰り返す */
+    for ( idx = 0; idx < num; idx++ ) {
+        /* テーブル取得 */
+        pHdr = ( AcpiSdtHdr_t * ) pRsdt->entry[ idx ];
+
+        /* テーブルヘッダチェック */
+        if ( CheckAddr( ( uint32_t ) pHdr, sizeof ( AcpiSdtHdr_t ) ) == false ) {
+            /* 不正 */
+            continue;
+        }
+
+        /* シグネチャ比較 */
+        ret = MLibUtilCmpString( pHdr->signature,
+                                 ACPI_SIG_MADT,
+                                 sizeof ( pHdr->signature ) );
+
+        /* 比較結果判定 */
+        if ( ret != 0 ) {
+            /* 不一致 */
+            continue;
+        }
+
+        /* MADTチェック */
+        if ( ( pHdr->length < sizeof ( AcpiMadt_t )                 ) ||
+             ( CheckAddr( ( uint32_t ) pHdr, pHdr->length ) == false ) ||
+             ( CalcChecksum( pHdr, pHdr->length ) != 0              )    ) {
+            /* 不正 */
+            continue;
+        }
+
+        return ( AcpiMadt_t * ) pHdr;
+    }
+
+    return NULL;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       RSDP検索
+ * @details     指定範囲を16バイト境界毎に検索し、シグネチャとチェックサムが正
+ *              しいRSDPを検出する。
+ *
+ * @param[in]   addr 検索先頭物理アドレス
+ * @param[in]   size 検索サイズ
+ *
+ * @return      RSDPを返す。
+ * @retval      NULL     未検出
+ * @retval      NULL以外 RSDP
+ */
+/******************************************************************************/
+static AcpiRsdp_t *FindRsdp( uint32_t addr,
+                             size_t   size  )
+{
+    int32_t    ret;     /* 比較結果 */
+    size_t     offset;  /* オフセット */
+    AcpiRsdp_t *pRsdp;  /* RSDP     */
+
+    /* 初期化 */
+    ret   = 0;
+    pRsdp = NULL;
+
+    /* 16バイト境界毎に繰り返す */
+    for ( offset  = 0;
+          offset  < ( size - sizeof ( AcpiRsdp_t ) );
+          offset += ACPI_RSDP_ALIGN                   ) {
+        /* RSDP候補取得 */
+        pRsdp = ( AcpiRsdp_t * ) ( addr + offset );
+
+        /* シグネチャ比較 */
+        ret = MLibUtilCmpString( pRsdp->signature,
+                                 ACPI_SIG_RSDP,
+                                 sizeof ( pRsdp->signature ) );
+
+        /* 比較結果判定 */
+        if ( ( ret == 0                                           ) &&
+             ( CalcChecksum( pRsdp, sizeof ( AcpiRsdp_t ) ) == 0 )    ) {
+            /* 一致 */
+
+            return pRsdp;
+        }
+    }
+
+    return NULL;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       リダイレクションエントリモード取得
+ * @details     MPS INTIフラグをI/O APICリダイレクションエントリの極性とトリ
+ *              ガモードに変換する。バス規定の場合は指定した既定値を使用する。
+ *
+ * @param[in]   flags MPS INTIフラグ
+ * @param[in]   pol   既定極性
+ * @param[in]   trg   既定トリガモード
+ *
+ * @return      リダイレクションエントリモードを返す。
+ */
+/******************************************************************************/
+static uint32_t GetMode( uint16_t flags,
+                         uint32_t pol,
+                         uint32_t trg    )
+{
+    /* 極性判定 */
+    if ( ( flags & ACPI_MPS_INTI_POL_MASK ) == ACPI_MPS_INTI_POL_HIGH ) {
+        /* アクティブHigh */
+
+        pol = APIC_IOAPIC_RTE_POL_HIGH;
+
+    } else if ( ( flags & ACPI_MPS_INTI_POL_MASK ) == ACPI_MPS_INTI_POL_LOW ) {
+        /* アクティブLow */
+
+        pol = APIC_IOAPIC_RTE_POL_LOW;
+    }
+
+    /* トリガモード判定 */
+    if ( ( flags & ACPI_MPS_INTI_TRG_MASK ) == ACPI_MPS_INTI_TRG_EDGE ) {
+        /* エッジ */
+
+        trg = APIC_IOAPIC_RTE_TRG_EDGE;
+
+    } else if ( ( flags & ACPI_MPS_INTI_TRG_MASK ) == ACPI_MPS_INTI_TRG_LEVEL ) {
+        /* レベル */
+
+        trg = APIC_IOAPIC_RTE_TRG_LEVEL;
+    }
+
+    return pol | trg;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       スプリアス割込みハンドラ
+ * @details     ローカルAPICのスプリアス割込みを破棄する。スプリアス割込みは
+ *              EOI通知不要である。
+ *
+ * @param[in]   intNo     割込み番号
+ * @param[in]   *pContext 割込み発生時コンテキスト
+ */
+/******************************************************************************/
+static void HdlSpurious( uint32_t         intNo,
+                         IntmngContext_t *pContext )
+{
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       I/O APIC初期化
+ * @details     MADTのI/O APICエントリ毎にレジスタをマッピングし、全ピンを
+ *              マスクする。
+ *
+ * @param[in]   *pMadt MADT
+ *
+ * @return      処理結果を返す。
+ * @retval      CMN_SUCCESS 正常終了
+ * @retval      CMN_FAILURE 異常終了
+ */
+/******************************************************************************/
+static CmnRet_t InitIoapic( AcpiMadt_t *pMadt )
+{
+    CmnRet_t         ret;       /* 戻り値               */
+    uint32_t         idx;       /* I/O APICインデックス */
+    uint32_t         pin;       /* ピン番号             */
+    uint32_t         offset;    /* エントリオフセット   */
+    uint32_t         length;    /* エントリ領域長       */
+    AcpiMadtHdr_t    *pEntry;   /* エントリ             */
+    AcpiMadtIoapic_t *pIoapic;  /* I/O APICエントリ     */
+
+    /* 初期化 */
+    ret     = CMN_FAILURE;
+    idx     = 0;
+    pin     = 0;
+    offset  = 0;
+    length  = pMadt->header.length - sizeof ( AcpiMadt_t );
+    pEntry  = NULL;
+    pIoapic = NULL;
+
+    /* エントリ毎に繰り返す */
+    while ( ( offset + sizeof ( AcpiMadtHdr_t ) ) <= length ) {
+        /* エントリ取得 */
+        pEntry = ( AcpiMadtHdr_t * ) &( pMadt->entry[ offset ] );
+
+        /* エントリ長チェック */
+        if ( ( pEntry->length < sizeof ( AcpiMadtHdr_t ) ) ||
+             ( ( offset + pEntry->length ) > length     )    ) {
+            /* 不正 */
+
+            break;
+        }
+
+        /* 次エントリ設定 */
+        offset += pEntry->length;
+
+        /* エントリ判定 */
+        if ( ( pEntry->type   != ACPI_MADT_TYPE_IOAPIC        ) ||
+             ( pEntry->length <  sizeof ( AcpiMadtIoapic_t ) ) ||
+             ( gApicTbl.ioapicNum >= IOAPIC_NUM_MAX          )    ) {
+            /* 対象外 */
+            continue;
+        }
+
+        /* I/O APICエントリ取得 */
+        pIoapic = ( AcpiMadtIoapic_t * ) pEntry;
+        idx     = gApicTbl.ioapicNum;
+
+        /* I/O APICレジスタマッピング */
+        ret = MemmngPageSet(
+                  MEMMNG_PAGE_DIR_ID_IDLE,
+                  ( void * ) IOAPIC_VADDR( idx ),
+                  ( void * ) ( pIoapic->ioapicAddr & IA32_APIC_BASE_ADDR ),
+                  APIC_IOAPIC_SIZE,
+                  MEMMNG_PAGE_ALLOC_PHYS_FALSE,
+                  IA32_PAGING_G_YES,
+                  IA32_PAGING_US_SV,
+                  IA32_PAGING_RW_RW
+              );
+
+        /* マッピング結果判定 */
+        if ( ret != CMN_SUCCESS ) {
+            /* 失敗 */
+
+            continue;
+        }
+
+        /* I/O APIC情報設定 */
+        gApicTbl.ioapic[ idx ].addr    =
+            IOAPIC_VADDR( idx ) +
+            ( pIoapic->ioapicAddr & ~IA32_APIC_BASE_ADDR );
+        gApicTbl.ioapic[ idx ].gsiBase = pIoapic->gsiBase;
+        gApicTbl.ioapic[ idx ].pinNum  =
+            APIC_IOAPIC_VER_MRE( ReadIoapic( idx, APIC_IOAPIC_REG_VER ) ) + 1;
+        gApicTbl.ioapicNum++;
+
+        /* ピン毎に繰り返す */
+        for ( pin = 0; pin < gApicTbl.ioapic[ idx ].pinNum; pin++ ) {
+            /* ピンマスク */
+            WriteIoapic( idx,
+                         APIC_IOAPIC_REDTBL_LOW( pin ),
+                         APIC_IOAPIC_RTE_MASK           );
+        }
+    }
+
+    /* I/O APIC数判定 */
+    if ( gApicTbl.ioapicNum == 0 ) {
+        /* I/O APIC無し */
+
+        return CMN_FAILURE;
+    }
+
+    return CMN_SUCCESS;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       IRQ情報初期化
+ * @details     MADTの割込みソース上書きエントリを反映してIRQ番号をI/O APICの
+ *              ピンに割り当てる。ISA IRQは既定でアクティブHigh・エッジトリガ、
+ *              IRQ16以降はGSI番号と同じピンにアクティブLow・レベルトリガで割
+ *              り当てる。他のISA IRQに上書きされたGSIは割り当てない。
+ *
+ * @param[in]   *pMadt MADT
+ */
+/******************************************************************************/
+static void InitIrq( AcpiMadt_t *pMadt )
+{
+    bool          isaIso[ INTMNG_IRQ_ISA_NUM ];     /* ISA IRQ毎上書き有無 */
+    uint16_t      isaFlags[ INTMNG_IRQ_ISA_NUM ];   /* ISA IRQ毎フラグ     */
+    uint32_t      isaGsi[ INTMNG_IRQ_ISA_NUM ];     /* ISA IRQ毎GSI        */
+    uint32_t      idx;                              /* インデックス        */
+    uint32_t      irqNo;                            /* IRQ番号             */
+    uint32_t      gsi;                              /* GSI                 */
+    uint32_t      mode;                             /* モード              */
+    uint32_t      offset;                           /* エントリオフセット  */
+    uint32_t      length;                           /* エントリ領域長      */
+    AcpiMadtHdr_t *pEntry;                          /* エントリ            */
+    AcpiMadtIso_t *pIso;                            /* 上書きエントリ      */
+
+    /* 初期化 */
+    idx    = 0;
+    gsi    = 0;
+    mode   = 0;
+    offset = 0;
+    length = pMadt->header.length - sizeof ( AcpiMadt_t );
+    pEntry = NULL;
+    pIso   = NULL;
+
+    /* ISA IRQ毎に繰り返す */
+    for ( irqNo = 0; irqNo < INTMNG_IRQ_ISA_NUM; irqNo++ ) {
+        /* 恒等割当て */
+        isaIso[ irqNo ]   = false;
+        isaFlags[ irqNo ] = ACPI_MPS_INTI_POL_BUS | ACPI_MPS_INTI_TRG_BUS;
+        isaGsi[ irqNo ]   = irqNo;
+    }
+
+    /* エントリ毎に繰り返す */
+    while ( ( offset + sizeof ( AcpiMadtHdr_t ) ) <= length ) {
+        /* エントリ取得 */
+        pEntry = ( AcpiMadtHdr_t * ) &( pMadt->entry[ offset ] );
+
+        /* エントリ長チェック */
+        if ( ( pEntry->length < sizeof ( AcpiMadtHdr_t ) ) ||
+             ( ( offset + pEntry->length ) > length     )    ) {
+            /* 不正 */
+
+            break;
+        }
+
+        /* 次エントリ設定 */
+        offset += pEntry->length;
+
+        /* エントリ判定 */
+        if ( ( pEntry->type   != ACPI_MADT_TYPE_ISO        ) ||
+             ( pEntry->length <  sizeof ( AcpiMadtIso_t ) )    ) {
+            /* 対象外 */
+            continue;
+        }
+
+        /* 上書きエントリ取得 */
+        pIso = ( AcpiMadtIso_t * ) pEntry;
+
+        /* ISA IRQ判定 */
+        if ( ( pIso->bus    == 0                  ) &&
+             ( pIso->source <  INTMNG_IRQ_ISA_NUM )    ) {
+            /* ISA IRQ */
+
+            isaIso[ pIso->source ]   = true;
+            isaFlags[ pIso->source ] = pIso->flags;
+            isaGsi[ pIso->source ]   = pIso->gsi;
+        }
+    }
+
+    /* IRQ毎に繰り返す */
+    for ( irqNo = 0; irqNo < INTMNG_IRQ_NUM; irqNo++ ) {
+        /* ISA IRQ判定 */
+        if ( irqNo < INTMNG_IRQ_ISA_NUM ) {
+            /* ISA IRQ */
+
+            gsi  = isaGsi[ irqNo ];
+            mode = GetMode( isaFlags[ irqNo ],
+                            APIC_IOAPIC_RTE_POL_HIGH,
+                            APIC_IOAPIC_RTE_TRG_EDGE  );
+
+        } else {
+            /* PCI IRQ */
+
+            gsi  = irqNo;
+            mode = APIC_IOAPIC_RTE_POL_LOW | APIC_IOAPIC_RTE_TRG_LEVEL;
+        }
+
+        /* GSI重複チェック */
+        for ( idx = 0; idx < INTMNG_IRQ_ISA_NUM; idx++ ) {
+            /* 他IRQ上書き判定 */
+            if ( ( idx           != irqNo                 ) &&
+                 ( isaGsi[ idx ] == gsi                   ) &&
+                 ( ( isaIso[ idx ]             == true ) ||
+                   ( irqNo >= INTMNG_IRQ_ISA_NUM       )    )    ) {
+                /* 他IRQに割当て済 */
+
+                break;
+            }
+        }
+
+        /* 重複判定 */
+        if ( idx < INTMNG_IRQ_ISA_NUM ) {
+            /* 重複 */
+            continue;
+        }
+
+        /* I/O APIC毎に繰り返す */
+        for ( idx = 0; idx < gApicTbl.ioapicNum; idx++ ) {
+            /* GSI範囲判定 */
+            if ( ( gsi >= gApicTbl.ioapic[ idx ].gsiBase ) &&
+                 ( gsi <  ( gApicTbl.ioapic[ idx ].gsiBase +
+                            gApicTbl.ioapic[ idx ].pinNum    ) ) ) {
+                /* 範囲内 */
+
+                /* IRQ情報設定 */
+                gApicTbl.irq[ irqNo ].valid     = true;
+                gApicTbl.irq[ irqNo ].ioapicIdx = idx;
+                gApicTbl.irq[ irqNo ].pin       =
+                    gsi - gApicTbl.ioapic[ idx ].gsiBase;
+                gApicTbl.irq[ irqNo ].mode      = mode;
+
+                /* IRQ数更新 */
+                gApicTbl.irqNum = irqNo + 1;
+
+                break;
+            }
+        }
+    }
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       ローカルAPIC初期化
+ * @details     ローカルAPICレジスタをマッピングしてソフトウェア有効化し、
+ *              LINT0・タイマ・エラーのLVTをマスクする。LINT1はNMIとする。
+ *
+ * @param[in]   *pMadt MADT
+ *
+ * @return      処理結果を返す。
+ * @retval      CMN_SUCCESS 正常終了
+ * @retval      CMN_FAILURE 異常終了
+ */
+/******************************************************************************/
+static CmnRet_t InitLapic( AcpiMadt_t *pMadt )
+{
+    CmnRet_t ret;   /* 戻り値          */
+    uint64_t base;  /* APICベースMSR値 */
+
+    /* 初期化 */
+    ret  = CMN_FAILURE;
+    base = IA32InstructionRdmsr( IA32_MSR_APIC_BASE );
+
+    /* ローカルAPICレジスタマッピング */
+    ret = MemmngPageSet( MEMMNG_PAGE_DIR_ID_IDLE,
+                         ( void * ) LAPIC_VADDR,
+                         ( void * ) ( pMadt->lapicAddr & IA32_APIC_BASE_ADDR ),
+                         APIC_LAPIC_SIZE,
+                         MEMMNG_PAGE_ALLOC_PHYS_FALSE,
+                         IA32_PAGING_G_YES,
+                         IA32_PAGING_US_SV,
+                         IA32_PAGING_RW_RW                                      );
+
+    /* マッピング結果判定 */
+    if ( ret != CMN_SUCCESS ) {
+        /* 失敗 */
+
+        return CMN_FAILURE;
+    }
+
+    /* ローカルAPICハードウェア有効化 */
+    IA32InstructionWrmsr( IA32_MSR_APIC_BASE, base | IA32_APIC_BASE_EN );
+
+    /* ローカルAPIC ID取得 */
+    gApicTbl.lapicId = LAPIC_REG( APIC_LAPIC_REG_ID ) >> APIC_LAPIC_ID_SHIFT;
+
+    /* LVT設定 */
+    LAPIC_REG( APIC_LAPIC_REG_LVT_TMR ) = APIC_LAPIC_LVT_MASK;
+    LAPIC_REG( APIC_LAPIC_REG_LVT_LI0 ) = APIC_LAPIC_LVT_MASK;
+    LAPIC_REG( APIC_LAPIC_REG_LVT_LI1 ) = APIC_LAPIC_LVT_DM_NMI;
+    LAPIC_REG( APIC_LAPIC_REG_LVT_ERR ) = APIC_LAPIC_LVT_MASK;
+
+    /* タスク優先度設定 */
+    LAPIC_REG( APIC_LAPIC_REG_TPR ) = 0;
+
+    /* ローカルAPICソフトウェア有効化 */
+    LAPIC_REG( APIC_LAPIC_REG_SVR ) = APIC_LAPIC_SVR_EN | INTMNG_SPURIOUS_VCTR;
+
+    /* 未処理割込みEOI通知 */
+    IntmngApicEoi();
+
+    return CMN_SUCCESS;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       I/O APICレジスタ読込み
+ * @details     指定したI/O APICのレジスタを読み込む。
+ *
+ * @param[in]   idx I/O APICインデックス
+ * @param[in]   reg レジスタ番号
+ *
+ * @return      レジスタ値を返す。
+ */
+/******************************************************************************/
+static uint32_t ReadIoapic( uint32_t idx,
+                            uint32_t reg  )
+{
+    volatile uint32_t *pRegSel; /* レジスタ選択レジスタ */
+    volatile uint32_t *pWin;    /* データレジスタ       */
+
+    /* 初期化 */
+    pRegSel = ( volatile uint32_t * )
+              ( gApicTbl.ioapic[ idx ].addr + APIC_IOAPIC_IOREGSEL );
+    pWin    = ( volatile uint32_t * )
+              ( gApicTbl.ioapic[ idx ].addr + APIC_IOAPIC_IOWIN    );
+
+    /* レジスタ選択 */
+    *pRegSel = reg;
+
+    return *pWin;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       リダイレクションエントリ設定
+ * @details     IRQのリダイレクションエントリを設定する。割込み無効状態、非許
+ *              可IRQ、処理委譲中IRQはマスクする。
+ *
+ * @param[in]   irqNo IRQ番号
+ */
+/******************************************************************************/
+static void SetRte( uint8_t irqNo )
+{
+    uint32_t  low;      /* 下位レジスタ値 */
+    irqInfo_t *pIrq;    /* IRQ情報        */
+
+    /* 初期化 */
+    pIrq = &( gApicTbl.irq[ irqNo ] );
+
+    /* 有効判定 */
+    if ( pIrq->valid == false ) {
+        /* 無効 */
+
+        return;
+    }
+
+    /* 下位レジスタ値設定 */
+    low = INTMNG_IRQ_TO_INTNO( irqNo ) |
+          APIC_IOAPIC_RTE_DM_FIXED     |
+          APIC_IOAPIC_RTE_DST_PHYS     |
+          pIrq->mode;
+
+    /* マスク判定 */
+    if ( ( gApicTbl.maskState == APIC_MASK_STATE_DISABLE ) ||
+         ( ( gApicTbl.allow & IRQ_BIT( irqNo ) ) == 0   ) ||
+         ( ( gApicTbl.defer & IRQ_BIT( irqNo ) ) != 0   )    ) {
+        /* マスク */
+
+        low |= APIC_IOAPIC_RTE_MASK;
+    }
+
+    /* 上位レジスタ設定 */
+    WriteIoapic( pIrq->ioapicIdx,
+                 APIC_IOAPIC_REDTBL_HIGH( pIrq->pin ),
+                 gApicTbl.lapicId << APIC_IOAPIC_RTE_DST_SHIFT );
+
+    /* 下位レジスタ設定 */
+    WriteIoapic( pIrq->ioapicIdx,
+                 APIC_IOAPIC_REDTBL_LOW( pIrq->pin ),
+                 low                                  );
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       I/O APICレジスタ書込み
+ * @details     指定したI/O APICのレジスタに書き込む。
+ *
+ * @param[in]   idx   I/O APICインデックス
+ * @param[in]   reg   レジスタ番号
+ * @param[in]   value 書込み値
+ */
+/******************************************************************************/
+static void WriteIoapic( uint32_t idx,
+                         uint32_t reg,
+                         uint32_t value )
+{
+    volatile uint32_t *pRegSel; /* レジスタ選択レジスタ */
+    volatile uint32_t *pWin;    /* データレジスタ       */
+
+    /* 初期化 */
+    pRegSel = ( volatile uint32_t * )
+              ( gApicTbl.ioapic[ idx ].addr + APIC_IOAPIC_IOREGSEL );
+    pWin    = ( volatile uint32_t * )
+              ( gApicTbl.ioapic[ idx ].addr + APIC_IOAPIC_IOWIN    );
+
+    /* レジスタ選択 */
+    *pRegSel = reg;
+
+    /* 書込み */
+    *pWin = value;
+
+    return;
+}
+
+
+/******************************************************************************/
@@ -0,0 +1,53 @@
+/******************************************************************************/
+/*                                                                            */
+/* src/kernel/Intmng/IntmngApic.h                                             */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2026 Mochi.                                                  */
+/*                                                                            */
+/******************************************************************************/
+#ifndef INTMNG_APIC_H
+#define INTMNG_APIC_H
+/******************************************************************************/
+/* インクルード                                                               */
+/******************************************************************************/
+/* 標準ヘッダ */
+#include <stdbool.h>
+#include <stdint.h>
+
+/* 外部モジュールヘッダ */
+#include <Cmn.h>
+
+
+/******************************************************************************/
+/* グローバル関数宣言                                                         */
+/******************************************************************************/
+/* APIC割込み許可 */
+extern void IntmngApicAllowIrq( uint8_t irqNo );
+
+/* APIC割込み処理完了 */
+extern void IntmngApicComplete( uint8_t irqNo );
+
+/* APIC割込み処理委譲 */
+extern void IntmngApicDefer( uint8_t irqNo );
+
+/* APIC割込み拒否 */
+extern void IntmngApicDenyIrq( uint8_t irqNo );
+
+/* APIC割込み無効化 */
+extern void IntmngApicDisable( void );
+
+/* APIC割込み有効化 */
+extern void IntmngApicEnable( void );
+
+/* APIC IRQ数取得 */
+extern uint8_t IntmngApicGetIrqNum( void );
+
+/* APIC管理初期化 */
+extern CmnRet_t IntmngApicInit( void );
+
+/* APICレベルトリガ判定 */
+extern bool IntmngApicIsLevel( uint8_t irqNo );
+
+
+/******************************************************************************/
+#endif
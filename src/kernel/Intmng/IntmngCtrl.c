@@ -1,8 +1,8 @@
 /******************************************************************************/
 /*                                                                            */
 /* src/kernel/IntmngCtrl/IntmngCtrl.c                                         */
-/*                                                                 2024/06/18 */
-/* Copyright (C) 2018-2024 Mochi.                                             */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2018-2026 Mochi.                                             */
 /*                                                                            */
 /******************************************************************************/
 /******************************************************************************/
@@ -10,11 +10,20 @@
 /******************************************************************************/
 /* 標準ヘッダ */
 #include <stdbool.h>
+#include <stdint.h>
+
+/* ライブラリヘッダ */
+#include <MLib/MLib.h>
+#include <MLib/MLibUtil.h>
 
 /* カーネルヘッダ */
+#include <kernel/config.h>
 #include <kernel/interrupt.h>
+#include <kernel/sharedpage.h>
+#include <kernel/syscall.h>
 
 /* 共通ヘッダ */
+#include <memmap.h>
 #include <hardware/IA32/IA32Instruction.h>
 #include <hardware/I8259A/I8259A.h>
 
@@ -22,9 +31,13 @@
 #include <Cmn.h>
 #include <Debug.h>
 #include <Intmng.h>
+#include <Itcctrl.h>
+#include <Memmng.h>
 #include <Taskmng.h>
+#include <Timermng.h>
 
 /* 内部モジュールヘッダ */
+#include "IntmngStat.h"
 
 
 /******************************************************************************/
@@ -33,24 +46,59 @@
 /* モジュールID */
 #define _MODULE_ID_ CMN_MODULE_INTMNG_CTRL
 
-/** 割込み待ち情報エントリ数 */
-#define WAITINFO_ENTRY_NUM I8259A_IRQ_NUM
+/** 割込み待ち情報エントリ数(共有ページ割込み状態と1対1) */
+#define WAITINFO_ENTRY_NUM ( MK_SHAREDPAGE_INT_NUM )
+
+/** 割込み待ち情報ビット */
+#define WAITINFO_BIT( _IDX ) ( 0x00000001u << ( _IDX ) )
 
 /* 割込み待ち状態 */
 #define STATE_INIT ( 0 )    /**< 初期状態       */
 #define STATE_WAIT ( 1 )    /**< 割込み待ち状態 */
 
+/** 割込み発生情報格納先アドレス最大 */
+#define INFO_ADDR_MAX                                  \
+    ( MEMMAP_VADDR_USER_SHARED -                       \
+      sizeof ( MkIntInfo_t ) * MK_INT_IRQ_NUM        )
+
+/** 確認済み発生回数格納先アドレス最大 */
+#define SEEN_ADDR_MAX                                  \
+    ( MEMMAP_VADDR_USER_SHARED -                       \
+      sizeof ( uint32_t ) * MK_INT_IRQ_NUM           )
+
+/** 合体タイマ引数作成 */
+#define TIMER_ARG( _IDX, _IRQNO )                                   \
+    ( ( void * ) ( ( _IDX ) * INTMNG_IRQ_NUM + ( _IRQNO ) ) )
+
+/** IRQ毎割込み発生情報型 */
+typedef struct {
+    uint32_t count;         /**< 割込み発生回数     */
+    uint32_t timerId;       /**< 合体タイマID       */
+    uint64_t firstTsc;      /**< 初回割込み発生TSC  */
+    uint64_t lastTsc;       /**< 最終割込み発生TSC  */
+    uint32_t coalesceNum;   /**< 合体割込み回数     */
+    uint32_t coalesceUsec;  /**< 合体待ち時間[us]   */
+} IrqInfo_t;
+
 /** 割込み監視情報型 */
 typedef struct {
-    uint32_t waitInfoIdx[ I8259A_IRQ_NUM ];  /**< 割込み待ち情報インデックス */
+    uint32_t subscriber;    /**< 監視中割込み待ち情報         */
+    uint32_t pending;       /**< 処理完了待ち割込み待ち情報   */
+    uint32_t enable;        /**< 割込み有効化済割込み待ち情報 */
 } MonitoringInfo_t;
 
 /** 割込み待ち情報型 */
 typedef struct {
-    MkTaskId_t taskId;      /**< タスクID         */
-    uint8_t    monitor;     /**< 監視中IRQ        */
-    uint8_t    flag;        /**< 割込み発生フラグ */
-    uint32_t   state;       /**< 割込み待ち状態   */
+    MkTaskId_t taskId;                      /**< タスクID            */
+    uint32_t   monitor;                     /**< 監視中IRQ           */
+    uint32_t   flag;                        /**< 割込み発生フラグ    */
+    uint32_t   state;                       /**< 割込み待ち状態      */
+    IrqInfo_t  irqInfo[ INTMNG_IRQ_NUM ];   /**< IRQ毎割込み発生情報 */
+#ifdef INTMNG_STAT_ENABLE
+    uint8_t    wakeIrqNo;                   /**< 待ち解除IRQ番号     */
+    uint64_t   irqTsc;                      /**< 割込み発生時TSC値   */
+    uint64_t   wakeTsc;                     /**< 待ち解除時TSC値     */
+#endif
 } WaitInfo_t;
 
 
@@ -82,11 +130,40 @@ static uint32_t getWaitInfoIdx( MkTaskId_t taskId );
 
 /* ソフトウェア割込みハンドラ */
 static void HdlSwInt( uint32_t        intNo,
-                      IntmngContext_t context );
+                      IntmngContext_t *pContext );
 
 /* ハードウェア割込みハンドラ */
 static void HdlHwInt( uint32_t        intNo,
-                      IntmngContext_t context );
+                      IntmngContext_t *pContext );
+
+/* システムコールハンドラ */
+static void HdlSys( uint32_t     no,
+                    IA32Pushad_t *pReg );
+
+/* 割込み合体タイマ満了 */
+static void HdlTimeout( uint32_t timerId,
+                        void     *pArg    );
+
+/* 割込み待ち合わせ解除 */
+static void Notify( uint8_t  irqNo,
+                    uint32_t idx    );
+
+/* 割込み発生記録 */
+static void Record( uint8_t  irqNo,
+                    uint32_t idx,
+                    uint64_t tsc    );
+
+/* 割込み処理完了待ち解除 */
+static void Release( uint8_t  irqNo,
+                     uint32_t mask   );
+
+/* IRQ毎割込み発生情報初期化 */
+static void ResetIrqInfo( uint8_t  irqNo,
+                          uint32_t idx    );
+
+/* ハードウェア割込み合体設定 */
+static void SetCoalesce( MkTaskId_t   taskId,
+                         MkIntParam_t *pParam );
 
 /* ハードウェア割込み監視開始 */
 static void StartMonitoring( MkTaskId_t   taskId,
@@ -105,11 +182,14 @@ static void Wait( MkTaskId_t   taskId,
 /* 変数定義                                                                   */
 /******************************************************************************/
 /** 割込み監視情報 */
-static volatile MonitoringInfo_t gMonitoringInfo;
+static volatile MonitoringInfo_t gMonitoringInfo[ INTMNG_IRQ_NUM ];
 
 /** 割込み待ち情報 */
 static volatile WaitInfo_t gWaitInfo[ WAITINFO_ENTRY_NUM ];
 
+/** タスク毎割込み待ち情報インデックス */
+static volatile uint8_t gTaskIdx[ MK_TASKID_NUM ];
+
 
 /******************************************************************************/
 /* グローバル関数定義                                                         */
@@ -131,34 +211,32 @@ static volatile WaitInfo_t gWaitInfo[ WAITINFO_ENTRY_NUM ];
 static uint32_t AllocWaitInfo( MkTaskId_t taskId )
 {
     uint32_t idx;   /* 割込み待ち情報インデックス */
-    uint32_t free;  /* 空きエントリインデックス   */
 
-    /* 初期化 */
-    free = WAITINFO_ENTRY_NUM;
+    /* 割込み待ち情報インデックス取得 */
+    idx = getWaitInfoIdx( taskId );
 
-    /* 割込み待ち情報エントリ毎に繰り返し */
-    for ( idx = 0; idx < WAITINFO_ENTRY_NUM; idx++ ) {
-        /* タスクID判定 */
-        if ( gWaitInfo[ idx ].taskId == taskId ) {
-            /* 一致 */
+    /* 割当て済み判定 */
+    if ( idx != WAITINFO_ENTRY_NUM ) {
+        /* 割当て済み */
 
-            return idx;
+        return idx;
+    }
 
-        } else if ( gWaitInfo[ idx ].taskId == MK_TASKID_NULL ) {
+    /* 割込み待ち情報エントリ毎に繰り返し */
+    for ( idx = 0; idx < WAITINFO_ENTRY_NUM; idx++ ) {
+        /* 空きエントリ判定 */
+        if ( gWaitInfo[ idx ].taskId == MK_TASKID_NULL ) {
             /* 空きエントリ */
 
-            free = idx;
-        }
-    }
-
-    /* 空きエントリ有無判定 */
-    if ( free != WAITINFO_ENTRY_NUM ) {
-        /* 空きエントリ有り */
+            /* 割当て */
+            gWaitInfo[ idx ].taskId = taskId;
+            gTaskIdx[ taskId ]      = idx;
 
-        /* 割当て */
-        gWaitInfo[ free ].taskId = taskId;
+            /* 共有ページ割込み状態割当て */
+            MemmngShareSetInt( idx, taskId );
 
-        return free;
+            return idx;
+        }
     }
 
     return WAITINFO_ENTRY_NUM;
@@ -169,18 +247,21 @@ static uint32_t AllocWaitInfo( MkTaskId_t taskId )
 /**
  * @brief       ハードウェア割込み制御初期化
  * @details     管理データの初期化、カーネルコール用とハードウェア用の割込みハ
- *              ンドラを設定する。
+ *              ンドラ、およびシステムコールハンドラを設定する。
  */
 /******************************************************************************/
 void IntmngCtrlInit( void )
 {
     uint32_t i;
+    uint32_t j;
 
     DEBUG_LOG_TRC( "%s() start.", __func__ );
 
     /* 割込み監視情報初期化 */
-    for ( i = 0; i < I8259A_IRQ_NUM; i++ ) {
-        gMonitoringInfo.waitInfoIdx[ i ] = WAITINFO_ENTRY_NUM;
+    for ( i = 0; i < INTMNG_IRQ_NUM; i++ ) {
+        gMonitoringInfo[ i ].subscriber = 0;
+        gMonitoringInfo[ i ].pending    = 0;
+        gMonitoringInfo[ i ].enable     = 0;
     }
 
     /* 割込み待ち情報初期化 */
@@ -189,6 +270,20 @@ void IntmngCtrlInit( void )
         gWaitInfo[ i ].monitor = 0;
         gWaitInfo[ i ].flag    = 0;
         gWaitInfo[ i ].state   = STATE_INIT;
+#ifdef INTMNG_STAT_ENABLE
+        gWaitInfo[ i ].wakeTsc = 0;
+#endif
+
+        /* IRQ毎割込み発生情報初期化 */
+        for ( j = 0; j < INTMNG_IRQ_NUM; j++ ) {
+            gWaitInfo[ i ].irqInfo[ j ].timerId = TIMERMNG_TIMERID_NULL;
+            ResetIrqInfo( j, i );
+        }
+    }
+
+    /* タスク毎割込み待ち情報インデックス初期化 */
+    for ( i = 0; i < MK_TASKID_NUM; i++ ) {
+        gTaskIdx[ i ] = WAITINFO_ENTRY_NUM;
     }
 
     /* ソフトウェア割込みハンドラ設定 */
@@ -209,12 +304,51 @@ void IntmngCtrlInit( void )
     IntmngHdlSet( INTMNG_PIC_VCTR_BASE + I8259A_IRQ14, &HdlHwInt, IA32_DESCRIPTOR_DPL_0 );
     IntmngHdlSet( INTMNG_PIC_VCTR_BASE + I8259A_IRQ15, &HdlHwInt, IA32_DESCRIPTOR_DPL_0 );
 
+    /* 拡張ハードウェア割込みハンドラ設定 */
+    for ( i = INTMNG_IRQ_ISA_NUM; i < INTMNG_IRQ_NUM; i++ ) {
+        IntmngHdlSet( INTMNG_IRQ_TO_INTNO( i ), &HdlHwInt, IA32_DESCRIPTOR_DPL_0 );
+    }
+
+    /* システムコールハンドラ設定 */
+    IntmngSysSet( MK_SYSCALL_INT_COMPLETE, HdlSys );
+
     DEBUG_LOG_TRC( "%s() end.", __func__ );
 
     return;
 }
 
 
+/******************************************************************************/
+/**
+ * @brief       割込み発生IRQリスト取得
+ * @details     指定したタスクが監視中のIRQで発生済みのハードウェア割込みのIRQ
+ *              リストを取得する。割込み発生フラグはクリアしない。
+ *
+ * @param[in]   taskId タスクID
+ *
+ * @return      割込み発生IRQリストを返す。
+ * @retval      0     割込み未発生または監視無し
+ * @retval      0以外 割込み発生IRQリスト
+ */
+/******************************************************************************/
+uint32_t IntmngCtrlGetIntList( MkTaskId_t taskId )
+{
+    uint32_t idx;   /* 割込み待ち情報インデックス */
+
+    /* 割込み待ち情報インデックス取得 */
+    idx = getWaitInfoIdx( taskId );
+
+    /* 取得結果判定 */
+    if ( idx == WAITINFO_ENTRY_NUM ) {
+        /* 該当エントリ無し */
+
+        return 0;
+    }
+
+    return gWaitInfo[ idx ].flag;
+}
+
+
 /******************************************************************************/
 /* ローカル関数定義                                                           */
 /******************************************************************************/
@@ -241,19 +375,26 @@ static bool CheckAuthority( MkTaskId_t taskId,
 {
     uint32_t idx;   /* 割込み待ち情報インデックス */
 
+    /* IRQ番号チェック */
+    if ( irqNo >= INTMNG_IRQ_NUM ) {
+        /* 範囲外 */
+
+        return false;
+    }
+
     /* 割込み待ち情報インデックス取得 */
-    idx = gMonitoringInfo.waitInfoIdx[ irqNo ];
+    idx = getWaitInfoIdx( taskId );
 
     /* 割込み待ち情報エントリ有無判定 */
     if ( idx == WAITINFO_ENTRY_NUM ) {
-        /* エントリ無(非監視中) */
+        /* エントリ無 */
 
         return false;
     }
 
-    /* 割込み監視開始タスクIDチェック */
-    if ( gWaitInfo[ idx ].taskId != taskId ) {
-        /* タスクID不一致 */
+    /* 割込み監視判定 */
+    if ( ( gMonitoringInfo[ irqNo ].subscriber & WAITINFO_BIT( idx ) ) == 0 ) {
+        /* 非監視中 */
 
         return false;
     }
@@ -272,7 +413,9 @@ static bool CheckAuthority( MkTaskId_t taskId,
 /******************************************************************************/
 /**
  * @brief       ハードウェア割込み処理完了
- * @details     EOI通知を行い、次の割込みを可能にする。
+ * @details     割込みを監視している全タスクが処理完了するか、いずれかのタスク
+ *              が割込みを自デバイスのものとして処理完了(クレーム)した場合に、
+ *              割込みコントローラに処理完了を通知し、次の割込みを可能にする。
  *
  * @param[in]   taskId  タスクID
  * @param[in]   *pParam パラメータ
@@ -281,10 +424,11 @@ static bool CheckAuthority( MkTaskId_t taskId,
 static void Complete( MkTaskId_t   taskId,
                       MkIntParam_t *pParam )
 {
-    bool authority;     /* 制御権限 */
+    bool     authority;     /* 制御権限                   */
+    uint32_t idx;           /* 割込み待ち情報インデックス */
 
     /* 制御権限チェック */
-    authority = CheckAuthority( taskId, pParam->irqNo, NULL );
+    authority = CheckAuthority( taskId, pParam->irqNo, &idx );
 
     /* 制御権限チェック結果判定 */
     if ( authority == false ) {
@@ -304,8 +448,19 @@ static void Complete( MkTaskId_t   taskId,
         return;
     }
 
-    /* EOI通知 */
-    IntmngPicEoi( pParam->irqNo );
+    /* クレーム判定 */
+    if ( pParam->funcId == MK_INT_FUNCID_CLAIM ) {
+        /* クレーム */
+
+        /* 全タスク処理完了待ち解除 */
+        Release( pParam->irqNo, gMonitoringInfo[ pParam->irqNo ].pending );
+
+    } else {
+        /* 処理完了 */
+
+        /* 処理完了待ち解除 */
+        Release( pParam->irqNo, WAITINFO_BIT( idx ) );
+    }
 
     /* 戻り値設定 */
     pParam->ret = MK_RET_SUCCESS;
@@ -318,7 +473,9 @@ static void Complete( MkTaskId_t   taskId,
 /******************************************************************************/
 /**
  * @brief       ハードウェア割込み無効化
- * @details     指定したIRQ番号のハードウェア割込みを無効にする。
+ * @details     指定したIRQ番号のハードウェア割込みを無効にする。割込みを共有
+ *              する全タスクが無効化した時点で割込みコントローラの割込みを拒否
+ *              する。
  *
  * @param[in]   taskId  タスクID
  * @param[in]   *pParam パラメータ
@@ -327,10 +484,11 @@ static void Complete( MkTaskId_t   taskId,
 static void Disable( MkTaskId_t   taskId,
                      MkIntParam_t *pParam )
 {
-    bool authority;     /* 制御権限 */
+    bool     authority;     /* 制御権限                   */
+    uint32_t idx;           /* 割込み待ち情報インデックス */
 
     /* 制御権限チェック */
-    authority = CheckAuthority( taskId, pParam->irqNo, NULL );
+    authority = CheckAuthority( taskId, pParam->irqNo, &idx );
 
     /* 制御権限チェック結果判定 */
     if ( authority == false ) {
@@ -350,14 +508,27 @@ static void Disable( MkTaskId_t   taskId,
         return;
     }
 
-    /* 割込み無効化 */
-    IntmngPicDenyIrq( pParam->irqNo );
+    /* 割込み有効化解除 */
+    gMonitoringInfo[ pParam->irqNo ].enable &= ~WAITINFO_BIT( idx );
+
+    /* 他タスク割込み有効化判定 */
+    if ( gMonitoringInfo[ pParam->irqNo ].enable == 0 ) {
+        /* 無し */
+
+        /* 割込み無効化 */
+        IntmngIrqDeny( pParam->irqNo );
+    }
 
     /* 戻り値設定 */
     pParam->ret = MK_RET_SUCCESS;
     pParam->err = MK_ERR_NONE;
 
-    DEBUG_LOG_INF( "%s(): irqNo=%d, taskId=%d", pParam->irqNo, taskId );
+    DEBUG_LOG_INF(
+        "%s(): irqNo=%d, taskId=%d",
+        __func__,
+        pParam->irqNo,
+        taskId
+    );
 
     return;
 }
@@ -375,10 +546,11 @@ static void Disable( MkTaskId_t   taskId,
 static void Enable( MkTaskId_t   taskId,
                     MkIntParam_t *pParam )
 {
-    bool authority;     /* 制御権限 */
+    bool     authority;     /* 制御権限                   */
+    uint32_t idx;           /* 割込み待ち情報インデックス */
 
     /* 制御権限チェック */
-    authority = CheckAuthority( taskId, pParam->irqNo, NULL );
+    authority = CheckAuthority( taskId, pParam->irqNo, &idx );
 
     /* 制御権限チェック結果判定 */
     if ( authority == false ) {
@@ -398,8 +570,11 @@ static void Enable( MkTaskId_t   taskId,
         return;
     }
 
+    /* 割込み有効化設定 */
+    gMonitoringInfo[ pParam->irqNo ].enable |= WAITINFO_BIT( idx );
+
     /* 割込み有効化 */
-    IntmngPicAllowIrq( pParam->irqNo );
+    IntmngIrqAllow( pParam->irqNo );
 
     /* 戻り値設定 */
     pParam->ret = MK_RET_SUCCESS;
@@ -430,19 +605,14 @@ static void Enable( MkTaskId_t   taskId,
 /******************************************************************************/
 static uint32_t getWaitInfoIdx( MkTaskId_t taskId )
 {
-    uint32_t idx;   /* 割込み待ち情報インデックス */
-
-    /* 割込み待ち情報エントリ毎に繰り返し */
-    for ( idx = 0; idx < WAITINFO_ENTRY_NUM; idx++ ) {
-        /* タスクID判定 */
-        if ( gWaitInfo[ idx ].taskId == taskId ) {
-            /* 一致 */
+    /* タスクIDチェック */
+    if ( taskId >= MK_TASKID_NUM ) {
+        /* 範囲外 */
 
-            return idx;
-        }
+        return WAITINFO_ENTRY_NUM;
     }
 
-    return WAITINFO_ENTRY_NUM;
+    return gTaskIdx[ taskId ];
 }
 
 
@@ -451,19 +621,19 @@ static uint32_t getWaitInfoIdx( MkTaskId_t taskId )
  * @brief       ソフトウェア割込みハンドラ
  * @details     共通パラメータをチェックし、機能IDから該当する機能を呼び出す。
  *
- * @param[in]   intNo   割込み番号
- * @param[in]   context 割込み発生時コンテキスト
+ * @param[in]   intNo     割込み番号
+ * @param[in]   *pContext 割込み発生時コンテキスト
  */
 /******************************************************************************/
 static void HdlSwInt( uint32_t        intNo,
-                      IntmngContext_t context )
+                      IntmngContext_t *pContext )
 {
     uint8_t      type;      /* プロセスタイプ */
     MkTaskId_t   taskId;    /* タスクID       */
     MkIntParam_t *pParam;   /* パラメータ     */
 
     /* 初期化 */
-    pParam = ( MkIntParam_t * ) context.genReg.esi;
+    pParam = ( MkIntParam_t * ) pContext->genReg.esi;
 
     /* タスクID取得 */
     taskId = TaskmngSchedGetTaskId();
@@ -514,7 +684,8 @@ static void HdlSwInt( uint32_t        intNo,
 
         Wait( taskId, pParam );
 
-    } else if ( pParam->funcId == MK_INT_FUNCID_COMPLETE ) {
+    } else if ( ( pParam->funcId == MK_INT_FUNCID_COMPLETE ) ||
+                ( pParam->funcId == MK_INT_FUNCID_CLAIM    )    ) {
         /* ハードウェア割込み完了 */
 
         Complete( taskId, pParam );
@@ -529,6 +700,11 @@ static void HdlSwInt( uint32_t        intNo,
 
         Disable( taskId, pParam );
 
+    } else if ( pParam->funcId == MK_INT_FUNCID_SET_COALESCE ) {
+        /* ハードウェア割込み合体設定 */
+
+        SetCoalesce( taskId, pParam );
+
     } else {
         /* 不明 */
 
@@ -551,34 +727,203 @@ static void HdlSwInt( uint32_t        intNo,
 /******************************************************************************/
 /**
  * @brief           ハードウェア割込みハンドラ
- * @details         当該割込み番号の割込み発生フラグをONに設定し、当該の割込み
- *                  待ち合わせを行っているタスクがいる場合はスケジュールを開始
- *                  し割込み待ちを解除する。
+ * @details         割込みコントローラに処理委譲を通知した後、当該IRQを監視し
+ *                  ている全タスクを処理完了待ちとし、タスク毎に割込み発生を記
+ *                  録する。監視しているタスクがいない場合は直ちに処理完了とす
+ *                  る。
  *
- * @param[in]       intNo   割込み番号
- * @param[in]       context 割込み発生時コンテキスト
+ * @param[in]       intNo     割込み番号
+ * @param[in]       *pContext 割込み発生時コンテキスト
  */
 /******************************************************************************/
 static void HdlHwInt( uint32_t        intNo,
-                      IntmngContext_t context )
+                      IntmngContext_t *pContext )
+{
+    uint8_t  irqNo;         /* IRQ番号                    */
+    uint32_t idx;           /* 割込み待ち情報インデックス */
+    uint32_t subscriber;    /* 監視中割込み待ち情報       */
+    uint64_t tsc;           /* 割込み発生TSC              */
+
+    /* 初期化 */
+    irqNo      = ( uint8_t ) INTMNG_INTNO_TO_IRQ( intNo );
+    subscriber = gMonitoringInfo[ irqNo ].subscriber;
+
+    /* 割込み処理委譲通知 */
+    IntmngIrqDefer( irqNo );
+
+    /* 監視有無判定 */
+    if ( subscriber == 0 ) {
+        /* 非監視中 */
+
+        DEBUG_LOG_WRN( "%s(): ignore irqNo(%d)", __func__, irqNo );
+
+        /* 割込み処理完了通知 */
+        IntmngIrqComplete( irqNo );
+
+        return;
+    }
+
+    /* 割込み発生TSC取得 */
+    tsc = IA32InstructionRdtsc();
+
+    /* 処理完了待ち設定 */
+    gMonitoringInfo[ irqNo ].pending |= subscriber;
+
+    /* 監視中割込み待ち情報毎に繰り返す */
+    for ( idx = 0; idx < WAITINFO_ENTRY_NUM; idx++ ) {
+        /* 監視判定 */
+        if ( ( subscriber & WAITINFO_BIT( idx ) ) != 0 ) {
+            /* 監視中 */
+
+            /* 割込み発生記録 */
+            Record( irqNo, idx, tsc );
+        }
+    }
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief           システムコールハンドラ
+ * @details         レジスタ渡し形式のハードウェア割込み完了システムコールを処
+ *                  理する。
+ *                  - 入力: EBX=IRQ番号, ESI=完了フラグ
+ *
+ * @param[in]       no    システムコール番号
+ * @param[in,out]   *pReg 汎用レジスタ
+ */
+/******************************************************************************/
+static void HdlSys( uint32_t     no,
+                    IA32Pushad_t *pReg )
+{
+    uint8_t      type;      /* プロセスタイプ */
+    MkTaskId_t   taskId;    /* タスクID       */
+    MkIntParam_t param;     /* パラメータ     */
+
+    /* 初期化 */
+    taskId = TaskmngSchedGetTaskId();
+    type   = TaskmngTaskGetType( taskId );
+
+    /* パラメータ設定 */
+    param.funcId = MK_INT_FUNCID_COMPLETE;
+    param.ret    = MK_RET_FAILURE;
+    param.err    = MK_ERR_NONE;
+    param.flag   = 0;
+
+    /* プロセスタイプチェック */
+    if ( type != TASKMNG_PROC_TYPE_DRIVER ) {
+        /* 非ドライバプロセス */
+
+        /* 戻り値設定 */
+        pReg->eax = MK_RET_FAILURE;
+        pReg->ebx = MK_ERR_UNAUTHORIZED;
+
+        return;
+    }
+
+    /* IRQ番号チェック */
+    if ( pReg->ebx >= IntmngIrqGetNum() ) {
+        /* 範囲外 */
+
+        /* 戻り値設定 */
+        pReg->eax = MK_RET_FAILURE;
+        pReg->ebx = MK_ERR_PARAM;
+
+        return;
+    }
+
+    /* クレーム判定 */
+    if ( ( pReg->esi & MK_INT_COMPLETE_CLAIM ) != 0 ) {
+        /* クレーム */
+
+        param.funcId = MK_INT_FUNCID_CLAIM;
+    }
+
+    /* ハードウェア割込み完了 */
+    param.irqNo = ( uint8_t ) pReg->ebx;
+    Complete( taskId, &param );
+
+    /* 戻り値設定 */
+    pReg->eax = param.ret;
+    pReg->ebx = param.err;
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       割込み合体タイマ満了
+ * @details     合体待ち時間が経過したIRQの割込み待ち合わせを解除する。
+ *
+ * @param[in]   timerId タイマID
+ * @param[in]   *pArg   割込み待ち情報インデックスとIRQ番号
+ */
+/******************************************************************************/
+static void HdlTimeout( uint32_t timerId,
+                        void     *pArg    )
 {
     uint8_t  irqNo;     /* IRQ番号                    */
     uint32_t idx;       /* 割込み待ち情報インデックス */
 
-    /* IRQ番号算出 */
-    irqNo = ( uint8_t ) ( intNo - INTMNG_PIC_VCTR_BASE );
+    /* 初期化 */
+    irqNo = ( uint8_t ) ( ( uint32_t ) pArg % INTMNG_IRQ_NUM );
+    idx   = ( uint32_t ) pArg / INTMNG_IRQ_NUM;
 
-    /* 割込み待ち情報インデックス取得 */
-    idx = gMonitoringInfo.waitInfoIdx[ irqNo ];
+    /* タイマIDチェック */
+    if ( gWaitInfo[ idx ].irqInfo[ irqNo ].timerId != timerId ) {
+        /* 不一致 */
 
-    /* 割込み待ち情報エントリ有無判定 */
-    if ( idx == WAITINFO_ENTRY_NUM ) {
-        /* エントリ無(非監視中) */
+        return;
+    }
+
+    /* タイマ満了済み設定 */
+    gWaitInfo[ idx ].irqInfo[ irqNo ].timerId = TIMERMNG_TIMERID_NULL;
+
+    /* 割込み監視判定 */
+    if ( ( gMonitoringInfo[ irqNo ].subscriber & WAITINFO_BIT( idx ) ) == 0 ) {
+        /* 非監視中 */
 
-        DEBUG_LOG_WRN( "%s(): ignore irqNo(%d)", __func__, irqNo );
         return;
     }
 
+    /* 割込み待ち合わせ解除 */
+    Notify( irqNo, idx );
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       割込み待ち合わせ解除
+ * @details     合体タイマを解除して割込み発生フラグをONに設定し、割込み待ち合
+ *              わせを行っているタスクがいる場合はスケジュールを開始し割込み待
+ *              ちを解除する。
+ *
+ * @param[in]   irqNo IRQ番号
+ * @param[in]   idx   割込み待ち情報インデックス
+ */
+/******************************************************************************/
+static void Notify( uint8_t  irqNo,
+                    uint32_t idx    )
+{
+    volatile IrqInfo_t *pIrqInfo;   /* IRQ毎割込み発生情報 */
+
+    /* 初期化 */
+    pIrqInfo = &( gWaitInfo[ idx ].irqInfo[ irqNo ] );
+
+    /* 合体タイマ設定有無判定 */
+    if ( pIrqInfo->timerId != TIMERMNG_TIMERID_NULL ) {
+        /* 有り */
+
+        /* 合体タイマ解除 */
+        TimermngCtrlUnset( pIrqInfo->timerId );
+        pIrqInfo->timerId = TIMERMNG_TIMERID_NULL;
+    }
+
     /* 割込み待ち情報設定 */
     gWaitInfo[ idx ].flag |= ( 1 << irqNo );
 
@@ -586,18 +931,297 @@ static void HdlHwInt( uint32_t        intNo,
     if ( gWaitInfo[ idx ].state == STATE_WAIT ) {
         /* 待ち状態 */
 
+#ifdef INTMNG_STAT_ENABLE
+        /* 待ち解除済み判定 */
+        if ( gWaitInfo[ idx ].wakeTsc == 0 ) {
+            /* 未解除 */
+
+            /* 割込み遅延計測開始 */
+            gWaitInfo[ idx ].wakeIrqNo = irqNo;
+            gWaitInfo[ idx ].irqTsc    = pIrqInfo->lastTsc;
+            gWaitInfo[ idx ].wakeTsc   = IA32InstructionRdtsc();
+        }
+#endif
+
         /* スケジュール開始 */
         TaskmngSchedStart( gWaitInfo[ idx ].taskId );
+
+    } else {
+        /* 待ち状態でない */
+
+        /* イベント通知 */
+        ItcctrlEventNotify( gWaitInfo[ idx ].taskId, MK_EVENT_INT );
+    }
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       割込み発生記録
+ * @details     タスク毎の割込み発生回数とTSC、および共有ページの割込み発生回
+ *              数を記録する。合体条件を満たした場合は割込み待ち合わせを解除
+ *              し、満たさない場合は必要に応じて合体タイマを設定する。待ち合わ
+ *              せを保留したエッジトリガ割込みは、次の割込みを計数する為に当該
+ *              タスクの処理完了待ちを解除する。レベルトリガ割込みは処理完了ま
+ *              で再発生しない為、合体タイマが無い場合は直ちに待ち合わせを解除
+ *              する。
+ *
+ * @param[in]   irqNo IRQ番号
+ * @param[in]   idx   割込み待ち情報インデックス
+ * @param[in]   tsc   割込み発生TSC
+ */
+/******************************************************************************/
+static void Record( uint8_t  irqNo,
+                    uint32_t idx,
+                    uint64_t tsc    )
+{
+    volatile IrqInfo_t *pIrqInfo;   /* IRQ毎割込み発生情報 */
+
+    /* 初期化 */
+    pIrqInfo = &( gWaitInfo[ idx ].irqInfo[ irqNo ] );
+
+    /* 共有ページ割込み発生回数加算 */
+    MemmngShareAddInt( idx, irqNo );
+
+    /* 初回割込み判定 */
+    if ( pIrqInfo->count == 0 ) {
+        /* 初回 */
+
+        pIrqInfo->firstTsc = tsc;
+    }
+
+    /* 割込み発生情報設定 */
+    pIrqInfo->count++;
+    pIrqInfo->lastTsc = tsc;
+
+    /* 待ち合わせ解除済み判定 */
+    if ( ( gWaitInfo[ idx ].flag & ( 1 << irqNo ) ) != 0 ) {
+        /* 解除済み */
+
+        return;
+    }
+
+    /* 合体割込み回数判定 */
+    if ( ( pIrqInfo->coalesceNum != 0                     ) &&
+         ( pIrqInfo->count       >= pIrqInfo->coalesceNum )    ) {
+        /* 到達 */
+
+        /* 割込み待ち合わせ解除 */
+        Notify( irqNo, idx );
+
+        return;
+    }
+
+    /* 合体タイマ設定判定 */
+    if ( ( pIrqInfo->timerId      == TIMERMNG_TIMERID_NULL ) &&
+         ( pIrqInfo->coalesceUsec != 0                     )    ) {
+        /* 合体タイマ未設定 */
+
+        /* 合体タイマ設定 */
+        pIrqInfo->timerId = TimermngCtrlSet( pIrqInfo->coalesceUsec,
+                                             TIMERMNG_TYPE_ONESHOT,
+                                             HdlTimeout,
+                                             TIMER_ARG( idx, irqNo )  );
+
+        /* 設定結果判定 */
+        if ( pIrqInfo->timerId == TIMERMNG_TIMERID_NULL ) {
+            /* 失敗 */
+
+            /* 割込み待ち合わせ解除 */
+            Notify( irqNo, idx );
+
+            return;
+        }
+
+        /* 合体タイマスラック設定(割込み発生時のタスクに依らず遅延無し) */
+        TimermngCtrlSetSlack( pIrqInfo->timerId, 0 );
+    }
+
+    /* トリガモード判定 */
+    if ( IntmngIrqIsLevel( irqNo ) == false ) {
+        /* エッジトリガ */
+
+        /* 処理完了待ち解除 */
+        Release( irqNo, WAITINFO_BIT( idx ) );
+
+    } else if ( pIrqInfo->timerId == TIMERMNG_TIMERID_NULL ) {
+        /* レベルトリガかつ合体タイマ無し */
+
+        /* 割込み待ち合わせ解除 */
+        Notify( irqNo, idx );
+    }
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       割込み処理完了待ち解除
+ * @details     指定した割込み待ち情報の処理完了待ちを解除し、処理完了待ちが無
+ *              くなった場合は割込みコントローラに処理完了を通知する。
+ *
+ * @param[in]   irqNo IRQ番号
+ * @param[in]   mask  解除する割込み待ち情報ビット
+ */
+/******************************************************************************/
+static void Release( uint8_t  irqNo,
+                     uint32_t mask   )
+{
+    /* 処理完了待ち判定 */
+    if ( ( gMonitoringInfo[ irqNo ].pending & mask ) == 0 ) {
+        /* 処理完了待ち無し */
+
+        return;
+    }
+
+    /* 処理完了待ち解除 */
+    gMonitoringInfo[ irqNo ].pending &= ~mask;
+
+    /* 全タスク処理完了判定 */
+    if ( gMonitoringInfo[ irqNo ].pending == 0 ) {
+        /* 全タスク処理完了 */
+
+        /* 割込み処理完了通知 */
+        IntmngIrqComplete( irqNo );
     }
 
     return;
 }
 
 
+/******************************************************************************/
+/**
+ * @brief       IRQ毎割込み発生情報初期化
+ * @details     合体タイマを解除し、割込み発生回数とTSCをクリアして合体条件を
+ *              割込み毎の待ち合わせ解除に戻す。
+ *
+ * @param[in]   irqNo IRQ番号
+ * @param[in]   idx   割込み待ち情報インデックス
+ */
+/******************************************************************************/
+static void ResetIrqInfo( uint8_t  irqNo,
+                          uint32_t idx    )
+{
+    volatile IrqInfo_t *pIrqInfo;   /* IRQ毎割込み発生情報 */
+
+    /* 初期化 */
+    pIrqInfo = &( gWaitInfo[ idx ].irqInfo[ irqNo ] );
+
+    /* 合体タイマ設定有無判定 */
+    if ( pIrqInfo->timerId != TIMERMNG_TIMERID_NULL ) {
+        /* 有り */
+
+        /* 合体タイマ解除 */
+        TimermngCtrlUnset( pIrqInfo->timerId );
+    }
+
+    /* 初期化 */
+    pIrqInfo->count        = 0;
+    pIrqInfo->timerId      = TIMERMNG_TIMERID_NULL;
+    pIrqInfo->firstTsc     = 0;
+    pIrqInfo->lastTsc      = 0;
+    pIrqInfo->coalesceNum  = 1;
+    pIrqInfo->coalesceUsec = 0;
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       ハードウェア割込み合体設定
+ * @details     指定したIRQ番号の割込み合体条件を設定する。割込み待ち合わせは
+ *              割込みが合体割込み回数発生するか、最初の割込み発生から合体待ち
+ *              時間が経過した時点で解除する。レベルトリガ割込みは処理完了まで
+ *              再発生せず回数条件のみでは待ち合わせを解除できない為、合体待ち
+ *              時間の無い回数条件はエッジトリガ割込みに限り受け付ける。
+ *
+ * @param[in]   taskId  タスクID
+ * @param[in]   *pParam パラメータ
+ */
+/******************************************************************************/
+static void SetCoalesce( MkTaskId_t   taskId,
+                         MkIntParam_t *pParam )
+{
+    bool     authority;     /* 制御権限                   */
+    uint32_t idx;           /* 割込み待ち情報インデックス */
+
+    /* 制御権限チェック */
+    authority = CheckAuthority( taskId, pParam->irqNo, &idx );
+
+    /* 制御権限チェック結果判定 */
+    if ( authority == false ) {
+        /* 権限無し */
+
+        /* エラー設定 */
+        pParam->ret = MK_RET_FAILURE;
+        pParam->err = MK_ERR_UNAUTHORIZED;
+
+        DEBUG_LOG_WRN(
+            "%s(): unauthorized. irqNo=%d, taskId=%d",
+            __func__,
+            pParam->irqNo,
+            taskId
+        );
+
+        return;
+    }
+
+    /* 合体条件判定 */
+    if ( ( pParam->count == 0 ) && ( pParam->usec == 0 ) ) {
+        /* 条件無し */
+
+        /* 割込み毎に解除 */
+        pParam->count = 1;
+
+    } else if ( ( pParam->count                     >  1     ) &&
+                ( pParam->usec                      == 0     ) &&
+                ( IntmngIrqIsLevel( pParam->irqNo ) != false )    ) {
+        /* 回数条件のみかつ割込みが再発生しない */
+
+        /* エラー設定 */
+        pParam->ret = MK_RET_FAILURE;
+        pParam->err = MK_ERR_PARAM;
+
+        DEBUG_LOG_WRN(
+            "%s(): no time bound. irqNo=%d, count=%u",
+            __func__,
+            pParam->irqNo,
+            pParam->count
+        );
+
+        return;
+    }
+
+    /* 合体条件設定 */
+    gWaitInfo[ idx ].irqInfo[ pParam->irqNo ].coalesceNum  = pParam->count;
+    gWaitInfo[ idx ].irqInfo[ pParam->irqNo ].coalesceUsec = pParam->usec;
+
+    /* 戻り値設定 */
+    pParam->ret = MK_RET_SUCCESS;
+    pParam->err = MK_ERR_NONE;
+
+    DEBUG_LOG_INF(
+        "%s(): irqNo=%d, taskId=%d, count=%u, usec=%u",
+        __func__,
+        pParam->irqNo,
+        taskId,
+        pParam->count,
+        pParam->usec
+    );
+
+    return;
+}
+
+
 /******************************************************************************/
 /**
  * @brief       ハードウェア割込み監視開始
- * @details     指定したIRQ番号のハードウェア割込み監視を開始する。
+ * @details     指定したIRQ番号のハードウェア割込み監視を開始する。IRQは複数
+ *              のタスクで共有できる。
  *
  * @param[in]   taskId  タスクID
  * @param[in]   *pParam パラメータ
@@ -609,10 +1233,10 @@ static void StartMonitoring( MkTaskId_t   taskId,
     uint32_t idx;   /* 割込み待ち情報インデックス */
 
     /* IRQ番号範囲チェック */
-    if ( ( pParam->irqNo >= I8259A_IRQ_NUM ) ||
-         ( pParam->irqNo == I8259A_IRQ0    ) ||     /* PIT */
-         ( pParam->irqNo == I8259A_IRQ2    ) ||     /* PIC */
-         ( pParam->irqNo == I8259A_IRQ8    )    ) { /* RTC */
+    if ( ( pParam->irqNo >= IntmngIrqGetNum() ) ||
+         ( pParam->irqNo == I8259A_IRQ0       ) ||     /* PIT */
+         ( pParam->irqNo == I8259A_IRQ2       ) ||     /* PIC */
+         ( pParam->irqNo == I8259A_IRQ8       )    ) { /* RTC */
         /* 範囲外 */
 
         /* エラー設定 */
@@ -630,7 +1254,7 @@ static void StartMonitoring( MkTaskId_t   taskId,
     }
 
     /* 監視開始済みチェック */
-    if ( gMonitoringInfo.waitInfoIdx[ pParam->irqNo ] != WAITINFO_ENTRY_NUM ) {
+    if ( CheckAuthority( taskId, pParam->irqNo, NULL ) != false ) {
         /* 開始済み */
 
         /* エラー設定 */
@@ -650,8 +1274,29 @@ static void StartMonitoring( MkTaskId_t   taskId,
     /* 割込み待ち情報エントリ割り当て */
     idx = AllocWaitInfo( taskId );
 
+    /* 割り当て結果判定 */
+    if ( idx == WAITINFO_ENTRY_NUM ) {
+        /* 失敗 */
+
+        /* エラー設定 */
+        pParam->ret = MK_RET_FAILURE;
+        pParam->err = MK_ERR_NO_RESOURCE;
+
+        DEBUG_LOG_WRN(
+            "%s(): no resource. irqNo=%d, taskId=%d",
+            __func__,
+            pParam->irqNo,
+            taskId
+        );
+
+        return;
+    }
+
+    /* IRQ毎割込み発生情報初期化 */
+    ResetIrqInfo( pParam->irqNo, idx );
+
     /* 割込み監視情報設定 */
-    gMonitoringInfo.waitInfoIdx[ pParam->irqNo ] = idx;
+    gMonitoringInfo[ pParam->irqNo ].subscriber |= WAITINFO_BIT( idx );
 
     /* 割込み待ち情報設定 */
     gWaitInfo[ idx ].monitor |= ( 1 << pParam->irqNo );
@@ -661,13 +1306,13 @@ static void StartMonitoring( MkTaskId_t   taskId,
     pParam->err = MK_ERR_NONE;
 
     DEBUG_LOG_INF(
-        "%s(): irqNo=%d, taskId=%d, idx=%d, monitor=%02x, flag=%02x",
+        "%s(): irqNo=%d, taskId=%d, idx=%d, monitor=%06x, subscriber=%08x",
         __func__,
         pParam->irqNo,
         taskId,
         idx,
         gWaitInfo[ idx ].monitor,
-        gWaitInfo[ idx ].flag
+        gMonitoringInfo[ pParam->irqNo ].subscriber
     );
 
     return;
@@ -677,7 +1322,9 @@ static void StartMonitoring( MkTaskId_t   taskId,
 /******************************************************************************/
 /**
  * @brief       ハードウェア割込み監視終了
- * @details     指定したIRQ番号のハードウェア割込み監視を停止する。
+ * @details     指定したIRQ番号のハードウェア割込み監視を停止する。処理完了待
+ *              ちの割込みは処理完了とし、割込みを有効化しているタスクがいなく
+ *              なった場合は割込みを無効化する。
  *
  * @param[in]   taskId  タスクID
  * @param[in]   *pParam パラメータ
@@ -690,10 +1337,10 @@ static void StopMonitoring( MkTaskId_t   taskId,
     uint32_t idx;           /* 割込み待ち情報インデックス */
 
     /* IRQ番号範囲チェック */
-    if ( ( pParam->irqNo >= I8259A_IRQ_NUM ) ||
-         ( pParam->irqNo == I8259A_IRQ0    ) ||     /* PIT */
-         ( pParam->irqNo == I8259A_IRQ2    ) ||     /* PIC */
-         ( pParam->irqNo == I8259A_IRQ8    )    ) { /* RTC */
+    if ( ( pParam->irqNo >= IntmngIrqGetNum() ) ||
+         ( pParam->irqNo == I8259A_IRQ0       ) ||     /* PIT */
+         ( pParam->irqNo == I8259A_IRQ2       ) ||     /* PIC */
+         ( pParam->irqNo == I8259A_IRQ8       )    ) { /* RTC */
         /* 範囲外 */
 
         /* エラー設定 */
@@ -731,33 +1378,59 @@ static void StopMonitoring( MkTaskId_t   taskId,
         return;
     }
 
+    /* IRQ毎割込み発生情報初期化 */
+    ResetIrqInfo( pParam->irqNo, idx );
+
     /* 割込み待ち情報設定 */
     gWaitInfo[ idx ].monitor &= ~( 1 << pParam->irqNo );
     gWaitInfo[ idx ].flag    &= ~( 1 << pParam->irqNo );
 
+    /* 割込み監視情報設定 */
+    gMonitoringInfo[ pParam->irqNo ].subscriber &= ~WAITINFO_BIT( idx );
+
+    /* 割込み有効化判定 */
+    if ( ( gMonitoringInfo[ pParam->irqNo ].enable & WAITINFO_BIT( idx ) ) != 0 ) {
+        /* 有効化済み */
+
+        /* 割込み有効化解除 */
+        gMonitoringInfo[ pParam->irqNo ].enable &= ~WAITINFO_BIT( idx );
+
+        /* 他タスク割込み有効化判定 */
+        if ( gMonitoringInfo[ pParam->irqNo ].enable == 0 ) {
+            /* 無し */
+
+            /* 割込み無効化 */
+            IntmngIrqDeny( pParam->irqNo );
+        }
+    }
+
+    /* 処理完了待ち解除 */
+    Release( pParam->irqNo, WAITINFO_BIT( idx ) );
+
     /* 他割込み監視判定 */
     if ( gWaitInfo[ idx ].monitor == 0 ) {
         /* 無し */
 
         /* 割込み待ち情報初期化 */
         gWaitInfo[ idx ].taskId = MK_TASKID_NULL;
-    }
+        gTaskIdx[ taskId ]      = WAITINFO_ENTRY_NUM;
 
-    /* 割込み待ち情報インデックス初期化 */
-    gMonitoringInfo.waitInfoIdx[ pParam->irqNo ] = WAITINFO_ENTRY_NUM;
+        /* 共有ページ割込み状態割当て解除 */
+        MemmngShareSetInt( idx, MK_TASKID_NULL );
+    }
 
     /* 戻り値設定 */
     pParam->ret = MK_RET_SUCCESS;
     pParam->err = MK_ERR_NONE;
 
     DEBUG_LOG_INF(
-        "%s(): irqNo=%d, taskId=%d, idx=%d, monitor=%02x, flag=%02x",
+        "%s(): irqNo=%d, taskId=%d, idx=%d, monitor=%06x, subscriber=%08x",
         __func__,
         pParam->irqNo,
         taskId,
         idx,
         gWaitInfo[ idx ].monitor,
-        gWaitInfo[ idx ].flag
+        gMonitoringInfo[ pParam->irqNo ].subscriber
     );
 
     return;
@@ -768,7 +1441,11 @@ static void StopMonitoring( MkTaskId_t   taskId,
 /**
  * @brief       ハードウェア割込み待ち合わせ
  * @details     ハードウェア割込みが発生しているか確認する。発生していない場合
- *              は割込みが発生するまで待ち合わせる。
+ *              は割込みが発生するまで待ち合わせる。割込み発生情報格納先が指定
+ *              された場合は発生したIRQ毎の割込み発生回数とTSCを設定する。
+ *              確認済み発生回数が指定された場合は、共有ページの割込み発生回数
+ *              が一致する(ユーザが共有ページで確認済みの)IRQを割込み未発生と
+ *              して扱い、復帰時に発生したIRQの確認済み発生回数を更新する。
  *
  * @param[in]   taskId  タスクID
  * @param[in]   *pParam パラメータ
@@ -777,7 +1454,14 @@ static void StopMonitoring( MkTaskId_t   taskId,
 static void Wait( MkTaskId_t   taskId,
                   MkIntParam_t *pParam )
 {
-    uint32_t idx; /* 割込み待ち情報インデックス */
+    uint8_t            irqNo;       /* IRQ番号                    */
+    uint32_t           idx;         /* 割込み待ち情報インデックス */
+    uint32_t           flag;        /* 割込み発生フラグ           */
+    MkIntInfo_t        info;        /* 割込み発生情報             */
+    volatile IrqInfo_t *pIrqInfo;   /* IRQ毎割込み発生情報        */
+
+    /* 初期化 */
+    MLibUtilSetMemory8( &info, 0, sizeof ( info ) );
 
     /* 割込み待ち情報インデックス取得 */
     idx = getWaitInfoIdx( taskId );
@@ -800,6 +1484,51 @@ static void Wait( MkTaskId_t   taskId,
         return;
     }
 
+    /* 割込み発生情報格納先チェック */
+    if ( ( pParam->pInfo != NULL                                   ) &&
+         ( ( ( uint32_t ) pParam->pInfo <  MEMMAP_VADDR_USER )   ||
+           ( ( uint32_t ) pParam->pInfo >  INFO_ADDR_MAX     )      )    ) {
+        /* 不正 */
+
+        /* エラー設定 */
+        pParam->ret = MK_RET_FAILURE;
+        pParam->err = MK_ERR_PARAM;
+
+        return;
+    }
+
+    /* 確認済み発生回数格納先チェック */
+    if ( ( pParam->pSeen != NULL                                   ) &&
+         ( ( ( uint32_t ) pParam->pSeen <  MEMMAP_VADDR_USER )   ||
+           ( ( uint32_t ) pParam->pSeen >  SEEN_ADDR_MAX     )      )    ) {
+        /* 不正 */
+
+        /* エラー設定 */
+        pParam->ret = MK_RET_FAILURE;
+        pParam->err = MK_ERR_PARAM;
+
+        return;
+    }
+
+    /* 確認済み発生回数有無判定 */
+    if ( pParam->pSeen != NULL ) {
+        /* 有り */
+
+        /* IRQ毎に繰り返す */
+        for ( irqNo = 0; irqNo < INTMNG_IRQ_NUM; irqNo++ ) {
+            /* 確認済み判定 */
+            if ( ( ( gWaitInfo[ idx ].flag & ( 1 << irqNo ) ) != 0 ) &&
+                 ( MemmngShareGetInt( idx, irqNo ) ==
+                   pParam->pSeen[ irqNo ]                         )    ) {
+                /* 共有ページで確認済み */
+
+                /* 割込み発生フラグ解除 */
+                gWaitInfo[ idx ].flag &= ~( 1 << irqNo );
+                gWaitInfo[ idx ].irqInfo[ irqNo ].count = 0;
+            }
+        }
+    }
+
     /* 割込み発生フラグ判定 */
     if ( gWaitInfo[ idx ].flag == 0 ) {
         /* 割込み未発生 */
@@ -812,12 +1541,66 @@ static void Wait( MkTaskId_t   taskId,
 
         /* スケジューラ実行 */
         TaskmngSchedExec();
+
+#ifdef INTMNG_STAT_ENABLE
+        /* 割込み遅延計測判定 */
+        if ( gWaitInfo[ idx ].wakeTsc != 0 ) {
+            /* 計測中 */
+
+            /* 割込み遅延計測設定 */
+            IntmngStatIntSet( taskId,
+                              gWaitInfo[ idx ].wakeIrqNo,
+                              gWaitInfo[ idx ].irqTsc,
+                              gWaitInfo[ idx ].wakeTsc,
+                              TaskmngSchedGetSwitchTsc()  );
+            gWaitInfo[ idx ].wakeTsc = 0;
+        }
+#endif
+    }
+
+    /* 割込み発生フラグ取得 */
+    flag = gWaitInfo[ idx ].flag;
+
+    /* IRQ毎に繰り返す */
+    for ( irqNo = 0; irqNo < INTMNG_IRQ_NUM; irqNo++ ) {
+        /* 割込み発生判定 */
+        if ( ( flag & ( 1 << irqNo ) ) == 0 ) {
+            /* 未発生 */
+            continue;
+        }
+
+        /* IRQ毎割込み発生情報取得 */
+        pIrqInfo = &( gWaitInfo[ idx ].irqInfo[ irqNo ] );
+
+        /* 割込み発生情報格納先有無判定 */
+        if ( pParam->pInfo != NULL ) {
+            /* 有り */
+
+            /* 割込み発生情報コピー */
+            info.count    = pIrqInfo->count;
+            info.firstTsc = pIrqInfo->firstTsc;
+            info.lastTsc  = pIrqInfo->lastTsc;
+            MLibUtilCopyMemory( &( pParam->pInfo[ irqNo ] ),
+                                &info,
+                                sizeof ( MkIntInfo_t )       );
+        }
+
+        /* 確認済み発生回数格納先有無判定 */
+        if ( pParam->pSeen != NULL ) {
+            /* 有り */
+
+            /* 確認済み発生回数設定 */
+            pParam->pSeen[ irqNo ] = MemmngShareGetInt( idx, irqNo );
+        }
+
+        /* 割込み発生回数初期化 */
+        pIrqInfo->count = 0;
     }
 
     /* 戻り値設定 */
     pParam->ret  = MK_RET_SUCCESS;
     pParam->err  = MK_ERR_NONE;
-    pParam->flag = gWaitInfo[ idx ].flag;
+    pParam->flag = flag;
 
     /* 割込み待ち情報設定 */
     gWaitInfo[ idx ].flag  = 0;
@@ -0,0 +1,542 @@
+/******************************************************************************/
+/*                                                                            */
+/* src/kernel/Intmng/IntmngEntry.s                                            */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2026 Mochi.                                                  */
+/*                                                                            */
+/******************************************************************************/
+.intel_syntax noprefix
+.code32
+
+/******************************************************************************/
+/* 定義                                                                       */
+/******************************************************************************/
+/* セグメントセレクタ */
+.equ SEGSEL_KERNEL_DATA, 0x10           /* MEMMNG_SEGSEL_KERNEL_DATA */
+.equ SEGSEL_APL_CODE,    0x1B           /* MEMMNG_SEGSEL_APL_CODE    */
+.equ SEGSEL_APL_DATA,    0x23           /* MEMMNG_SEGSEL_APL_DATA    */
+
+/* 割込み番号 */
+.equ INTNO_TIMER,        0x20           /* INTMNG_PIC_VCTR_BASE+IRQ0 */
+.equ INTNO_SYSCALL,      0x3D           /* MK_CONFIG_INTNO_SYSCALL   */
+
+/* EFLAGS */
+.equ EFLAGS_IF,          0x00000200     /* IA32_EFLAGS_IF            */
+
+/* 割込み発生時コンテキスト(IntmngContext_t)オフセット */
+.equ CONTEXT_INTNO,      48             /* 割込み番号                */
+.equ CONTEXT_EIP,        56             /* EIPレジスタ値             */
+.equ CONTEXT_CS,         60             /* CSレジスタ値              */
+.equ CONTEXT_ESP,        68             /* ESPレジスタ値             */
+
+/*
+ * コンテキスト保存マクロ
+ *
+ * エラーコードと割込み番号がプッシュされた状態で呼び出し、IntmngContext_tの
+ * 並びでセグメントレジスタと汎用レジスタを保存する。割込み発生元がリング3の
+ * 場合のみDS/ESにカーネルデータセグメントを設定する。
+ */
+.macro SAVE_CONTEXT
+    push        gs
+    push        fs
+    push        es
+    push        ds
+    pushad
+    cld
+
+    /* 割込み発生元特権レベル判定 */
+    test        BYTE PTR [ esp + CONTEXT_CS ], 3
+    jz          1f
+
+    /* カーネルデータセグメント設定 */
+    mov         ax, SEGSEL_KERNEL_DATA
+    mov         ds, ax
+    mov         es, ax
+1:
+.endm
+
+/** エラーコード無し割込み入口定義マクロ */
+.macro ENTRY_NOERR no
+Entry\no\():
+    push        0                       /* 空エラーコード */
+    push        \no                     /* 割込み番号     */
+    jmp         EntryCommon
+.endm
+
+/** エラーコード有り割込み入口定義マクロ */
+.macro ENTRY_ERR no
+Entry\no\():
+    push        \no                     /* 割込み番号     */
+    jmp         EntryCommon
+.endm
+
+
+/******************************************************************************/
+/* グローバル宣言                                                             */
+/******************************************************************************/
+.global IntmngEntrySysenter
+.global gIntmngEntryTbl
+
+
+/******************************************************************************/
+/* 外部変数宣言                                                               */
+/******************************************************************************/
+.extern gIntmngHdlTbl
+
+
+/******************************************************************************/
+/* TEXTセクション                                                             */
+/******************************************************************************/
+.section .text
+
+/*----------------------------------------------------------------------------*/
+/* 共通割込み入口                                                             */
+/*----------------------------------------------------------------------------*/
+EntryCommon:
+    SAVE_CONTEXT
+
+    /* 割込みハンドラ呼出し */
+    mov         eax, [ esp + CONTEXT_INTNO ]
+    push        esp                     /* 割込み発生時コンテキスト */
+    push        eax                     /* 割込み番号               */
+    call        [ gIntmngHdlTbl + eax * 4 ]
+    add         esp, 8
+
+    /* 割込み出口 */
+EntryExit:
+    /* 割込み発生元特権レベル判定 */
+    test        BYTE PTR [ esp + CONTEXT_CS ], 3
+    jz          EntryExitRing0
+
+    /* コンテキスト復帰 */
+    popad
+    pop         ds
+    pop         es
+    pop         fs
+    pop         gs
+
+    /* 割込み番号・エラーコード削除 */
+    add         esp, 8
+    iretd
+
+EntryExitRing0:
+    /* コンテキスト復帰(セグメントレジスタ未変更) */
+    popad
+
+    /* セグメントレジスタ・割込み番号・エラーコード削除 */
+    add         esp, 24
+    iretd
+
+/*----------------------------------------------------------------------------*/
+/* タイマ割込み入口                                                           */
+/*----------------------------------------------------------------------------*/
+EntryTimer:
+    push        0                       /* 空エラーコード */
+    push        INTNO_TIMER             /* 割込み番号     */
+    SAVE_CONTEXT
+
+    /* 割込みハンドラ呼出し */
+    push        esp                     /* 割込み発生時コンテキスト */
+    push        INTNO_TIMER             /* 割込み番号               */
+    call        [ gIntmngHdlTbl + INTNO_TIMER * 4 ]
+    add         esp, 8
+
+    jmp         EntryExit
+
+/*----------------------------------------------------------------------------*/
+/* システムコール割込み入口                                                   */
+/*----------------------------------------------------------------------------*/
+EntrySyscall:
+    push        0                       /* 空エラーコード */
+    push        INTNO_SYSCALL           /* 割込み番号     */
+    SAVE_CONTEXT
+
+    /* 割込みハンドラ呼出し */
+    push        esp                     /* 割込み発生時コンテキスト */
+    push        INTNO_SYSCALL           /* 割込み番号               */
+    call        [ gIntmngHdlTbl + INTNO_SYSCALL * 4 ]
+    add         esp, 8
+
+    jmp         EntryExit
+
+/*----------------------------------------------------------------------------*/
+/* SYSENTER入口                                                               */
+/*----------------------------------------------------------------------------*/
+/*
+ * SYSENTER ESP MSRにはTSSのESP0フィールドのアドレスを設定しており、タスク切替
+ * え毎に更新される実行中タスクのカーネルスタックを最初に取得する。int命令と同
+ * じ割込み発生時コンテキストを構築してシステムコール割込み番号の割込みハンド
+ * ラを呼び出し、SYSEXIT命令で復帰する。呼出し元は復帰先のESPをECXレジスタ
+ * に、EIPをEDXレジスタに設定する。
+ */
+IntmngEntrySysenter:
+    /* カーネルスタック切替え */
+    mov         esp, [ esp ]
+
+    /* 割込みリターン情報作成 */
+    push        SEGSEL_APL_DATA         /* ss     */
+    push        ecx                     /* esp    */
+    pushfd                              /* eflags */
+    or          DWORD PTR [ esp ], EFLAGS_IF
+    push        SEGSEL_APL_CODE         /* cs     */
+    push        edx                     /* eip    */
+
+    push        0                       /* 空エラーコード */
+    push        INTNO_SYSCALL           /* 割込み番号     */
+    SAVE_CONTEXT
+
+    /* 割込みハンドラ呼出し */
+    push        esp                     /* 割込み発生時コンテキスト */
+    push        INTNO_SYSCALL           /* 割込み番号               */
+    call        [ gIntmngHdlTbl + INTNO_SYSCALL * 4 ]
+    add         esp, 8
+
+    /* コンテキスト復帰 */
+    popad
+    pop         ds
+    pop         es
+    pop         fs
+    pop         gs
+
+    /* 割込み番号・エラーコード削除 */
+    add         esp, 8
+
+    /* 復帰 */
+    mov         edx, [ esp ]            /* eip */
+    mov         ecx, [ esp + 12 ]       /* esp */
+    sti
+    sysexit
+
+/*----------------------------------------------------------------------------*/
+/* 割込み番号毎入口                                                           */
+/*----------------------------------------------------------------------------*/
+    ENTRY_NOERR 0x00
+    ENTRY_NOERR 0x01
+    ENTRY_NOERR 0x02
+    ENTRY_NOERR 0x03
+    ENTRY_NOERR 0x04
+    ENTRY_NOERR 0x05
+    ENTRY_NOERR 0x06
+    ENTRY_NOERR 0x07
+    ENTRY_ERR   0x08
+    ENTRY_NOERR 0x09
+    ENTRY_ERR   0x0A
+    ENTRY_ERR   0x0B
+    ENTRY_ERR   0x0C
+    ENTRY_ERR   0x0D
+    ENTRY_ERR   0x0E
+    ENTRY_NOERR 0x0F
+    ENTRY_NOERR 0x10
+    ENTRY_ERR   0x11
+    ENTRY_NOERR 0x12
+    ENTRY_NOERR 0x13
+    ENTRY_NOERR 0x14
+    ENTRY_NOERR 0x15
+    ENTRY_NOERR 0x16
+    ENTRY_NOERR 0x17
+    ENTRY_NOERR 0x18
+    ENTRY_NOERR 0x19
+    ENTRY_NOERR 0x1A
+    ENTRY_NOERR 0x1B
+    ENTRY_NOERR 0x1C
+    ENTRY_NOERR 0x1D
+    ENTRY_NOERR 0x1E
+    ENTRY_NOERR 0x1F
+    ENTRY_NOERR 0x21
+    ENTRY_NOERR 0x22
+    ENTRY_NOERR 0x23
+    ENTRY_NOERR 0x24
+    ENTRY_NOERR 0x25
+    ENTRY_NOERR 0x26
+    ENTRY_NOERR 0x27
+    ENTRY_NOERR 0x28
+    ENTRY_NOERR 0x29
+    ENTRY_NOERR 0x2A
+    ENTRY_NOERR 0x2B
+    ENTRY_NOERR 0x2C
+    ENTRY_NOERR 0x2D
+    ENTRY_NOERR 0x2E
+    ENTRY_NOERR 0x2F
+    ENTRY_NOERR 0x30
+    ENTRY_NOERR 0x31
+    ENTRY_NOERR 0x32
+    ENTRY_NOERR 0x33
+    ENTRY_NOERR 0x34
+    ENTRY_NOERR 0x35
+    ENTRY_NOERR 0x36
+    ENTRY_NOERR 0x37
+    ENTRY_NOERR 0x38
+    ENTRY_NOERR 0x39
+    ENTRY_NOERR 0x3A
+    ENTRY_NOERR 0x3B
+    ENTRY_NOERR 0x3C
+    ENTRY_NOERR 0x3E
+    ENTRY_NOERR 0x3F
+    ENTRY_NOERR 0x40
+    ENTRY_NOERR 0x41
+    ENTRY_NOERR 0x42
+    ENTRY_NOERR 0x43
+    ENTRY_NOERR 0x44
+    ENTRY_NOERR 0x45
+    ENTRY_NOERR 0x46
+    ENTRY_NOERR 0x47
+    ENTRY_NOERR 0x48
+    ENTRY_NOERR 0x49
+    ENTRY_NOERR 0x4A
+    ENTRY_NOERR 0x4B
+    ENTRY_NOERR 0x4C
+    ENTRY_NOERR 0x4D
+    ENTRY_NOERR 0x4E
+    ENTRY_NOERR 0x4F
+    ENTRY_NOERR 0x50
+    ENTRY_NOERR 0x51
+    ENTRY_NOERR 0x52
+    ENTRY_NOERR 0x53
+    ENTRY_NOERR 0x54
+    ENTRY_NOERR 0x55
+    ENTRY_NOERR 0x56
+    ENTRY_NOERR 0x57
+    ENTRY_NOERR 0x58
+    ENTRY_NOERR 0x59
+    ENTRY_NOERR 0x5A
+    ENTRY_NOERR 0x5B
+    ENTRY_NOERR 0x5C
+    ENTRY_NOERR 0x5D
+    ENTRY_NOERR 0x5E
+    ENTRY_NOERR 0x5F
+    ENTRY_NOERR 0x60
+    ENTRY_NOERR 0x61
+    ENTRY_NOERR 0x62
+    ENTRY_NOERR 0x63
+    ENTRY_NOERR 0x64
+    ENTRY_NOERR 0x65
+    ENTRY_NOERR 0x66
+    ENTRY_NOERR 0x67
+    ENTRY_NOERR 0x68
+    ENTRY_NOERR 0x69
+    ENTRY_NOERR 0x6A
+    ENTRY_NOERR 0x6B
+    ENTRY_NOERR 0x6C
+    ENTRY_NOERR 0x6D
+    ENTRY_NOERR 0x6E
+    ENTRY_NOERR 0x6F
+    ENTRY_NOERR 0x70
+    ENTRY_NOERR 0x71
+    ENTRY_NOERR 0x72
+    ENTRY_NOERR 0x73
+    ENTRY_NOERR 0x74
+    ENTRY_NOERR 0x75
+    ENTRY_NOERR 0x76
+    ENTRY_NOERR 0x77
+    ENTRY_NOERR 0x78
+    ENTRY_NOERR 0x79
+    ENTRY_NOERR 0x7A
+    ENTRY_NOERR 0x7B
+    ENTRY_NOERR 0x7C
+    ENTRY_NOERR 0x7D
+    ENTRY_NOERR 0x7E
+    ENTRY_NOERR 0x7F
+    ENTRY_NOERR 0x80
+    ENTRY_NOERR 0x81
+    ENTRY_NOERR 0x82
+    ENTRY_NOERR 0x83
+    ENTRY_NOERR 0x84
+    ENTRY_NOERR 0x85
+    ENTRY_NOERR 0x86
+    ENTRY_NOERR 0x87
+    ENTRY_NOERR 0x88
+    ENTRY_NOERR 0x89
+    ENTRY_NOERR 0x8A
+    ENTRY_NOERR 0x8B
+    ENTRY_NOERR 0x8C
+    ENTRY_NOERR 0x8D
+    ENTRY_NOERR 0x8E
+    ENTRY_NOERR 0x8F
+    ENTRY_NOERR 0x90
+    ENTRY_NOERR 0x91
+    ENTRY_NOERR 0x92
+    ENTRY_NOERR 0x93
+    ENTRY_NOERR 0x94
+    ENTRY_NOERR 0x95
+    ENTRY_NOERR 0x96
+    ENTRY_NOERR 0x97
+    ENTRY_NOERR 0x98
+    ENTRY_NOERR 0x99
+    ENTRY_NOERR 0x9A
+    ENTRY_NOERR 0x9B
+    ENTRY_NOERR 0x9C
+    ENTRY_NOERR 0x9D
+    ENTRY_NOERR 0x9E
+    ENTRY_NOERR 0x9F
+    ENTRY_NOERR 0xA0
+    ENTRY_NOERR 0xA1
+    ENTRY_NOERR 0xA2
+    ENTRY_NOERR 0xA3
+    ENTRY_NOERR 0xA4
+    ENTRY_NOERR 0xA5
+    ENTRY_NOERR 0xA6
+    ENTRY_NOERR 0xA7
+    ENTRY_NOERR 0xA8
+    ENTRY_NOERR 0xA9
+    ENTRY_NOERR 0xAA
+    ENTRY_NOERR 0xAB
+    ENTRY_NOERR 0xAC
+    ENTRY_NOERR 0xAD
+    ENTRY_NOERR 0xAE
+    ENTRY_NOERR 0xAF
+    ENTRY_NOERR 0xB0
+    ENTRY_NOERR 0xB1
+    ENTRY_NOERR 0xB2
+    ENTRY_NOERR 0xB3
+    ENTRY_NOERR 0xB4
+    ENTRY_NOERR 0xB5
+    ENTRY_NOERR 0xB6
+    ENTRY_NOERR 0xB7
+    ENTRY_NOERR 0xB8
+    ENTRY_NOERR 0xB9
+    ENTRY_NOERR 0xBA
+    ENTRY_NOERR 0xBB
+    ENTRY_NOERR 0xBC
+    ENTRY_NOERR 0xBD
+    ENTRY_NOERR 0xBE
+    ENTRY_NOERR 0xBF
+    ENTRY_NOERR 0xC0
+    ENTRY_NOERR 0xC1
+    ENTRY_NOERR 0xC2
+    ENTRY_NOERR 0xC3
+    ENTRY_NOERR 0xC4
+    ENTRY_NOERR 0xC5
+    ENTRY_NOERR 0xC6
+    ENTRY_NOERR 0xC7
+    ENTRY_NOERR 0xC8
+    ENTRY_NOERR 0xC9
+    ENTRY_NOERR 0xCA
+    ENTRY_NOERR 0xCB
+    ENTRY_NOERR 0xCC
+    ENTRY_NOERR 0xCD
+    ENTRY_NOERR 0xCE
+    ENTRY_NOERR 0xCF
+    ENTRY_NOERR 0xD0
+    ENTRY_NOERR 0xD1
+    ENTRY_NOERR 0xD2
+    ENTRY_NOERR 0xD3
+    ENTRY_NOERR 0xD4
+    ENTRY_NOERR 0xD5
+    ENTRY_NOERR 0xD6
+    ENTRY_NOERR 0xD7
+    ENTRY_NOERR 0xD8
+    ENTRY_NOERR 0xD9
+    ENTRY_NOERR 0xDA
+    ENTRY_NOERR 0xDB
+    ENTRY_NOERR 0xDC
+    ENTRY_NOERR 0xDD
+    ENTRY_NOERR 0xDE
+    ENTRY_NOERR 0xDF
+    ENTRY_NOERR 0xE0
+    ENTRY_NOERR 0xE1
+    ENTRY_NOERR 0xE2
+    ENTRY_NOERR 0xE3
+    ENTRY_NOERR 0xE4
+    ENTRY_NOERR 0xE5
+    ENTRY_NOERR 0xE6
+    ENTRY_NOERR 0xE7
+    ENTRY_NOERR 0xE8
+    ENTRY_NOERR 0xE9
+    ENTRY_NOERR 0xEA
+    ENTRY_NOERR 0xEB
+    ENTRY_NOERR 0xEC
+    ENTRY_NOERR 0xED
+    ENTRY_NOERR 0xEE
+    ENTRY_NOERR 0xEF
+    ENTRY_NOERR 0xF0
+    ENTRY_NOERR 0xF1
+    ENTRY_NOERR 0xF2
+    ENTRY_NOERR 0xF3
+    ENTRY_NOERR 0xF4
+    ENTRY_NOERR 0xF5
+    ENTRY_NOERR 0xF6
+    ENTRY_NOERR 0xF7
+    ENTRY_NOERR 0xF8
+    ENTRY_NOERR 0xF9
+    ENTRY_NOERR 0xFA
+    ENTRY_NOERR 0xFB
+    ENTRY_NOERR 0xFC
+    ENTRY_NOERR 0xFD
+    ENTRY_NOERR 0xFE
+    ENTRY_NOERR 0xFF
+
+/******************************************************************************/
+/* RODATAセクション                                                           */
+/******************************************************************************/
+.section .rodata
+
+/** 割込み入口テーブル */
+.align 4
+gIntmngEntryTbl:
+    .long       Entry0x00, Entry0x01, Entry0x02, Entry0x03
+    .long       Entry0x04, Entry0x05, Entry0x06, Entry0x07
+    .long       Entry0x08, Entry0x09, Entry0x0A, Entry0x0B
+    .long       Entry0x0C, Entry0x0D, Entry0x0E, Entry0x0F
+    .long       Entry0x10, Entry0x11, Entry0x12, Entry0x13
+    .long       Entry0x14, Entry0x15, Entry0x16, Entry0x17
+    .long       Entry0x18, Entry0x19, Entry0x1A, Entry0x1B
+    .long       Entry0x1C, Entry0x1D, Entry0x1E, Entry0x1F
+    .long       EntryTimer, Entry0x21, Entry0x22, Entry0x23
+    .long       Entry0x24, Entry0x25, Entry0x26, Entry0x27
+    .long       Entry0x28, Entry0x29, Entry0x2A, Entry0x2B
+    .long       Entry0x2C, Entry0x2D, Entry0x2E, Entry0x2F
+    .long       Entry0x30, Entry0x31, Entry0x32, Entry0x33
+    .long       Entry0x34, Entry0x35, Entry0x36, Entry0x37
+    .long       Entry0x38, Entry0x39, Entry0x3A, Entry0x3B
+    .long       Entry0x3C, EntrySyscall, Entry0x3E, Entry0x3F
+    .long       Entry0x40, Entry0x41, Entry0x42, Entry0x43
+    .long       Entry0x44, Entry0x45, Entry0x46, Entry0x47
+    .long       Entry0x48, Entry0x49, Entry0x4A, Entry0x4B
+    .long       Entry0x4C, Entry0x4D, Entry0x4E, Entry0x4F
+    .long       Entry0x50, Entry0x51, Entry0x52, Entry0x53
+    .long       Entry0x54, Entry0x55, Entry0x56, Entry0x57
+    .long       Entry0x58, Entry0x59, Entry0x5A, Entry0x5B
+    .long       Entry0x5C, Entry0x5D, Entry0x5E, Entry0x5F
+    .long       Entry0x60, Entry0x61, Entry0x62, Entry0x63
+    .long       Entry0x64, Entry0x65, Entry0x66, Entry0x67
+    .long       Entry0x68, Entry0x69, Entry0x6A, Entry0x6B
+    .long       Entry0x6C, Entry0x6D, Entry0x6E, Entry0x6F
+    .long       Entry0x70, Entry0x71, Entry0x72, Entry0x73
+    .long       Entry0x74, Entry0x75, Entry0x76, Entry0x77
+    .long       Entry0x78, Entry0x79, Entry0x7A, Entry0x7B
+    .long       Entry0x7C, Entry0x7D, Entry0x7E, Entry0x7F
+    .long       Entry0x80, Entry0x81, Entry0x82, Entry0x83
+    .long       Entry0x84, Entry0x85, Entry0x86, Entry0x87
+    .long       Entry0x88, Entry0x89, Entry0x8A, Entry0x8B
+    .long       Entry0x8C, Entry0x8D, Entry0x8E, Entry0x8F
+    .long       Entry0x90, Entry0x91, Entry0x92, Entry0x93
+    .long       Entry0x94, Entry0x95, Entry0x96, Entry0x97
+    .long       Entry0x98, Entry0x99, Entry0x9A, Entry0x9B
+    .long       Entry0x9C, Entry0x9D, Entry0x9E, Entry0x9F
+    .long       Entry0xA0, Entry0xA1, Entry0xA2, Entry0xA3
+    .long       Entry0xA4, Entry0xA5, Entry0xA6, Entry0xA7
+    .long       Entry0xA8, Entry0xA9, Entry0xAA, Entry0xAB
+    .long       Entry0xAC, Entry0xAD, Entry0xAE, Entry0xAF
+    .long       Entry0xB0, Entry0xB1, Entry0xB2, Entry0xB3
+    .long       Entry0xB4, Entry0xB5, Entry0xB6, Entry0xB7
+    .long       Entry0xB8, Entry0xB9, Entry0xBA, Entry0xBB
+    .long       Entry0xBC, Entry0xBD, Entry0xBE, Entry0xBF
+    .long       Entry0xC0, Entry0xC1, Entry0xC2, Entry0xC3
+    .long       Entry0xC4, Entry0xC5, Entry0xC6, Entry0xC7
+    .long       Entry0xC8, Entry0xC9, Entry0xCA, Entry0xCB
+    .long       Entry0xCC, Entry0xCD, Entry0xCE, Entry0xCF
+    .long       Entry0xD0, Entry0xD1, Entry0xD2, Entry0xD3
+    .long       Entry0xD4, Entry0xD5, Entry0xD6, Entry0xD7
+    .long       Entry0xD8, Entry0xD9, Entry0xDA, Entry0xDB
+    .long       Entry0xDC, Entry0xDD, Entry0xDE, Entry0xDF
+    .long       Entry0xE0, Entry0xE1, Entry0xE2, Entry0xE3
+    .long       Entry0xE4, Entry0xE5, Entry0xE6, Entry0xE7
+    .long       Entry0xE8, Entry0xE9, Entry0xEA, Entry0xEB
+    .long       Entry0xEC, Entry0xED, Entry0xEE, Entry0xEF
+    .long       Entry0xF0, Entry0xF1, Entry0xF2, Entry0xF3
+    .long       Entry0xF4, Entry0xF5, Entry0xF6, Entry0xF7
+    .long       Entry0xF8, Entry0xF9, Entry0xFA, Entry0xFB
+    .long       Entry0xFC, Entry0xFD, Entry0xFE, Entry0xFF
+
+
+/******************************************************************************/
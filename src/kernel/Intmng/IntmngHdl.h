@@ -1,15 +1,47 @@
 /******************************************************************************/
 /*                                                                            */
 /* src/kernel/Intmng/IntmngHdl.h                                              */
-/*                                                                 2021/11/27 */
-/* Copyright (C) 2016-2021 Mochi.                                             */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2016-2026 Mochi.                                             */
 /*                                                                            */
 /******************************************************************************/
 #ifndef INTMNG_HDL_H
 #define INTMNG_HDL_H
+/******************************************************************************/
+/* インクルード                                                               */
+/******************************************************************************/
+/* 標準ヘッダ */
+#include <stdint.h>
+
+/* 外部モジュールヘッダ */
+#include <Intmng.h>
+
+
+/******************************************************************************/
+/* 定義                                                                       */
+/******************************************************************************/
+/** 割込み入口型 */
+typedef void ( *IntmngEntry_t )( void );
+
+
+/******************************************************************************/
+/* グローバル変数宣言                                                         */
+/******************************************************************************/
+/** 割込み入口テーブル(IntmngEntry.s) */
+extern const IntmngEntry_t gIntmngEntryTbl[ INTMNG_INT_NO_NUM ];
+/** 割込みハンドラ管理テーブル */
+extern IntmngHdl_t gIntmngHdlTbl[ INTMNG_INT_NO_NUM ];
+
+
 /******************************************************************************/
 /* グローバル関数宣言                                                         */
 /******************************************************************************/
+/* SYSENTER入口(IntmngEntry.s) */
+extern void IntmngEntrySysenter( void );
+
+/* 割込みハンドラ取得 */
+extern IntmngHdl_t IntmngHdlGet( uint32_t intNo );
+
 /* ハンドラ管理初期化 */
 extern void IntmngHdlInit( void );
 
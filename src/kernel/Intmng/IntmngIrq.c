@@ -0,0 +1,317 @@
+/******************************************************************************/
+/*                                                                            */
+/* src/kernel/Intmng/IntmngIrq.c                                              */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2026 Mochi.                                                  */
+/*                                                                            */
+/******************************************************************************/
+/******************************************************************************/
+/* インクルード                                                               */
+/******************************************************************************/
+/* 標準ヘッダ */
+#include <stdbool.h>
+#include <stdint.h>
+
+/* 外部モジュールヘッダ */
+#include <Cmn.h>
+#include <Debug.h>
+#include <Intmng.h>
+
+/* 内部モジュールヘッダ */
+#include "IntmngApic.h"
+#include "IntmngIrq.h"
+#include "IntmngPic.h"
+
+
+/******************************************************************************/
+/* 定義                                                                       */
+/******************************************************************************/
+/* モジュールID */
+#define _MODULE_ID_ CMN_MODULE_INTMNG_IRQ
+
+/* 割込みコントローラ定義 */
+#define IRQ_CTRL_PIC  ( 0 )     /**< PIC  */
+#define IRQ_CTRL_APIC ( 1 )     /**< APIC */
+
+
+/******************************************************************************/
+/* 変数定義                                                                   */
+/******************************************************************************/
+/** 使用割込みコントローラ */
+static uint8_t gCtrl;
+
+
+/******************************************************************************/
+/* グローバル関数定義                                                         */
+/******************************************************************************/
+/******************************************************************************/
+/**
+ * @brief       IRQ割込み許可
+ * @details     割込みコントローラに指定したIRQ番号の割込み許可設定を行う。
+ *
+ * @param[in]   irqNo IRQ番号
+ */
+/******************************************************************************/
+void IntmngIrqAllow( uint8_t irqNo )
+{
+    /* 割込みコントローラ判定 */
+    if ( gCtrl == IRQ_CTRL_APIC ) {
+        /* APIC */
+
+        IntmngApicAllowIrq( irqNo );
+
+    } else {
+        /* PIC */
+
+        IntmngPicAllowIrq( irqNo );
+    }
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       IRQ割込み処理完了
+ * @details     タスクに委譲したIRQ割込みの処理完了を割込みコントローラに通知
+ *              する。PICはEOIを通知し、APICは委譲時のマスクを解除する。
+ *
+ * @param[in]   irqNo IRQ番号
+ */
+/******************************************************************************/
+void IntmngIrqComplete( uint8_t irqNo )
+{
+    /* 割込みコントローラ判定 */
+    if ( gCtrl == IRQ_CTRL_APIC ) {
+        /* APIC */
+
+        IntmngApicComplete( irqNo );
+
+    } else {
+        /* PIC */
+
+        IntmngPicEoi( irqNo );
+    }
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       IRQ割込み処理委譲
+ * @details     IRQ割込みの処理をタスクに委譲する事を割込みコントローラに通知
+ *              する。PICはEOIを処理完了まで遅延する為、何もしない。
+ *
+ * @param[in]   irqNo IRQ番号
+ */
+/******************************************************************************/
+void IntmngIrqDefer( uint8_t irqNo )
+{
+    /* 割込みコントローラ判定 */
+    if ( gCtrl == IRQ_CTRL_APIC ) {
+        /* APIC */
+
+        IntmngApicDefer( irqNo );
+    }
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       IRQ割込み拒否
+ * @details     割込みコントローラに指定したIRQ番号の割込み拒否設定を行う。
+ *
+ * @param[in]   irqNo IRQ番号
+ */
+/******************************************************************************/
+void IntmngIrqDeny( uint8_t irqNo )
+{
+    /* 割込みコントローラ判定 */
+    if ( gCtrl == IRQ_CTRL_APIC ) {
+        /* APIC */
+
+        IntmngApicDenyIrq( irqNo );
+
+    } else {
+        /* PIC */
+
+        IntmngPicDenyIrq( irqNo );
+    }
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       IRQ割込み無効化
+ * @details     割込みコントローラの割込みを無効化する。
+ */
+/******************************************************************************/
+void IntmngIrqDisable( void )
+{
+    /* 割込みコントローラ判定 */
+    if ( gCtrl == IRQ_CTRL_APIC ) {
+        /* APIC */
+
+        IntmngApicDisable();
+
+    } else {
+        /* PIC */
+
+        IntmngPicDisable();
+    }
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       IRQ割込み有効化
+ * @details     割込みコントローラの割込みを有効化する。
+ */
+/******************************************************************************/
+void IntmngIrqEnable( void )
+{
+    /* 割込みコントローラ判定 */
+    if ( gCtrl == IRQ_CTRL_APIC ) {
+        /* APIC */
+
+        IntmngApicEnable();
+
+    } else {
+        /* PIC */
+
+        IntmngPicEnable();
+    }
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       IRQ割込みEOI通知
+ * @details     カーネル内で処理を完了したIRQ割込みのEOIを割込みコントローラ
+ *              に通知する。
+ *
+ * @param[in]   irqNo IRQ番号
+ */
+/******************************************************************************/
+void IntmngIrqEoi( uint8_t irqNo )
+{
+    /* 割込みコントローラ判定 */
+    if ( gCtrl == IRQ_CTRL_APIC ) {
+        /* APIC */
+
+        IntmngApicEoi();
+
+    } else {
+        /* PIC */
+
+        IntmngPicEoi( irqNo );
+    }
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       IRQ数取得
+ * @details     割込みコントローラで使用可能なIRQ数を取得する。
+ *
+ * @return      IRQ数を返す。
+ */
+/******************************************************************************/
+uint8_t IntmngIrqGetNum( void )
+{
+    /* 割込みコントローラ判定 */
+    if ( gCtrl == IRQ_CTRL_APIC ) {
+        /* APIC */
+
+        return IntmngApicGetIrqNum();
+    }
+
+    return INTMNG_IRQ_ISA_NUM;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       IRQ管理初期化
+ * @details     PICを初期化して全IRQをマスクした後、APICを初期化する。APICの
+ *              初期化に成功した場合はAPICを、失敗した場合はPICを使用する。
+ */
+/******************************************************************************/
+void IntmngIrqInit( void )
+{
+    CmnRet_t ret;   /* 戻り値 */
+
+    /* 初期化 */
+    ret = CMN_FAILURE;
+
+    DEBUG_LOG_TRC( "%s() start.", __func__ );
+
+    /* PIC管理初期化 */
+    IntmngPicInit();
+
+    /* APIC管理初期化 */
+    ret = IntmngApicInit();
+
+    /* 初期化結果判定 */
+    if ( ret == CMN_SUCCESS ) {
+        /* 成功 */
+
+        gCtrl = IRQ_CTRL_APIC;
+
+    } else {
+        /* 失敗 */
+
+        gCtrl = IRQ_CTRL_PIC;
+    }
+
+    DEBUG_LOG_TRC( "%s() end. ctrl=%u", __func__, gCtrl );
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       IRQレベルトリガ判定
+ * @details     指定したIRQ番号の割込みがレベルトリガか判定する。APICはリダイ
+ *              レクションテーブルの設定、PICはELCRの設定で判定する。
+ *
+ * @param[in]   irqNo IRQ番号
+ *
+ * @return      判定結果を返す。
+ * @retval      true  レベルトリガ
+ * @retval      false エッジトリガ
+ */
+/******************************************************************************/
+bool IntmngIrqIsLevel( uint8_t irqNo )
+{
+    bool level; /* レベルトリガ */
+
+    /* 割込みコントローラ判定 */
+    if ( gCtrl == IRQ_CTRL_APIC ) {
+        /* APIC */
+
+        level = IntmngApicIsLevel( irqNo );
+
+    } else {
+        /* PIC */
+
+        level = IntmngPicIsLevel( irqNo );
+    }
+
+    return level;
+}
+
+
+/******************************************************************************/
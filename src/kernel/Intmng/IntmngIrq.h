@@ -0,0 +1,18 @@
+/******************************************************************************/
+/*                                                                            */
+/* src/kernel/Intmng/IntmngIrq.h                                              */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2026 Mochi.                                                  */
+/*                                                                            */
+/******************************************************************************/
+#ifndef INTMNG_IRQ_H
+#define INTMNG_IRQ_H
+/******************************************************************************/
+/* グローバル関数宣言                                                         */
+/******************************************************************************/
+/* IRQ管理初期化 */
+extern void IntmngIrqInit( void );
+
+
+/******************************************************************************/
+#endif
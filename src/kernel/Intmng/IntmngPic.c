@@ -1,8 +1,8 @@
 /******************************************************************************/
 /*                                                                            */
 /* src/kernel/Intmng/IntmngPic.c                                              */
-/*                                                                 2024/06/01 */
-/* Copyright (C) 2016-2024 Mochi.                                             */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2016-2026 Mochi.                                             */
 /*                                                                            */
 /******************************************************************************/
 /******************************************************************************/
@@ -10,6 +10,7 @@
 /******************************************************************************/
 /* 標準ヘッダ */
 #include <stdarg.h>
+#include <stdbool.h>
 
 /* 共通ヘッダ */
 #include <hardware/IA32/IA32Instruction.h>
@@ -21,6 +22,7 @@
 
 /* 内部モジュールヘッダ */
 #include "Intmng.h"
+#include "IntmngPic.h"
 
 
 /******************************************************************************/
@@ -40,9 +42,9 @@
 
 /** PIC管理テーブル型 */
 typedef struct {
-    uint8_t maskState;          /**< PICマスク状態 */
-    uint8_t mask[ PIC_NUM ];    /**< PICマスク値   */
-    uint8_t reserved;           /**< パディング    */
+    uint8_t maskState;          /**< PICマスク状態       */
+    uint8_t mask[ PIC_NUM ];    /**< PICマスク値         */
+    uint8_t elcr[ PIC_NUM ];    /**< トリガモード設定値 */
 } picTbl_t;
 
 
@@ -82,6 +84,18 @@ void IntmngPicInit( void )
     gPicTbl.mask[ PIC_MASTER ] = 0xFF;
     gPicTbl.mask[ PIC_SLAVE  ] = 0xFF;
 
+    /* トリガモード取得 */
+    IA32InstructionInByte( &( gPicTbl.elcr[ PIC_MASTER ] ),
+                           I8259A_M_PORT_ELCR                );
+    IA32InstructionInByte( &( gPicTbl.elcr[ PIC_SLAVE  ] ),
+                           I8259A_S_PORT_ELCR                );
+
+    DEBUG_LOG_INF(
+        "ELCR: master=%#x, slave=%#x",
+        gPicTbl.elcr[ PIC_MASTER ],
+        gPicTbl.elcr[ PIC_SLAVE  ]
+    );
+
     /* 割込み無効化 */
     IntmngPicDisable();
 
@@ -332,4 +346,53 @@ void IntmngPicEoi( uint8_t irqNo )
 }
 
 
+/******************************************************************************/
+/**
+ * @brief       PICレベルトリガ判定
+ * @details     指定したIRQ番号の割込みがレベルトリガか判定する。トリガモード
+ *              は初期化時にELCR(Edge/Level Control Register)から取得した値で
+ *              判定する。
+ *
+ * @param[in]   irqNo IRQ番号
+ *                  - I8259A_IRQ0  IRQ0
+ *                  - I8259A_IRQ1  IRQ1
+ *                  - I8259A_IRQ2  IRQ2
+ *                  - I8259A_IRQ3  IRQ3
+ *                  - I8259A_IRQ4  IRQ4
+ *                  - I8259A_IRQ5  IRQ5
+ *                  - I8259A_IRQ6  IRQ6
+ *                  - I8259A_IRQ7  IRQ7
+ *                  - I8259A_IRQ8  IRQ8
+ *                  - I8259A_IRQ9  IRQ9
+ *                  - I8259A_IRQ10 IRQ10
+ *                  - I8259A_IRQ11 IRQ11
+ *                  - I8259A_IRQ12 IRQ12
+ *                  - I8259A_IRQ13 IRQ13
+ *                  - I8259A_IRQ14 IRQ14
+ *                  - I8259A_IRQ15 IRQ15
+ *
+ * @return      判定結果を返す。
+ * @retval      true  レベルトリガ
+ * @retval      false エッジトリガ
+ */
+/******************************************************************************/
+bool IntmngPicIsLevel( uint8_t irqNo )
+{
+    /* PIC割込み番号判定 */
+    if ( irqNo <= I8259A_IRQ7 ) {
+        /* PIC1（マスタ）向け割込み番号 */
+
+        return ( gPicTbl.elcr[ PIC_MASTER ] & ( 0x01 << irqNo ) ) != 0;
+
+    } else if ( irqNo < I8259A_IRQ_NUM ) {
+        /* PIC2（スレーブ）向け割込み番号 */
+
+        return ( gPicTbl.elcr[ PIC_SLAVE ] &
+                 ( 0x01 << ( irqNo - I8259A_IRQ8 ) ) ) != 0;
+    }
+
+    return false;
+}
+
+
 /******************************************************************************/
@@ -1,18 +1,44 @@
 /******************************************************************************/
 /*                                                                            */
 /* src/kernel/Intmng/IntmngPic.h                                              */
-/*                                                                 2021/11/27 */
-/* Copyright (C) 2016-2021 Mochi.                                             */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2016-2026 Mochi.                                             */
 /*                                                                            */
 /******************************************************************************/
 #ifndef INTMNG_PIC_H
 #define INTMNG_PIC_H
+/******************************************************************************/
+/* インクルード                                                               */
+/******************************************************************************/
+/* 標準ヘッダ */
+#include <stdbool.h>
+#include <stdint.h>
+
+
 /******************************************************************************/
 /* グローバル関数宣言                                                         */
 /******************************************************************************/
+/* PIC割込み許可 */
+extern void IntmngPicAllowIrq( uint8_t irqNo );
+
+/* PIC割込み拒否 */
+extern void IntmngPicDenyIrq( uint8_t irqNo );
+
+/* PIC割込み無効化 */
+extern void IntmngPicDisable( void );
+
+/* PIC割込み有効化 */
+extern void IntmngPicEnable( void );
+
+/* PIC割込みEOI通知 */
+extern void IntmngPicEoi( uint8_t irqNo );
+
 /* PIC管理初期化 */
 extern void IntmngPicInit( void );
 
+/* PICレベルトリガ判定 */
+extern bool IntmngPicIsLevel( uint8_t irqNo );
+
 
 /******************************************************************************/
 #endif
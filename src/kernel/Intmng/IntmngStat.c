@@ -0,0 +1,712 @@
+/******************************************************************************/
+/*                                                                            */
+/* src/kernel/Intmng/IntmngStat.c                                             */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2026 Mochi.                                                  */
+/*                                                                            */
+/******************************************************************************/
+#ifdef INTMNG_STAT_ENABLE
+/******************************************************************************/
+/* インクルード                                                               */
+/******************************************************************************/
+/* 標準ヘッダ */
+#include <stdint.h>
+
+/* ライブラリヘッダ */
+#include <MLib/MLib.h>
+#include <MLib/MLibUtil.h>
+
+/* カーネルヘッダ */
+#include <kernel/kernel.h>
+#include <kernel/syscall.h>
+#include <kernel/sysstat.h>
+#include <kernel/types.h>
+
+/* 共通ヘッダ */
+#include <memmap.h>
+#include <hardware/IA32/IA32.h>
+
+/* 外部モジュールヘッダ */
+#include <Cmn.h>
+#include <Debug.h>
+#include <Intmng.h>
+#include <Taskmng.h>
+#include <Timermng.h>
+
+/* 内部モジュールヘッダ */
+#include "IntmngStat.h"
+
+
+/******************************************************************************/
+/* 定義                                                                       */
+/******************************************************************************/
+/* モジュールID */
+#define _MODULE_ID_ CMN_MODULE_INTMNG_STAT
+
+/** 統計格納先アドレス最大 */
+#define BUFFER_ADDR_MAX                                  \
+    ( MEMMAP_VADDR_USER_SHARED -                         \
+      sizeof ( MkSysStat_t ) * MK_SYSSTAT_PROCTYPE_NUM )
+
+/** 割込み遅延統計格納先アドレス最大 */
+#define INTSTAT_BUFFER_ADDR_MAX                          \
+    ( MEMMAP_VADDR_USER_SHARED -                         \
+      sizeof ( MkIntStat_t ) * MK_INTSTAT_STAGE_NUM    )
+
+/** タイマ合体統計格納先アドレス最大 */
+#define TIMERSTAT_BUFFER_ADDR_MAX                        \
+    ( MEMMAP_VADDR_USER_SHARED - sizeof ( MkTimerStat_t ) )
+
+/** ヒストグラムパーセンタイル(p50) */
+#define PERCENTILE_50 ( 50 )
+/** ヒストグラムパーセンタイル(p99) */
+#define PERCENTILE_99 ( 99 )
+
+/** 割込み遅延計測中情報型 */
+typedef struct {
+    MkTaskId_t taskId;          /**< 計測中タスクID          */
+    uint8_t    irqNo;           /**< IRQ番号                 */
+    uint8_t    reserved[ 3 ];   /**< 予約                    */
+    uint64_t   irqTsc;          /**< 割込み発生時TSC値       */
+    uint64_t   wakeTsc;         /**< スケジュール開始時TSC値 */
+    uint64_t   switchTsc;       /**< タスクスイッチ時TSC値   */
+} intPending_t;
+
+
+/******************************************************************************/
+/* ローカル関数宣言                                                           */
+/******************************************************************************/
+/* システムコール統計ログ出力 */
+static void DoDump( IA32Pushad_t *pReg );
+/* システムコール統計取得 */
+static void DoGet( IA32Pushad_t *pReg );
+/* 割込み遅延統計取得 */
+static void DoGetInt( IA32Pushad_t *pReg );
+/* タイマ合体統計取得 */
+static void DoGetTimer( IA32Pushad_t *pReg );
+/* ビン取得 */
+static uint32_t GetBin( uint64_t cycle );
+/* パーセンタイルビン取得 */
+static uint32_t GetPercentileBin( uint32_t count,
+                                  uint32_t *pBin,
+                                  uint32_t percent );
+/* システムコールハンドラ */
+static void HdlSys( uint32_t     no,
+                    IA32Pushad_t *pReg );
+
+
+/******************************************************************************/
+/* 静的グローバル変数定義                                                     */
+/******************************************************************************/
+/** システムコール統計テーブル */
+static MkSysStat_t gStatTbl[ MK_SYSSTAT_PROCTYPE_NUM ]
+                           [ MK_SYSCALL_NUM          ]
+                           [ MK_SYSSTAT_FUNCID_NUM   ];
+
+/** 割込み遅延統計テーブル */
+static MkIntStat_t gIntStatTbl[ INTMNG_IRQ_NUM ][ MK_INTSTAT_STAGE_NUM ];
+
+/** 割込み遅延計測中情報 */
+static intPending_t gIntPending;
+
+
+/******************************************************************************/
+/* モジュール内グローバル関数定義                                             */
+/******************************************************************************/
+/******************************************************************************/
+/**
+ * @brief       システムコール統計記録
+ * @details     呼出し元タスクのプロセスタイプ、システムコール番号、機能ID毎に
+ *              呼出し回数と処理時間を記録する。範囲外の機能IDは機能ID0に記録
+ *              する。
+ *
+ * @param[in]   taskId 呼出し元タスクID
+ * @param[in]   no     システムコール番号
+ * @param[in]   funcId 機能ID
+ * @param[in]   cycle  処理時間(TSC差)
+ */
+/******************************************************************************/
+void IntmngStatAdd( MkTaskId_t taskId,
+                    uint32_t   no,
+                    uint32_t   funcId,
+                    uint64_t   cycle   )
+{
+    uint8_t     type;   /* プロセスタイプ     */
+    uint32_t    bin;    /* ビン               */
+    uint32_t    max;    /* 処理時間(上限付き) */
+    MkSysStat_t *pStat; /* システムコール統計 */
+
+    /* 初期化 */
+    type  = TaskmngTaskGetType( taskId );
+    bin   = 0;
+    max   = UINT32_MAX;
+    pStat = NULL;
+
+    /* パラメータチェック */
+    if ( ( type >= MK_SYSSTAT_PROCTYPE_NUM ) ||
+         ( no   >= MK_SYSCALL_NUM          )    ) {
+        /* 範囲外 */
+
+        return;
+    }
+
+    /* 機能IDチェック */
+    if ( funcId >= MK_SYSSTAT_FUNCID_NUM ) {
+        /* 範囲外 */
+
+        funcId = 0;
+    }
+
+    /* 統計取得 */
+    pStat = &( gStatTbl[ type ][ no ][ funcId ] );
+
+    /* ビン取得 */
+    bin = GetBin( cycle );
+
+    /* 統計更新 */
+    pStat->count++;
+    pStat->total += cycle;
+    pStat->bin[ bin ]++;
+
+    /* 処理時間上限判定 */
+    if ( cycle < UINT32_MAX ) {
+        /* 上限未満 */
+
+        max = ( uint32_t ) cycle;
+    }
+
+    /* 最大値判定 */
+    if ( max > pStat->max ) {
+        /* 最大値更新 */
+
+        pStat->max = max;
+    }
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       システムコール統計初期化
+ * @details     システムコール統計テーブルと割込み遅延統計テーブルを初期化し、
+ *              統計取得とログ出力のシステムコールハンドラを設定する。タイマ
+ *              合体統計はタイマ制御が管理する。
+ */
+/******************************************************************************/
+void IntmngStatInit( void )
+{
+    DEBUG_LOG_TRC( "%s() start.", __func__ );
+
+    /* システムコール統計テーブル初期化 */
+    MLibUtilSetMemory8( gStatTbl, 0, sizeof ( gStatTbl ) );
+
+    /* 割込み遅延統計テーブル初期化 */
+    MLibUtilSetMemory8( gIntStatTbl, 0, sizeof ( gIntStatTbl ) );
+    gIntPending.taskId = MK_TASKID_NULL;
+
+    /* システムコールハンドラ設定 */
+    IntmngSysSet( MK_SYSCALL_SYSSTAT_GET,  HdlSys );
+    IntmngSysSet( MK_SYSCALL_SYSSTAT_DUMP, HdlSys );
+    IntmngSysSet( MK_SYSCALL_INTSTAT_GET,  HdlSys );
+    IntmngSysSet( MK_SYSCALL_TIMERSTAT_GET, HdlSys );
+
+    DEBUG_LOG_TRC( "%s() end.", __func__ );
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       割込み遅延記録
+ * @details     割込み遅延計測中のタスクがユーザモードに復帰する時に、割込み発
+ *              生からの各区間の遅延をIRQ毎に記録する。計測中のタスク以外の復
+ *              帰の場合は計測を破棄する。
+ *
+ * @param[in]   taskId 復帰するタスクID
+ * @param[in]   tsc    ユーザモード復帰時TSC値
+ */
+/******************************************************************************/
+void IntmngStatIntEnd( MkTaskId_t taskId,
+                       uint64_t   tsc     )
+{
+    uint64_t    cycle;  /* 遅延           */
+    uint32_t    bin;    /* ビン           */
+    uint32_t    stage;  /* 区間           */
+    MkIntStat_t *pStat; /* 割込み遅延統計 */
+
+    /* 初期化 */
+    cycle = 0;
+    bin   = 0;
+    pStat = NULL;
+
+    /* 計測中判定 */
+    if ( gIntPending.taskId != taskId ) {
+        /* 計測中でない */
+
+        /* 計測破棄 */
+        gIntPending.taskId = MK_TASKID_NULL;
+
+        return;
+    }
+
+    /* 区間毎に繰り返す */
+    for ( stage = 0; stage < MK_INTSTAT_STAGE_NUM; stage++ ) {
+        /* 区間判定 */
+        if ( stage == MK_INTSTAT_STAGE_WAKE ) {
+            /* 割込み発生→スケジュール開始 */
+
+            cycle = gIntPending.wakeTsc - gIntPending.irqTsc;
+
+        } else if ( stage == MK_INTSTAT_STAGE_SWITCH ) {
+            /* スケジュール開始→タスクスイッチ */
+
+            cycle = gIntPending.switchTsc - gIntPending.wakeTsc;
+
+        } else if ( stage == MK_INTSTAT_STAGE_RETURN ) {
+            /* タスクスイッチ→ユーザモード復帰 */
+
+            cycle = tsc - gIntPending.switchTsc;
+
+        } else {
+            /* 割込み発生→ユーザモード復帰 */
+
+            cycle = tsc - gIntPending.irqTsc;
+        }
+
+        /* 統計取得 */
+        pStat = &( gIntStatTbl[ gIntPending.irqNo ][ stage ] );
+
+        /* 遅延上限判定 */
+        if ( cycle > UINT32_MAX ) {
+            /* 上限超過 */
+
+            cycle = UINT32_MAX;
+        }
+
+        /* ビン取得 */
+        bin = GetBin( cycle );
+
+        /* 最小値判定 */
+        if ( ( pStat->count       == 0          ) ||
+             ( ( uint32_t ) cycle <  pStat->min )    ) {
+            /* 最小値更新 */
+
+            pStat->min = ( uint32_t ) cycle;
+        }
+
+        /* 最大値判定 */
+        if ( ( uint32_t ) cycle > pStat->max ) {
+            /* 最大値更新 */
+
+            pStat->max = ( uint32_t ) cycle;
+        }
+
+        /* 統計更新 */
+        pStat->count++;
+        pStat->total += cycle;
+        pStat->bin[ bin ]++;
+    }
+
+    /* 計測終了 */
+    gIntPending.taskId = MK_TASKID_NULL;
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       割込み遅延計測設定
+ * @details     割込み待ち合わせから復帰したタスクの割込み発生時、スケジュール
+ *              開始時、タスクスイッチ時のTSC値を設定し、ユーザモード復帰時に
+ *              記録する。タスクスイッチ時TSC値がスケジュール開始前の場合はス
+ *              ケジュール開始時TSC値とする。
+ *
+ * @param[in]   taskId    タスクID
+ * @param[in]   irqNo     IRQ番号
+ * @param[in]   irqTsc    割込み発生時TSC値
+ * @param[in]   wakeTsc   スケジュール開始時TSC値
+ * @param[in]   switchTsc タスクスイッチ時TSC値
+ */
+/******************************************************************************/
+void IntmngStatIntSet( MkTaskId_t taskId,
+                       uint8_t    irqNo,
+                       uint64_t   irqTsc,
+                       uint64_t   wakeTsc,
+                       uint64_t   switchTsc )
+{
+    /* パラメータチェック */
+    if ( ( irqNo >= INTMNG_IRQ_NUM ) || ( wakeTsc < irqTsc ) ) {
+        /* 不正 */
+
+        return;
+    }
+
+    /* タスクスイッチ時TSC値判定 */
+    if ( switchTsc < wakeTsc ) {
+        /* スケジュール開始前 */
+
+        switchTsc = wakeTsc;
+    }
+
+    /* 割込み遅延計測中情報設定 */
+    gIntPending.taskId    = taskId;
+    gIntPending.irqNo     = irqNo;
+    gIntPending.irqTsc    = irqTsc;
+    gIntPending.wakeTsc   = wakeTsc;
+    gIntPending.switchTsc = switchTsc;
+
+    return;
+}
+
+
+/******************************************************************************/
+/* ローカル関数定義                                                           */
+/******************************************************************************/
+/******************************************************************************/
+/**
+ * @brief           システムコール統計ログ出力
+ * @details         呼出しの有ったシステムコール統計と計測の有った割込み遅延統
+ *                  計、タイマ合体統計をログ出力する。停止前に呼び出すことで実
+ *                  行期間全体の統計を残す。
+ *
+ * @param[in,out]   *pReg 汎用レジスタ
+ */
+/******************************************************************************/
+static void DoDump( IA32Pushad_t *pReg )
+{
+    uint32_t      type;     /* プロセスタイプ     */
+    uint32_t      no;       /* システムコール番号 */
+    uint32_t      funcId;   /* 機能ID             */
+    uint32_t      irqNo;    /* IRQ番号            */
+    uint32_t      stage;    /* 割込み遅延区間     */
+    MkSysStat_t   *pStat;   /* システムコール統計 */
+    MkIntStat_t   *pInt;    /* 割込み遅延統計     */
+    MkTimerStat_t timer;    /* タイマ合体統計     */
+
+    /* 初期化 */
+    pStat = NULL;
+    pInt  = NULL;
+
+    /* プロセスタイプ毎に繰り返す */
+    for ( type = 0; type < MK_SYSSTAT_PROCTYPE_NUM; type++ ) {
+        /* システムコール番号毎に繰り返す */
+        for ( no = 0; no < MK_SYSCALL_NUM; no++ ) {
+            /* 機能ID毎に繰り返す */
+            for ( funcId = 0; funcId < MK_SYSSTAT_FUNCID_NUM; funcId++ ) {
+                /* 統計取得 */
+                pStat = &( gStatTbl[ type ][ no ][ funcId ] );
+
+                /* 呼出し有無判定 */
+                if ( pStat->count == 0 ) {
+                    /* 呼出し無し */
+                    continue;
+                }
+
+                DEBUG_LOG_INF(
+                    "sysstat: type=%u no=%#x func=%u num=%u "
+                    "avg=%u max=%u p50<2^%u p99<2^%u",
+                    type + MK_PROC_TYPE_KERNEL,
+                    no,
+                    funcId,
+                    pStat->count,
+                    ( uint32_t ) ( pStat->total / pStat->count ),
+                    pStat->max,
+                    GetPercentileBin( pStat->count,
+                                      pStat->bin,
+                                      PERCENTILE_50 ) +
+                    MK_SYSSTAT_BIN_SHIFT + 1,
+                    GetPercentileBin( pStat->count,
+                                      pStat->bin,
+                                      PERCENTILE_99 ) +
+                    MK_SYSSTAT_BIN_SHIFT + 1
+                );
+            }
+        }
+    }
+
+    /* IRQ毎に繰り返す */
+    for ( irqNo = 0; irqNo < INTMNG_IRQ_NUM; irqNo++ ) {
+        /* 割込み遅延区間毎に繰り返す */
+        for ( stage = 0; stage < MK_INTSTAT_STAGE_NUM; stage++ ) {
+            /* 統計取得 */
+            pInt = &( gIntStatTbl[ irqNo ][ stage ] );
+
+            /* 計測有無判定 */
+            if ( pInt->count == 0 ) {
+                /* 計測無し */
+                continue;
+            }
+
+            DEBUG_LOG_INF(
+                "intstat: irq=%u stage=%u num=%u "
+                "avg=%u min=%u max=%u p50<2^%u p99<2^%u",
+                irqNo,
+                stage,
+                pInt->count,
+                ( uint32_t ) ( pInt->total / pInt->count ),
+                pInt->min,
+                pInt->max,
+                GetPercentileBin( pInt->count, pInt->bin, PERCENTILE_50 ) +
+                MK_SYSSTAT_BIN_SHIFT + 1,
+                GetPercentileBin( pInt->count, pInt->bin, PERCENTILE_99 ) +
+                MK_SYSSTAT_BIN_SHIFT + 1
+            );
+        }
+    }
+
+    /* タイマ合体統計取得 */
+    TimermngCtrlGetStat( &timer );
+
+    DEBUG_LOG_INF(
+        "timerstat: tick=%u hres=%u spurious=%u "
+        "expire=%u coalesce=%u defer=%u",
+        timer.tickWakeup,
+        timer.hresWakeup,
+        timer.hresSpurious,
+        timer.expire,
+        timer.coalesce,
+        timer.defer
+    );
+
+    /* 戻り値設定 */
+    pReg->eax = MK_RET_SUCCESS;
+    pReg->ebx = MK_ERR_NONE;
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief           システムコール統計取得
+ * @details         指定したシステムコール番号と機能IDの統計を全プロセスタイプ
+ *                  分コピーする。
+ *                  - 入力: EBX=システムコール番号, ESI=機能ID,
+ *                          EDI=統計格納先(MK_SYSSTAT_PROCTYPE_NUM個)
+ *
+ * @param[in,out]   *pReg 汎用レジスタ
+ */
+/******************************************************************************/
+static void DoGet( IA32Pushad_t *pReg )
+{
+    uint32_t    type;       /* プロセスタイプ */
+    MkSysStat_t *pBuffer;   /* 統計格納先     */
+
+    /* 初期化 */
+    pBuffer = ( MkSysStat_t * ) pReg->edi;
+
+    /* パラメータチェック */
+    if ( ( pReg->ebx >= MK_SYSCALL_NUM        ) ||
+         ( pReg->esi >= MK_SYSSTAT_FUNCID_NUM ) ||
+         ( pReg->edi <  MEMMAP_VADDR_USER     ) ||
+         ( pReg->edi >  BUFFER_ADDR_MAX       )    ) {
+        /* 不正 */
+
+        /* 戻り値設定 */
+        pReg->eax = MK_RET_FAILURE;
+        pReg->ebx = MK_ERR_PARAM;
+
+        return;
+    }
+
+    /* プロセスタイプ毎に繰り返す */
+    for ( type = 0; type < MK_SYSSTAT_PROCTYPE_NUM; type++ ) {
+        /* 統計コピー */
+        MLibUtilCopyMemory( &( pBuffer[ type ] ),
+                            &( gStatTbl[ type ][ pReg->ebx ][ pReg->esi ] ),
+                            sizeof ( MkSysStat_t )                           );
+    }
+
+    /* 戻り値設定 */
+    pReg->eax = MK_RET_SUCCESS;
+    pReg->ebx = MK_ERR_NONE;
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief           割込み遅延統計取得
+ * @details         指定したIRQ番号の割込み遅延統計を全区間分コピーする。
+ *                  - 入力: EBX=IRQ番号,
+ *                          EDI=統計格納先(MK_INTSTAT_STAGE_NUM個)
+ *
+ * @param[in,out]   *pReg 汎用レジスタ
+ */
+/******************************************************************************/
+static void DoGetInt( IA32Pushad_t *pReg )
+{
+    /* パラメータチェック */
+    if ( ( pReg->ebx >= INTMNG_IRQ_NUM          ) ||
+         ( pReg->edi <  MEMMAP_VADDR_USER       ) ||
+         ( pReg->edi >  INTSTAT_BUFFER_ADDR_MAX )    ) {
+        /* 不正 */
+
+        /* 戻り値設定 */
+        pReg->eax = MK_RET_FAILURE;
+        pReg->ebx = MK_ERR_PARAM;
+
+        return;
+    }
+
+    /* 統計コピー */
+    MLibUtilCopyMemory( ( void * ) pReg->edi,
+                        gIntStatTbl[ pReg->ebx ],
+                        sizeof ( gIntStatTbl[ 0 ] ) );
+
+    /* 戻り値設定 */
+    pReg->eax = MK_RET_SUCCESS;
+    pReg->ebx = MK_ERR_NONE;
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief           タイマ合体統計取得
+ * @details         タイマ合体統計をコピーする。
+ *                  - 入力: EDI=統計格納先
+ *
+ * @param[in,out]   *pReg 汎用レジスタ
+ */
+/******************************************************************************/
+static void DoGetTimer( IA32Pushad_t *pReg )
+{
+    /* パラメータチェック */
+    if ( ( pReg->edi < MEMMAP_VADDR_USER         ) ||
+         ( pReg->edi > TIMERSTAT_BUFFER_ADDR_MAX )    ) {
+        /* 不正 */
+
+        /* 戻り値設定 */
+        pReg->eax = MK_RET_FAILURE;
+        pReg->ebx = MK_ERR_PARAM;
+
+        return;
+    }
+
+    /* 統計コピー */
+    TimermngCtrlGetStat( ( MkTimerStat_t * ) pReg->edi );
+
+    /* 戻り値設定 */
+    pReg->eax = MK_RET_SUCCESS;
+    pReg->ebx = MK_ERR_NONE;
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       ビン取得
+ * @details     処理時間からヒストグラムのビンを取得する。
+ *
+ * @param[in]   cycle 処理時間(TSC差)
+ *
+ * @return      ビンを返す。
+ */
+/******************************************************************************/
+static uint32_t GetBin( uint64_t cycle )
+{
+    uint32_t bin;   /* ビン */
+
+    /* 初期化 */
+    bin = 0;
+
+    /* ビン算出 */
+    while ( ( bin < ( MK_SYSSTAT_BIN_NUM - 1 ) ) &&
+            ( ( cycle >> ( bin + MK_SYSSTAT_BIN_SHIFT + 1 ) ) != 0 ) ) {
+        bin++;
+    }
+
+    return bin;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       パーセンタイルビン取得
+ * @details     ヒストグラムから指定パーセンタイルの計測値が含まれるビンを取得
+ *              する。
+ *
+ * @param[in]   count   計測回数
+ * @param[in]   *pBin   ヒストグラム(MK_SYSSTAT_BIN_NUM個)
+ * @param[in]   percent パーセンタイル
+ *
+ * @return      ビンを返す。
+ */
+/******************************************************************************/
+static uint32_t GetPercentileBin( uint32_t count,
+                                  uint32_t *pBin,
+                                  uint32_t percent )
+{
+    uint32_t bin;       /* ビン           */
+    uint64_t sum;       /* 累積計測回数   */
+    uint64_t target;    /* 目標計測回数   */
+
+    /* 初期化 */
+    sum    = 0;
+    target = ( uint64_t ) count * percent;
+
+    /* ビン毎に繰り返す */
+    for ( bin = 0; bin < ( MK_SYSSTAT_BIN_NUM - 1 ); bin++ ) {
+        /* 累積 */
+        sum += pBin[ bin ];
+
+        /* 到達判定 */
+        if ( ( sum * 100 ) >= target ) {
+            /* 到達 */
+
+            break;
+        }
+    }
+
+    return bin;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief           システムコールハンドラ
+ * @details         レジスタ渡し形式のシステムコール統計と割込み遅延統計のシス
+ *                  テムコールを処理する。
+ *
+ * @param[in]       no    システムコール番号
+ * @param[in,out]   *pReg 汎用レジスタ
+ */
+/******************************************************************************/
+static void HdlSys( uint32_t     no,
+                    IA32Pushad_t *pReg )
+{
+    /* システムコール番号判定 */
+    if ( no == MK_SYSCALL_SYSSTAT_GET ) {
+        /* システムコール統計取得 */
+
+        DoGet( pReg );
+
+    } else if ( no == MK_SYSCALL_INTSTAT_GET ) {
+        /* 割込み遅延統計取得 */
+
+        DoGetInt( pReg );
+
+    } else if ( no == MK_SYSCALL_TIMERSTAT_GET ) {
+        /* タイマ合体統計取得 */
+
+        DoGetTimer( pReg );
+
+    } else {
+        /* システムコール統計ログ出力 */
+
+        DoDump( pReg );
+    }
+
+    return;
+}
+
+
+/******************************************************************************/
+#endif
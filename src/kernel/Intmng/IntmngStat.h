@@ -0,0 +1,44 @@
+/******************************************************************************/
+/*                                                                            */
+/* src/kernel/Intmng/IntmngStat.h                                             */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2026 Mochi.                                                  */
+/*                                                                            */
+/******************************************************************************/
+#ifndef INTMNG_STAT_H
+#define INTMNG_STAT_H
+/******************************************************************************/
+/* インクルード                                                               */
+/******************************************************************************/
+/* 標準ヘッダ */
+#include <stdint.h>
+
+/* カーネルヘッダ */
+#include <kernel/types.h>
+
+
+/******************************************************************************/
+/* グローバル関数宣言                                                         */
+/******************************************************************************/
+#ifdef INTMNG_STAT_ENABLE
+/* システムコール統計記録 */
+extern void IntmngStatAdd( MkTaskId_t taskId,
+                           uint32_t   no,
+                           uint32_t   funcId,
+                           uint64_t   cycle   );
+/* システムコール統計初期化 */
+extern void IntmngStatInit( void );
+/* 割込み遅延記録 */
+extern void IntmngStatIntEnd( MkTaskId_t taskId,
+                              uint64_t   tsc     );
+/* 割込み遅延計測設定 */
+extern void IntmngStatIntSet( MkTaskId_t taskId,
+                              uint8_t    irqNo,
+                              uint64_t   irqTsc,
+                              uint64_t   wakeTsc,
+                              uint64_t   switchTsc );
+#endif
+
+
+/******************************************************************************/
+#endif
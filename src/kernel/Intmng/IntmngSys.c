@@ -0,0 +1,433 @@
+/******************************************************************************/
+/*                                                                            */
+/* src/kernel/Intmng/IntmngSys.c                                              */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2026 Mochi.                                                  */
+/*                                                                            */
+/******************************************************************************/
+/******************************************************************************/
+/* インクルード                                                               */
+/******************************************************************************/
+/* 標準ヘッダ */
+#include <stdbool.h>
+#include <stdint.h>
+
+/* カーネルヘッダ */
+#include <kernel/config.h>
+#include <kernel/ring.h>
+#include <kernel/syscall.h>
+#include <kernel/types.h>
+
+/* 共通ヘッダ */
+#include <memmap.h>
+#include <hardware/IA32/IA32.h>
+#include <hardware/IA32/IA32Descriptor.h>
+#include <hardware/IA32/IA32Instruction.h>
+
+/* 外部モジュールヘッダ */
+#include <Cmn.h>
+#include <Debug.h>
+#include <Intmng.h>
+#include <Taskmng.h>
+
+/* 内部モジュールヘッダ */
+#include "IntmngHdl.h"
+#include "IntmngStat.h"
+#include "IntmngSys.h"
+
+
+/******************************************************************************/
+/* 定義                                                                       */
+/******************************************************************************/
+/* モジュールID */
+#define _MODULE_ID_ CMN_MODULE_INTMNG_SYS
+
+/** システムコール管理情報 */
+typedef struct {
+    uint32_t       type;    /**< システムコール形式 */
+    uint32_t       intNo;   /**< 転送先割込み番号   */
+    IntmngSysHdl_t func;    /**< ハンドラ           */
+} sysEntry_t;
+
+/** システムコール管理情報設定マクロ */
+#define SYS_ENTRY( _NAME, _NO, _TYPE, _INTNO )          \
+    gSysTbl[ ( _NO ) ].type  = MK_SYSCALL_TYPE_##_TYPE; \
+    gSysTbl[ ( _NO ) ].intNo = ( _INTNO );
+
+
+/******************************************************************************/
+/* ローカル関数宣言                                                           */
+/******************************************************************************/
+/* リング投入可否チェック */
+static bool CheckRing( uint32_t no );
+/* 割込みハンドラ */
+static void HdlInt( uint32_t        intNo,
+                    IntmngContext_t *pContext );
+/* リング投入システムコールハンドラ */
+static void HdlRing( uint32_t     no,
+                     IA32Pushad_t *pReg );
+
+
+/******************************************************************************/
+/* 静的グローバル変数定義                                                     */
+/******************************************************************************/
+/** システムコール管理テーブル */
+static sysEntry_t gSysTbl[ MK_SYSCALL_NUM ];
+
+
+/******************************************************************************/
+/* グローバル関数定義                                                         */
+/******************************************************************************/
+/******************************************************************************/
+/**
+ * @brief       システムコールハンドラ設定
+ * @details     レジスタ渡し形式のシステムコールのハンドラを設定する。
+ *
+ * @param[in]   no   システムコール番号
+ * @param[in]   func ハンドラ
+ */
+/******************************************************************************/
+void IntmngSysSet( uint32_t       no,
+                   IntmngSysHdl_t func )
+{
+    /* システムコール形式判定 */
+    if ( gSysTbl[ no ].type != MK_SYSCALL_TYPE_REG ) {
+        /* レジスタ渡し形式でない */
+
+        DEBUG_LOG_ERR( "invalid syscall: no=%#x", no );
+
+        return;
+    }
+
+    /* ハンドラ設定 */
+    gSysTbl[ no ].func = func;
+
+    return;
+}
+
+
+/******************************************************************************/
+/* モジュール内グローバル関数定義                                             */
+/******************************************************************************/
+/******************************************************************************/
+/**
+ * @brief       システムコール管理初期化
+ * @details     システムコールテーブルからシステムコール管理テーブルを作成し、
+ *              システムコール割込み番号の割込みハンドラとリング投入システム
+ *              コールのハンドラを設定する。
+ */
+/******************************************************************************/
+void IntmngSysInit( void )
+{
+    uint32_t no;    /* システムコール番号 */
+
+    DEBUG_LOG_TRC( "%s() start.", __func__ );
+
+    /* システムコール番号毎に繰り返す */
+    for ( no = 0; no < MK_SYSCALL_NUM; no++ ) {
+        /* 初期化 */
+        gSysTbl[ no ].type  = MK_SYSCALL_TYPE_NONE;
+        gSysTbl[ no ].intNo = 0;
+        gSysTbl[ no ].func  = NULL;
+    }
+
+    /* システムコール管理情報設定 */
+    MK_SYSCALL_TABLE( SYS_ENTRY )
+
+    /* 割込みハンドラ設定 */
+    IntmngHdlSet( MK_CONFIG_INTNO_SYSCALL,      /* 割込み番号     */
+                  HdlInt,                       /* 割込みハンドラ */
+                  IA32_DESCRIPTOR_DPL_3    );   /* 特権レベル     */
+
+    /* システムコールハンドラ設定 */
+    IntmngSysSet( MK_SYSCALL_RING_ENTER, HdlRing );
+
+    DEBUG_LOG_TRC( "%s() end.", __func__ );
+
+    return;
+}
+
+
+/******************************************************************************/
+/* ローカル関数定義                                                           */
+/******************************************************************************/
+/******************************************************************************/
+/**
+ * @brief       リング投入可否チェック
+ * @details     システムコールリングで処理できるシステムコールかチェックする。
+ *              リング投入はユーザ処理を介さずに連続して処理するため、呼出し元
+ *              タスクをブロックし得るシステムコールは許可しない。
+ *
+ * @param[in]   no システムコール番号
+ *
+ * @return      チェック結果を返す。
+ * @retval      true  投入可
+ * @retval      false 投入不可
+ */
+/******************************************************************************/
+static bool CheckRing( uint32_t no )
+{
+    /* システムコール番号判定 */
+    switch ( no ) {
+        case MK_SYSCALL_MSG_SEND_NB:
+        case MK_SYSCALL_IOPORT_IN_BYTE:
+        case MK_SYSCALL_IOPORT_IN_WORD:
+        case MK_SYSCALL_IOPORT_IN_DWORD:
+        case MK_SYSCALL_IOPORT_OUT_BYTE:
+        case MK_SYSCALL_IOPORT_OUT_WORD:
+        case MK_SYSCALL_IOPORT_OUT_DWORD:
+        case MK_SYSCALL_TASK_GET_ID:
+        case MK_SYSCALL_INT_COMPLETE:
+        case MK_SYSCALL_TIMER_START:
+        case MK_SYSCALL_TIMER_STOP:
+            /* ノンブロッキング */
+            return true;
+
+        default:
+            /* ブロッキングまたは未定義 */
+            break;
+    }
+
+    return false;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief           割込みハンドラ
+ * @details         EAXレジスタのシステムコール番号から、パラメータブロック渡
+ *                  し形式の場合は転送先割込み番号の割込みハンドラを、レジスタ
+ *                  渡し形式の場合は設定されたハンドラを呼び出す。レジスタ渡し
+ *                  形式の出力値は割込み発生時コンテキストの汎用レジスタに設定
+ *                  し、復帰時にレジスタに反映する。
+ *
+ * @param[in]       intNo     割込み番号
+ * @param[in,out]   *pContext 割込み発生時コンテキスト情報
+ */
+/******************************************************************************/
+static void HdlInt( uint32_t        intNo,
+                    IntmngContext_t *pContext )
+{
+    uint32_t              no;       /* システムコール番号 */
+    IntmngHdl_t           func;     /* 割込みハンドラ     */
+    sysEntry_t            *pEntry;  /* 管理情報           */
+    volatile IA32Pushad_t *pReg;    /* 汎用レジスタ       */
+#ifdef INTMNG_STAT_ENABLE
+    uint32_t              funcId;   /* 機能ID             */
+    uint64_t              tsc;      /* 呼出し時TSC値      */
+    uint64_t              end;      /* 復帰時TSC値        */
+    MkTaskId_t            taskId;   /* 呼出し元タスクID   */
+#endif
+
+    /* 初期化 */
+    no     = pContext->genReg.eax;
+    func   = NULL;
+    pEntry = NULL;
+    pReg   = &( pContext->genReg );
+#ifdef INTMNG_STAT_ENABLE
+    funcId = 0;
+    tsc    = IA32InstructionRdtsc();
+    end    = 0;
+    taskId = TaskmngSchedGetTaskId();
+#endif
+
+    /* システムコール番号チェック */
+    if ( no >= MK_SYSCALL_NUM ) {
+        /* 不正 */
+
+        /* 戻り値設定 */
+        pReg->eax = MK_RET_FAILURE;
+        pReg->ebx = MK_ERR_PARAM;
+
+        return;
+    }
+
+    /* 管理情報取得 */
+    pEntry = &( gSysTbl[ no ] );
+
+    /* システムコール形式判定 */
+    if ( pEntry->type == MK_SYSCALL_TYPE_PARAM ) {
+        /* パラメータブロック渡し */
+
+        /* 割込みハンドラ取得 */
+        func = IntmngHdlGet( pEntry->intNo );
+
+#ifdef INTMNG_STAT_ENABLE
+        /* パラメータ有無判定 */
+        if ( pContext->genReg.esi != 0 ) {
+            /* 有り */
+
+            /* 機能ID取得 */
+            funcId = *( ( uint32_t * ) pContext->genReg.esi );
+        }
+#endif
+
+        /* 割込みハンドラ呼出し */
+        func( pEntry->intNo, pContext );
+
+    } else if ( ( pEntry->type == MK_SYSCALL_TYPE_REG ) &&
+                ( pEntry->func != NULL                )    ) {
+        /* レジスタ渡し */
+
+        /* ハンドラ呼出し */
+        ( pEntry->func )( no, ( IA32Pushad_t * ) pReg );
+
+    } else {
+        /* 未定義 */
+
+        /* 戻り値設定 */
+        pReg->eax = MK_RET_FAILURE;
+        pReg->ebx = MK_ERR_PARAM;
+    }
+
+#ifdef INTMNG_STAT_ENABLE
+    /* 復帰時TSC値取得 */
+    end = IA32InstructionRdtsc();
+
+    /* システムコール統計記録 */
+    IntmngStatAdd( taskId, no, funcId, end - tsc );
+
+    /* 割込み遅延記録 */
+    IntmngStatIntEnd( TaskmngSchedGetTaskId(), end );
+#endif
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief           リング投入システムコールハンドラ
+ * @details         ユーザ領域のシステムコールリングの投入キューからエントリを
+ *                  取り出し、レジスタ渡し形式のシステムコールのハンドラを順に
+ *                  呼び出して結果を完了キューに格納する。投入キューが空になる
+ *                  か完了キューが満杯になるまで繰り返す。ブロックし得るシステ
+ *                  ムコールはMK_ERR_PARAMで完了させる。
+ *                  - 入力: EBX=システムコールリングアドレス
+ *                  - 出力: ESI=処理エントリ数
+ *
+ * @param[in]       no    システムコール番号
+ * @param[in,out]   *pReg 汎用レジスタ
+ */
+/******************************************************************************/
+static void HdlRing( uint32_t     no,
+                     IA32Pushad_t *pReg )
+{
+    uint32_t     num;       /* 処理エントリ数     */
+    uint32_t     sqeNo;     /* システムコール番号 */
+    MkRing_t     *pRing;    /* リング             */
+    MkRingSqe_t  *pSqe;     /* 投入キューエントリ */
+    MkRingCqe_t  *pCqe;     /* 完了キューエントリ */
+    sysEntry_t   *pEntry;   /* 管理情報           */
+    IA32Pushad_t reg;       /* 汎用レジスタ       */
+#ifdef INTMNG_STAT_ENABLE
+    uint64_t     tsc;       /* 呼出し時TSC値      */
+#endif
+
+    /* 初期化 */
+    num    = 0;
+    sqeNo  = 0;
+    pRing  = ( MkRing_t * ) pReg->ebx;
+    pSqe   = NULL;
+    pCqe   = NULL;
+    pEntry = NULL;
+
+    /* リングアドレスチェック */
+    if ( ( pReg->ebx < MEMMAP_VADDR_USER                              ) ||
+         ( pReg->ebx > MEMMAP_VADDR_USER_SHARED - sizeof ( MkRing_t ) )    ) {
+        /* 不正 */
+
+        /* 戻り値設定 */
+        pReg->eax = MK_RET_FAILURE;
+        pReg->ebx = MK_ERR_PARAM;
+        pReg->esi = 0;
+
+        return;
+    }
+
+    /* 投入キューエントリ有無と完了キュー空き有無判定 */
+    while ( ( pRing->sqHead != pRing->sqTail                       ) &&
+            ( pRing->cqTail - pRing->cqHead < MK_RING_ENTRY_NUM )    ) {
+        /* 処理可 */
+
+        /* エントリ取得 */
+        pSqe  = &( pRing->sq[ pRing->sqHead & MK_RING_MASK ] );
+        pCqe  = &( pRing->cq[ pRing->cqTail & MK_RING_MASK ] );
+        sqeNo = pSqe->no;
+
+        /* 汎用レジスタ設定 */
+        reg.eax = sqeNo;
+        reg.ebx = pSqe->arg[ 0 ];
+        reg.ecx = 0;
+        reg.edx = 0;
+        reg.esi = pSqe->arg[ 1 ];
+        reg.edi = pSqe->arg[ 2 ];
+        reg.ebp = 0;
+        reg.esp = 0;
+
+        /* リング投入可否チェック */
+        if ( CheckRing( sqeNo ) != false ) {
+            /* 投入可 */
+
+            /* 管理情報取得 */
+            pEntry = &( gSysTbl[ sqeNo ] );
+
+        } else {
+            /* 投入不可 */
+
+            pEntry = NULL;
+        }
+
+        /* システムコール形式判定 */
+        if ( ( pEntry       != NULL                ) &&
+             ( pEntry->type == MK_SYSCALL_TYPE_REG ) &&
+             ( pEntry->func != NULL                )    ) {
+            /* レジスタ渡し */
+
+#ifdef INTMNG_STAT_ENABLE
+            /* 呼出し時TSC値取得 */
+            tsc = IA32InstructionRdtsc();
+#endif
+
+            /* ハンドラ呼出し */
+            ( pEntry->func )( sqeNo, &reg );
+
+#ifdef INTMNG_STAT_ENABLE
+            /* システムコール統計記録 */
+            IntmngStatAdd( TaskmngSchedGetTaskId(),
+                           sqeNo,
+                           0,
+                           IA32InstructionRdtsc() - tsc );
+#endif
+
+        } else {
+            /* 未定義 */
+
+            /* 戻り値設定 */
+            reg.eax = MK_RET_FAILURE;
+            reg.ebx = MK_ERR_PARAM;
+            reg.esi = 0;
+        }
+
+        /* 完了キューエントリ設定 */
+        pCqe->userData = pSqe->userData;
+        pCqe->ret      = reg.eax;
+        pCqe->err      = reg.ebx;
+        pCqe->value    = reg.esi;
+
+        /* キュー更新 */
+        pRing->sqHead++;
+        pRing->cqTail++;
+        num++;
+    }
+
+    /* 戻り値設定 */
+    pReg->eax = MK_RET_SUCCESS;
+    pReg->ebx = MK_ERR_NONE;
+    pReg->esi = num;
+
+    return;
+}
+
+
+/******************************************************************************/
@@ -0,0 +1,18 @@
+/******************************************************************************/
+/*                                                                            */
+/* src/kernel/Intmng/IntmngSys.h                                              */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2026 Mochi.                                                  */
+/*                                                                            */
+/******************************************************************************/
+#ifndef INTMNG_SYS_H
+#define INTMNG_SYS_H
+/******************************************************************************/
+/* グローバル関数宣言                                                         */
+/******************************************************************************/
+/* システムコール管理初期化 */
+extern void IntmngSysInit( void );
+
+
+/******************************************************************************/
+#endif
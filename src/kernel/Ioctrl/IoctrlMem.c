@@ -1,8 +1,8 @@
 /******************************************************************************/
 /*                                                                            */
 /* src/kernel/Ioctrl/IoctrlMem.c                                              */
-/*                                                                 2024/08/10 */
-/* Copyright (C) 2018-2024 Mochi.                                             */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2018-2026 Mochi.                                             */
 /*                                                                            */
 /******************************************************************************/
 /******************************************************************************/
@@ -31,7 +31,7 @@
 /******************************************************************************/
 /* 割込みハンドラ */
 static void HdlInt( uint32_t        intNo,
-                    IntmngContext_t context );
+                    IntmngContext_t *pContext );
 
 
 /******************************************************************************/
@@ -167,17 +167,17 @@ static void Alloc( MkIoMemParam_t *pParam )
  * @brief       割込みハンドラ
  * @details     機能IDから該当する機能を呼び出す。
  *
- * @param[in]   intNo   割込み番号
- * @param[in]   context 割込み発生時コンテキスト
+ * @param[in]   intNo     割込み番号
+ * @param[in]   *pContext 割込み発生時コンテキスト
  */
 /******************************************************************************/
 static void HdlInt( uint32_t        intNo,
-                    IntmngContext_t context )
+                    IntmngContext_t *pContext )
 {
     MkIoMemParam_t *pParam;    /* パラメータ   */
 
     /* 初期化 */
-    pParam = ( MkIoMemParam_t * ) context.genReg.esi;
+    pParam = ( MkIoMemParam_t * ) pContext->genReg.esi;
 
     /* パラメータチェック */
     if ( pParam == NULL ) {
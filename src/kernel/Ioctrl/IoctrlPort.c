@@ -1,8 +1,8 @@
 
 /*                                                                            */
 /* src/kernel/Ioctrl/IoctrlPort.c                                             */
-/*                                                                 2025/04/02 */
-/* Copyright (C) 2018-2025 Mochi.                                             */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2018-2026 Mochi.                                             */
 /*                                                                            */
 /******************************************************************************/
 /******************************************************************************/
@@ -10,6 +10,7 @@
 /******************************************************************************/
 /* カーネルヘッダ */
 #include <kernel/ioport.h>
+#include <kernel/syscall.h>
 
 /* 共通ヘッダ */
 #include <hardware/IA32/IA32Instruction.h>
@@ -40,9 +41,16 @@ typedef struct {
 /* I/Oポートバルク入出力 */
 static void Bulk( MkIoPortParam_t *pParam );
 
+/* 機能呼出し */
+static void CallFunc( MkIoPortParam_t *pParam );
+
 /* 割込みハンドラ */
 static void HdlInt( uint32_t        intNo,
-                    IntmngContext_t context );
+                    IntmngContext_t *pContext );
+
+/* システムコールハンドラ */
+static void HdlSys( uint32_t     no,
+                    IA32Pushad_t *pReg );
 
 /* I/Oポート入力(1バイト単位) */
 static void InByte( MkIoPortParam_t *pParam );
@@ -98,6 +106,14 @@ void PortInit( void )
                   HdlInt,                       /* 割込みハンドラ */
                   IA32_DESCRIPTOR_DPL_3   );    /* 特権レベル     */
 
+    /* システムコールハンドラ設定 */
+    IntmngSysSet( MK_SYSCALL_IOPORT_IN_BYTE,   HdlSys );
+    IntmngSysSet( MK_SYSCALL_IOPORT_IN_WORD,   HdlSys );
+    IntmngSysSet( MK_SYSCALL_IOPORT_IN_DWORD,  HdlSys );
+    IntmngSysSet( MK_SYSCALL_IOPORT_OUT_BYTE,  HdlSys );
+    IntmngSysSet( MK_SYSCALL_IOPORT_OUT_WORD,  HdlSys );
+    IntmngSysSet( MK_SYSCALL_IOPORT_OUT_DWORD, HdlSys );
+
     DEBUG_LOG_TRC( "%s() end.", __func__ );
 
     return;
@@ -214,28 +230,18 @@ static void Bulk( MkIoPortParam_t *pParam )
 
 /******************************************************************************/
 /**
- * @brief       割込みハンドラ
- * @details     機能IDから該当する機能を呼び出す。
+ * @brief           機能呼出し
+ * @details         機能IDから該当する機能を呼び出す。
  *
- * @param[in]   intNo   割込み番号
- * @param[in]   context 割込み発生時コンテキスト
+ * @param[in,out]   *pParam パラメータ
  */
 /******************************************************************************/
-static void HdlInt( uint32_t        intNo,
-                    IntmngContext_t context )
+static void CallFunc( MkIoPortParam_t *pParam )
 {
-    uint32_t        idx;        /* インデックス */
-    MkIoPortParam_t *pParam;    /* パラメータ   */
+    uint32_t idx;   /* インデックス */
 
     /* 初期化 */
-    pParam = ( MkIoPortParam_t * ) context.genReg.esi;
-
-    /* パラメータチェック */
-    if ( pParam == NULL ) {
-        /* 不正 */
-
-        return;
-    }
+    idx = 0;
 
     /* エラー設定初期化 */
     pParam->ret = MK_RET_SUCCESS;
@@ -262,6 +268,96 @@ static void HdlInt( uint32_t        intNo,
 }
 
 
+/******************************************************************************/
+/**
+ * @brief       割込みハンドラ
+ * @details     パラメータを取得し、機能を呼び出す。
+ *
+ * @param[in]   intNo     割込み番号
+ * @param[in]   *pContext 割込み発生時コンテキスト
+ */
+/******************************************************************************/
+static void HdlInt( uint32_t        intNo,
+                    IntmngContext_t *pContext )
+{
+    MkIoPortParam_t *pParam;    /* パラメータ */
+
+    /* 初期化 */
+    pParam = ( MkIoPortParam_t * ) pContext->genReg.esi;
+
+    /* パラメータチェック */
+    if ( pParam == NULL ) {
+        /* 不正 */
+
+        return;
+    }
+
+    /* 機能呼出し */
+    CallFunc( pParam );
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief           システムコールハンドラ
+ * @details         レジスタ渡し形式のI/Oポート入出力システムコールのパラメー
+ *                  タをレジスタから作成し、機能を呼び出す。
+ *                  - 入力: EBX=I/Oポート番号, ESI=データ, EDI=カウント
+ *
+ * @param[in]       no    システムコール番号
+ * @param[in,out]   *pReg 汎用レジスタ
+ */
+/******************************************************************************/
+static void HdlSys( uint32_t     no,
+                    IA32Pushad_t *pReg )
+{
+    MkIoPortParam_t param;  /* パラメータ */
+
+    /* パラメータ設定 */
+    param.funcId = 0;
+    param.portNo = ( uint16_t ) pReg->ebx;
+    param.pData  = ( void * ) pReg->esi;
+    param.count  = pReg->edi;
+
+    /* システムコール番号判定 */
+    if ( no == MK_SYSCALL_IOPORT_IN_BYTE ) {
+        /* I/Oポート入力(1バイト単位) */
+        param.funcId = MK_IOPORT_FUNCID_IN_BYTE;
+
+    } else if ( no == MK_SYSCALL_IOPORT_IN_WORD ) {
+        /* I/Oポート入力(2バイト単位) */
+        param.funcId = MK_IOPORT_FUNCID_IN_WORD;
+
+    } else if ( no == MK_SYSCALL_IOPORT_IN_DWORD ) {
+        /* I/Oポート入力(4バイト単位) */
+        param.funcId = MK_IOPORT_FUNCID_IN_DWORD;
+
+    } else if ( no == MK_SYSCALL_IOPORT_OUT_BYTE ) {
+        /* I/Oポート出力(1バイト単位) */
+        param.funcId = MK_IOPORT_FUNCID_OUT_BYTE;
+
+    } else if ( no == MK_SYSCALL_IOPORT_OUT_WORD ) {
+        /* I/Oポート出力(2バイト単位) */
+        param.funcId = MK_IOPORT_FUNCID_OUT_WORD;
+
+    } else if ( no == MK_SYSCALL_IOPORT_OUT_DWORD ) {
+        /* I/Oポート出力(4バイト単位) */
+        param.funcId = MK_IOPORT_FUNCID_OUT_DWORD;
+    }
+
+    /* 機能呼出し */
+    CallFunc( &param );
+
+    /* 戻り値設定 */
+    pReg->eax = param.ret;
+    pReg->ebx = param.err;
+
+    return;
+}
+
+
 /******************************************************************************/
 /**
  * @brief       I/Oポート入力(1バイト単位)
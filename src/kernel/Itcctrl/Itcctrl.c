@@ -1,8 +1,8 @@
 /******************************************************************************/
 /*                                                                            */
 /* src/kernel/Itcctrl/Itcctrl.c                                               */
-/*                                                                 2024/06/01 */
-/* Copyright (C) 2018-2024 Mochi.                                             */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2018-2026 Mochi.                                             */
 /*                                                                            */
 /******************************************************************************/
 /******************************************************************************/
@@ -13,7 +13,11 @@
 #include <Debug.h>
 
 /* 内部モジュールヘッダ */
+#include "ItcctrlEp.h"
+#include "ItcctrlEvent.h"
 #include "ItcctrlMsg.h"
+#include "ItcctrlNtf.h"
+#include "ItcctrlPub.h"
 
 
 /******************************************************************************/
@@ -39,6 +43,18 @@ void ItcctrlInit( void )
     /* メッセージ制御サブモジュール初期化 */
     ItcctrlMsgInit();
 
+    /* 通知制御サブモジュール初期化 */
+    ItcctrlNtfInit();
+
+    /* 出版購読制御サブモジュール初期化 */
+    ItcctrlPubInit();
+
+    /* エンドポイント制御サブモジュール初期化 */
+    ItcctrlEpInit();
+
+    /* イベント待ち合わせサブモジュール初期化 */
+    ItcctrlEventInit();
+
     DEBUG_LOG_TRC( "%s() end.", __func__ );
 
     return;
@@ -0,0 +1,844 @@
+/******************************************************************************/
+/*                                                                            */
+/* src/kernel/Itcctrl/ItcctrlEp.c                                             */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2026 Mochi.                                                  */
+/*                                                                            */
+/******************************************************************************/
+/******************************************************************************/
+/* インクルード                                                               */
+/******************************************************************************/
+/* 標準ヘッダ */
+#include <stdbool.h>
+#include <stdint.h>
+
+/* ライブラリヘッダ */
+#include <MLib/MLib.h>
+#include <MLib/MLibDynamicArray.h>
+#include <MLib/MLibList.h>
+#include <MLib/MLibUtil.h>
+
+/* カーネルヘッダ */
+#include <kernel/config.h>
+#include <kernel/endpoint.h>
+#include <kernel/message.h>
+#include <kernel/types.h>
+
+/* 共通ヘッダ */
+#include <hardware/IA32/IA32.h>
+#include <hardware/IA32/IA32Instruction.h>
+
+/* 外部モジュールヘッダ */
+#include <Cmn.h>
+#include <Debug.h>
+#include <Intmng.h>
+#include <Memmng.h>
+#include <Taskmng.h>
+#include <Timermng.h>
+
+/* 内部モジュールヘッダ */
+#include "ItcctrlEp.h"
+#include "ItcctrlMsg.h"
+
+
+/******************************************************************************/
+/* 定義                                                                       */
+/******************************************************************************/
+/* モジュールID */
+#define _MODULE_ID_ CMN_MODULE_ITCCTRL_EP
+
+/** 動的配列チャンクサイズ */
+#define EP_CHUNK_SIZE ( 32 )
+
+/* 状態 */
+#define STATE_INIT    ( 0 ) /**< 初期状態                 */
+#define STATE_WAIT    ( 1 ) /**< 受信待ち状態             */
+#define STATE_TIMEOUT ( 2 ) /**< 受信待ちタイムアウト状態 */
+#define STATE_DELETED ( 3 ) /**< エンドポイント削除状態   */
+
+/** エンドポイント管理情報 */
+typedef struct {
+    MkPid_t          pid;       /**< 所有プロセスID       */
+    MkTaskId_t       owner;     /**< 生成タスクID         */
+    MLibList_t       msgList;   /**< メッセージリスト     */
+    MLibList_t       waitList;  /**< 受信待ちタスクリスト */
+    MkMsgQueueStat_t stat;      /**< キュー統計           */
+} epEntry_t;
+
+/** メッセージ */
+typedef struct {
+    MLibListNode_t nodeInfo;    /**< ノード情報        */
+    MkTaskId_t     src;         /**< 送信元タスクID    */
+    size_t         size;        /**< メッセージサイズ  */
+    uint64_t       tsc;         /**< キューイング時TSC */
+    uint8_t        msg[];       /**< メッセージ        */
+} epMsg_t;
+
+/** 受信待ち管理情報 */
+typedef struct {
+    MLibListNode_t nodeInfo;    /**< ノード情報               */
+    MkTaskId_t     taskId;      /**< タスクID                 */
+    uint32_t       state;       /**< 状態                     */
+    uint32_t       timerId;     /**< タイマID                 */
+    MkEpId_t       epId;        /**< 受信待ちエンドポイントID */
+    epMsg_t        *pMsg;       /**< 引渡しメッセージ         */
+} waitEntry_t;
+
+
+/******************************************************************************/
+/* ローカル関数宣言                                                           */
+/******************************************************************************/
+/* エンドポイント生成 */
+static void DoCreate( MkEpParam_t *pParam );
+/* エンドポイント削除 */
+static void DoDelete( MkEpParam_t *pParam );
+/* キュー統計取得 */
+static void DoGetStat( MkEpParam_t *pParam );
+/* メッセージ受信 */
+static void DoReceive( MkEpParam_t *pParam );
+/* メッセージ送信 */
+static void DoSend( MkEpParam_t *pParam );
+/* エンドポイント管理情報取得 */
+static epEntry_t *GetEntry( MkEpId_t epId );
+/* 割込みハンドラ */
+static void HdlInt( uint32_t        intNo,
+                    IntmngContext_t *pContext );
+/* メッセージ受信待ちタイムアウト */
+static void TimeoutReceive( uint32_t timerId,
+                            void     *pArg    );
+
+
+/******************************************************************************/
+/* 静的グローバル変数定義                                                     */
+/******************************************************************************/
+/** エンドポイント管理テーブル */
+static MLibDynamicArray_t gEpTbl;
+
+/** 受信待ち管理情報 */
+static waitEntry_t gWaitTbl[ MK_TASKID_NUM ];
+
+
+/******************************************************************************/
+/* グローバル関数定義                                                         */
+/******************************************************************************/
+/******************************************************************************/
+/**
+ * @brief       エンドポイント制御初期化
+ * @details     機能呼出し用割込みハンドラの設定とエンドポイント管理テーブルの
+ *              初期化を行う。
+ */
+/******************************************************************************/
+void ItcctrlEpInit( void )
+{
+    uint32_t  idx;      /* インデックス */
+    MLibRet_t retMLib;  /* MLib戻り値   */
+
+    /* 初期化 */
+    idx     = 0;
+    retMLib = MLIB_RET_FAILURE;
+
+    /* 割込みハンドラ設定 */
+    IntmngHdlSet( MK_CONFIG_INTNO_ENDPOINT,     /* 割込み番号     */
+                  HdlInt,                       /* 割込みハンドラ */
+                  IA32_DESCRIPTOR_DPL_3    );   /* 特権レベル     */
+
+    /* エンドポイント管理テーブル初期化 */
+    retMLib = MLibDynamicArrayInit( &gEpTbl,
+                                    EP_CHUNK_SIZE,
+                                    sizeof ( epEntry_t ),
+                                    MK_CONFIG_EP_NUM,
+                                    NULL                  );
+
+    /* 初期化結果判定 */
+    if ( retMLib != MLIB_RET_SUCCESS ) {
+        /* 失敗 */
+
+        DEBUG_LOG_ERR( "MLibDynamicArrayInit() error." );
+    }
+
+    /* 受信待ち管理情報エントリ毎に繰り返す */
+    for ( idx = 0; idx < MK_TASKID_NUM; idx++ ) {
+        /* 初期化 */
+        gWaitTbl[ idx ].taskId  = idx;
+        gWaitTbl[ idx ].state   = STATE_INIT;
+        gWaitTbl[ idx ].timerId = TIMERMNG_TIMERID_NULL;
+        gWaitTbl[ idx ].epId    = MK_EPID_NULL;
+        gWaitTbl[ idx ].pMsg    = NULL;
+    }
+
+    return;
+}
+
+
+/******************************************************************************/
+/* ローカル関数定義                                                           */
+/******************************************************************************/
+/******************************************************************************/
+/**
+ * @brief           エンドポイント生成
+ * @details         エンドポイントを生成し、エンドポイントIDを返す。生成したエ
+ *                  ンドポイントは呼出し元タスクのプロセスが所有し、同一プロセ
+ *                  ス内の全てのスレッドから受信できる。
+ *
+ * @param[in,out]   *pParam パラメータ
+ */
+/******************************************************************************/
+static void DoCreate( MkEpParam_t *pParam )
+{
+    uint_t     epId;    /* エンドポイントID       */
+    MkTaskId_t taskId;  /* タスクID               */
+    MLibRet_t  retMLib; /* MLib戻り値             */
+    epEntry_t  *pEp;    /* エンドポイント管理情報 */
+
+    /* 初期化 */
+    epId    = MK_EPID_NULL;
+    taskId  = TaskmngSchedGetTaskId();
+    retMLib = MLIB_RET_FAILURE;
+    pEp     = NULL;
+
+    /* エンドポイント管理情報割当 */
+    retMLib = MLibDynamicArrayAlloc( &gEpTbl,
+                                     &epId,
+                                     ( void ** ) &pEp,
+                                     NULL              );
+
+    /* 割当結果判定 */
+    if ( retMLib != MLIB_RET_SUCCESS ) {
+        /* 失敗 */
+
+        /* 戻り値設定 */
+        pParam->err = MK_ERR_NO_RESOURCE;
+
+        return;
+    }
+
+    /* エンドポイント管理情報設定 */
+    pEp->pid   = MK_TASKID_TO_PID( taskId );
+    pEp->owner = taskId;
+    MLibListInit( &( pEp->msgList  ) );
+    MLibListInit( &( pEp->waitList ) );
+    MLibUtilSetMemory8( &( pEp->stat ), 0, sizeof ( MkMsgQueueStat_t ) );
+    pEp->stat.limitNum  = MK_CONFIG_EP_QUEUE_NUM;
+    pEp->stat.limitSize = MK_CONFIG_MSG_QUEUE_SIZE;
+
+    /* 戻り値設定 */
+    pParam->ret  = MK_RET_SUCCESS;
+    pParam->err  = MK_ERR_NONE;
+    pParam->epId = ( MkEpId_t ) epId;
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief           エンドポイント削除
+ * @details         エンドポイントを削除する。未受信のメッセージは破棄し、受信
+ *                  待ち中のタスクはMK_ERR_NO_EXISTで受信待ちを解除する。所有
+ *                  プロセス以外からの削除は許可しない。
+ *
+ * @param[in,out]   *pParam パラメータ
+ */
+/******************************************************************************/
+static void DoDelete( MkEpParam_t *pParam )
+{
+    epMsg_t     *pMsg;  /* メッセージ             */
+    MkTaskId_t  taskId; /* タスクID               */
+    epEntry_t   *pEp;   /* エンドポイント管理情報 */
+    waitEntry_t *pWait; /* 受信待ち管理情報       */
+
+    /* 初期化 */
+    pMsg   = NULL;
+    taskId = TaskmngSchedGetTaskId();
+    pEp    = GetEntry( pParam->epId );
+    pWait  = NULL;
+
+    /* エンドポイント有無判定 */
+    if ( pEp == NULL ) {
+        /* 無し */
+
+        /* 戻り値設定 */
+        pParam->err = MK_ERR_NO_EXIST;
+
+        return;
+    }
+
+    /* 所有プロセス判定 */
+    if ( pEp->pid != MK_TASKID_TO_PID( taskId ) ) {
+        /* 所有プロセスでない */
+
+        /* 戻り値設定 */
+        pParam->err = MK_ERR_UNAUTHORIZED;
+
+        return;
+    }
+
+    /* 未受信メッセージ取得 */
+    pMsg = ( epMsg_t * ) MLibListRemoveHead( &( pEp->msgList ) );
+
+    /* 未受信メッセージ毎に繰り返す */
+    while ( pMsg != NULL ) {
+        /* メッセージ解放 */
+        MemmngHeapFree( pMsg );
+
+        /* 次未受信メッセージ取得 */
+        pMsg = ( epMsg_t * ) MLibListRemoveHead( &( pEp->msgList ) );
+    }
+
+    /* 受信待ちタスク取得 */
+    pWait = ( waitEntry_t * ) MLibListRemoveHead( &( pEp->waitList ) );
+
+    /* 受信待ちタスク毎に繰り返す */
+    while ( pWait != NULL ) {
+        /* 状態設定 */
+        pWait->state = STATE_DELETED;
+
+        /* スケジュール開始 */
+        TaskmngSchedStart( pWait->taskId );
+
+        /* 次受信待ちタスク取得 */
+        pWait = ( waitEntry_t * ) MLibListRemoveHead( &( pEp->waitList ) );
+    }
+
+    /* エンドポイント管理情報解放 */
+    pEp->pid = MK_PID_NULL;
+    MLibDynamicArrayFree( &gEpTbl, ( uint_t ) pParam->epId, NULL );
+
+    /* 戻り値設定 */
+    pParam->ret = MK_RET_SUCCESS;
+    pParam->err = MK_ERR_NONE;
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief           キュー統計取得
+ * @details         エンドポイントのキュー統計を取得する。所有プロセス以外から
+ *                  の取得は許可しない。
+ *
+ * @param[in,out]   *pParam パラメータ
+ */
+/******************************************************************************/
+static void DoGetStat( MkEpParam_t *pParam )
+{
+    MkTaskId_t taskId;  /* タスクID               */
+    epEntry_t  *pEp;    /* エンドポイント管理情報 */
+
+    /* 初期化 */
+    taskId = TaskmngSchedGetTaskId();
+    pEp    = GetEntry( pParam->epId );
+
+    /* パラメータチェック */
+    if ( pParam->pStat == NULL ) {
+        /* 不正 */
+
+        /* 戻り値設定 */
+        pParam->err = MK_ERR_PARAM;
+
+        return;
+    }
+
+    /* エンドポイント有無判定 */
+    if ( pEp == NULL ) {
+        /* 無し */
+
+        /* 戻り値設定 */
+        pParam->err = MK_ERR_NO_EXIST;
+
+        return;
+    }
+
+    /* 所有プロセス判定 */
+    if ( pEp->pid != MK_TASKID_TO_PID( taskId ) ) {
+        /* 所有プロセスでない */
+
+        /* 戻り値設定 */
+        pParam->err = MK_ERR_UNAUTHORIZED;
+
+        return;
+    }
+
+    /* キュー統計コピー */
+    MLibUtilCopyMemory( pParam->pStat,
+                        &( pEp->stat ),
+                        sizeof ( MkMsgQueueStat_t ) );
+
+    /* 戻り値設定 */
+    pParam->ret = MK_RET_SUCCESS;
+    pParam->err = MK_ERR_NONE;
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief           メッセージ受信
+ * @details         エンドポイントからメッセージを受信する。メッセージが無い場
+ *                  合は受信待ちタスクリストの末尾に登録してブロックし、送信側
+ *                  から直接メッセージを引き渡される。受信は所有プロセス内の全
+ *                  てのスレッドから可能で、先に受信待ちとなったスレッドから順
+ *                  にメッセージを受け取る。
+ *
+ * @param[in,out]   *pParam パラメータ
+ */
+/******************************************************************************/
+static void DoReceive( MkEpParam_t *pParam )
+{
+    size_t      size;   /* 受信サイズ             */
+    epMsg_t     *pMsg;  /* メッセージ             */
+    MkTaskId_t  taskId; /* タスクID               */
+    epEntry_t   *pEp;   /* エンドポイント管理情報 */
+    waitEntry_t *pWait; /* 受信待ち管理情報       */
+
+    /* 初期化 */
+    size   = 0;
+    pMsg   = NULL;
+    taskId = TaskmngSchedGetTaskId();
+    pEp    = GetEntry( pParam->epId );
+    pWait  = &( gWaitTbl[ taskId ] );
+
+    /* エンドポイント有無判定 */
+    if ( pEp == NULL ) {
+        /* 無し */
+
+        /* 戻り値設定 */
+        pParam->err = MK_ERR_NO_EXIST;
+
+        return;
+    }
+
+    /* 所有プロセス判定 */
+    if ( pEp->pid != MK_TASKID_TO_PID( taskId ) ) {
+        /* 所有プロセスでない */
+
+        /* 戻り値設定 */
+        pParam->err = MK_ERR_UNAUTHORIZED;
+
+        return;
+    }
+
+    /* メッセージ取得 */
+    pMsg = ( epMsg_t * ) MLibListRemoveHead( &( pEp->msgList ) );
+
+    /* 取得結果判定 */
+    if ( pMsg != NULL ) {
+        /* メッセージ有り */
+
+        /* キュー統計更新 */
+        pEp->stat.num--;
+        pEp->stat.size -= pMsg->size;
+
+    } else {
+        /* メッセージ無し */
+
+        /* タイムアウト設定判定 */
+        if ( pParam->timeout != 0 ) {
+            /* タイムアウト有り */
+
+            /* タイマ設定 */
+            pWait->timerId = TimermngCtrlSet( pParam->timeout,
+                                              TIMERMNG_TYPE_ONESHOT,
+                                              TimeoutReceive,
+                                              pWait                  );
+
+            /* タイマ設定結果判定 */
+            if ( pWait->timerId == TIMERMNG_TIMERID_NULL ) {
+                /* 失敗 */
+
+                /* 戻り値設定 */
+                pParam->err = MK_ERR_NO_RESOURCE;
+
+                return;
+            }
+        }
+
+        /* 受信待ち登録 */
+        pWait->state = STATE_WAIT;
+        pWait->epId  = pParam->epId;
+        pWait->pMsg  = NULL;
+        MLibListInsertTail( &( pEp->waitList ), &( pWait->nodeInfo ) );
+
+        /* スケジュール停止 */
+        TaskmngSchedStop( taskId );
+
+        /* スケジュール実行 */
+        TaskmngSchedExec();
+
+        /* タイマ解除 */
+        TimermngCtrlUnset( pWait->timerId );
+        pWait->timerId = TIMERMNG_TIMERID_NULL;
+
+        /* 引渡しメッセージ取得 */
+        pMsg        = pWait->pMsg;
+        pWait->pMsg = NULL;
+
+        /* 状態判定 */
+        if ( pWait->state == STATE_TIMEOUT ) {
+            /* タイムアウト */
+
+            /* 戻り値設定 */
+            pParam->err = MK_ERR_TIMEOUT;
+
+        } else if ( pWait->state == STATE_DELETED ) {
+            /* エンドポイント削除 */
+
+            /* 戻り値設定 */
+            pParam->err = MK_ERR_NO_EXIST;
+
+        } else if ( pMsg == NULL ) {
+            /* 引渡し無しで起床 */
+
+            /* 受信待ち解除 */
+            MLibListRemove( &( pEp->waitList ), &( pWait->nodeInfo ) );
+        }
+
+        /* 受信待ち情報初期化 */
+        pWait->epId = MK_EPID_NULL;
+
+        /* 状態初期化 */
+        pWait->state = STATE_INIT;
+
+        /* 引渡しメッセージ判定 */
+        if ( pMsg == NULL ) {
+            /* 無し */
+
+            return;
+        }
+    }
+
+    /* 受信サイズ計算 */
+    size = MLIB_UTIL_MIN( pMsg->size, pParam->bufferSize );
+
+    /* メッセージコピー */
+    MLibUtilCopyMemory( pParam->pMsg, pMsg->msg, size );
+
+    /* 戻り値設定 */
+    pParam->ret  = MK_RET_SUCCESS;
+    pParam->err  = MK_ERR_NONE;
+    pParam->src  = pMsg->src;
+    pParam->size = size;
+
+    /* トラフィック統計記録 */
+    ItcctrlMsgTrafficRecordRecv( pMsg->src, pEp->owner, pMsg->tsc );
+
+    /* メッセージ解放 */
+    MemmngHeapFree( pMsg );
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief           メッセージ送信
+ * @details         エンドポイントにメッセージを送信する。受信待ちのスレッドが
+ *                  有る場合は先頭の受信待ちスレッドにメッセージを直接引き渡し
+ *                  て起床し、無い場合はエンドポイントのメッセージリストにキュ
+ *                  ーイングする。キューイング時はメッセージキューと同じキュー
+ *                  統計で上限を判定し、上限に達している場合はブロックせずに
+ *                  MK_ERR_QUEUE_FULLまたはMK_ERR_SIZE_OVERで失敗する。トラフ
+ *                  ィック統計は送信先をエンドポイント生成タスクとして記録する。
+ *
+ * @param[in,out]   *pParam パラメータ
+ */
+/******************************************************************************/
+static void DoSend( MkEpParam_t *pParam )
+{
+    bool        valid;  /* キュー空き有無         */
+    uint8_t     diff;   /* プロセス階層差         */
+    epMsg_t     *pMsg;  /* メッセージ             */
+    MkTaskId_t  taskId; /* タスクID               */
+    epEntry_t   *pEp;   /* エンドポイント管理情報 */
+    waitEntry_t *pWait; /* 受信待ち管理情報       */
+
+    /* 初期化 */
+    valid  = true;
+    diff   = 0;
+    pMsg   = NULL;
+    taskId = TaskmngSchedGetTaskId();
+    pEp    = GetEntry( pParam->epId );
+    pWait  = NULL;
+
+    /* パラメータチェック */
+    if ( ( pParam->pMsg == NULL            ) ||
+         ( pParam->size == 0               ) ||
+         ( pParam->size >  MK_MSG_SIZE_MAX )    ) {
+        /* 不正 */
+
+        /* 戻り値設定 */
+        pParam->err = MK_ERR_PARAM;
+
+        return;
+    }
+
+    /* エンドポイント有無判定 */
+    if ( pEp == NULL ) {
+        /* 無し */
+
+        /* 戻り値設定 */
+        pParam->err = MK_ERR_NO_EXIST;
+
+        return;
+    }
+
+    /* プロセス階層差取得 */
+    diff = TaskmngTaskGetTypeDiff( taskId, pEp->owner );
+
+    /* 階層差判定 */
+    if ( diff > 1 ) {
+        /* 非隣接 */
+
+        /* 戻り値設定 */
+        pParam->err = MK_ERR_UNAUTHORIZED;
+
+        return;
+    }
+
+    /* 先頭受信待ちタスク取得 */
+    pWait = ( waitEntry_t * ) MLibListGetNextNode( &( pEp->waitList ), NULL );
+
+    /* 受信待ちタスク判定 */
+    if ( pWait == NULL ) {
+        /* 無し */
+
+        /* キュー空きチェック */
+        valid = ItcctrlMsgCheckSpace( &( pEp->stat ),
+                                      pParam->size,
+                                      &( pParam->err ) );
+
+        /* チェック結果判定 */
+        if ( valid == false ) {
+            /* 空き無し */
+
+            return;
+        }
+    }
+
+    /* メッセージ領域割当 */
+    pMsg = MemmngHeapAlloc( sizeof ( epMsg_t ) + pParam->size );
+
+    /* 割当結果判定 */
+    if ( pMsg == NULL ) {
+        /* 失敗 */
+
+        /* 戻り値設定 */
+        pParam->err = MK_ERR_NO_MEMORY;
+
+        return;
+    }
+
+    /* メッセージ設定 */
+    pMsg->src  = taskId;
+    pMsg->size = pParam->size;
+    pMsg->tsc  = IA32InstructionRdtsc();
+    MLibUtilCopyMemory( pMsg->msg, pParam->pMsg, pParam->size );
+
+    /* 受信待ちタスク判定 */
+    if ( pWait != NULL ) {
+        /* 有り */
+
+        /* 受信待ち解除 */
+        MLibListRemove( &( pEp->waitList ), &( pWait->nodeInfo ) );
+
+        /* メッセージ引渡し */
+        pWait->pMsg = pMsg;
+
+        /* スケジュール開始 */
+        TaskmngSchedStart( pWait->taskId );
+
+    } else {
+        /* 無し */
+
+        /* メッセージキューイング */
+        MLibListInsertTail( &( pEp->msgList ), &( pMsg->nodeInfo ) );
+
+        /* キュー統計更新 */
+        pEp->stat.num++;
+        pEp->stat.size += pMsg->size;
+        pEp->stat.hwmNum  = MLIB_UTIL_MAX( pEp->stat.hwmNum,  pEp->stat.num  );
+        pEp->stat.hwmSize = MLIB_UTIL_MAX( pEp->stat.hwmSize, pEp->stat.size );
+    }
+
+    /* トラフィック統計記録 */
+    ItcctrlMsgTrafficRecordSend( taskId, pEp->owner, pParam->size, true );
+
+    /* 戻り値設定 */
+    pParam->ret = MK_RET_SUCCESS;
+    pParam->err = MK_ERR_NONE;
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       エンドポイント管理情報取得
+ * @details     エンドポイントIDからエンドポイント管理情報を取得する。
+ *
+ * @param[in]   epId エンドポイントID
+ *
+ * @return      エンドポイント管理情報を返す。
+ * @retval      NULL     存在しない
+ * @retval      NULL以外 エンドポイント管理情報
+ */
+/******************************************************************************/
+static epEntry_t *GetEntry( MkEpId_t epId )
+{
+    epEntry_t *pEp;     /* エンドポイント管理情報 */
+    MLibRet_t retMLib;  /* MLib戻り値             */
+
+    /* 初期化 */
+    pEp     = NULL;
+    retMLib = MLIB_RET_FAILURE;
+
+    /* エンドポイントIDチェック */
+    if ( epId >= MK_CONFIG_EP_NUM ) {
+        /* 範囲外 */
+
+        return NULL;
+    }
+
+    /* エンドポイント管理情報取得 */
+    retMLib = MLibDynamicArrayGet( &gEpTbl,
+                                   ( uint_t ) epId,
+                                   ( void ** ) &pEp,
+                                   NULL              );
+
+    /* 取得結果判定 */
+    if ( ( retMLib  != MLIB_RET_SUCCESS ) ||
+         ( pEp->pid == MK_PID_NULL      )    ) {
+        /* 存在しない */
+
+        return NULL;
+    }
+
+    return pEp;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief           割込みハンドラ
+ * @details         機能IDから適切なハンドラを呼び出す。
+ *
+ * @param[in]       intNo     割込み番号
+ * @param[in,out]   *pContext 割込み発生時コンテキスト情報
+ */
+/******************************************************************************/
+static void HdlInt( uint32_t        intNo,
+                    IntmngContext_t *pContext )
+{
+    MkEpParam_t *pParam;    /* パラメータ */
+
+    /* 初期化 */
+    pParam = ( MkEpParam_t * ) pContext->genReg.esi;
+
+    /* パラメータチェック */
+    if ( pParam == NULL ) {
+        /* 不正 */
+        return;
+    }
+
+    /* パラメータ初期化 */
+    pParam->ret = MK_RET_FAILURE;
+    pParam->err = MK_ERR_NONE;
+
+    /* 機能ID判定 */
+    if ( pParam->funcId == MK_EP_FUNCID_CREATE ) {
+        /* エンドポイント生成 */
+
+        DoCreate( pParam );
+
+    } else if ( pParam->funcId == MK_EP_FUNCID_DELETE ) {
+        /* エンドポイント削除 */
+
+        DoDelete( pParam );
+
+    } else if ( pParam->funcId == MK_EP_FUNCID_SEND ) {
+        /* メッセージ送信 */
+
+        DoSend( pParam );
+
+    } else if ( pParam->funcId == MK_EP_FUNCID_RECEIVE ) {
+        /* メッセージ受信 */
+
+        pParam->src  = MK_TASKID_NULL;
+        pParam->size = 0;
+        DoReceive( pParam );
+
+    } else if ( pParam->funcId == MK_EP_FUNCID_GET_STAT ) {
+        /* キュー統計取得 */
+
+        DoGetStat( pParam );
+
+    } else {
+        /* 不正 */
+
+        /* エラー設定 */
+        pParam->err = MK_ERR_PARAM;
+    }
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       メッセージ受信待ちタイムアウト
+ * @details     受信待ちタスクリストから登録を削除し、受信待ちを解除する。
+ *
+ * @param[in]   timerId タイマID
+ * @param[in]   *pArg   受信待ち管理情報
+ */
+/******************************************************************************/
+static void TimeoutReceive( uint32_t timerId,
+                            void     *pArg    )
+{
+    epEntry_t   *pEp;   /* エンドポイント管理情報 */
+    waitEntry_t *pWait; /* 受信待ち管理情報       */
+
+    /* 初期化 */
+    pEp   = NULL;
+    pWait = ( waitEntry_t * ) pArg;
+
+    /* タイマID無効判定 */
+    if ( pWait->timerId != timerId ) {
+        /* 無効 */
+
+        return;
+    }
+
+    /* タイマID初期化 */
+    pWait->timerId = TIMERMNG_TIMERID_NULL;
+
+    /* 受信待ち状態判定 */
+    if ( ( pWait->state == STATE_WAIT ) &&
+         ( pWait->pMsg  == NULL       )    ) {
+        /* 受信待ち状態 */
+
+        /* エンドポイント管理情報取得 */
+        pEp = GetEntry( pWait->epId );
+
+        /* エンドポイント有無判定 */
+        if ( pEp != NULL ) {
+            /* 有り */
+
+            /* 受信待ち解除 */
+            MLibListRemove( &( pEp->waitList ), &( pWait->nodeInfo ) );
+        }
+
+        /* 状態設定 */
+        pWait->state = STATE_TIMEOUT;
+
+        /* スケジュール開始 */
+        TaskmngSchedStart( pWait->taskId );
+    }
+
+    return;
+}
+
+
+/******************************************************************************/
@@ -0,0 +1,18 @@
+/******************************************************************************/
+/*                                                                            */
+/* src/kernel/Itcctrl/ItcctrlEp.h                                             */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2026 Mochi.                                                  */
+/*                                                                            */
+/******************************************************************************/
+#ifndef ITCCTRL_EP_H
+#define ITCCTRL_EP_H
+/******************************************************************************/
+/* グローバル関数プロトタイプ宣言                                             */
+/******************************************************************************/
+/* エンドポイント制御初期化 */
+extern void ItcctrlEpInit( void );
+
+
+/******************************************************************************/
+#endif
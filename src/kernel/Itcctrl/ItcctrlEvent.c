@@ -0,0 +1,440 @@
+/******************************************************************************/
+/*                                                                            */
+/* src/kernel/Itcctrl/ItcctrlEvent.c                                          */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2026 Mochi.                                                  */
+/*                                                                            */
+/******************************************************************************/
+/******************************************************************************/
+/* インクルード                                                               */
+/******************************************************************************/
+/* 標準ヘッダ */
+#include <stdbool.h>
+#include <stdint.h>
+
+/* ライブラリヘッダ */
+#include <MLib/MLib.h>
+#include <MLib/MLibUtil.h>
+
+/* カーネルヘッダ */
+#include <kernel/event.h>
+#include <kernel/types.h>
+
+/* 共通ヘッダ */
+#include <hardware/IA32/IA32.h>
+
+/* 外部モジュールヘッダ */
+#include <Cmn.h>
+#include <Debug.h>
+#include <Intmng.h>
+#include <Itcctrl.h>
+#include <Taskmng.h>
+#include <Timermng.h>
+
+/* 内部モジュールヘッダ */
+#include "ItcctrlEvent.h"
+#include "ItcctrlMsg.h"
+#include "ItcctrlNtf.h"
+
+
+/******************************************************************************/
+/* 定義                                                                       */
+/******************************************************************************/
+/* モジュールID */
+#define _MODULE_ID_ CMN_MODULE_ITCCTRL_EVENT
+
+/* 状態 */
+#define STATE_INIT ( 0 )    /**< 初期状態             */
+#define STATE_WAIT ( 1 )    /**< イベント待ち合わせ中 */
+
+/** 待ち合わせ可能イベント */
+#define EVENT_ALL ( MK_EVENT_MSG   | \
+                    MK_EVENT_INT   | \
+                    MK_EVENT_TIMER | \
+                    MK_EVENT_NTF     )
+
+/** 待ち合わせ情報 */
+typedef struct {
+    uint32_t   state;                   /**< 状態                     */
+    uint32_t   events;                  /**< 待ち合わせイベント       */
+    uint32_t   occurred;                /**< 発生済みイベント         */
+    uint32_t   timerId;                 /**< タイマID                 */
+    uint32_t   srcNum;                  /**< 受信待ち送信元タスク数   */
+    MkTaskId_t src[ MK_EVENT_SRC_NUM ]; /**< 受信待ち送信元タスクID   */
+} waitInfo_t;
+
+
+/******************************************************************************/
+/* ローカル関数宣言                                                           */
+/******************************************************************************/
+/* 発生イベントチェック */
+static uint32_t Check( MkTaskId_t taskId,
+                       waitInfo_t *pInfo  );
+/* イベント待ち合わせ */
+static void DoWait( MkEventParam_t *pParam );
+/* 割込みハンドラ */
+static void HdlInt( uint32_t        intNo,
+                    IntmngContext_t *pContext );
+/* タイマ満了 */
+static void Timeout( uint32_t timerId,
+                     void     *pArg    );
+
+
+/******************************************************************************/
+/* 静的グローバル変数定義                                                     */
+/******************************************************************************/
+/** 待ち合わせ情報 */
+static waitInfo_t gWaitTbl[ MK_TASKID_NUM ];
+
+
+/******************************************************************************/
+/* グローバル関数定義                                                         */
+/******************************************************************************/
+/******************************************************************************/
+/**
+ * @brief       イベント待ち合わせ制御初期化
+ * @details     機能呼出し用割込みハンドラの設定を行う。
+ */
+/******************************************************************************/
+void ItcctrlEventInit( void )
+{
+    uint32_t idx;   /* インデックス */
+
+    /* 初期化 */
+    idx = 0;
+
+    /* 割込みハンドラ設定 */
+    IntmngHdlSet( MK_CONFIG_INTNO_EVENT,        /* 割込み番号     */
+                  HdlInt,                       /* 割込みハンドラ */
+                  IA32_DESCRIPTOR_DPL_3    );   /* 特権レベル     */
+
+    /* 待ち合わせ情報エントリ毎に繰り返す */
+    for ( idx = 0; idx < MK_TASKID_NUM; idx++ ) {
+        /* 初期化 */
+        gWaitTbl[ idx ].state    = STATE_INIT;
+        gWaitTbl[ idx ].events   = 0;
+        gWaitTbl[ idx ].occurred = 0;
+        gWaitTbl[ idx ].timerId  = TIMERMNG_TIMERID_NULL;
+        gWaitTbl[ idx ].srcNum   = 0;
+    }
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       イベント通知
+ * @details     指定したタスクがイベント待ち合わせ中であり、通知したイベントを
+ *              待ち合わせている場合はタスクのスケジュールを開始する。発生イベ
+ *              ントの判定は待ち合わせ側で改めて行う。
+ *
+ * @param[in]   taskId タスクID
+ * @param[in]   event  イベント
+ *                  - MK_EVENT_MSG メッセージ受信
+ *                  - MK_EVENT_INT ハードウェア割込み
+ *                  - MK_EVENT_NTF 通知
+ */
+/******************************************************************************/
+void ItcctrlEventNotify( MkTaskId_t taskId,
+                         uint32_t   event   )
+{
+    /* タスクID範囲チェック */
+    if ( taskId >= MK_TASKID_NUM ) {
+        /* 範囲外 */
+
+        return;
+    }
+
+    /* 待ち合わせ状態判定 */
+    if ( ( gWaitTbl[ taskId ].state                  == STATE_WAIT ) &&
+         ( ( gWaitTbl[ taskId ].events & event ) != 0          )    ) {
+        /* 待ち合わせ中 */
+
+        /* スケジュール開始 */
+        TaskmngSchedStart( taskId );
+    }
+
+    return;
+}
+
+
+/******************************************************************************/
+/* ローカル関数定義                                                           */
+/******************************************************************************/
+/******************************************************************************/
+/**
+ * @brief       発生イベントチェック
+ * @details     待ち合わせ中のイベント毎に発生有無をチェックする。
+ *
+ * @param[in]   taskId タスクID
+ * @param[in]   *pInfo 待ち合わせ情報
+ *
+ * @return      発生イベントを返す。
+ * @retval      0     発生無し
+ * @retval      0以外 発生イベント
+ */
+/******************************************************************************/
+static uint32_t Check( MkTaskId_t taskId,
+                       waitInfo_t *pInfo  )
+{
+    bool     exist;     /* 有無判定結果   */
+    uint32_t occurred;  /* 発生イベント   */
+
+    /* 初期化 */
+    exist    = false;
+    occurred = pInfo->occurred & pInfo->events;
+
+    /* メッセージ受信待ち合わせ判定 */
+    if ( ( pInfo->events & MK_EVENT_MSG ) != 0 ) {
+        /* 待ち合わせ有り */
+
+        /* 受信可能メッセージ有無チェック */
+        exist = ItcctrlMsgCheck( taskId, pInfo->src, pInfo->srcNum );
+
+        /* チェック結果判定 */
+        if ( exist != false ) {
+            /* 有り */
+
+            occurred |= MK_EVENT_MSG;
+        }
+    }
+
+    /* ハードウェア割込み待ち合わせ判定 */
+    if ( ( pInfo->events & MK_EVENT_INT ) != 0 ) {
+        /* 待ち合わせ有り */
+
+        /* 割込み発生判定 */
+        if ( IntmngCtrlGetIntList( taskId ) != 0 ) {
+            /* 発生済み */
+
+            occurred |= MK_EVENT_INT;
+        }
+    }
+
+    /* 通知待ち合わせ判定 */
+    if ( ( pInfo->events & MK_EVENT_NTF ) != 0 ) {
+        /* 待ち合わせ有り */
+
+        /* 通知有無チェック */
+        exist = ItcctrlNtfCheck( taskId );
+
+        /* チェック結果判定 */
+        if ( exist != false ) {
+            /* 有り */
+
+            occurred |= MK_EVENT_NTF;
+        }
+    }
+
+    return occurred;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief           イベント待ち合わせ
+ * @details         待ち合わせ対象のいずれかのイベントが発生するまでブロックし
+ *                  、発生したイベントを返す。イベントは消費しないため、メッセ
+ *                  ージ受信等は各機能呼出しで別途行う。
+ *
+ * @param[in,out]   *pParam パラメータ
+ */
+/******************************************************************************/
+static void DoWait( MkEventParam_t *pParam )
+{
+    uint32_t   occurred;    /* 発生イベント   */
+    MkTaskId_t taskId;      /* タスクID       */
+    waitInfo_t *pInfo;      /* 待ち合わせ情報 */
+
+    /* 初期化 */
+    occurred = 0;
+    taskId   = TaskmngSchedGetTaskId();
+    pInfo    = &( gWaitTbl[ taskId ] );
+
+    /* パラメータチェック */
+    if ( (   pParam->events                == 0                ) ||
+         ( ( pParam->events & ~EVENT_ALL ) != 0                ) ||
+         (   pParam->srcNum                >  MK_EVENT_SRC_NUM )    ) {
+        /* 不正 */
+
+        /* 戻り値設定 */
+        pParam->err = MK_ERR_PARAM;
+
+        return;
+    }
+
+    /* タイマ満了待ち合わせ判定 */
+    if ( ( ( pParam->events & MK_EVENT_TIMER ) != 0 ) &&
+         (   pParam->timeout                   == 0 )    ) {
+        /* タイマ値不正 */
+
+        /* 戻り値設定 */
+        pParam->err = MK_ERR_PARAM;
+
+        return;
+    }
+
+    /* 待ち合わせ情報設定 */
+    pInfo->events   = pParam->events;
+    pInfo->occurred = 0;
+    pInfo->srcNum   = pParam->srcNum;
+    MLibUtilCopyMemory( pInfo->src,
+                        pParam->src,
+                        sizeof ( MkTaskId_t ) * pParam->srcNum );
+
+    /* タイマ満了待ち合わせ判定 */
+    if ( ( pParam->events & MK_EVENT_TIMER ) != 0 ) {
+        /* 待ち合わせ有り */
+
+        /* タイマ設定 */
+        pInfo->timerId = TimermngCtrlSet( pParam->timeout,
+                                          TIMERMNG_TYPE_ONESHOT,
+                                          Timeout,
+                                          pInfo                  );
+
+        /* タイマ設定結果判定 */
+        if ( pInfo->timerId == TIMERMNG_TIMERID_NULL ) {
+            /* 失敗 */
+
+            /* 戻り値設定 */
+            pParam->err = MK_ERR_NO_RESOURCE;
+
+            return;
+        }
+    }
+
+    /* 待ち合わせループ */
+    while ( true ) {
+        /* 発生イベントチェック */
+        occurred = Check( taskId, pInfo );
+
+        /* チェック結果判定 */
+        if ( occurred != 0 ) {
+            /* 発生有り */
+            break;
+        }
+
+        /* 状態設定 */
+        pInfo->state = STATE_WAIT;
+
+        /* スケジュール停止 */
+        TaskmngSchedStop( taskId );
+
+        /* スケジュール実行 */
+        TaskmngSchedExec();
+
+        /* 状態設定 */
+        pInfo->state = STATE_INIT;
+    }
+
+    /* タイマ解除 */
+    TimermngCtrlUnset( pInfo->timerId );
+
+    /* 待ち合わせ情報初期化 */
+    pInfo->events   = 0;
+    pInfo->occurred = 0;
+    pInfo->timerId  = TIMERMNG_TIMERID_NULL;
+
+    /* 戻り値設定 */
+    pParam->ret      = MK_RET_SUCCESS;
+    pParam->err      = MK_ERR_NONE;
+    pParam->occurred = occurred;
+    pParam->intList  = IntmngCtrlGetIntList( taskId );
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief           割込みハンドラ
+ * @details         機能IDから適切なハンドラを呼び出す。
+ *
+ * @param[in]       intNo     割込み番号
+ * @param[in,out]   *pContext 割込み発生時コンテキスト情報
+ */
+/******************************************************************************/
+static void HdlInt( uint32_t        intNo,
+                    IntmngContext_t *pContext )
+{
+    MkEventParam_t *pParam; /* パラメータ */
+
+    /* 初期化 */
+    pParam = ( MkEventParam_t * ) pContext->genReg.esi;
+
+    /* パラメータチェック */
+    if ( pParam == NULL ) {
+        /* 不正 */
+        return;
+    }
+
+    /* パラメータ初期化 */
+    pParam->ret      = MK_RET_FAILURE;
+    pParam->err      = MK_ERR_NONE;
+    pParam->occurred = 0;
+    pParam->intList  = 0;
+
+    /* 機能ID判定 */
+    if ( pParam->funcId == MK_EVENT_FUNCID_WAIT ) {
+        /* イベント待ち合わせ */
+
+        DoWait( pParam );
+
+    } else {
+        /* 不正 */
+
+        /* エラー設定 */
+        pParam->err = MK_ERR_PARAM;
+    }
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       タイマ満了
+ * @details     タイマ満了イベントを設定し、待ち合わせ中であればタスクのスケ
+ *              ジュールを開始する。
+ *
+ * @param[in]   timerId タイマID
+ * @param[in]   *pArg   待ち合わせ情報
+ */
+/******************************************************************************/
+static void Timeout( uint32_t timerId,
+                     void     *pArg    )
+{
+    MkTaskId_t taskId;  /* タスクID       */
+    waitInfo_t *pInfo;  /* 待ち合わせ情報 */
+
+    /* 初期化 */
+    taskId = TimermngCtrlGetTaskId( timerId );
+    pInfo  = ( waitInfo_t * ) pArg;
+
+    /* タイマID無効判定 */
+    if ( pInfo->timerId != timerId ) {
+        /* 無効 */
+
+        return;
+    }
+
+    /* 発生イベント設定 */
+    pInfo->occurred |= MK_EVENT_TIMER;
+
+    /* タイマID初期化 */
+    pInfo->timerId = TIMERMNG_TIMERID_NULL;
+
+    /* 待ち合わせ状態判定 */
+    if ( pInfo->state == STATE_WAIT ) {
+        /* 待ち合わせ中 */
+
+        /* スケジュール開始 */
+        TaskmngSchedStart( taskId );
+    }
+
+    return;
+}
+
+
+/******************************************************************************/
@@ -0,0 +1,18 @@
+/******************************************************************************/
+/*                                                                            */
+/* src/kernel/Itcctrl/ItcctrlEvent.h                                          */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2026 Mochi.                                                  */
+/*                                                                            */
+/******************************************************************************/
+#ifndef ITCCTRL_EVENT_H
+#define ITCCTRL_EVENT_H
+/******************************************************************************/
+/* グローバル関数プロトタイプ宣言                                             */
+/******************************************************************************/
+/* イベント待ち合わせ制御初期化 */
+extern void ItcctrlEventInit( void );
+
+
+/******************************************************************************/
+#endif
@@ -1,8 +1,8 @@
 /******************************************************************************/
 /*                                                                            */
 /* src/kernel/Itcctrl/ItcctrlMsg.c                                            */
-/*                                                                 2026/06/02 */
-/* Copyright (C) 2018-2024 Mochi.                                             */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2018-2026 Mochi.                                             */
 /*                                                                            */
 /******************************************************************************/
 /******************************************************************************/
@@ -10,6 +10,7 @@
 /******************************************************************************/
 /* 標準ヘッダ */
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
 /* ライブラリヘッダ */
@@ -19,19 +20,25 @@
 
 /* カーネルヘッダ */
 #include <kernel/message.h>
+#include <kernel/syscall.h>
 #include <kernel/types.h>
 
 /* 共通ヘッダ */
 #include <hardware/IA32/IA32.h>
+#include <hardware/IA32/IA32Instruction.h>
 
 /* 外部モジュールヘッダ */
 #include <Cmn.h>
 #include <Debug.h>
 #include <Intmng.h>
+#include <Itcctrl.h>
 #include <Memmng.h>
 #include <Taskmng.h>
 #include <Timermng.h>
 
+/* 内部モジュールヘッダ */
+#include "ItcctrlMsg.h"
+
 
 /******************************************************************************/
 /* 定義                                                                       */
@@ -44,23 +51,42 @@
 #define STATE_RECVWAIT    ( 1 ) /**< 受信待ち状態             */
 #define STATE_RECVTIMEOUT ( 2 ) /**< 受信待ちタイムアウト状態 */
 #define STATE_SENDWAIT    ( 3 ) /**< 送信待ち状態             */
+#define STATE_FULLWAIT    ( 4 ) /**< キュー空き待ち状態       */
+
+/** トラフィック統計エントリ探索数 */
+#define TRAFFIC_PROBE_NUM ( 8 )
+
+/** トラフィック統計ハッシュ値計算 */
+#define TRAFFIC_HASH( _SRC, _DST )                        \
+    ( ( ( ( _SRC ) * 31 ) ^ ( _DST ) ) &                  \
+      ( MK_CONFIG_MSG_TRAFFIC_NUM - 1 )                    )
 
 /** 管理情報 */
 typedef struct {
-    MLibList_t list;    /**< メッセージリスト         */
-    MkTaskId_t src;     /**< 受信待ちメッセージ送信元 */
-    uint32_t   state;   /**< 状態                     */
-    uint32_t   seqNo;   /**< シーケンス番号           */
-    uint32_t   timerId; /**< タイマID                 */
+    MLibListNode_t   nodeInfo;                  /**< キュー空き待ちノード情報 */
+    MLibList_t       list[ MK_MSG_LANE_NUM ];   /**< レーン別メッセージリスト */
+    MLibList_t       fullList;                  /**< キュー空き待ちリスト     */
+    MkTaskId_t       taskId;                    /**< タスクID                 */
+    MkTaskId_t       src;                       /**< 受信待ちメッセージ送信元 */
+    uint32_t         state;                     /**< 状態                     */
+    uint32_t         seqNo;                     /**< シーケンス番号           */
+    uint32_t         timerId;                   /**< タイマID                 */
+    uint32_t         mode;                      /**< 受信モード               */
+    MkTaskId_t       lastSrc;                   /**< 前回受信メッセージ送信元 */
+    MkMsgQueueStat_t stat;                      /**< キュー統計               */
 } mngEntry_t;
 
 /** メッセージ */
 typedef struct {
-    MLibListNode_t nodeInfo;    /**< ノード情報       */
-    MkTaskId_t     src;         /**< 送信元タスクID   */
-    uint32_t       seqNo;       /**< シーケンス番号   */
-    size_t         size;        /**< メッセージサイズ */
-    uint8_t        msg[];       /**< メッセージ       */
+    MLibListNode_t   nodeInfo;  /**< ノード情報        */
+    MkTaskId_t       src;       /**< 送信元タスクID    */
+    uint32_t         seqNo;     /**< シーケンス番号    */
+    uint32_t         lane;      /**< レーン            */
+    size_t           size;      /**< メッセージサイズ  */
+    uint8_t          *pData;    /**< メッセージ本文    */
+    ItcctrlMsgBody_t *pBody;    /**< 共有メッセージ    */
+    uint64_t         tsc;       /**< キューイング時TSC */
+    uint8_t          msg[];     /**< メッセージ        */
 } msg_t;
 
 
@@ -74,19 +100,51 @@ static bool CheckSrc( MLibListNode_t *pNode,
 static bool CheckValid( MkTaskId_t self,
                         MkTaskId_t other,
                         MkErr_t    *pErr  );
+/* メッセージデキュー */
+static msg_t *Dequeue( mngEntry_t *pInfo,
+                       MkTaskId_t src    );
+/* メッセージデキュー(送信元ラウンドロビン) */
+static msg_t *DequeueRR( mngEntry_t *pInfo,
+                         MLibList_t *pList  );
+/* トラフィック統計ログ出力 */
+static void DoDumpTraffic( MkMsgParam_t *pParam );
+/* メッセージキュー統計取得 */
+static void DoGetStat( MkMsgParam_t *pParam );
+/* トラフィック統計取得 */
+static void DoGetTraffic( MkMsgParam_t *pParam );
 /* メッセージ受信 */
 static void DoReceive( MkMsgParam_t *pParam );
+/* メッセージ送信 */
+static void DoSend( MkMsgParam_t *pParam );
 /* メッセージ送信共通処理 */
 static void DoSendCmn( MkTaskId_t   *pTaskId,
                        MkMsgParam_t *pParam   );
-/* メッセージ送信 */
+/* メッセージ送信(ノンブロック) */
 static void DoSendNB( MkMsgParam_t *pParam );
+/* メッセージキュー上限設定 */
+static void DoSetLimit( MkMsgParam_t *pParam );
+/* メッセージ受信モード設定 */
+static void DoSetMode( MkMsgParam_t *pParam );
+/* メッセージキューイング */
+static void Enqueue( MkTaskId_t dst,
+                     msg_t      *pMsg );
+/* メッセージ解放 */
+static void FreeMsg( msg_t *pMsg );
 /* 割込みハンドラ */
 static void HdlInt( uint32_t        intNo,
-                    IntmngContext_t context );
+                    IntmngContext_t *pContext );
+/* システムコールハンドラ */
+static void HdlSys( uint32_t     no,
+                    IA32Pushad_t *pReg );
 /* メッセージ受信待ちタイムアウト */
 static void TimeoutReceive( uint32_t timerId,
                             void     *pArg    );
+/* トラフィック統計エントリ検索 */
+static MkMsgTraffic_t *TrafficSearch( MkTaskId_t src,
+                                      MkTaskId_t dst  );
+/* キュー空き待ち送信元起床 */
+static void WakeFullWait( mngEntry_t *pInfo,
+                          bool       all    );
 
 
 /******************************************************************************/
@@ -95,6 +153,12 @@ static void TimeoutReceive( uint32_t timerId,
 /** 管理情報 */
 static mngEntry_t gMngTbl[ MK_TASKID_NUM ];
 
+/** トラフィック統計 */
+static MkMsgTraffic_t gTrafficTbl[ MK_CONFIG_MSG_TRAFFIC_NUM ];
+
+/** トラフィック統計記録不可回数 */
+static uint32_t gTrafficLost;
+
 
 /******************************************************************************/
 /* グローバル関数定義                                                         */
@@ -107,24 +171,425 @@ static mngEntry_t gMngTbl[ MK_TASKID_NUM ];
 /******************************************************************************/
 void ItcctrlMsgInit( void )
 {
-    uint32_t idx;   /* インデックス */
+    uint32_t idx;   /* インデックス     */
+    uint32_t lane;  /* レーンインデックス */
 
     /* 初期化 */
-    idx = 0;
+    idx  = 0;
+    lane = 0;
 
     /* 割込みハンドラ設定 */
     IntmngHdlSet( MK_CONFIG_INTNO_MESSAGE,      /* 割込み番号     */
                   HdlInt,                       /* 割込みハンドラ */
                   IA32_DESCRIPTOR_DPL_3    );   /* 特権レベル     */
 
+    /* システムコールハンドラ設定 */
+    IntmngSysSet( MK_SYSCALL_MSG_RECEIVE, HdlSys );
+    IntmngSysSet( MK_SYSCALL_MSG_SEND,    HdlSys );
+    IntmngSysSet( MK_SYSCALL_MSG_SEND_NB, HdlSys );
+
     /* 管理テーブルエントリ毎に繰り返す */
     for ( idx = 0; idx < MK_TASKID_NUM; idx++ ) {
         /* 初期化 */
-        MLibListInit( &( gMngTbl[ idx ].list ) );
-        gMngTbl[ idx ].src     = MK_TASKID_NULL;
-        gMngTbl[ idx ].state   = STATE_INIT;
-        gMngTbl[ idx ].seqNo   = 0;
-        gMngTbl[ idx ].timerId = TIMERMNG_TIMERID_NULL;
+        for ( lane = 0; lane < MK_MSG_LANE_NUM; lane++ ) {
+            MLibListInit( &( gMngTbl[ idx ].list[ lane ] ) );
+        }
+        MLibListInit( &( gMngTbl[ idx ].fullList ) );
+        MLibUtilSetMemory8( &( gMngTbl[ idx ].stat ),
+                            0,
+                            sizeof ( MkMsgQueueStat_t ) );
+        gMngTbl[ idx ].taskId         = idx;
+        gMngTbl[ idx ].src            = MK_TASKID_NULL;
+        gMngTbl[ idx ].state          = STATE_INIT;
+        gMngTbl[ idx ].seqNo          = 0;
+        gMngTbl[ idx ].timerId        = TIMERMNG_TIMERID_NULL;
+        gMngTbl[ idx ].mode           = MK_MSG_MODE_FIFO;
+        gMngTbl[ idx ].lastSrc        = MK_TASKID_NULL;
+        gMngTbl[ idx ].stat.limitNum  = MK_CONFIG_MSG_QUEUE_NUM;
+        gMngTbl[ idx ].stat.limitSize = MK_CONFIG_MSG_QUEUE_SIZE;
+    }
+
+    /* トラフィック統計エントリ毎に繰り返す */
+    for ( idx = 0; idx < MK_CONFIG_MSG_TRAFFIC_NUM; idx++ ) {
+        /* 初期化 */
+        MLibUtilSetMemory8( &( gTrafficTbl[ idx ] ),
+                            0,
+                            sizeof ( MkMsgTraffic_t ) );
+        gTrafficTbl[ idx ].src = MK_TASKID_NULL;
+        gTrafficTbl[ idx ].dst = MK_TASKID_NULL;
+    }
+    gTrafficLost = 0;
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       受信可能メッセージ有無チェック
+ * @details     指定したタスクのメッセージキューに、送信元タスクIDリストのいず
+ *              れかのタスクから送信されたメッセージが有るかチェックする。送信
+ *              元タスク数が0の場合は全てのタスクを対象とする。
+ *
+ * @param[in]   taskId  タスクID
+ * @param[in]   *pSrc   送信元タスクIDリスト
+ * @param[in]   srcNum  送信元タスク数
+ *
+ * @return      チェック結果を返す。
+ * @retval      true  有り
+ * @retval      false 無し
+ */
+/******************************************************************************/
+bool ItcctrlMsgCheck( MkTaskId_t taskId,
+                      MkTaskId_t *pSrc,
+                      uint32_t   srcNum  )
+{
+    msg_t      *pMsg;   /* メッセージ         */
+    uint32_t   idx;     /* インデックス       */
+    uint32_t   lane;    /* レーンインデックス */
+    MLibList_t *pList;  /* メッセージリスト   */
+
+    /* 初期化 */
+    pMsg  = NULL;
+    idx   = 0;
+    lane  = 0;
+    pList = NULL;
+
+    /* 送信元タスク数判定 */
+    if ( srcNum == 0 ) {
+        /* 全てのタスク */
+
+        return ( gMngTbl[ taskId ].stat.num != 0 );
+    }
+
+    /* レーン毎に繰り返す */
+    for ( lane = 0; lane < MK_MSG_LANE_NUM; lane++ ) {
+        /* 先頭メッセージ取得 */
+        pList = &( gMngTbl[ taskId ].list[ lane ] );
+        pMsg  = ( msg_t * ) MLibListGetNextNode( pList, NULL );
+
+        /* メッセージ毎に繰り返す */
+        while ( pMsg != NULL ) {
+            /* 送信元タスクID毎に繰り返す */
+            for ( idx = 0; idx < srcNum; idx++ ) {
+                /* 送信元タスクID比較 */
+                if ( pMsg->src == pSrc[ idx ] ) {
+                    /* 一致 */
+
+                    return true;
+                }
+            }
+
+            /* 次メッセージ取得 */
+            pMsg = ( msg_t * ) MLibListGetNextNode( pList,
+                                                    &( pMsg->nodeInfo ) );
+        }
+    }
+
+    return false;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       メッセージキュー空きチェック
+ * @details     キュー統計の上限値に対して、指定サイズのメッセージを追加できる
+ *              かチェックする。キューが満杯の場合はキュー満杯発生回数を更新す
+ *              る。エンドポイントのキューも本関数で上限を判定する。
+ *
+ * @param[in]   *pStat キュー統計
+ * @param[in]   size   メッセージサイズ
+ * @param[out]  *pErr  エラー要因
+ *                  - MK_ERR_NONE       エラー無し
+ *                  - MK_ERR_SIZE_OVER  サイズ上限超過
+ *                  - MK_ERR_QUEUE_FULL キュー満杯
+ *
+ * @return      チェック結果を返す。
+ * @retval      true  空き有り
+ * @retval      false 空き無し
+ */
+/******************************************************************************/
+bool ItcctrlMsgCheckSpace( MkMsgQueueStat_t *pStat,
+                           size_t           size,
+                           MkErr_t          *pErr   )
+{
+    /* 初期化 */
+    *pErr = MK_ERR_NONE;
+
+    /* メッセージサイズチェック */
+    if ( size > pStat->limitSize ) {
+        /* 上限超過 */
+
+        /* エラー要因設定 */
+        *pErr = MK_ERR_SIZE_OVER;
+
+        return false;
+    }
+
+    /* キュー空きチェック */
+    if ( ( pStat->num  >= pStat->limitNum             ) ||
+         ( pStat->size >  ( pStat->limitSize - size ) )    ) {
+        /* 満杯 */
+
+        /* キュー満杯発生回数更新 */
+        pStat->fullCnt++;
+
+        /* エラー要因設定 */
+        *pErr = MK_ERR_QUEUE_FULL;
+
+        return false;
+    }
+
+    return true;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       カーネルメッセージ送信
+ * @details     カーネルが生成したメッセージを送信先タスクに送信する。送信元は
+ *              送信先タスク自身とし、メッセージ本文は共有メッセージにコピーし
+ *              て送信する。送信先タスクのメッセージキューが上限に達している場
+ *              合はブロックせずに失敗する。
+ *
+ * @param[in]   dst   送信先タスクID
+ * @param[in]   *pMsg メッセージ
+ * @param[in]   size  メッセージサイズ
+ * @param[out]  *pErr エラー要因
+ *                  - MK_ERR_NONE       エラー無し
+ *                  - MK_ERR_NO_EXIST   タスクが存在しない
+ *                  - MK_ERR_SIZE_OVER  サイズ上限超過
+ *                  - MK_ERR_QUEUE_FULL キュー満杯
+ *                  - MK_ERR_NO_MEMORY  メモリ不足
+ *
+ * @return      処理結果を返す。
+ * @retval      CMN_SUCCESS 正常終了
+ * @retval      CMN_FAILURE 異常終了
+ */
+/******************************************************************************/
+CmnRet_t ItcctrlMsgSendKernel( MkTaskId_t dst,
+                               const void *pMsg,
+                               size_t     size,
+                               MkErr_t    *pErr )
+{
+    CmnRet_t         ret;       /* 関数戻り値     */
+    ItcctrlMsgBody_t *pBody;    /* 共有メッセージ */
+
+    /* 初期化 */
+    ret   = CMN_FAILURE;
+    pBody = NULL;
+
+    /* 共有メッセージ領域割当 */
+    pBody = MemmngHeapAlloc( sizeof ( ItcctrlMsgBody_t ) + size );
+
+    /* 割当結果判定 */
+    if ( pBody == NULL ) {
+        /* 失敗 */
+
+        /* エラー要因設定 */
+        *pErr = MK_ERR_NO_MEMORY;
+
+        return CMN_FAILURE;
+    }
+
+    /* 共有メッセージ設定 */
+    pBody->refCnt = 0;
+    pBody->size   = size;
+    MLibUtilCopyMemory( pBody->data, pMsg, size );
+
+    /* 共有メッセージ送信 */
+    ret = ItcctrlMsgSendShared( dst, dst, pBody, pErr );
+
+    /* 参照判定 */
+    if ( pBody->refCnt == 0 ) {
+        /* 参照無し */
+
+        /* 共有メッセージ解放 */
+        MemmngHeapFree( pBody );
+    }
+
+    return ret;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       共有メッセージ送信
+ * @details     送信先タスクのメッセージキューに共有メッセージを参照するメッセ
+ *              ージを通常レーンでキューイングする。メッセージ本文はコピーせず
+ *              に共有メッセージの参照カウンタを加算する。送信先タスクのメッセ
+ *              ージキューが上限に達している場合はブロックせずに失敗する。
+ *
+ * @param[in]   src    送信元タスクID
+ * @param[in]   dst    送信先タスクID
+ * @param[in]   *pBody 共有メッセージ
+ * @param[out]  *pErr  エラー要因
+ *                  - MK_ERR_NONE       エラー無し
+ *                  - MK_ERR_NO_EXIST   タスクが存在しない
+ *                  - MK_ERR_SIZE_OVER  サイズ上限超過
+ *                  - MK_ERR_QUEUE_FULL キュー満杯
+ *                  - MK_ERR_NO_MEMORY  メモリ不足
+ *
+ * @return      処理結果を返す。
+ * @retval      CMN_SUCCESS 正常終了
+ * @retval      CMN_FAILURE 異常終了
+ */
+/******************************************************************************/
+CmnRet_t ItcctrlMsgSendShared( MkTaskId_t       src,
+                               MkTaskId_t       dst,
+                               ItcctrlMsgBody_t *pBody,
+                               MkErr_t          *pErr   )
+{
+    bool       ret;         /* 関数戻り値     */
+    msg_t      *pMsg;       /* メッセージ     */
+    mngEntry_t *pDstInfo;   /* 送信先管理情報 */
+
+    /* 初期化 */
+    ret      = false;
+    pMsg     = NULL;
+    pDstInfo = &( gMngTbl[ dst ] );
+    *pErr    = MK_ERR_NONE;
+
+    /* 送信先タスク存在確認 */
+    ret = TaskmngTaskCheckExist( dst );
+
+    /* 確認結果判定 */
+    if ( ret == false ) {
+        /* 存在しない */
+
+        /* エラー要因設定 */
+        *pErr = MK_ERR_NO_EXIST;
+
+        return CMN_FAILURE;
+    }
+
+    /* メッセージキュー空きチェック */
+    ret = ItcctrlMsgCheckSpace( &( pDstInfo->stat ), pBody->size, pErr );
+
+    /* チェック結果判定 */
+    if ( ret == false ) {
+        /* 空き無し */
+
+        return CMN_FAILURE;
+    }
+
+    /* メッセージヘッダ領域割当 */
+    pMsg = MemmngHeapAlloc( sizeof ( msg_t ) );
+
+    /* 割当結果判定 */
+    if ( pMsg == NULL ) {
+        /* 失敗 */
+
+        /* エラー要因設定 */
+        *pErr = MK_ERR_NO_MEMORY;
+
+        return CMN_FAILURE;
+    }
+
+    /* 参照カウンタ加算 */
+    pBody->refCnt++;
+
+    /* メッセージヘッダ設定 */
+    pMsg->src   = src;
+    pMsg->seqNo = 0;
+    pMsg->lane  = MK_MSG_LANE_NORMAL;
+    pMsg->size  = pBody->size;
+    pMsg->pData = pBody->data;
+    pMsg->pBody = pBody;
+
+    /* キューイング */
+    Enqueue( dst, pMsg );
+
+    /* トラフィック統計記録 */
+    ItcctrlMsgTrafficRecordSend( src, dst, pMsg->size, true );
+
+    return CMN_SUCCESS;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       トラフィック統計記録(受信)
+ * @details     送信元タスクと受信タスクの組に対して、受信数とキューイングから
+ *              受信までのTSC差を記録する。
+ *
+ * @param[in]   src 送信元タスクID
+ * @param[in]   dst 受信タスクID
+ * @param[in]   tsc キューイング時TSC
+ */
+/******************************************************************************/
+void ItcctrlMsgTrafficRecordRecv( MkTaskId_t src,
+                                  MkTaskId_t dst,
+                                  uint64_t   tsc  )
+{
+    uint64_t       latency;     /* 送信-受信間TSC差 */
+    MkMsgTraffic_t *pTraffic;   /* トラフィック統計 */
+
+    /* 初期化 */
+    latency  = IA32InstructionRdtsc() - tsc;
+    pTraffic = TrafficSearch( src, dst );
+
+    /* 検索結果判定 */
+    if ( pTraffic == NULL ) {
+        /* 記録不可 */
+
+        return;
+    }
+
+    /* 統計更新 */
+    pTraffic->recvNum++;
+    pTraffic->latencySum += latency;
+    pTraffic->latencyMax  =
+        MLIB_UTIL_MAX( pTraffic->latencyMax,
+                       ( uint32_t ) MLIB_UTIL_MIN( latency, UINT32_MAX ) );
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       トラフィック統計記録(送信)
+ * @details     送信元タスクと送信先タスクの組に対して、送信数と送信サイズを記
+ *              録する。
+ *
+ * @param[in]   src  送信元タスクID
+ * @param[in]   dst  送信先タスクID
+ * @param[in]   size メッセージサイズ
+ * @param[in]   nb   ノンブロッキング送信
+ */
+/******************************************************************************/
+void ItcctrlMsgTrafficRecordSend( MkTaskId_t src,
+                                  MkTaskId_t dst,
+                                  size_t     size,
+                                  bool       nb    )
+{
+    MkMsgTraffic_t *pTraffic;   /* トラフィック統計 */
+
+    /* 初期化 */
+    pTraffic = TrafficSearch( src, dst );
+
+    /* 検索結果判定 */
+    if ( pTraffic == NULL ) {
+        /* 記録不可 */
+
+        return;
+    }
+
+    /* 統計更新 */
+    pTraffic->num++;
+    pTraffic->size += size;
+
+    /* 送信種別判定 */
+    if ( nb != false ) {
+        /* ノンブロッキング */
+
+        pTraffic->nbNum++;
+
+    } else {
+        /* ブロッキング */
+
+        pTraffic->blockNum++;
     }
 
     return;
@@ -218,14 +683,320 @@ static bool CheckValid( MkTaskId_t self,
     if ( diff > 1 ) {
         /* 非隣接 */
 
-        /* エラー要因設定 */
-        *pErr = MK_ERR_UNAUTHORIZED;
+        /* エラー要因設定 */
+        *pErr = MK_ERR_UNAUTHORIZED;
+
+        return false;
+    }
+
+    return true;
+ }
+
+/******************************************************************************/
+/**
+ * @brief       メッセージデキュー
+ * @details     緊急レーン、通常レーンの順にメッセージをデキューする。送信元タ
+ *              スクIDを指定した場合は指定送信元のメッセージをデキューする。送
+ *              信元タスクIDを指定しない場合は、受信モードが送信元ラウンドロビ
+ *              ンであれば送信元毎に順番にデキューし、到着順であれば先頭からデ
+ *              キューする。
+ *
+ * @param[in]   *pInfo 管理情報
+ * @param[in]   src    送信元タスクID
+ *                  - MK_TASKID_NULL     全てのタスク
+ *                  - MK_TASKID_NULL以外 タスク指定
+ *
+ * @return      デキューしたメッセージを返す。
+ * @retval      NULL     メッセージ無し
+ * @retval      NULL以外 メッセージ
+ */
+/******************************************************************************/
+static msg_t *Dequeue( mngEntry_t *pInfo,
+                       MkTaskId_t src    )
+{
+    msg_t      *pMsg;   /* メッセージ         */
+    uint32_t   lane;    /* レーンインデックス */
+    MLibList_t *pList;  /* メッセージリスト   */
+
+    /* 初期化 */
+    pMsg  = NULL;
+    lane  = 0;
+    pList = NULL;
+
+    /* レーン毎に繰り返す */
+    for ( lane = 0; lane < MK_MSG_LANE_NUM; lane++ ) {
+        /* メッセージリスト取得 */
+        pList = &( pInfo->list[ lane ] );
+
+        /* 受信待ちタスクID判定 */
+        if ( src != MK_TASKID_NULL ) {
+            /* 指定 */
+
+            /* 指定送信元メッセージデキュー */
+            pMsg = ( msg_t * ) MLibListSearchHead( pList,
+                                                   &CheckSrc,
+                                                   &src,
+                                                   MLIB_LIST_REMOVE );
+
+        } else if ( pInfo->mode == MK_MSG_MODE_RR ) {
+            /* ANY(送信元ラウンドロビン) */
+
+            /* メッセージデキュー */
+            pMsg = DequeueRR( pInfo, pList );
+
+        } else {
+            /* ANY(到着順) */
+
+            /* メッセージデキュー */
+            pMsg = ( msg_t * ) MLibListRemoveHead( pList );
+        }
+
+        /* デキュー結果判定 */
+        if ( pMsg != NULL ) {
+            /* メッセージ有り */
+
+            return pMsg;
+        }
+    }
+
+    return NULL;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       メッセージデキュー(送信元ラウンドロビン)
+ * @details     前回受信したメッセージの送信元タスクIDより大きいタスクIDの中で
+ *              最小のタスクIDの送信元の先頭メッセージをデキューする。該当する
+ *              送信元が無い場合は最小のタスクIDの送信元の先頭メッセージをデキ
+ *              ューする。同一送信元のメッセージの順序は保たれる。
+ *
+ * @param[in]   *pInfo 管理情報
+ * @param[in]   *pList メッセージリスト
+ *
+ * @return      デキューしたメッセージを返す。
+ * @retval      NULL     メッセージ無し
+ * @retval      NULL以外 メッセージ
+ */
+/******************************************************************************/
+static msg_t *DequeueRR( mngEntry_t *pInfo,
+                         MLibList_t *pList  )
+{
+    msg_t *pMsg;    /* メッセージ                   */
+    msg_t *pNext;   /* 次送信元先頭メッセージ       */
+    msg_t *pFirst;  /* 最小送信元先頭メッセージ     */
+
+    /* 初期化 */
+    pMsg   = ( msg_t * ) MLibListGetNextNode( pList, NULL );
+    pNext  = NULL;
+    pFirst = NULL;
+
+    /* メッセージ毎に繰り返す */
+    while ( pMsg != NULL ) {
+        /* 最小送信元判定 */
+        if ( ( pFirst == NULL ) || ( pMsg->src < pFirst->src ) ) {
+            /* 最小 */
+
+            pFirst = pMsg;
+        }
+
+        /* 次送信元判定 */
+        if ( (   pMsg->src > pInfo->lastSrc   ) &&
+             ( ( pNext     == NULL          ) ||
+               ( pMsg->src <  pNext->src    )    )    ) {
+            /* 次送信元候補 */
+
+            pNext = pMsg;
+        }
+
+        /* 次メッセージ取得 */
+        pMsg = ( msg_t * ) MLibListGetNextNode( pList, &( pMsg->nodeInfo ) );
+    }
+
+    /* 次送信元有無判定 */
+    if ( pNext == NULL ) {
+        /* 無し */
+
+        /* 先頭に戻る */
+        pNext = pFirst;
+    }
+
+    /* メッセージ有無判定 */
+    if ( pNext != NULL ) {
+        /* 有り */
+
+        /* デキュー */
+        MLibListRemove( pList, &( pNext->nodeInfo ) );
+
+        /* 前回受信メッセージ送信元更新 */
+        pInfo->lastSrc = pNext->src;
+    }
+
+    return pNext;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief           トラフィック統計ログ出力
+ * @details         記録済みの全トラフィック統計をデバッグログに出力する。
+ *
+ * @param[in,out]   *pParam パラメータ
+ */
+/******************************************************************************/
+static void DoDumpTraffic( MkMsgParam_t *pParam )
+{
+    uint32_t       idx;         /* インデックス         */
+    uint32_t       avg;         /* 平均送信-受信間TSC差 */
+    MkMsgTraffic_t *pTraffic;   /* トラフィック統計     */
+
+    /* 初期化 */
+    idx      = 0;
+    avg      = 0;
+    pTraffic = NULL;
+
+    DEBUG_LOG_INF( "traffic: lost=%u", gTrafficLost );
+
+    /* トラフィック統計エントリ毎に繰り返す */
+    for ( idx = 0; idx < MK_CONFIG_MSG_TRAFFIC_NUM; idx++ ) {
+        /* エントリ取得 */
+        pTraffic = &( gTrafficTbl[ idx ] );
+
+        /* 使用判定 */
+        if ( pTraffic->src == MK_TASKID_NULL ) {
+            /* 未使用 */
+            continue;
+        }
+
+        /* 受信数判定 */
+        if ( pTraffic->recvNum != 0 ) {
+            /* 受信有り */
+
+            /* 平均計算 */
+            avg = ( uint32_t ) ( pTraffic->latencySum / pTraffic->recvNum );
+
+        } else {
+            /* 受信無し */
+
+            avg = 0;
+        }
+
+        DEBUG_LOG_INF(
+            " %#X->%#X: num=%u(blk=%u,nb=%u) recv=%u kb=%u lat(avg=%u,max=%u)",
+            pTraffic->src,
+            pTraffic->dst,
+            pTraffic->num,
+            pTraffic->blockNum,
+            pTraffic->nbNum,
+            pTraffic->recvNum,
+            ( uint32_t ) ( pTraffic->size >> 10 ),
+            avg,
+            pTraffic->latencyMax
+        );
+    }
+
+    /* 戻り値設定 */
+    pParam->ret = MK_RET_SUCCESS;
+    pParam->err = MK_ERR_NONE;
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief           メッセージキュー統計取得
+ * @details         自タスクのメッセージキュー統計を取得する。
+ *
+ * @param[in,out]   *pParam パラメータ
+ */
+/******************************************************************************/
+static void DoGetStat( MkMsgParam_t *pParam )
+{
+    MkTaskId_t taskId;  /* タスクID */
+
+    /* 初期化 */
+    taskId = TaskmngSchedGetTaskId();
+
+    /* パラメータチェック */
+    if ( pParam->pStat == NULL ) {
+        /* 不正 */
+
+        /* 戻り値設定 */
+        pParam->ret = MK_RET_FAILURE;
+        pParam->err = MK_ERR_PARAM;
+
+        return;
+    }
+
+    /* キュー統計コピー */
+    MLibUtilCopyMemory( pParam->pStat,
+                        &( gMngTbl[ taskId ].stat ),
+                        sizeof ( MkMsgQueueStat_t ) );
+
+    /* 戻り値設定 */
+    pParam->ret = MK_RET_SUCCESS;
+    pParam->err = MK_ERR_NONE;
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief           トラフィック統計取得
+ * @details         記録済みのトラフィック統計を格納先エントリ数まで取得する。
+ *
+ * @param[in,out]   *pParam パラメータ
+ */
+/******************************************************************************/
+static void DoGetTraffic( MkMsgParam_t *pParam )
+{
+    uint32_t idx;   /* インデックス   */
+    uint32_t num;   /* 取得エントリ数 */
+
+    /* 初期化 */
+    idx = 0;
+    num = 0;
+
+    /* パラメータチェック */
+    if ( ( pParam->traffic.pBuffer == NULL ) &&
+         ( pParam->traffic.num     != 0    )    ) {
+        /* 不正 */
+
+        /* 戻り値設定 */
+        pParam->ret = MK_RET_FAILURE;
+        pParam->err = MK_ERR_PARAM;
+
+        return;
+    }
+
+    /* トラフィック統計エントリ毎に繰り返す */
+    for ( idx = 0;
+          ( idx < MK_CONFIG_MSG_TRAFFIC_NUM ) && ( num < pParam->traffic.num );
+          idx++                                                                ) {
+        /* 使用判定 */
+        if ( gTrafficTbl[ idx ].src == MK_TASKID_NULL ) {
+            /* 未使用 */
+            continue;
+        }
 
-        return false;
+        /* トラフィック統計コピー */
+        MLibUtilCopyMemory( &( pParam->traffic.pBuffer[ num ] ),
+                            &( gTrafficTbl[ idx ] ),
+                            sizeof ( MkMsgTraffic_t )            );
+        num++;
     }
 
-    return true;
- }
+    /* 戻り値設定 */
+    pParam->ret          = MK_RET_SUCCESS;
+    pParam->err          = MK_ERR_NONE;
+    pParam->traffic.num  = num;
+    pParam->traffic.lost = gTrafficLost;
+
+    return;
+}
+
 
 /******************************************************************************/
 /**
@@ -246,7 +1017,6 @@ static void DoReceive( MkMsgParam_t *pParam )
     msg_t      *pMsg;       /* メッセージ     */
     size_t     size;        /* コピーサイズ   */
     MkErr_t    err;         /* エラー要因     */
-    uint32_t   tick;        /* タイムアウト値 */
     MkTaskId_t taskId;      /* タスクID       */
     mngEntry_t *pDstInfo;   /* 送信先管理情報 */
 
@@ -255,20 +1025,13 @@ static void DoReceive( MkMsgParam_t *pParam )
     pMsg     = NULL;
     size     = 0;
     err      = MK_ERR_NONE;
-    tick     = 0;
     taskId   = TaskmngSchedGetTaskId();
     pDstInfo = &( gMngTbl[ taskId ] );
 
     /* 受信ループ */
     while ( true ) {
         /* 受信待ちタスクID判定 */
-        if ( pParam->recv.src == MK_TASKID_NULL ) {
-            /* ANY */
-
-            /* メッセージデキュー */
-            pMsg = ( msg_t * ) MLibListRemoveHead( &( pDstInfo->list ) );
-
-        } else {
+        if ( pParam->recv.src != MK_TASKID_NULL ) {
             /* 指定 */
 
             /* タスク有効チェック */
@@ -291,15 +1054,11 @@ static void DoReceive( MkMsgParam_t *pParam )
 
                 return;
             }
-
-            /* 指定送信元メッセージデキュー */
-            pMsg = ( msg_t * )
-                   MLibListSearchHead( &( pDstInfo->list ),
-                                       &CheckSrc,
-                                       &( pParam->recv.src ),
-                                       MLIB_LIST_REMOVE       );
         }
 
+        /* メッセージデキュー */
+        pMsg = Dequeue( pDstInfo, pParam->recv.src );
+
         /* メッセージ取得結果判定 */
         if ( pMsg != NULL ) {
             /* メッセージ有 */
@@ -320,6 +1079,14 @@ static void DoReceive( MkMsgParam_t *pParam )
             pDstInfo->state   = STATE_INIT;
             pDstInfo->timerId = TIMERMNG_TIMERID_NULL;
 
+            /* キュー統計更新 */
+            pDstInfo->stat.num--;
+            pDstInfo->stat.size -= pMsg->size;
+            pDstInfo->stat.laneNum[ pMsg->lane ]--;
+
+            /* キュー空き待ち送信元起床 */
+            WakeFullWait( pDstInfo, false );
+
             /* コピーサイズ設定 */
             size = MLIB_UTIL_MIN( pMsg->size, pParam->recv.bufferSize );
 
@@ -331,12 +1098,14 @@ static void DoReceive( MkMsgParam_t *pParam )
 
             /* メッセージコピー */
             MLibUtilCopyMemory( pParam->recv.pBuffer,
-                                pMsg->msg,
+                                pMsg->pData,
                                 size                  );
 
-            /* メッセージバッファ解放 */
-            MLibUtilSetMemory8( pMsg, 0, sizeof ( pMsg->size ) );
-            MemmngHeapFree( pMsg );
+            /* トラフィック統計記録 */
+            ItcctrlMsgTrafficRecordRecv( pMsg->src, taskId, pMsg->tsc );
+
+            /* メッセージ解放 */
+            FreeMsg( pMsg );
             pMsg = NULL;
 
             return;
@@ -346,12 +1115,9 @@ static void DoReceive( MkMsgParam_t *pParam )
         if ( pParam->timeout != 0 ) {
             /* タイムアウト有り */
 
-            /* tick変換 */
-            tick = pParam->timeout / ( 1000000 / MK_CONFIG_TICK_HZ );
-
             /* タイマ設定 */
             pDstInfo->timerId =
-                TimermngCtrlSet( tick,
+                TimermngCtrlSet( pParam->timeout,
                                  TIMERMNG_TYPE_ONESHOT,
                                  TimeoutReceive,
                                  pDstInfo               );
@@ -406,7 +1172,8 @@ static void DoReceive( MkMsgParam_t *pParam )
 /**
  * @brief           メッセージ送信(ブロック)
  * @details         メッセージ送信共通処理を呼び出し、送信先タスクがメッセージ
- *                  を受け取るまでブロックする。
+ *                  を受け取るまでブロックする。送信先タスクのメッセージキュー
+ *                  が満杯の場合は、キューに空きができるまでブロックする。
  *
  * @param[in,out]   *pParam パラメータ
  */
@@ -418,13 +1185,36 @@ static void DoSend( MkMsgParam_t *pParam )
     /* 初期化 */
     taskId = MK_TASKID_NULL;
 
-    /* 共通処理 */
-    DoSendCmn( &taskId, pParam );
+    /* 送信ループ */
+    while ( true ) {
+        /* 共通処理 */
+        DoSendCmn( &taskId, pParam );
 
-    /* 処理結果判定 */
-    if ( pParam->ret == MK_RET_FAILURE ) {
-        /* 失敗 */
-        return;
+        /* 処理結果判定 */
+        if ( pParam->ret == MK_RET_SUCCESS ) {
+            /* 成功 */
+            break;
+
+        } else if ( pParam->err != MK_ERR_QUEUE_FULL ) {
+            /* キュー満杯以外の失敗 */
+            return;
+        }
+
+        /* キュー空き待ちリスト追加 */
+        MLibListInsertTail( &( gMngTbl[ pParam->send.dst ].fullList ),
+                            &( gMngTbl[ taskId ].nodeInfo           )  );
+
+        /* 状態設定 */
+        gMngTbl[ taskId ].state = STATE_FULLWAIT;
+
+        /* スケジュール停止 */
+        TaskmngSchedStop( taskId );
+
+        /* スケジュール実行 */
+        TaskmngSchedExec();
+
+        /* 状態初期化 */
+        gMngTbl[ taskId ].state = STATE_INIT;
     }
 
     /* 状態設定 */
@@ -453,7 +1243,8 @@ static void DoSend( MkMsgParam_t *pParam )
  * @details         送信先タスクが有効かチェックした後、メッセージをカーネル空
  *                  間内にコピーし、送信先タスクにキューイングする。送信先タス
  *                  クが受信ブロッキング状態にある場合は、ブロッキング状態を解
- *                  除する。
+ *                  除する。送信先タスクのメッセージキューが上限に達している場
+ *                  合はMK_ERR_QUEUE_FULLで失敗する。
  *
  * @param[out]      *pTaskId 送信元タスクID
  * @param[in,out]   *pParam  パラメータ
@@ -462,14 +1253,16 @@ static void DoSend( MkMsgParam_t *pParam )
 static void DoSendCmn( MkTaskId_t   *pTaskId,
                        MkMsgParam_t *pParam   )
 {
-    bool    valid;   /* タスク有効 */
-    msg_t   *pMsg;   /* メッセージ */
-    MkErr_t err;     /* エラー要因 */
+    bool       valid;       /* タスク有効     */
+    msg_t      *pMsg;       /* メッセージ     */
+    MkErr_t    err;         /* エラー要因     */
+    mngEntry_t *pDstInfo;   /* 送信先管理情報 */
 
     /* 初期化 */
     valid    = false;
     err      = MK_ERR_NONE;
     *pTaskId = TaskmngSchedGetTaskId();
+    pDstInfo = NULL;
 
     /* タスク有効チェック */
     valid = CheckValid( *pTaskId, pParam->send.dst, &err );
@@ -485,6 +1278,25 @@ static void DoSendCmn( MkTaskId_t   *pTaskId,
         return;
     }
 
+    /* 送信先管理情報取得 */
+    pDstInfo = &( gMngTbl[ pParam->send.dst ] );
+
+    /* メッセージキュー空きチェック */
+    valid = ItcctrlMsgCheckSpace( &( pDstInfo->stat ),
+                                  pParam->send.size,
+                                  &err                   );
+
+    /* チェック結果判定 */
+    if ( valid == false ) {
+        /* 空き無し */
+
+        /* 戻り値設定 */
+        pParam->ret = MK_RET_FAILURE;
+        pParam->err = err;
+
+        return;
+    }
+
     /* メッセージ領域割当 */
     pMsg = MemmngHeapAlloc( sizeof ( msg_t ) + pParam->send.size );
 
@@ -505,28 +1317,30 @@ static void DoSendCmn( MkTaskId_t   *pTaskId,
     /* メッセージヘッダ設定 */
     pMsg->src   = *pTaskId;
     pMsg->seqNo = gMngTbl[ *pTaskId ].seqNo;
+    pMsg->lane  = MK_MSG_LANE_NORMAL;
     pMsg->size  = pParam->send.size;
+    pMsg->pData = pMsg->msg;
+    pMsg->pBody = NULL;
+
+    /* 緊急メッセージ判定 */
+    if ( ( pParam->send.flags & MK_MSG_FLAG_URGENT ) != 0 ) {
+        /* 緊急 */
+
+        pMsg->lane = MK_MSG_LANE_URGENT;
+    }
 
     /* メッセージコピー */
     MLibUtilCopyMemory( pMsg->msg, pParam->send.pMsg, pParam->send.size );
 
     /* キューイング */
-    MLibListInsertTail( &( gMngTbl[ pParam->send.dst ].list ),
-                        &( pMsg->nodeInfo                   )  );
-
-    /* 送信先タスク状態判定 */
-    if ( gMngTbl[ pParam->send.dst ].state == STATE_RECVWAIT ) {
-        /* 受信待ち状態 */
-
-        /* 受信待ちメッセージ送信元判定 */
-        if ( ( gMngTbl[ pParam->send.dst ].src == *pTaskId       ) ||
-             ( gMngTbl[ pParam->send.dst ].src == MK_TASKID_NULL )    ) {
-            /* 自タスクIDまたはANY */
+    Enqueue( pParam->send.dst, pMsg );
 
-            /* 送信先タスクスケジュール開始 */
-            TaskmngSchedStart( pParam->send.dst );
-        }
-    }
+    /* トラフィック統計記録 */
+    ItcctrlMsgTrafficRecordSend(
+        *pTaskId,
+        pParam->send.dst,
+        pParam->send.size,
+        ( pParam->funcId == MK_MSG_FUNCID_SEND_NB ) );
 
     /* 戻り値設定 */
     pParam->ret = MK_RET_SUCCESS;
@@ -558,22 +1372,209 @@ static void DoSendNB( MkMsgParam_t *pParam )
 }
 
 
+/******************************************************************************/
+/**
+ * @brief           メッセージキュー上限設定
+ * @details         自タスクのメッセージキューの最大メッセージ数と最大サイズを
+ *                  設定する。上限の変更によりキューに空きができる場合に備え、
+ *                  キュー空き待ち中の送信元タスクを全て起床する。
+ *
+ * @param[in,out]   *pParam パラメータ
+ */
+/******************************************************************************/
+static void DoSetLimit( MkMsgParam_t *pParam )
+{
+    MkTaskId_t taskId;  /* タスクID */
+    mngEntry_t *pInfo;  /* 管理情報 */
+
+    /* 初期化 */
+    taskId = TaskmngSchedGetTaskId();
+    pInfo  = &( gMngTbl[ taskId ] );
+
+    /* パラメータチェック */
+    if ( ( pParam->limit.num  == 0               ) ||
+         ( pParam->limit.size <  MK_MSG_SIZE_MAX )    ) {
+        /* 不正 */
+
+        /* 戻り値設定 */
+        pParam->ret = MK_RET_FAILURE;
+        pParam->err = MK_ERR_PARAM;
+
+        return;
+    }
+
+    /* 上限設定 */
+    pInfo->stat.limitNum  = pParam->limit.num;
+    pInfo->stat.limitSize = pParam->limit.size;
+
+    /* キュー空き待ち送信元起床 */
+    WakeFullWait( pInfo, true );
+
+    /* 戻り値設定 */
+    pParam->ret = MK_RET_SUCCESS;
+    pParam->err = MK_ERR_NONE;
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief           メッセージ受信モード設定
+ * @details         自タスクの全てのタスクからのメッセージ受信時のデキュー順序
+ *                  を設定する。
+ *
+ * @param[in,out]   *pParam パラメータ
+ */
+/******************************************************************************/
+static void DoSetMode( MkMsgParam_t *pParam )
+{
+    MkTaskId_t taskId;  /* タスクID */
+
+    /* 初期化 */
+    taskId = TaskmngSchedGetTaskId();
+
+    /* パラメータチェック */
+    if ( ( pParam->mode != MK_MSG_MODE_FIFO ) &&
+         ( pParam->mode != MK_MSG_MODE_RR   )    ) {
+        /* 不正 */
+
+        /* 戻り値設定 */
+        pParam->ret = MK_RET_FAILURE;
+        pParam->err = MK_ERR_PARAM;
+
+        return;
+    }
+
+    /* 受信モード設定 */
+    gMngTbl[ taskId ].mode    = pParam->mode;
+    gMngTbl[ taskId ].lastSrc = MK_TASKID_NULL;
+
+    /* 戻り値設定 */
+    pParam->ret = MK_RET_SUCCESS;
+    pParam->err = MK_ERR_NONE;
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       メッセージキューイング
+ * @details     送信先タスクのメッセージキューにメッセージを追加し、キュー統計
+ *              を更新する。送信先タスクが受信ブロッキング状態にある場合はブロ
+ *              ッキング状態を解除し、そうでない場合はイベントを通知する。
+ *
+ * @param[in]   dst   送信先タスクID
+ * @param[in]   *pMsg メッセージ
+ */
+/******************************************************************************/
+static void Enqueue( MkTaskId_t dst,
+                     msg_t      *pMsg )
+{
+    mngEntry_t *pDstInfo;   /* 送信先管理情報 */
+
+    /* 初期化 */
+    pDstInfo = &( gMngTbl[ dst ] );
+
+    /* キューイング時TSC設定 */
+    pMsg->tsc = IA32InstructionRdtsc();
+
+    /* メッセージキューイング */
+    MLibListInsertTail( &( pDstInfo->list[ pMsg->lane ] ),
+                        &( pMsg->nodeInfo                 )  );
+
+    /* キュー統計更新 */
+    pDstInfo->stat.num++;
+    pDstInfo->stat.size += pMsg->size;
+    pDstInfo->stat.laneNum[ pMsg->lane ]++;
+    pDstInfo->stat.laneCnt[ pMsg->lane ]++;
+    pDstInfo->stat.hwmNum  = MLIB_UTIL_MAX( pDstInfo->stat.hwmNum,
+                                            pDstInfo->stat.num     );
+    pDstInfo->stat.hwmSize = MLIB_UTIL_MAX( pDstInfo->stat.hwmSize,
+                                            pDstInfo->stat.size     );
+
+    /* 送信先タスク状態判定 */
+    if ( pDstInfo->state == STATE_RECVWAIT ) {
+        /* 受信待ち状態 */
+
+        /* 受信待ちメッセージ送信元判定 */
+        if ( ( pDstInfo->src == pMsg->src      ) ||
+             ( pDstInfo->src == MK_TASKID_NULL )    ) {
+            /* 送信元タスクIDまたはANY */
+
+            /* 送信先タスクスケジュール開始 */
+            TaskmngSchedStart( dst );
+        }
+
+    } else {
+        /* 受信待ち状態でない */
+
+        /* イベント通知 */
+        ItcctrlEventNotify( dst, MK_EVENT_MSG );
+    }
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       メッセージ解放
+ * @details     メッセージを解放する。共有メッセージを参照している場合は参照
+ *              カウンタを減算し、参照が無くなった時点で共有メッセージも解放す
+ *              る。
+ *
+ * @param[in]   *pMsg メッセージ
+ */
+/******************************************************************************/
+static void FreeMsg( msg_t *pMsg )
+{
+    ItcctrlMsgBody_t *pBody;    /* 共有メッセージ */
+
+    /* 初期化 */
+    pBody = pMsg->pBody;
+
+    /* 共有メッセージ参照判定 */
+    if ( pBody != NULL ) {
+        /* 参照有り */
+
+        /* 参照カウンタ減算 */
+        pBody->refCnt--;
+
+        /* 参照カウンタ判定 */
+        if ( pBody->refCnt == 0 ) {
+            /* 参照無し */
+
+            /* 共有メッセージ解放 */
+            MemmngHeapFree( pBody );
+        }
+    }
+
+    /* メッセージバッファ解放 */
+    MLibUtilSetMemory8( pMsg, 0, sizeof ( pMsg->size ) );
+    MemmngHeapFree( pMsg );
+
+    return;
+}
+
+
 /******************************************************************************/
 /**
  * @brief           割込みハンドラ
  * @details         機能IDから適切なハンドラを呼び出す。
  *
- * @param[in]       intNo   割込み番号
- * @param[in,out]   context 割込み発生時コンテキスト情報
+ * @param[in]       intNo     割込み番号
+ * @param[in,out]   *pContext 割込み発生時コンテキスト情報
  */
 /******************************************************************************/
 static void HdlInt( uint32_t        intNo,
-                    IntmngContext_t context )
+                    IntmngContext_t *pContext )
 {
     MkMsgParam_t *pParam;   /* パラメータ */
 
     /* 初期化 */
-    pParam = ( MkMsgParam_t * ) context.genReg.esi;
+    pParam = ( MkMsgParam_t * ) pContext->genReg.esi;
 
     /* パラメータチェック */
     if ( pParam == NULL ) {
@@ -602,6 +1603,31 @@ static void HdlInt( uint32_t        intNo,
 
         DoSendNB( pParam );
 
+    } else if ( pParam->funcId == MK_MSG_FUNCID_SET_LIMIT ) {
+        /* メッセージキュー上限設定 */
+
+        DoSetLimit( pParam );
+
+    } else if ( pParam->funcId == MK_MSG_FUNCID_GET_STAT ) {
+        /* メッセージキュー統計取得 */
+
+        DoGetStat( pParam );
+
+    } else if ( pParam->funcId == MK_MSG_FUNCID_SET_MODE ) {
+        /* メッセージ受信モード設定 */
+
+        DoSetMode( pParam );
+
+    } else if ( pParam->funcId == MK_MSG_FUNCID_GET_TRAFFIC ) {
+        /* トラフィック統計取得 */
+
+        DoGetTraffic( pParam );
+
+    } else if ( pParam->funcId == MK_MSG_FUNCID_DUMP_TRAFFIC ) {
+        /* トラフィック統計ログ出力 */
+
+        DoDumpTraffic( pParam );
+
     } else {
         /* 不正 */
 
@@ -615,6 +1641,84 @@ static void HdlInt( uint32_t        intNo,
 }
 
 
+/******************************************************************************/
+/**
+ * @brief           システムコールハンドラ
+ * @details         レジスタ渡し形式のメッセージ送受信システムコールのパラメー
+ *                  タをレジスタから作成し、該当する機能を呼び出す。受信時のタ
+ *                  イムアウトは無し固定とする。
+ *
+ *                  - MK_SYSCALL_MSG_RECEIVE
+ *                      入力: EBX=受信待ちタスクID, ESI=受信バッファ,
+ *                            EDI=受信バッファサイズ
+ *                      出力: ESI=送信元タスクID, EDI=受信メッセージサイズ
+ *                  - MK_SYSCALL_MSG_SEND, MK_SYSCALL_MSG_SEND_NB
+ *                      入力: EBX=送信先タスクID, ESI=送信メッセージ,
+ *                            EDI=送信メッセージサイズ
+ *
+ * @param[in]       no    システムコール番号
+ * @param[in,out]   *pReg 汎用レジスタ
+ */
+/******************************************************************************/
+static void HdlSys( uint32_t     no,
+                    IA32Pushad_t *pReg )
+{
+    MkMsgParam_t param; /* パラメータ */
+
+    /* パラメータ初期化 */
+    param.ret     = MK_RET_FAILURE;
+    param.err     = MK_ERR_NONE;
+    param.timeout = 0;
+
+    /* システムコール番号判定 */
+    if ( no == MK_SYSCALL_MSG_RECEIVE ) {
+        /* メッセージ受信 */
+
+        /* パラメータ設定 */
+        param.funcId          = MK_MSG_FUNCID_RECEIVE;
+        param.recv.src        = pReg->ebx;
+        param.recv.pBuffer    = ( void * ) pReg->esi;
+        param.recv.bufferSize = pReg->edi;
+        param.recv.size       = 0;
+
+        DoReceive( &param );
+
+        /* 出力値設定 */
+        pReg->esi = param.recv.src;
+        pReg->edi = param.recv.size;
+
+    } else {
+        /* メッセージ送信 */
+
+        /* パラメータ設定 */
+        param.send.dst   = pReg->ebx;
+        param.send.pMsg  = ( void * ) pReg->esi;
+        param.send.size  = pReg->edi;
+        param.send.flags = MK_MSG_FLAG_NONE;
+
+        /* システムコール番号判定 */
+        if ( no == MK_SYSCALL_MSG_SEND ) {
+            /* ブロッキング */
+
+            param.funcId = MK_MSG_FUNCID_SEND;
+            DoSend( &param );
+
+        } else {
+            /* ノンブロッキング */
+
+            param.funcId = MK_MSG_FUNCID_SEND_NB;
+            DoSendNB( &param );
+        }
+    }
+
+    /* 戻り値設定 */
+    pReg->eax = param.ret;
+    pReg->ebx = param.err;
+
+    return;
+}
+
+
 /******************************************************************************/
 /**
  * @brief       メッセージ受信待ちタイムアウト
@@ -650,8 +1754,103 @@ static void TimeoutReceive( uint32_t timerId,
     /* スケジュール開始 */
     TaskmngSchedStart( taskId );
 
-    /* スケジューラ実行 */
-    TaskmngSchedExec();
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       トラフィック統計エントリ検索
+ * @details     送信元タスクと送信先タスクの組のトラフィック統計エントリをハッ
+ *              シュ表から検索する。該当エントリが無い場合は空きエントリを割り
+ *              当てる。探索はTRAFFIC_PROBE_NUM個のエントリまでとし、空きエン
+ *              トリも無い場合は記録不可回数を更新する。
+ *
+ * @param[in]   src 送信元タスクID
+ * @param[in]   dst 送信先タスクID
+ *
+ * @return      トラフィック統計エントリを返す。
+ * @retval      NULL     記録不可
+ * @retval      NULL以外 トラフィック統計エントリ
+ */
+/******************************************************************************/
+static MkMsgTraffic_t *TrafficSearch( MkTaskId_t src,
+                                      MkTaskId_t dst  )
+{
+    uint32_t       idx;         /* インデックス     */
+    uint32_t       hash;        /* ハッシュ値       */
+    MkMsgTraffic_t *pTraffic;   /* トラフィック統計 */
+
+    /* 初期化 */
+    idx      = 0;
+    hash     = TRAFFIC_HASH( src, dst );
+    pTraffic = NULL;
+
+    /* 探索数分繰り返す */
+    for ( idx = 0; idx < TRAFFIC_PROBE_NUM; idx++ ) {
+        /* エントリ取得 */
+        pTraffic = &( gTrafficTbl[ ( hash + idx ) &
+                                   ( MK_CONFIG_MSG_TRAFFIC_NUM - 1 ) ] );
+
+        /* エントリ判定 */
+        if ( ( pTraffic->src == src ) && ( pTraffic->dst == dst ) ) {
+            /* 該当 */
+
+            return pTraffic;
+
+        } else if ( pTraffic->src == MK_TASKID_NULL ) {
+            /* 空き */
+
+            /* エントリ割当 */
+            pTraffic->src = src;
+            pTraffic->dst = dst;
+
+            return pTraffic;
+        }
+    }
+
+    /* 記録不可回数更新 */
+    gTrafficLost++;
+
+    return NULL;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       キュー空き待ち送信元起床
+ * @details     メッセージキューの空き待ちでブロックしている送信元タスクを起床
+ *              する。起床した送信元タスクは送信を再試行する。
+ *
+ * @param[in]   *pInfo 送信先管理情報
+ * @param[in]   all    全送信元起床要否
+ *                  - true  全て起床する
+ *                  - false 先頭の1タスクのみ起床する
+ */
+/******************************************************************************/
+static void WakeFullWait( mngEntry_t *pInfo,
+                          bool       all    )
+{
+    mngEntry_t *pSrcInfo;   /* 送信元管理情報 */
+
+    /* 初期化 */
+    pSrcInfo = NULL;
+
+    do {
+        /* キュー空き待ちリスト先頭取得 */
+        pSrcInfo = ( mngEntry_t * ) MLibListRemoveHead( &( pInfo->fullList ) );
+
+        /* 取得結果判定 */
+        if ( pSrcInfo == NULL ) {
+            /* 空き待ち無し */
+
+            break;
+        }
+
+        /* 送信元タスクスケジュール開始 */
+        TaskmngSchedStart( pSrcInfo->taskId );
+
+    } while ( all != false );
 
     return;
 }
@@ -1,18 +1,72 @@
 /******************************************************************************/
 /*                                                                            */
 /* src/kernel/Itcctrl/ItcctrlMsg.h                                            */
-/*                                                                 2021/11/27 */
-/* Copyright (C) 2018-2021 Mochi.                                             */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2018-2026 Mochi.                                             */
 /*                                                                            */
 /******************************************************************************/
 #ifndef ITCCTRL_MSG_H
 #define ITCCTRL_MSG_H
+/******************************************************************************/
+/* インクルード                                                               */
+/******************************************************************************/
+/* 標準ヘッダ */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* カーネルヘッダ */
+#include <kernel/message.h>
+#include <kernel/types.h>
+
+/* 外部モジュールヘッダ */
+#include <Cmn.h>
+
+
+/******************************************************************************/
+/* 定義                                                                       */
+/******************************************************************************/
+/** 共有メッセージ */
+typedef struct {
+    uint32_t refCnt;    /**< 参照カウンタ     */
+    size_t   size;      /**< メッセージサイズ */
+    uint8_t  data[];    /**< メッセージ       */
+} ItcctrlMsgBody_t;
+
+
 /******************************************************************************/
 /* グローバル関数プロトタイプ宣言                                             */
 /******************************************************************************/
 /* メッセージ制御初期化 */
 extern void ItcctrlMsgInit( void );
 
+/* 受信可能メッセージ有無チェック */
+extern bool ItcctrlMsgCheck( MkTaskId_t taskId,
+                             MkTaskId_t *pSrc,
+                             uint32_t   srcNum  );
+
+/* メッセージキュー空きチェック */
+extern bool ItcctrlMsgCheckSpace( MkMsgQueueStat_t *pStat,
+                                  size_t           size,
+                                  MkErr_t          *pErr   );
+
+/* 共有メッセージ送信 */
+extern CmnRet_t ItcctrlMsgSendShared( MkTaskId_t       src,
+                                      MkTaskId_t       dst,
+                                      ItcctrlMsgBody_t *pBody,
+                                      MkErr_t          *pErr   );
+
+/* トラフィック統計記録(受信) */
+extern void ItcctrlMsgTrafficRecordRecv( MkTaskId_t src,
+                                         MkTaskId_t dst,
+                                         uint64_t   tsc  );
+
+/* トラフィック統計記録(送信) */
+extern void ItcctrlMsgTrafficRecordSend( MkTaskId_t src,
+                                         MkTaskId_t dst,
+                                         size_t     size,
+                                         bool       nb    );
+
 
 /******************************************************************************/
 #endif
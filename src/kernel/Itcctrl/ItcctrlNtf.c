@@ -0,0 +1,425 @@
+/******************************************************************************/
+/*                                                                            */
+/* src/kernel/Itcctrl/ItcctrlNtf.c                                            */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2026 Mochi.                                                  */
+/*                                                                            */
+/******************************************************************************/
+/******************************************************************************/
+/* インクルード                                                               */
+/******************************************************************************/
+/* 標準ヘッダ */
+#include <stdbool.h>
+#include <stdint.h>
+
+/* ライブラリヘッダ */
+#include <MLib/MLib.h>
+
+/* カーネルヘッダ */
+#include <kernel/event.h>
+#include <kernel/notify.h>
+#include <kernel/types.h>
+
+/* 共通ヘッダ */
+#include <hardware/IA32/IA32.h>
+
+/* 外部モジュールヘッダ */
+#include <Cmn.h>
+#include <Debug.h>
+#include <Intmng.h>
+#include <Itcctrl.h>
+#include <Taskmng.h>
+#include <Timermng.h>
+
+/* 内部モジュールヘッダ */
+#include "ItcctrlNtf.h"
+
+
+/******************************************************************************/
+/* 定義                                                                       */
+/******************************************************************************/
+/* モジュールID */
+#define _MODULE_ID_ CMN_MODULE_ITCCTRL_NTF
+
+/* 状態 */
+#define STATE_INIT    ( 0 ) /**< 初期状態                 */
+#define STATE_WAIT    ( 1 ) /**< 通知待ち状態             */
+#define STATE_TIMEOUT ( 2 ) /**< 通知待ちタイムアウト状態 */
+
+/** 通知管理情報 */
+typedef struct {
+    uint32_t bits;      /**< 通知ビット */
+    uint32_t state;     /**< 状態       */
+    uint32_t timerId;   /**< タイマID   */
+} ntfEntry_t;
+
+
+/******************************************************************************/
+/* ローカル関数宣言                                                           */
+/******************************************************************************/
+/* 通知送信 */
+static void DoSend( MkNtfParam_t *pParam );
+/* 通知待ち合わせ */
+static void DoWait( MkNtfParam_t *pParam );
+/* 割込みハンドラ */
+static void HdlInt( uint32_t        intNo,
+                    IntmngContext_t *pContext );
+/* 通知待ちタイムアウト */
+static void TimeoutWait( uint32_t timerId,
+                         void     *pArg    );
+
+
+/******************************************************************************/
+/* 静的グローバル変数定義                                                     */
+/******************************************************************************/
+/** 通知管理情報 */
+static ntfEntry_t gNtfTbl[ MK_TASKID_NUM ];
+
+
+/******************************************************************************/
+/* グローバル関数定義                                                         */
+/******************************************************************************/
+/******************************************************************************/
+/**
+ * @brief       通知有無チェック
+ * @details     指定したタスクに未読の通知ビットが有るかチェックする。
+ *
+ * @param[in]   taskId タスクID
+ *
+ * @return      チェック結果を返す。
+ * @retval      true  有り
+ * @retval      false 無し
+ */
+/******************************************************************************/
+bool ItcctrlNtfCheck( MkTaskId_t taskId )
+{
+    return ( gNtfTbl[ taskId ].bits != 0 );
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       通知制御初期化
+ * @details     機能呼出し用割込みハンドラの設定を行う。
+ */
+/******************************************************************************/
+void ItcctrlNtfInit( void )
+{
+    uint32_t idx;   /* インデックス */
+
+    /* 初期化 */
+    idx = 0;
+
+    /* 割込みハンドラ設定 */
+    IntmngHdlSet( MK_CONFIG_INTNO_NOTIFY,       /* 割込み番号     */
+                  HdlInt,                       /* 割込みハンドラ */
+                  IA32_DESCRIPTOR_DPL_3    );   /* 特権レベル     */
+
+    /* 通知管理情報エントリ毎に繰り返す */
+    for ( idx = 0; idx < MK_TASKID_NUM; idx++ ) {
+        /* 初期化 */
+        gNtfTbl[ idx ].bits    = 0;
+        gNtfTbl[ idx ].state   = STATE_INIT;
+        gNtfTbl[ idx ].timerId = TIMERMNG_TIMERID_NULL;
+    }
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       カーネル通知送信
+ * @details     送信先タスクの通知ビットに指定ビットを論理和で設定する。送信先
+ *              タスクが通知待ち状態の場合は待ち状態を解除し、イベント待ち合わ
+ *              せ中の場合はイベントを通知する。メモリ割当ては行わず、未読の通
+ *              知は合成される。送信先タスクと通知ビットは呼出し元でチェックす
+ *              る。
+ *
+ * @param[in]   dst  送信先タスクID
+ * @param[in]   bits 通知ビット
+ */
+/******************************************************************************/
+void ItcctrlNtfSendKernel( MkTaskId_t dst,
+                           uint32_t   bits )
+{
+    ntfEntry_t *pDst;   /* 送信先通知管理情報 */
+
+    /* 初期化 */
+    pDst = &( gNtfTbl[ dst ] );
+
+    /* 通知ビット設定 */
+    pDst->bits |= bits;
+
+    /* 送信先タスク状態判定 */
+    if ( pDst->state == STATE_WAIT ) {
+        /* 通知待ち状態 */
+
+        /* 送信先タスクスケジュール開始 */
+        TaskmngSchedStart( dst );
+
+    } else {
+        /* 通知待ち状態でない */
+
+        /* イベント通知 */
+        ItcctrlEventNotify( dst, MK_EVENT_NTF );
+    }
+
+    return;
+}
+
+
+/******************************************************************************/
+/* ローカル関数定義                                                           */
+/******************************************************************************/
+/******************************************************************************/
+/**
+ * @brief           通知送信
+ * @details         送信元タスクと送信先タスクの関係をチェックし、送信先タスク
+ *                  に通知を送信する。
+ *
+ * @param[in,out]   *pParam パラメータ
+ */
+/******************************************************************************/
+static void DoSend( MkNtfParam_t *pParam )
+{
+    bool       exist;   /* タスク存在確認結果 */
+    uint8_t    diff;    /* プロセス階層差     */
+    MkTaskId_t taskId;  /* 送信元タスクID     */
+
+    /* 初期化 */
+    exist  = false;
+    diff   = 0;
+    taskId = TaskmngSchedGetTaskId();
+
+    /* 通知ビットチェック */
+    if ( pParam->bits == 0 ) {
+        /* 不正 */
+
+        /* 戻り値設定 */
+        pParam->err = MK_ERR_PARAM;
+
+        return;
+    }
+
+    /* 送信先タスク存在確認 */
+    exist = TaskmngTaskCheckExist( pParam->dst );
+
+    /* 確認結果判定 */
+    if ( exist == false ) {
+        /* 存在しない */
+
+        /* 戻り値設定 */
+        pParam->err = MK_ERR_NO_EXIST;
+
+        return;
+    }
+
+    /* プロセス階層差取得 */
+    diff = TaskmngTaskGetTypeDiff( taskId, pParam->dst );
+
+    /* 階層差判定 */
+    if ( diff > 1 ) {
+        /* 非隣接 */
+
+        /* 戻り値設定 */
+        pParam->err = MK_ERR_UNAUTHORIZED;
+
+        return;
+    }
+
+    /* 通知送信 */
+    ItcctrlNtfSendKernel( pParam->dst, pParam->bits );
+
+    /* 戻り値設定 */
+    pParam->ret = MK_RET_SUCCESS;
+    pParam->err = MK_ERR_NONE;
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief           通知待ち合わせ
+ * @details         通知ビットが設定されるまでブロックし、通知ビットを返す。返
+ *                  却した通知ビットはクリアする。タイムアウト時間が設定されて
+ *                  いる場合はタイマを設定する。
+ *
+ * @param[in,out]   *pParam パラメータ
+ */
+/******************************************************************************/
+static void DoWait( MkNtfParam_t *pParam )
+{
+    MkTaskId_t taskId;  /* タスクID       */
+    ntfEntry_t *pInfo;  /* 通知管理情報   */
+
+    /* 初期化 */
+    taskId = TaskmngSchedGetTaskId();
+    pInfo  = &( gNtfTbl[ taskId ] );
+
+    /* 通知ビット判定 */
+    while ( pInfo->bits == 0 ) {
+        /* 通知無し */
+
+        /* タイムアウト設定判定 */
+        if ( pParam->timeout != 0 ) {
+            /* タイムアウト有り */
+
+            /* タイマ設定 */
+            pInfo->timerId = TimermngCtrlSet( pParam->timeout,
+                                              TIMERMNG_TYPE_ONESHOT,
+                                              TimeoutWait,
+                                              pInfo                  );
+
+            /* タイムアウト設定初期化 */
+            pParam->timeout = 0;
+
+            /* タイマ設定結果判定 */
+            if ( pInfo->timerId == TIMERMNG_TIMERID_NULL ) {
+                /* 失敗 */
+
+                /* 戻り値設定 */
+                pParam->err = MK_ERR_NO_RESOURCE;
+
+                return;
+            }
+        }
+
+        /* 状態設定 */
+        pInfo->state = STATE_WAIT;
+
+        /* スケジュール停止 */
+        TaskmngSchedStop( taskId );
+
+        /* スケジュール実行 */
+        TaskmngSchedExec();
+
+        /* タイムアウト判定 */
+        if ( pInfo->state == STATE_TIMEOUT ) {
+            /* タイムアウト */
+
+            /* 状態設定 */
+            pInfo->state = STATE_INIT;
+
+            /* 戻り値設定 */
+            pParam->err = MK_ERR_TIMEOUT;
+
+            return;
+        }
+
+        /* 状態設定 */
+        pInfo->state = STATE_INIT;
+    }
+
+    /* タイマ解除 */
+    TimermngCtrlUnset( pInfo->timerId );
+    pInfo->timerId = TIMERMNG_TIMERID_NULL;
+
+    /* 戻り値設定 */
+    pParam->ret  = MK_RET_SUCCESS;
+    pParam->err  = MK_ERR_NONE;
+    pParam->bits = pInfo->bits;
+
+    /* 通知ビットクリア */
+    pInfo->bits = 0;
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief           割込みハンドラ
+ * @details         機能IDから適切なハンドラを呼び出す。
+ *
+ * @param[in]       intNo     割込み番号
+ * @param[in,out]   *pContext 割込み発生時コンテキスト情報
+ */
+/******************************************************************************/
+static void HdlInt( uint32_t        intNo,
+                    IntmngContext_t *pContext )
+{
+    MkNtfParam_t *pParam;   /* パラメータ */
+
+    /* 初期化 */
+    pParam = ( MkNtfParam_t * ) pContext->genReg.esi;
+
+    /* パラメータチェック */
+    if ( pParam == NULL ) {
+        /* 不正 */
+        return;
+    }
+
+    /* パラメータ初期化 */
+    pParam->ret = MK_RET_FAILURE;
+    pParam->err = MK_ERR_NONE;
+
+    /* 機能ID判定 */
+    if ( pParam->funcId == MK_NTF_FUNCID_SEND ) {
+        /* 通知送信 */
+
+        DoSend( pParam );
+
+    } else if ( pParam->funcId == MK_NTF_FUNCID_WAIT ) {
+        /* 通知待ち合わせ */
+
+        pParam->bits = 0;
+        DoWait( pParam );
+
+    } else {
+        /* 不正 */
+
+        /* エラー設定 */
+        pParam->err = MK_ERR_PARAM;
+    }
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       通知待ちタイムアウト
+ * @details     通知待ち合わせを解除する。
+ *
+ * @param[in]   timerId タイマID
+ * @param[in]   *pArg   通知管理情報
+ */
+/******************************************************************************/
+static void TimeoutWait( uint32_t timerId,
+                         void     *pArg    )
+{
+    MkTaskId_t taskId;  /* タスクID     */
+    ntfEntry_t *pInfo;  /* 通知管理情報 */
+
+    /* 初期化 */
+    taskId = TimermngCtrlGetTaskId( timerId );
+    pInfo  = ( ntfEntry_t * ) pArg;
+
+    /* タイマID無効判定 */
+    if ( pInfo->timerId != timerId ) {
+        /* 無効 */
+
+        return;
+    }
+
+    /* タイマID初期化 */
+    pInfo->timerId = TIMERMNG_TIMERID_NULL;
+
+    /* 通知待ち状態判定 */
+    if ( pInfo->state == STATE_WAIT ) {
+        /* 通知待ち状態 */
+
+        /* 状態設定 */
+        pInfo->state = STATE_TIMEOUT;
+
+        /* スケジュール開始 */
+        TaskmngSchedStart( taskId );
+    }
+
+    return;
+}
+
+
+/******************************************************************************/
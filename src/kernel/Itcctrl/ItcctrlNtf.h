@@ -0,0 +1,31 @@
+/******************************************************************************/
+/*                                                                            */
+/* src/kernel/Itcctrl/ItcctrlNtf.h                                            */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2026 Mochi.                                                  */
+/*                                                                            */
+/******************************************************************************/
+#ifndef ITCCTRL_NTF_H
+#define ITCCTRL_NTF_H
+/******************************************************************************/
+/* インクルード                                                               */
+/******************************************************************************/
+/* 標準ヘッダ */
+#include <stdbool.h>
+
+/* カーネルヘッダ */
+#include <kernel/types.h>
+
+
+/******************************************************************************/
+/* グローバル関数プロトタイプ宣言                                             */
+/******************************************************************************/
+/* 通知有無チェック */
+extern bool ItcctrlNtfCheck( MkTaskId_t taskId );
+
+/* 通知制御初期化 */
+extern void ItcctrlNtfInit( void );
+
+
+/******************************************************************************/
+#endif
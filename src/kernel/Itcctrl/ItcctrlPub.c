@@ -0,0 +1,471 @@
+/******************************************************************************/
+/*                                                                            */
+/* src/kernel/Itcctrl/ItcctrlPub.c                                            */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2026 Mochi.                                                  */
+/*                                                                            */
+/******************************************************************************/
+/******************************************************************************/
+/* インクルード                                                               */
+/******************************************************************************/
+/* 標準ヘッダ */
+#include <stdbool.h>
+#include <stdint.h>
+
+/* ライブラリヘッダ */
+#include <MLib/MLib.h>
+#include <MLib/MLibUtil.h>
+
+/* カーネルヘッダ */
+#include <kernel/config.h>
+#include <kernel/message.h>
+#include <kernel/pubsub.h>
+#include <kernel/types.h>
+
+/* 共通ヘッダ */
+#include <hardware/IA32/IA32.h>
+
+/* 外部モジュールヘッダ */
+#include <Cmn.h>
+#include <Debug.h>
+#include <Intmng.h>
+#include <Memmng.h>
+#include <Taskmng.h>
+
+/* 内部モジュールヘッダ */
+#include "ItcctrlMsg.h"
+#include "ItcctrlPub.h"
+
+
+/******************************************************************************/
+/* 定義                                                                       */
+/******************************************************************************/
+/* モジュールID */
+#define _MODULE_ID_ CMN_MODULE_ITCCTRL_PUB
+
+/** 出版購読グループ管理情報 */
+typedef struct {
+    uint32_t   num;                                 /**< 購読タスク数 */
+    MkTaskId_t member[ MK_CONFIG_PUB_MEMBER_NUM ];  /**< 購読タスクID */
+} grpEntry_t;
+
+
+/******************************************************************************/
+/* ローカル関数宣言                                                           */
+/******************************************************************************/
+/* 出版 */
+static void DoPublish( MkPubParam_t *pParam );
+/* 購読開始 */
+static void DoSubscribe( MkPubParam_t *pParam );
+/* 購読終了 */
+static void DoUnsubscribe( MkPubParam_t *pParam );
+/* 割込みハンドラ */
+static void HdlInt( uint32_t        intNo,
+                    IntmngContext_t *pContext );
+/* 購読タスク検索 */
+static uint32_t SearchMember( grpEntry_t *pGrp,
+                              MkTaskId_t taskId );
+
+
+/******************************************************************************/
+/* 静的グローバル変数定義                                                     */
+/******************************************************************************/
+/** 出版購読グループ管理情報 */
+static grpEntry_t gGrpTbl[ MK_CONFIG_PUB_GRP_NUM ];
+
+
+/******************************************************************************/
+/* グローバル関数定義                                                         */
+/******************************************************************************/
+/******************************************************************************/
+/**
+ * @brief       出版購読制御初期化
+ * @details     機能呼出し用割込みハンドラの設定を行う。
+ */
+/******************************************************************************/
+void ItcctrlPubInit( void )
+{
+    uint32_t grpId; /* グループID   */
+    uint32_t idx;   /* インデックス */
+
+    /* 初期化 */
+    grpId = 0;
+    idx   = 0;
+
+    /* 割込みハンドラ設定 */
+    IntmngHdlSet( MK_CONFIG_INTNO_PUBSUB,       /* 割込み番号     */
+                  HdlInt,                       /* 割込みハンドラ */
+                  IA32_DESCRIPTOR_DPL_3    );   /* 特権レベル     */
+
+    /* グループ毎に繰り返す */
+    for ( grpId = 0; grpId < MK_CONFIG_PUB_GRP_NUM; grpId++ ) {
+        /* 初期化 */
+        gGrpTbl[ grpId ].num = 0;
+
+        /* 購読タスク毎に繰り返す */
+        for ( idx = 0; idx < MK_CONFIG_PUB_MEMBER_NUM; idx++ ) {
+            /* 初期化 */
+            gGrpTbl[ grpId ].member[ idx ] = MK_TASKID_NULL;
+        }
+    }
+
+    return;
+}
+
+
+/******************************************************************************/
+/* ローカル関数定義                                                           */
+/******************************************************************************/
+/******************************************************************************/
+/**
+ * @brief           出版
+ * @details         メッセージをカーネル空間内に一度だけコピーし、グループの全
+ *                  購読タスク(自タスクを除く)のメッセージキューに参照をキュー
+ *                  イングする。メッセージ本文は参照カウンタで共有し、全ての購
+ *                  読タスクが受信した時点で解放する。メッセージキューが満杯の
+ *                  購読タスクへの配信はブロックせずに破棄し、存在しなくなった
+ *                  購読タスクはグループから削除する。メッセージ送信と同様に、
+ *                  出版元タスクとプロセス階層が隣接しない購読タスクには配信し
+ *                  ない。
+ *
+ * @param[in,out]   *pParam パラメータ
+ */
+/******************************************************************************/
+static void DoPublish( MkPubParam_t *pParam )
+{
+    bool             exist;     /* タスク存在確認結果 */
+    uint32_t         idx;       /* インデックス       */
+    uint8_t          diff;      /* プロセス階層差     */
+    MkErr_t          err;       /* エラー要因         */
+    CmnRet_t         ret;       /* 関数戻り値         */
+    MkTaskId_t       taskId;    /* 出版元タスクID     */
+    grpEntry_t       *pGrp;     /* グループ管理情報   */
+    ItcctrlMsgBody_t *pBody;    /* 共有メッセージ     */
+
+    /* 初期化 */
+    exist  = false;
+    idx    = 0;
+    diff   = 0;
+    err    = MK_ERR_NONE;
+    ret    = CMN_FAILURE;
+    taskId = TaskmngSchedGetTaskId();
+    pGrp   = NULL;
+    pBody  = NULL;
+
+    /* パラメータチェック */
+    if ( ( pParam->grpId >= MK_CONFIG_PUB_GRP_NUM ) ||
+         ( pParam->pMsg  == NULL                  ) ||
+         ( pParam->size  == 0                     ) ||
+         ( pParam->size  >  MK_MSG_SIZE_MAX       )    ) {
+        /* 不正 */
+
+        /* 戻り値設定 */
+        pParam->err = MK_ERR_PARAM;
+
+        return;
+    }
+
+    /* グループ管理情報取得 */
+    pGrp = &( gGrpTbl[ pParam->grpId ] );
+
+    /* 共有メッセージ領域割当 */
+    pBody = MemmngHeapAlloc( sizeof ( ItcctrlMsgBody_t ) + pParam->size );
+
+    /* 割当結果判定 */
+    if ( pBody == NULL ) {
+        /* 失敗 */
+
+        /* 戻り値設定 */
+        pParam->err = MK_ERR_NO_MEMORY;
+
+        return;
+    }
+
+    /* 共有メッセージ設定 */
+    pBody->refCnt = 0;
+    pBody->size   = pParam->size;
+    MLibUtilCopyMemory( pBody->data, pParam->pMsg, pParam->size );
+
+    /* 購読タスク毎に繰り返す */
+    for ( idx = 0; idx < MK_CONFIG_PUB_MEMBER_NUM; idx++ ) {
+        /* 配信対象判定 */
+        if ( ( pGrp->member[ idx ] == MK_TASKID_NULL ) ||
+             ( pGrp->member[ idx ] == taskId         )    ) {
+            /* 対象外 */
+            continue;
+        }
+
+        /* 購読タスク存在確認 */
+        exist = TaskmngTaskCheckExist( pGrp->member[ idx ] );
+
+        /* 確認結果判定 */
+        if ( exist == false ) {
+            /* 存在しない */
+
+            /* 購読タスク削除 */
+            pGrp->member[ idx ] = MK_TASKID_NULL;
+            pGrp->num--;
+
+            continue;
+        }
+
+        /* プロセス階層差取得 */
+        diff = TaskmngTaskGetTypeDiff( taskId, pGrp->member[ idx ] );
+
+        /* 階層差判定 */
+        if ( diff > 1 ) {
+            /* 非隣接 */
+
+            /* 配信しない */
+            continue;
+        }
+
+        /* 共有メッセージ送信 */
+        ret = ItcctrlMsgSendShared( taskId, pGrp->member[ idx ], pBody, &err );
+
+        /* 送信結果判定 */
+        if ( ret == CMN_SUCCESS ) {
+            /* 成功 */
+
+            /* 配信数更新 */
+            pParam->num++;
+
+        } else if ( err == MK_ERR_NO_EXIST ) {
+            /* 購読タスク不在 */
+
+            /* 購読タスク削除 */
+            pGrp->member[ idx ] = MK_TASKID_NULL;
+            pGrp->num--;
+        }
+    }
+
+    /* 参照判定 */
+    if ( pBody->refCnt == 0 ) {
+        /* 参照無し */
+
+        /* 共有メッセージ解放 */
+        MemmngHeapFree( pBody );
+    }
+
+    /* 戻り値設定 */
+    pParam->ret = MK_RET_SUCCESS;
+    pParam->err = MK_ERR_NONE;
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief           購読開始
+ * @details         自タスクを指定グループの購読タスクとして登録する。
+ *
+ * @param[in,out]   *pParam パラメータ
+ */
+/******************************************************************************/
+static void DoSubscribe( MkPubParam_t *pParam )
+{
+    uint32_t   idx;     /* インデックス     */
+    MkTaskId_t taskId;  /* タスクID         */
+    grpEntry_t *pGrp;   /* グループ管理情報 */
+
+    /* 初期化 */
+    idx    = 0;
+    taskId = TaskmngSchedGetTaskId();
+    pGrp   = NULL;
+
+    /* パラメータチェック */
+    if ( pParam->grpId >= MK_CONFIG_PUB_GRP_NUM ) {
+        /* 不正 */
+
+        /* 戻り値設定 */
+        pParam->err = MK_ERR_PARAM;
+
+        return;
+    }
+
+    /* グループ管理情報取得 */
+    pGrp = &( gGrpTbl[ pParam->grpId ] );
+
+    /* 登録済み判定 */
+    if ( SearchMember( pGrp, taskId ) != MK_CONFIG_PUB_MEMBER_NUM ) {
+        /* 登録済み */
+
+        /* 戻り値設定 */
+        pParam->err = MK_ERR_REGISTERED;
+
+        return;
+    }
+
+    /* 空きエントリ検索 */
+    idx = SearchMember( pGrp, MK_TASKID_NULL );
+
+    /* 検索結果判定 */
+    if ( idx == MK_CONFIG_PUB_MEMBER_NUM ) {
+        /* 空き無し */
+
+        /* 戻り値設定 */
+        pParam->err = MK_ERR_NO_RESOURCE;
+
+        return;
+    }
+
+    /* 購読タスク登録 */
+    pGrp->member[ idx ] = taskId;
+    pGrp->num++;
+
+    /* 戻り値設定 */
+    pParam->ret = MK_RET_SUCCESS;
+    pParam->err = MK_ERR_NONE;
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief           購読終了
+ * @details         自タスクを指定グループの購読タスクから削除する。削除前にキ
+ *                  ューイング済みのメッセージは受信可能なまま残る。
+ *
+ * @param[in,out]   *pParam パラメータ
+ */
+/******************************************************************************/
+static void DoUnsubscribe( MkPubParam_t *pParam )
+{
+    uint32_t   idx;     /* インデックス     */
+    MkTaskId_t taskId;  /* タスクID         */
+    grpEntry_t *pGrp;   /* グループ管理情報 */
+
+    /* 初期化 */
+    idx    = 0;
+    taskId = TaskmngSchedGetTaskId();
+    pGrp   = NULL;
+
+    /* パラメータチェック */
+    if ( pParam->grpId >= MK_CONFIG_PUB_GRP_NUM ) {
+        /* 不正 */
+
+        /* 戻り値設定 */
+        pParam->err = MK_ERR_PARAM;
+
+        return;
+    }
+
+    /* グループ管理情報取得 */
+    pGrp = &( gGrpTbl[ pParam->grpId ] );
+
+    /* 購読タスク検索 */
+    idx = SearchMember( pGrp, taskId );
+
+    /* 検索結果判定 */
+    if ( idx == MK_CONFIG_PUB_MEMBER_NUM ) {
+        /* 未登録 */
+
+        /* 戻り値設定 */
+        pParam->err = MK_ERR_NO_REGISTERED;
+
+        return;
+    }
+
+    /* 購読タスク削除 */
+    pGrp->member[ idx ] = MK_TASKID_NULL;
+    pGrp->num--;
+
+    /* 戻り値設定 */
+    pParam->ret = MK_RET_SUCCESS;
+    pParam->err = MK_ERR_NONE;
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief           割込みハンドラ
+ * @details         機能IDから適切なハンドラを呼び出す。
+ *
+ * @param[in]       intNo     割込み番号
+ * @param[in,out]   *pContext 割込み発生時コンテキスト情報
+ */
+/******************************************************************************/
+static void HdlInt( uint32_t        intNo,
+                    IntmngContext_t *pContext )
+{
+    MkPubParam_t *pParam;   /* パラメータ */
+
+    /* 初期化 */
+    pParam = ( MkPubParam_t * ) pContext->genReg.esi;
+
+    /* パラメータチェック */
+    if ( pParam == NULL ) {
+        /* 不正 */
+        return;
+    }
+
+    /* パラメータ初期化 */
+    pParam->ret = MK_RET_FAILURE;
+    pParam->err = MK_ERR_NONE;
+
+    /* 機能ID判定 */
+    if ( pParam->funcId == MK_PUB_FUNCID_SUBSCRIBE ) {
+        /* 購読開始 */
+
+        DoSubscribe( pParam );
+
+    } else if ( pParam->funcId == MK_PUB_FUNCID_UNSUBSCRIBE ) {
+        /* 購読終了 */
+
+        DoUnsubscribe( pParam );
+
+    } else if ( pParam->funcId == MK_PUB_FUNCID_PUBLISH ) {
+        /* 出版 */
+
+        pParam->num = 0;
+        DoPublish( pParam );
+
+    } else {
+        /* 不正 */
+
+        /* エラー設定 */
+        pParam->err = MK_ERR_PARAM;
+    }
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       購読タスク検索
+ * @details     グループ管理情報から指定したタスクIDのエントリを検索する。
+ *
+ * @param[in]   *pGrp  グループ管理情報
+ * @param[in]   taskId タスクID
+ *                  - MK_TASKID_NULL 空きエントリ
+ *
+ * @return      エントリのインデックスを返す。
+ * @retval      MK_CONFIG_PUB_MEMBER_NUM     該当無し
+ * @retval      MK_CONFIG_PUB_MEMBER_NUM以外 該当有り
+ */
+/******************************************************************************/
+static uint32_t SearchMember( grpEntry_t *pGrp,
+                              MkTaskId_t taskId )
+{
+    uint32_t idx;   /* インデックス */
+
+    /* 購読タスク毎に繰り返す */
+    for ( idx = 0; idx < MK_CONFIG_PUB_MEMBER_NUM; idx++ ) {
+        /* タスクID比較 */
+        if ( pGrp->member[ idx ] == taskId ) {
+            /* 一致 */
+
+            break;
+        }
+    }
+
+    return idx;
+}
+
+
+/******************************************************************************/
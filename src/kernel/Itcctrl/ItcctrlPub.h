@@ -0,0 +1,18 @@
+/******************************************************************************/
+/*                                                                            */
+/* src/kernel/Itcctrl/ItcctrlPub.h                                            */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2026 Mochi.                                                  */
+/*                                                                            */
+/******************************************************************************/
+#ifndef ITCCTRL_PUB_H
+#define ITCCTRL_PUB_H
+/******************************************************************************/
+/* グローバル関数プロトタイプ宣言                                             */
+/******************************************************************************/
+/* 出版購読制御初期化 */
+extern void ItcctrlPubInit( void );
+
+
+/******************************************************************************/
+#endif
@@ -1,8 +1,8 @@
 /******************************************************************************/
 /*                                                                            */
 /* src/kernel/Memmng/Memmng.c                                                 */
-/*                                                                 2024/06/02 */
-/* Copyright (C) 2016-2024 Mochi.                                             */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2016-2026 Mochi.                                             */
 /*                                                                            */
 /******************************************************************************/
 /******************************************************************************/
@@ -23,6 +23,7 @@
 #include "MemmngMap.h"
 #include "MemmngPage.h"
 #include "MemmngPhys.h"
+#include "MemmngShare.h"
 #include "MemmngVirt.h"
 
 
@@ -75,6 +76,9 @@ void MemmngInit( BiosE820Entry_t *pBiosE820,
     /* 仮想メモリ領域管理サブモジュール初期化 */
     VirtInit();
 
+    /* 共有ページ管理サブモジュール初期化 */
+    ShareInit();
+
     DEBUG_LOG_TRC( "%s() end.", __func__ );
 
     return;
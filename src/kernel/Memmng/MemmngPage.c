@@ -1,8 +1,8 @@
 /******************************************************************************/
 /*                                                                            */
 /* src/kernel/Memmng/MemmngPage.c                                             */
-/*                                                                 2024/08/10 */
-/* Copyright (C) 2017-2024 Mochi.                                             */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2017-2026 Mochi.                                             */
 /*                                                                            */
 /******************************************************************************/
 /******************************************************************************/
@@ -29,6 +29,9 @@
 #include <Debug.h>
 #include <Memmng.h>
 
+/* 内部モジュールヘッダ */
+#include "MemmngShare.h"
+
 
 /******************************************************************************/
 /* 定義                                                                       */
@@ -133,7 +136,8 @@ static void Unset( void *pVirtAddr,
 /******************************************************************************/
 /**
  * @brief       ページディレクトリ割当
- * @details     ページディレクトリを割り当てる。
+ * @details     ページディレクトリを割り当て、カーネル領域と共有ページをマッピ
+ *              ングする。
  *
  * @param[in]   pid プロセスID
  *
@@ -148,12 +152,14 @@ MemmngPageDirId_t MemmngPageAllocDir( MkPid_t pid )
     IA32PagingDir_t   *pPageDir;        /* ページディレクトリ               */
     IA32PagingDir_t   *pPageDirPhys;    /* ページディレクトリ(物理アドレス) */
     MemmngPageDirId_t dirId;            /* ページディレクトリID             */
+    CmnRet_t          ret;              /* 関数戻り値                       */
 
     /* 初期化 */
     pMngInfo     = NULL;
     pPageDir     = ( IA32PagingDir_t * ) MEMMAP_VADDR_KERNEL_PD1;
     pPageDirPhys = NULL;
     dirId        = 0;
+    ret          = CMN_FAILURE;
 
     /* 管理情報割当 */
     pMngInfo = AllocMngInfo( &dirId );
@@ -194,6 +200,24 @@ MemmngPageDirId_t MemmngPageAllocDir( MkPid_t pid )
                         ( IA32PagingDir_t * ) MEMMAP_PADDR_IDLE_PD,
                         KERNEL_AREA_PAGE_DIR_SIZE                   );
 
+    /* 共有ページマッピング設定 */
+    ret = Set( ( void * ) MEMMAP_VADDR_USER_SHARED,
+               ShareGetPhysAddr(),
+               MEMMNG_PAGE_ALLOC_PHYS_FALSE,
+               IA32_PAGING_G_NO,
+               IA32_PAGING_US_USER,
+               IA32_PAGING_RW_R                 );
+
+    /* 設定結果判定 */
+    if ( ret != CMN_SUCCESS ) {
+        /* 失敗 */
+
+        /* ページディレクトリ解放 */
+        MemmngPageFreeDir( dirId );
+
+        return MEMMNG_PAGE_DIR_ID_NULL;
+    }
+
     return dirId;
 }
 
@@ -1,8 +1,8 @@
 /******************************************************************************/
 /*                                                                            */
 /* src/kernel/Memmng/MemmngPhys.c                                             */
-/*                                                                 2024/08/11 */
-/* Copyright (C) 2018-2024 Mochi.                                             */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2018-2026 Mochi.                                             */
 /*                                                                            */
 /******************************************************************************/
 /******************************************************************************/
@@ -10,13 +10,15 @@
 /******************************************************************************/
 /* 標準ヘッダ */
 #include <stdarg.h>
+#include <stdbool.h>
+#include <stdint.h>
 
 /* ライブラリヘッダ */
 #include <MLib/MLib.h>
-#include <MLib/MLibList.h>
 #include <MLib/MLibUtil.h>
 
 /* 共通ヘッダ */
+#include <hardware/IA32/IA32Instruction.h>
 #include <hardware/IA32/IA32Paging.h>
 #include <kernel/kernel.h>
 
@@ -26,9 +28,6 @@
 #include <Debug.h>
 #include <Memmng.h>
 
-/* 内部モジュールヘッダ */
-#include "MemmngArea.h"
-
 
 /******************************************************************************/
 /* 定義                                                                       */
@@ -36,17 +35,119 @@
 /* モジュールID */
 #define _MODULE_ID_ CMN_MODULE_MEMMNG_PHYS
 
-/** ブロック管理情報数 */
-#define AREAINFO_NUM ( 1048575 )
+/** 最大ページ数(32bit物理アドレス空間) */
+#define PAGE_NUM_MAX ( 0x00100000 )
+
+/** 物理アドレス上限 */
+#define PADDR_LIMIT  ( ( uint64_t ) PAGE_NUM_MAX * IA32_PAGING_PAGE_SIZE )
+
+/** ページ番号 */
+#define PAGE_NO( _ADDR ) \
+    ( ( uint32_t ) ( ( _ADDR ) / IA32_PAGING_PAGE_SIZE ) )
+
+/** オーダ数(4KiB～16MiB) */
+#define ORDER_NUM    ( 13 )
+
+/* ビットマップ定義 */
+#define MAP_WORD_BITS ( 32 )                    /**< ワード当たりビット数 */
+#define MAP_LEVEL_NUM ( 3 )                     /**< 階層数               */
+#define MAP_NONE      ( UINT32_MAX )            /**< 該当無し             */
+
+/** ビット位置のワードインデックス */
+#define MAP_WORD( _IDX ) ( ( _IDX ) / MAP_WORD_BITS )
+
+/** ビット位置のワード内ビット */
+#define MAP_BIT( _IDX )  ( 1U << ( ( _IDX ) % MAP_WORD_BITS ) )
+
+/** ビット数当たりのワード数 */
+#define MAP_WORD_NUM( _BITS ) \
+    ( ( ( _BITS ) + MAP_WORD_BITS - 1 ) / MAP_WORD_BITS )
+
+/**
+ * ビットマップ領域ワード数
+ *
+ * 全オーダの空きブロックビットマップ(3階層)と割当済ブロックビットマップの合
+ * 計。各オーダのブロック数は最大ページ数の1/2^orderの為、合計は最大ページ数
+ * の2倍未満となり、切り上げ分をオーダ毎に加算する。
+ */
+#define MAP_POOL_SIZE                                                       \
+    ( ( PAGE_NUM_MAX / MAP_WORD_BITS ) * 2 * 2                           +  \
+      ( PAGE_NUM_MAX / MAP_WORD_BITS / MAP_WORD_BITS ) * 2               +  \
+      ( PAGE_NUM_MAX / MAP_WORD_BITS / MAP_WORD_BITS / MAP_WORD_BITS ) * 2 + \
+      ORDER_NUM * 8                                                         )
+
+/** 予約領域数 */
+#define RSV_NUM ( 3 )
+
+/**
+ * ビットマップ
+ *
+ * 下位階層のワードが0以外の場合に上位階層の対応ビットを設定し、最上位階層か
+ * ら辿る事で空きブロックを階層数回のbsf命令で検索する。
+ */
+typedef struct {
+    uint32_t *pLevel[ MAP_LEVEL_NUM ];  /**< 階層毎ビットマップ */
+    uint32_t topNum;                    /**< 最上位階層ワード数 */
+} Map_t;
+
+/** オーダ管理情報 */
+typedef struct {
+    uint32_t blockNum;      /**< ブロック数                 */
+    uint32_t freeNum;       /**< 空きブロック数             */
+    Map_t    freeMap;       /**< 空きブロックビットマップ   */
+    uint32_t *pAllocMap;    /**< 割当済ブロックビットマップ */
+} OrderInfo_t;
 
 /** 物理メモリ領域管理テーブル */
 typedef struct {
-    MLibList_t allocList;                   /**< 割当済リンクリスト */
-    MLibList_t freeList;                    /**< 未割当リンクリスト */
-    MLibList_t unusedList;                  /**< 未使用リンクリスト */
-    AreaInfo_t areaInfo[ AREAINFO_NUM ];    /**< ブロック管理情報   */
+    uint32_t    pageNum;                /**< 管理ページ数     */
+    OrderInfo_t order[ ORDER_NUM ];     /**< オーダ管理情報   */
+    uint32_t    map[ MAP_POOL_SIZE ];   /**< ビットマップ領域 */
 } PhysTbl_t;
 
+/** 予約領域情報 */
+typedef struct {
+    uint32_t addr;  /**< 先頭アドレス */
+    uint32_t size;  /**< サイズ       */
+} RsvInfo_t;
+
+
+/******************************************************************************/
+/* ローカル関数宣言                                                           */
+/******************************************************************************/
+/* 未割当メモリ領域追加 */
+static void AddArea( uint32_t start,
+                     uint32_t end,
+                     uint32_t rsvIdx );
+
+/* ブロック割当 */
+static uint32_t AllocBlock( uint32_t order );
+
+/* ブロック解放 */
+static void FreeBlock( uint32_t page,
+                       uint32_t order );
+
+/* オーダ取得 */
+static uint32_t GetOrder( size_t size );
+
+/* ビットマップ初期化 */
+static void InitMap( uint32_t pageNum );
+
+/* ビットクリア */
+static void MapClear( Map_t    *pMap,
+                      uint32_t idx    );
+
+/* 設定ビット検索 */
+static uint32_t MapFind( Map_t *pMap );
+
+/* ビット設定 */
+static void MapSet( Map_t    *pMap,
+                    uint32_t idx    );
+
+/* ビット判定 */
+static bool MapTest( uint32_t *pWord,
+                     uint32_t idx     );
+
 
 /******************************************************************************/
 /* 変数定義                                                                   */
@@ -54,6 +155,13 @@ typedef struct {
 /** 物理メモリ領域管理テーブル */
 static PhysTbl_t gPhysTbl;
 
+/** 予約領域情報テーブル */
+static const RsvInfo_t gRsvTbl[ RSV_NUM ] = {
+    { MEMMAP_PADDR_DEBUG,     MEMMAP_PSIZE_DEBUG     },  /* デバッグ用メモリ領域   */
+    { MEMMAP_PADDR_IDLE_PD,   MEMMAP_PSIZE_IDLE_PD   },  /* アイドルプロセス用PD   */
+    { MEMMAP_PADDR_KERNEL_PT, MEMMAP_PSIZE_KERNEL_PT }   /* カーネル領域PT         */
+};
+
 
 /******************************************************************************/
 /* 外部モジュール向けグローバル関数定義                                       */
@@ -61,8 +169,8 @@ static PhysTbl_t gPhysTbl;
 /******************************************************************************/
 /**
  * @brief       物理メモリ領域割当
- * @details     指定サイズを満たす物理メモリ領域を割り当てる。割当て領域は、0で
- *              初期化する。
+ * @details     指定サイズを満たす物理メモリ領域をバディアロケータで割り当て
+ *              る。割当て領域は、0で初期化する。
  *
  * @param[in]   size 割当サイズ
  *
@@ -70,16 +178,20 @@ static PhysTbl_t gPhysTbl;
  * @retval      NULL     失敗
  * @retval      NULL以外 成功
  *
- * @note        割当サイズが4Kバイトアライメントでない場合は、割当サイズが4Kバ
- *              イトアライメントに合うよう加算して、物理メモリ領域を割り当てる。
+ * @note        割当サイズは4Kバイトの2のべき乗倍に切り上げて、物理メモリ領域
+ *              を割り当てる。割当サイズの上限は2^(ORDER_NUM-1)ページとする。
  */
 /******************************************************************************/
 void *MemmngPhysAlloc( size_t size )
 {
-    void *pRet; /* 戻り値 */
+    void     *pRet; /* 戻り値       */
+    uint32_t order; /* オーダ       */
+    uint32_t page;  /* ページ番号   */
 
     /* 初期化 */
-    pRet = NULL;
+    pRet  = NULL;
+    order = 0;
+    page  = 0;
 
     /* サイズチェック */
     if ( size == 0 ) {
@@ -94,16 +206,27 @@ void *MemmngPhysAlloc( size_t size )
         size = MLIB_UTIL_ALIGN( size, IA32_PAGING_PAGE_SIZE );
     }
 
-    /* メモリ領域割当 */
-    pRet = AreaAlloc( &( gPhysTbl.allocList  ),
-                      &( gPhysTbl.freeList   ),
-                      &( gPhysTbl.unusedList ),
-                      size                      );
+    /* オーダ取得 */
+    order = GetOrder( size );
+
+    /* オーダ判定 */
+    if ( order >= ORDER_NUM ) {
+        /* 上限超過 */
+
+        DEBUG_LOG_ERR( "%s(): size over! size=%d", __func__, size );
+
+        return NULL;
+    }
+
+    /* ブロック割当 */
+    page = AllocBlock( order );
 
     /* 割当結果判定 */
-    if ( pRet != NULL ) {
+    if ( page != PAGE_NUM_MAX ) {
         /* 成功 */
 
+        pRet = ( void * ) ( page * IA32_PAGING_PAGE_SIZE );
+
         DEBUG_LOG_TRC( "%s(): addr=%p, size=%d", __func__, pRet, size );
 
         /* 0初期化 */
@@ -122,35 +245,68 @@ void *MemmngPhysAlloc( size_t size )
 /******************************************************************************/
 /**
  * @brief       物理メモリ領域解放
- * @details     割当済みの物理メモリ領域を解放する。
+ * @details     割当済みの物理メモリ領域を解放する。割当時のオーダは割当済ブロ
+ *              ックビットマップから求め、空いているバディと結合する。
  *
  * @param[in]   *pAddr 解放するメモリアドレス
  *
  * @return      解放結果を返す。
- * @retval      CMN_FAILURE 成功
- * @retval      CMN_SUCCESS 失敗
+ * @retval      CMN_SUCCESS 成功
+ * @retval      CMN_FAILURE 失敗
  */
 /******************************************************************************/
 CmnRet_t MemmngPhysFree( void *pAddr )
 {
-    CmnRet_t ret;   /* 戻り値 */
+    uint32_t    order;  /* オーダ           */
+    uint32_t    page;   /* ページ番号       */
+    OrderInfo_t *pInfo; /* オーダ管理情報   */
 
-    DEBUG_LOG_TRC( "%s(): pAddr=%p", __func__, pAddr );
+    /* 初期化 */
+    order = 0;
+    page  = PAGE_NO( ( uint32_t ) pAddr );
+    pInfo = NULL;
 
-    /* メモリ領域解放 */
-    ret = AreaFree( &( gPhysTbl.allocList  ),
-                    &( gPhysTbl.freeList   ),
-                    &( gPhysTbl.unusedList ),
-                    pAddr                     );
+    DEBUG_LOG_TRC( "%s(): pAddr=%p", __func__, pAddr );
 
-    /* メモリ解放結果判定 */
-    if ( ret != CMN_SUCCESS ) {
-        /* 失敗 */
+    /* アドレスチェック */
+    if ( ( ( ( uint32_t ) pAddr % IA32_PAGING_PAGE_SIZE ) != 0 ) ||
+         ( page >= gPhysTbl.pageNum                          )    ) {
+        /* 不正 */
 
         DEBUG_LOG_ERR( "%s(): failure! pAddr=%p", __func__, pAddr );
+
+        return CMN_FAILURE;
     }
 
-    return ret;
+    /* オーダ毎に繰り返す */
+    for ( order = 0; order < ORDER_NUM; order++ ) {
+        /* アライメント判定 */
+        if ( ( page & ( ( 1U << order ) - 1 ) ) != 0 ) {
+            /* 不一致 */
+
+            break;
+        }
+
+        pInfo = &( gPhysTbl.order[ order ] );
+
+        /* 割当済判定 */
+        if ( MapTest( pInfo->pAllocMap, page >> order ) != false ) {
+            /* 割当済 */
+
+            /* 割当済ブロッククリア */
+            pInfo->pAllocMap[ MAP_WORD( page >> order ) ] &=
+                ~MAP_BIT( page >> order );
+
+            /* ブロック解放 */
+            FreeBlock( page, order );
+
+            return CMN_SUCCESS;
+        }
+    }
+
+    DEBUG_LOG_ERR( "%s(): failure! pAddr=%p", __func__, pAddr );
+
+    return CMN_FAILURE;
 }
 
 
@@ -160,7 +316,9 @@ CmnRet_t MemmngPhysFree( void *pAddr )
 /******************************************************************************/
 /**
  * @brief       物理メモリ領域管理初期化
- * @details     物理メモリ領域管理テーブルを初期化する。
+ * @details     メモリマップの使用可能メモリ領域の最終アドレスから管理ページ数
+ *              を求めてビットマップを初期化し、予約領域を除いた使用可能メモリ
+ *              領域をバディアロケータに追加する。
  *
  * @param[in]   *pMemMap メモリマップ
  * @param[in]   entryNum メモリマップエントリ数
@@ -169,65 +327,513 @@ CmnRet_t MemmngPhysFree( void *pAddr )
 void PhysInit( MkMemMapEntry_t *pMemMap,
                size_t          entryNum  )
 {
-    uint32_t idx;   /* インデックス */
+    uint32_t idx;       /* インデックス   */
+    uint32_t pageNum;   /* 管理ページ数   */
+    uint64_t start;     /* 先頭アドレス   */
+    uint64_t end;       /* 終端アドレス   */
 
     /* 初期化 */
-    idx = 0;
+    idx     = 0;
+    pageNum = 0;
+    start   = 0;
+    end     = 0;
+
+    /* メモリマップエントリ毎に繰り返し */
+    for ( idx = 0; idx < entryNum; idx++ ) {
+        /* メモリ領域タイプ判定 */
+        if ( pMemMap[ idx ].type != MK_MEM_TYPE_AVAILABLE ) {
+            /* 使用可能メモリ領域以外 */
+
+            continue;
+        }
+
+        /* 終端アドレス計算 */
+        end = ( uint64_t ) ( uint32_t ) pMemMap[ idx ].pAddr +
+              pMemMap[ idx ].size;
 
-    /* 割当済リンクリスト初期化 */
-    MLibListInit( &( gPhysTbl.allocList ) );
+        /* 終端ページ判定 */
+        if ( end > PADDR_LIMIT ) {
+            /* 物理アドレス上限超過 */
 
-    /* 未割当リンクリスト初期化 */
-    MLibListInit( &( gPhysTbl.freeList ) );
+            pageNum = PAGE_NUM_MAX;
 
-    /* 未使用リンクリスト初期化 */
-    MLibListInit( &( gPhysTbl.unusedList ) );
+        } else if ( PAGE_NO( end ) > pageNum ) {
+            /* 管理ページ数超過 */
 
-    /* ブロック管理情報毎に繰り返す */
-    for ( idx = 0; idx < AREAINFO_NUM; idx++ ) {
-        /* 未使用リンクリスト追加 */
-        MLibListInsertTail( &( gPhysTbl.unusedList           ),
-                            &( gPhysTbl.areaInfo[ idx ].node )  );
+            pageNum = PAGE_NO( end );
+        }
     }
 
+    /* ビットマップ初期化 */
+    InitMap( pageNum );
+
     /* メモリマップエントリ毎に繰り返し */
     for ( idx = 0; idx < entryNum; idx++ ) {
         /* メモリ領域タイプ判定 */
-        if ( pMemMap[ idx ].type == MK_MEM_TYPE_AVAILABLE ) {
-            /* 使用可能メモリ領域 */
-
-            /* 未割当メモリ領域追加 */
-            AreaAdd( &( gPhysTbl.freeList   ),
-                     &( gPhysTbl.unusedList ),
-                     pMemMap[ idx ].pAddr,
-                     pMemMap[ idx ].size,
-                     true                      );
-        }
-    }
-
-    /* デバッグ用メモリ領域割当て */
-    AreaAllocSpec( &( gPhysTbl.allocList  ),
-                   &( gPhysTbl.freeList   ),
-                   &( gPhysTbl.unusedList ),
-                   ( void * ) MEMMAP_PADDR_DEBUG,
-                   MEMMAP_PSIZE_DEBUG             );
-
-    /* アイドルプロセス用ページディレクトリ領域割当て */
-    AreaAllocSpec( &( gPhysTbl.allocList  ),
-                   &( gPhysTbl.freeList   ),
-                   &( gPhysTbl.unusedList ),
-                   ( void * ) MEMMAP_PADDR_IDLE_PD,
-                   MEMMAP_PSIZE_IDLE_PD             );
-
-    /* カーネル領域ページテーブル領域割当て */
-    AreaAllocSpec( &( gPhysTbl.allocList  ),
-                   &( gPhysTbl.freeList   ),
-                   &( gPhysTbl.unusedList ),
-                   ( void * ) MEMMAP_PADDR_KERNEL_PT,
-                   MEMMAP_PSIZE_KERNEL_PT             );
+        if ( pMemMap[ idx ].type != MK_MEM_TYPE_AVAILABLE ) {
+            /* 使用可能メモリ領域以外 */
+
+            continue;
+        }
+
+        /* 領域計算 */
+        start = ( uint32_t ) pMemMap[ idx ].pAddr;
+        end   = start + pMemMap[ idx ].size;
+        start = MLIB_UTIL_ALIGN( start, IA32_PAGING_PAGE_SIZE );
+
+        /* 終端アドレス判定 */
+        if ( end > PADDR_LIMIT ) {
+            /* 物理アドレス上限超過 */
+
+            end = PADDR_LIMIT;
+        }
+
+        /* 未割当メモリ領域追加 */
+        AddArea( PAGE_NO( start ), PAGE_NO( end ), 0 );
+    }
+
+    DEBUG_LOG_INF( "phys: pageNum=%u", pageNum );
+
+    return;
+}
+
+
+/******************************************************************************/
+/* ローカル関数定義                                                           */
+/******************************************************************************/
+/******************************************************************************/
+/**
+ * @brief       未割当メモリ領域追加
+ * @details     指定したページ範囲から予約領域を除き、アライメントが合う最大の
+ *              ブロックに分割して解放する。
+ *
+ * @param[in]   start  先頭ページ番号
+ * @param[in]   end    終端ページ番号(範囲外)
+ * @param[in]   rsvIdx 判定開始予約領域インデックス
+ */
+/******************************************************************************/
+static void AddArea( uint32_t start,
+                     uint32_t end,
+                     uint32_t rsvIdx )
+{
+    uint32_t order;     /* オーダ           */
+    uint32_t rsvStart;  /* 予約先頭ページ   */
+    uint32_t rsvEnd;    /* 予約終端ページ   */
+
+    /* 初期化 */
+    order    = 0;
+    rsvStart = 0;
+    rsvEnd   = 0;
+
+    /* 予約領域毎に繰り返す */
+    for ( ; rsvIdx < RSV_NUM; rsvIdx++ ) {
+        /* 予約ページ範囲計算 */
+        rsvStart = PAGE_NO( gRsvTbl[ rsvIdx ].addr );
+        rsvEnd   = PAGE_NO( gRsvTbl[ rsvIdx ].addr + gRsvTbl[ rsvIdx ].size );
+
+        /* 重複判定 */
+        if ( ( rsvEnd <= start ) || ( end <= rsvStart ) ) {
+            /* 重複無し */
+
+            continue;
+        }
+
+        /* 予約領域前判定 */
+        if ( start < rsvStart ) {
+            /* 有り */
+
+            AddArea( start, rsvStart, rsvIdx + 1 );
+        }
+
+        /* 予約領域後判定 */
+        if ( rsvEnd < end ) {
+            /* 有り */
+
+            AddArea( rsvEnd, end, rsvIdx + 1 );
+        }
+
+        return;
+    }
+
+    /* ブロック毎に繰り返す */
+    while ( start < end ) {
+        /* 最大オーダ検索 */
+        for ( order = 0; order < ( ORDER_NUM - 1 ); order++ ) {
+            /* アライメント・サイズ判定 */
+            if ( ( ( start & ( ( 2U << order ) - 1 ) ) != 0 ) ||
+                 ( ( end - start ) < ( 2U << order )        )    ) {
+                /* 不一致 */
+
+                break;
+            }
+        }
+
+        /* ブロック解放 */
+        FreeBlock( start, order );
+
+        start += 1U << order;
+    }
 
     return;
 }
 
 
+/******************************************************************************/
+/**
+ * @brief       ブロック割当
+ * @details     指定オーダ以上で空きブロックが有る最小のオーダから空きブロック
+ *              を取り出し、指定オーダになるまで二分割して上位側を空きブロック
+ *              に戻す。
+ *
+ * @param[in]   order オーダ
+ *
+ * @return      割り当てたブロックの先頭ページ番号を返す。
+ * @retval      PAGE_NUM_MAX     空きブロック無し
+ * @retval      PAGE_NUM_MAX以外 先頭ページ番号
+ */
+/******************************************************************************/
+static uint32_t AllocBlock( uint32_t order )
+{
+    uint32_t    now;    /* 取出しオーダ     */
+    uint32_t    idx;    /* ブロック番号     */
+    uint32_t    page;   /* 先頭ページ番号   */
+    OrderInfo_t *pInfo; /* オーダ管理情報   */
+
+    /* 初期化 */
+    now   = order;
+    idx   = 0;
+    page  = 0;
+    pInfo = NULL;
+
+    /* 空きブロック有りオーダ検索 */
+    while ( gPhysTbl.order[ now ].freeNum == 0 ) {
+        now++;
+
+        /* オーダ上限判定 */
+        if ( now >= ORDER_NUM ) {
+            /* 空きブロック無し */
+
+            return PAGE_NUM_MAX;
+        }
+    }
+
+    /* 空きブロック取出し */
+    pInfo = &( gPhysTbl.order[ now ] );
+    idx   = MapFind( &( pInfo->freeMap ) );
+    MapClear( &( pInfo->freeMap ), idx );
+    pInfo->freeNum--;
+    page  = idx << now;
+
+    /* 指定オーダまで繰り返す */
+    while ( now > order ) {
+        now--;
+
+        /* 上位側ブロックを空きブロックに戻す */
+        pInfo = &( gPhysTbl.order[ now ] );
+        MapSet( &( pInfo->freeMap ), ( page >> now ) + 1 );
+        pInfo->freeNum++;
+    }
+
+    /* 割当済ブロック設定 */
+    pInfo = &( gPhysTbl.order[ order ] );
+    pInfo->pAllocMap[ MAP_WORD( page >> order ) ] |= MAP_BIT( page >> order );
+
+    return page;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       ブロック解放
+ * @details     指定ブロックのバディが空いている間はバディと結合してオーダを上
+ *              げ、結合後のブロックを空きブロックに追加する。
+ *
+ * @param[in]   page  先頭ページ番号
+ * @param[in]   order オーダ
+ */
+/******************************************************************************/
+static void FreeBlock( uint32_t page,
+                       uint32_t order )
+{
+    uint32_t    buddy;  /* バディブロック番号 */
+    OrderInfo_t *pInfo; /* オーダ管理情報     */
+
+    /* 初期化 */
+    buddy = 0;
+    pInfo = NULL;
+
+    /* 最大オーダまで繰り返す */
+    while ( order < ( ORDER_NUM - 1 ) ) {
+        /* バディ取得 */
+        pInfo = &( gPhysTbl.order[ order ] );
+        buddy = ( page >> order ) ^ 1;
+
+        /* バディ空き判定 */
+        if ( ( buddy >= pInfo->blockNum                              ) ||
+             ( MapTest( pInfo->freeMap.pLevel[ 0 ], buddy ) == false )    ) {
+            /* 空き無し */
+
+            break;
+        }
+
+        /* バディ結合 */
+        MapClear( &( pInfo->freeMap ), buddy );
+        pInfo->freeNum--;
+        page &= ~( 1U << order );
+        order++;
+    }
+
+    /* 空きブロック追加 */
+    pInfo = &( gPhysTbl.order[ order ] );
+    MapSet( &( pInfo->freeMap ), page >> order );
+    pInfo->freeNum++;
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       オーダ取得
+ * @details     指定サイズを満たす最小のオーダを取得する。
+ *
+ * @param[in]   size サイズ(ページアライメント済)
+ *
+ * @return      オーダを返す。
+ */
+/******************************************************************************/
+static uint32_t GetOrder( size_t size )
+{
+    uint32_t order;     /* オーダ   */
+    size_t   pageNum;   /* ページ数 */
+
+    /* 初期化 */
+    order   = 0;
+    pageNum = size / IA32_PAGING_PAGE_SIZE;
+
+    /* ページ数を満たすまで繰り返す */
+    while ( ( order < ORDER_NUM ) && ( ( 1U << order ) < pageNum ) ) {
+        order++;
+    }
+
+    return order;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       ビットマップ初期化
+ * @details     管理ページ数から各オーダのブロック数を求め、ビットマップ領域を
+ *              各オーダの空きブロックビットマップと割当済ブロックビットマップ
+ *              に割り当てる。ビットマップ領域の大きさは搭載メモリ量に比例し、
+ *              全ビット0で開始する。
+ *
+ * @param[in]   pageNum 管理ページ数
+ */
+/******************************************************************************/
+static void InitMap( uint32_t pageNum )
+{
+    uint32_t    order;  /* オーダ           */
+    uint32_t    level;  /* 階層             */
+    uint32_t    bits;   /* 階層ビット数     */
+    uint32_t    *pPool; /* ビットマップ領域 */
+    OrderInfo_t *pInfo; /* オーダ管理情報   */
+
+    /* 初期化 */
+    order = 0;
+    level = 0;
+    bits  = 0;
+    pPool = gPhysTbl.map;
+    pInfo = NULL;
+
+    /* 管理ページ数設定 */
+    gPhysTbl.pageNum = pageNum;
+
+    /* オーダ毎に繰り返す */
+    for ( order = 0; order < ORDER_NUM; order++ ) {
+        /* ブロック数設定 */
+        pInfo           = &( gPhysTbl.order[ order ] );
+        pInfo->blockNum = ( pageNum + ( 1U << order ) - 1 ) >> order;
+        pInfo->freeNum  = 0;
+        bits            = pInfo->blockNum;
+
+        /* 階層毎に繰り返す */
+        for ( level = 0; level < MAP_LEVEL_NUM; level++ ) {
+            /* 空きブロックビットマップ割当 */
+            pInfo->freeMap.pLevel[ level ] = pPool;
+            bits                           = MAP_WORD_NUM( bits );
+            pPool                         += bits;
+        }
+
+        pInfo->freeMap.topNum = bits;
+
+        /* 割当済ブロックビットマップ割当 */
+        pInfo->pAllocMap = pPool;
+        pPool           += MAP_WORD_NUM( pInfo->blockNum );
+    }
+
+    DEBUG_LOG_TRC(
+        "%s(): pageNum=%u, mapSize=%u",
+        __func__,
+        pageNum,
+        ( uint32_t ) ( pPool - gPhysTbl.map ) * sizeof ( uint32_t )
+    );
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       ビットクリア
+ * @details     ビットマップの指定ビットをクリアし、ワードが0になった場合は上
+ *              位階層の対応ビットもクリアする。
+ *
+ * @param[in]   *pMap ビットマップ
+ * @param[in]   idx   ビット位置
+ */
+/******************************************************************************/
+static void MapClear( Map_t    *pMap,
+                      uint32_t idx    )
+{
+    uint32_t level; /* 階層 */
+
+    /* 初期化 */
+    level = 0;
+
+    /* 階層毎に繰り返す */
+    for ( level = 0; level < MAP_LEVEL_NUM; level++ ) {
+        /* ビットクリア */
+        pMap->pLevel[ level ][ MAP_WORD( idx ) ] &= ~MAP_BIT( idx );
+
+        /* ワード判定 */
+        if ( pMap->pLevel[ level ][ MAP_WORD( idx ) ] != 0 ) {
+            /* 他ビット有り */
+
+            break;
+        }
+
+        idx = MAP_WORD( idx );
+    }
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       設定ビット検索
+ * @details     最上位階層から設定ビットを辿り、最下位階層の設定ビットを検索す
+ *              る。
+ *
+ * @param[in]   *pMap ビットマップ
+ *
+ * @return      ビット位置を返す。
+ * @retval      MAP_NONE     設定ビット無し
+ * @retval      MAP_NONE以外 ビット位置
+ */
+/******************************************************************************/
+static uint32_t MapFind( Map_t *pMap )
+{
+    uint32_t idx;   /* ワードインデックス */
+    uint32_t level; /* 階層               */
+    uint32_t *pTop; /* 最上位階層         */
+
+    /* 初期化 */
+    idx   = 0;
+    level = MAP_LEVEL_NUM - 1;
+    pTop  = pMap->pLevel[ level ];
+
+    /* 最上位階層ワード毎に繰り返す */
+    while ( pTop[ idx ] == 0 ) {
+        idx++;
+
+        /* ワード数判定 */
+        if ( idx >= pMap->topNum ) {
+            /* 設定ビット無し */
+
+            return MAP_NONE;
+        }
+    }
+
+    /* 階層毎に繰り返す */
+    while ( true ) {
+        /* ビット位置計算 */
+        idx = idx * MAP_WORD_BITS +
+              IA32InstructionBsf( pMap->pLevel[ level ][ idx ] );
+
+        /* 階層判定 */
+        if ( level == 0 ) {
+            /* 最下位階層 */
+
+            break;
+        }
+
+        level--;
+    }
+
+    return idx;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       ビット設定
+ * @details     ビットマップの指定ビットを設定し、ワードが0から変化した場合は
+ *              上位階層の対応ビットも設定する。
+ *
+ * @param[in]   *pMap ビットマップ
+ * @param[in]   idx   ビット位置
+ */
+/******************************************************************************/
+static void MapSet( Map_t    *pMap,
+                    uint32_t idx    )
+{
+    uint32_t level; /* 階層     */
+    uint32_t word;  /* 設定前値 */
+
+    /* 初期化 */
+    level = 0;
+    word  = 0;
+
+    /* 階層毎に繰り返す */
+    for ( level = 0; level < MAP_LEVEL_NUM; level++ ) {
+        /* ビット設定 */
+        word = pMap->pLevel[ level ][ MAP_WORD( idx ) ];
+        pMap->pLevel[ level ][ MAP_WORD( idx ) ] = word | MAP_BIT( idx );
+
+        /* 設定前値判定 */
+        if ( word != 0 ) {
+            /* 上位階層設定済 */
+
+            break;
+        }
+
+        idx = MAP_WORD( idx );
+    }
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       ビット判定
+ * @details     ビットマップの指定ビットが設定されているか判定する。
+ *
+ * @param[in]   *pWord ビットマップ
+ * @param[in]   idx    ビット位置
+ *
+ * @return      判定結果を返す。
+ * @retval      true  設定
+ * @retval      false 未設定
+ */
+/******************************************************************************/
+static bool MapTest( uint32_t *pWord,
+                     uint32_t idx     )
+{
+    return ( pWord[ MAP_WORD( idx ) ] & MAP_BIT( idx ) ) != 0;
+}
+
+
 /******************************************************************************/
@@ -0,0 +1,300 @@
+/******************************************************************************/
+/*                                                                            */
+/* src/kernel/Memmng/MemmngShare.c                                            */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2026 Mochi.                                                  */
+/*                                                                            */
+/******************************************************************************/
+/******************************************************************************/
+/* インクルード                                                               */
+/******************************************************************************/
+/* 標準ヘッダ */
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+/* ライブラリヘッダ */
+#include <MLib/MLibUtil.h>
+
+/* 共通ヘッダ */
+#include <kernel/config.h>
+#include <kernel/sharedpage.h>
+#include <kernel/types.h>
+#include <hardware/IA32/IA32.h>
+#include <hardware/IA32/IA32Instruction.h>
+
+/* 外部モジュールヘッダ */
+#include <Cmn.h>
+#include <Debug.h>
+#include <Memmng.h>
+
+/* 内部モジュールヘッダ */
+#include "MemmngShare.h"
+
+
+/******************************************************************************/
+/* 定義                                                                       */
+/******************************************************************************/
+/* モジュールID */
+#define _MODULE_ID_ CMN_MODULE_MEMMNG_SHARE
+
+
+/******************************************************************************/
+/* 変数定義                                                                   */
+/******************************************************************************/
+/**
+ * 共有ページ領域
+ *
+ * ユーザにマッピングするページに他のカーネルデータが含まれない様に1ページを
+ * 占有させる。カーネル領域は物理アドレスと仮想アドレスが等しい。
+ */
+static uint8_t gPageArea[ MK_SHAREDPAGE_SIZE ]
+    __attribute__ ( ( aligned( MK_SHAREDPAGE_SIZE ) ) );
+
+/** 共有ページ */
+static volatile MkSharedPage_t *gpPage;
+
+/** TSC有無 */
+static bool gTscExist;
+
+
+/******************************************************************************/
+/* グローバル関数定義                                                         */
+/******************************************************************************/
+/******************************************************************************/
+/**
+ * @brief       共有ページ割込み発生回数加算
+ * @details     割込み状態の割込み発生回数をインクリメントする。割込み禁止中に
+ *              呼び出し、ユーザからは32bit単位で読み込む為、更新途中の値は読
+ *              まれない。
+ *
+ * @param[in]   idx   割込み状態インデックス
+ * @param[in]   irqNo IRQ番号
+ */
+/******************************************************************************/
+void MemmngShareAddInt( uint32_t idx,
+                        uint8_t  irqNo )
+{
+    /* パラメータチェック */
+    if ( ( idx   >= MK_SHAREDPAGE_INT_NUM ) ||
+         ( irqNo >= MK_INT_IRQ_NUM        )    ) {
+        /* 不正 */
+
+        return;
+    }
+
+    /* 割込み発生回数加算 */
+    gpPage->intState[ idx ].count[ irqNo ]++;
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       共有ページ割込み発生回数取得
+ * @details     割込み状態の割込み発生回数を取得する。
+ *
+ * @param[in]   idx   割込み状態インデックス
+ * @param[in]   irqNo IRQ番号
+ *
+ * @return      割込み発生回数を返す。
+ */
+/******************************************************************************/
+uint32_t MemmngShareGetInt( uint32_t idx,
+                            uint8_t  irqNo )
+{
+    /* パラメータチェック */
+    if ( ( idx   >= MK_SHAREDPAGE_INT_NUM ) ||
+         ( irqNo >= MK_INT_IRQ_NUM        )    ) {
+        /* 不正 */
+
+        return 0;
+    }
+
+    return gpPage->intState[ idx ].count[ irqNo ];
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       共有ページ割込み状態割当て
+ * @details     割込み状態を指定したタスクに割り当て、割込み発生回数を0にす
+ *              る。MK_TASKID_NULLを指定した場合は割当てを解除する。
+ *
+ * @param[in]   idx    割込み状態インデックス
+ * @param[in]   taskId 割当て先タスクID
+ */
+/******************************************************************************/
+void MemmngShareSetInt( uint32_t   idx,
+                        MkTaskId_t taskId )
+{
+    /* パラメータチェック */
+    if ( idx >= MK_SHAREDPAGE_INT_NUM ) {
+        /* 不正 */
+
+        return;
+    }
+
+    /* 割込み状態設定 */
+    MLibUtilSetMemory8( ( void * ) gpPage->intState[ idx ].count,
+                        0,
+                        sizeof ( gpPage->intState[ idx ].count ) );
+    gpPage->intState[ idx ].taskId = taskId;
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       共有ページ時刻情報設定
+ * @details     共有ページにTSC周波数と単調増加時刻・実時刻の基準値を設定す
+ *              る。
+ *
+ * @param[in]   tscHz    TSC周波数[Hz](0:TSC無し)
+ * @param[in]   tscBase  単調増加時刻0時のTSC値
+ * @param[in]   realBase 単調増加時刻0時の実時刻[ns]
+ */
+/******************************************************************************/
+void MemmngShareSetClock( uint64_t tscHz,
+                          uint64_t tscBase,
+                          uint64_t realBase )
+{
+    /* 更新開始 */
+    gpPage->seq++;
+
+    /* 時刻情報設定 */
+    gpPage->tscHz    = tscHz;
+    gpPage->tscBase  = tscBase;
+    gpPage->realBase = realBase;
+
+    /* 更新終了 */
+    gpPage->seq++;
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       共有ページ実行中タスク設定
+ * @details     共有ページの実行中タスクIDと実行中プロセスIDを設定する。タスク
+ *              スイッチ時に切替先タスクの値を設定する。
+ *
+ * @param[in]   taskId タスクID
+ * @param[in]   pid    プロセスID
+ */
+/******************************************************************************/
+void MemmngShareSetTask( MkTaskId_t taskId,
+                         MkPid_t    pid     )
+{
+    /* 実行中タスク設定 */
+    gpPage->taskId = taskId;
+    gpPage->pid    = pid;
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       共有ページtick更新
+ * @details     共有ページのtickカウンタをインクリメントし、最終tick時TSC値を
+ *              設定する。
+ */
+/******************************************************************************/
+void MemmngShareUpdateTick( void )
+{
+    uint64_t tsc;   /* TSC値 */
+
+    /* 初期化 */
+    tsc = 0;
+
+    /* TSC有無判定 */
+    if ( gTscExist != false ) {
+        /* 有り */
+
+        /* TSC取得 */
+        tsc = IA32InstructionRdtsc();
+    }
+
+    /* 更新開始 */
+    gpPage->seq++;
+
+    /* tick情報設定 */
+    gpPage->tick++;
+    gpPage->tickTsc = tsc;
+
+    /* 更新終了 */
+    gpPage->seq++;
+
+    return;
+}
+
+
+/******************************************************************************/
+/* モジュール内グローバル関数定義                                             */
+/******************************************************************************/
+/******************************************************************************/
+/**
+ * @brief       共有ページ物理アドレス取得
+ * @details     ユーザ空間にマッピングする共有ページの物理アドレスを取得する。
+ *
+ * @return      共有ページ物理アドレスを返す。
+ */
+/******************************************************************************/
+void *ShareGetPhysAddr( void )
+{
+    return gPageArea;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       共有ページ管理初期化
+ * @details     共有ページを初期化し、TSCの有無を判定する。
+ */
+/******************************************************************************/
+void ShareInit( void )
+{
+    uint32_t eax;   /* CPUID EAX出力値 */
+    uint32_t ebx;   /* CPUID EBX出力値 */
+    uint32_t ecx;   /* CPUID ECX出力値 */
+    uint32_t edx;   /* CPUID EDX出力値 */
+    uint32_t idx;   /* インデックス    */
+
+    DEBUG_LOG_TRC( "%s() start.", __func__ );
+
+    /* 初期化 */
+    eax    = 0;
+    ebx    = 0;
+    ecx    = 0;
+    edx    = 0;
+    idx    = 0;
+    gpPage = ( volatile MkSharedPage_t * ) gPageArea;
+
+    /* 共有ページ初期化 */
+    MLibUtilSetMemory8( gPageArea, 0, MK_SHAREDPAGE_SIZE );
+    gpPage->taskId = MK_TASKID_NULL;
+    gpPage->pid    = MK_PID_NULL;
+    gpPage->tickHz = MK_CONFIG_TICK_HZ;
+
+    /* 割込み状態初期化 */
+    for ( idx = 0; idx < MK_SHAREDPAGE_INT_NUM; idx++ ) {
+        gpPage->intState[ idx ].taskId = MK_TASKID_NULL;
+    }
+
+    /* CPUID取得 */
+    IA32InstructionCpuid( 1, &eax, &ebx, &ecx, &edx );
+
+    /* TSCサポート判定 */
+    gTscExist = ( ( edx & IA32_CPUID_1_EDX_TSC ) != 0 );
+
+    DEBUG_LOG_TRC( "%s() end. tsc=%d", __func__, gTscExist );
+
+    return;
+}
+
+
+/******************************************************************************/
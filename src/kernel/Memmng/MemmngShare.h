@@ -0,0 +1,20 @@
+/******************************************************************************/
+/*                                                                            */
+/* src/kernel/Memmng/MemmngShare.h                                            */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2026 Mochi.                                                  */
+/*                                                                            */
+/******************************************************************************/
+#ifndef MEMMNG_SHARE_H
+#define MEMMNG_SHARE_H
+/******************************************************************************/
+/* モジュール内グローバル関数宣言                                             */
+/******************************************************************************/
+/* 共有ページ物理アドレス取得 */
+extern void *ShareGetPhysAddr( void );
+/* 共有ページ管理初期化 */
+extern void ShareInit( void );
+
+
+/******************************************************************************/
+#endif
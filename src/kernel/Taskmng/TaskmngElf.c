@@ -1,8 +1,8 @@
 /******************************************************************************/
 /*                                                                            */
 /* src/kernel/Taskmng/TaskmngElf.c                                            */
-/*                                                                 2024/08/10 */
-/* Copyright (C) 2017-2024 Mochi.                                             */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2017-2026 Mochi.                                             */
 /*                                                                            */
 /******************************************************************************/
 /******************************************************************************/
@@ -430,7 +430,7 @@ static CmnRet_t ElfCheckPrgHeader( void   *pAddr,
         /* 仮想メモリチェック */
         if ( ( pEntry->p_vaddr < MEMMAP_VADDR_USER              ) ||
              ( ( pEntry->p_vaddr + pEntry->p_memsz ) >
-               MEMMAP_VADDR_USER_STACK                          ) ||
+               MEMMAP_VADDR_USER_SHARED                         ) ||
              ( ( pEntry->p_vaddr % IA32_PAGING_PAGE_SIZE ) != 0 )    ) {
             /* 不正値 */
 
@@ -1,8 +1,8 @@
 /******************************************************************************/
 /*                                                                            */
 /* src/kernel/Taskmng/TaskmngName.c                                           */
-/*                                                                 2024/06/02 */
-/* Copyright (C) 2019-2024 Mochi.                                             */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2019-2026 Mochi.                                             */
 /*                                                                            */
 /******************************************************************************/
 /******************************************************************************/
@@ -54,7 +54,7 @@ static void doUnregister( MkTaskNameParam_t *pParam );
 static TaskNameEntry_t *GetUnusedEntry( void );
 /* 割込みハンドラ */
 static void HdlInt( uint32_t        intNo,
-                    IntmngContext_t context );
+                    IntmngContext_t *pContext );
 /* タスクID検索 */
 static TaskNameEntry_t *SearchTaskId( MkTaskId_t taskId );
 /* タスク名検索 */
@@ -361,17 +361,17 @@ static TaskNameEntry_t *GetUnusedEntry( void )
  * @brief       割込みハンドラ
  * @details     機能IDから該当する機能を呼び出す。
  *
- * @param[in]   intNo   割込み番号
- * @param[in]   context 割込み発生時コンテキスト
+ * @param[in]   intNo     割込み番号
+ * @param[in]   *pContext 割込み発生時コンテキスト
  */
 /******************************************************************************/
 static void HdlInt( uint32_t        intNo,
-                    IntmngContext_t context )
+                    IntmngContext_t *pContext )
 {
     MkTaskNameParam_t *pParam;  /* パラメータ */
 
     /* 初期化 */
-    pParam = ( MkTaskNameParam_t * ) context.genReg.esi;
+    pParam = ( MkTaskNameParam_t * ) pContext->genReg.esi;
 
     /* パラメータチェック */
     if ( pParam == NULL ) {
@@ -1,8 +1,8 @@
 /******************************************************************************/
 /*                                                                            */
 /* src/kernel/Taskmng/TaskmngProc.c                                           */
-/*                                                                 2024/08/10 */
-/* Copyright (C) 2018-2024 Mochi.                                             */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2018-2026 Mochi.                                             */
 /*                                                                            */
 /******************************************************************************/
 /******************************************************************************/
@@ -55,7 +55,7 @@ static ProcInfo_t *AllocProcInfo( uint8_t type );
 static void FreeProcInfo( ProcInfo_t *pProcInfo );
 /* 割込みハンドラ */
 static void HdlInt( uint32_t        intNo,
-                    IntmngContext_t context );
+                    IntmngContext_t *pContext );
 /* ブレイクポイント設定 */
 static void SetBreakPoint( MkProcParam_t *pParam );
 /* ユーザスタック情報設定 */
@@ -551,17 +551,17 @@ static void FreeProcInfo( ProcInfo_t *pProcInfo )
  * @brief       割込みハンドラ
  * @details     機能IDから該当する機能を呼び出す。
  *
- * @param[in]   intNo   割込み番号
- * @param[in]   context 割込み発生時コンテキスト
+ * @param[in]   intNo     割込み番号
+ * @param[in]   *pContext 割込み発生時コンテキスト
  */
 /******************************************************************************/
 static void HdlInt( uint32_t        intNo,
-                    IntmngContext_t context )
+                    IntmngContext_t *pContext )
 {
     MkProcParam_t *pParam;  /* パラメータ */
 
     /* 初期化 */
-    pParam = ( MkProcParam_t * ) context.genReg.esi;
+    pParam = ( MkProcParam_t * ) pContext->genReg.esi;
 
     /* パラメータチェック */
     if ( pParam == NULL ) {
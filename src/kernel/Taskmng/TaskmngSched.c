@@ -1,8 +1,8 @@
 /******************************************************************************/
 /*                                                                            */
 /* src/kernel/Taskmng/TaskmngSched.c                                          */
-/*                                                                 2024/06/18 */
-/* Copyright (C) 2017-2024 Mochi.                                             */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2017-2026 Mochi.                                             */
 /*                                                                            */
 /******************************************************************************/
 /******************************************************************************/
@@ -80,6 +80,9 @@ typedef struct {
     uint32_t       reservedGrpIdx;              /**< 予約タスクグループIDX   */
     schedRunGrp_t  runGrp[ SCHED_RUNGRP_NUM ];  /**< 実行可能タスクグループ  */
     schedWaitGrp_t waitGrp;                     /**< 待ちタスクグループ      */
+#ifdef INTMNG_STAT_ENABLE
+    uint64_t       switchTsc;                   /**< タスクスイッチ時TSC値   */
+#endif
 } schedTbl_t;
 
 
@@ -239,6 +242,22 @@ void TaskmngSchedExec( void )
 }
 
 
+#ifdef INTMNG_STAT_ENABLE
+/******************************************************************************/
+/**
+ * @brief       タスクスイッチ時TSC値取得
+ * @details     最後に実行中タスクへタスクスイッチした時のTSC値を取得する。
+ *
+ * @return      TSC値を返す。
+ */
+/******************************************************************************/
+uint64_t TaskmngSchedGetSwitchTsc( void )
+{
+    return gSchedTbl.switchTsc;
+}
+
+
+#endif
 /******************************************************************************/
 /**
  * @brief       タスクID取得
@@ -578,6 +597,9 @@ static __attribute__ ( ( noinline ) )
     /* カーネルスタック設定 */
     TssSetEsp0( ( uint32_t ) pKernelStack );
 
+    /* 共有ページ実行中タスク設定 */
+    MemmngShareSetTask( pNextTaskInfo->taskId, pNextProcInfo->pid );
+
     /* ページディレクトリ切替 */
     MemmngPageSwitchDir( pNextProcInfo->dirId );
 
@@ -586,6 +608,11 @@ static __attribute__ ( ( noinline ) )
     pRunContext->esp = IA32InstructionGetEsp();
     pRunContext->ebp = IA32InstructionGetEbp();
 
+#ifdef INTMNG_STAT_ENABLE
+    /* タスクスイッチ時TSC値設定 */
+    gSchedTbl.switchTsc = IA32InstructionRdtsc();
+#endif
+
     /* タスクスイッチ */
     __asm__ __volatile__ ( "mov eax, %0\n"
                            "mov ebx, %1\n"
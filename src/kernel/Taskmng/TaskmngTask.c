@@ -1,8 +1,8 @@
 /******************************************************************************/
 /*                                                                            */
 /* src/kernel/Taskmng/TaskmngTask.c                                           */
-/*                                                                 2024/06/18 */
-/* Copyright (C) 2017-2024 Mochi.                                             */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2017-2026 Mochi.                                             */
 /*                                                                            */
 /******************************************************************************/
 /******************************************************************************/
@@ -19,6 +19,7 @@
 #include <memmap.h>
 #include <hardware/IA32/IA32Instruction.h>
 #include <kernel/config.h>
+#include <kernel/syscall.h>
 #include <kernel/task.h>
 #include <kernel/types.h>
 
@@ -48,7 +49,10 @@
 static void DoGetId( MkTaskParam_t *pParam );
 /* 割込みハンドラ */
 static void HdlInt( uint32_t        intNo,
-                    IntmngContext_t context );
+                    IntmngContext_t *pContext );
+/* システムコールハンドラ */
+static void HdlSys( uint32_t     no,
+                    IA32Pushad_t *pReg );
 /* タスク起動 */
 static void Start( void );
 /* 複製タスク開始ポイント */
@@ -351,6 +355,9 @@ void TaskInit( void )
                   HdlInt,                   /* 割込みハンドラ */
                   IA32_DESCRIPTOR_DPL_3 );  /* 特権レベル     */
 
+    /* システムコールハンドラ設定 */
+    IntmngSysSet( MK_SYSCALL_TASK_GET_ID, HdlSys );
+
     DEBUG_LOG_TRC( "%s() end.", __func__ );
 
     return;
@@ -386,17 +393,17 @@ static void DoGetId( MkTaskParam_t *pParam )
  * @brief       割込みハンドラ
  * @details     機能IDから該当する機能を呼び出す。
  *
- * @param[in]   intNo   割込み番号
- * @param[in]   context 割込み発生時コンテキスト
+ * @param[in]   intNo     割込み番号
+ * @param[in]   *pContext 割込み発生時コンテキスト
  */
 /******************************************************************************/
 static void HdlInt( uint32_t        intNo,
-                    IntmngContext_t context )
+                    IntmngContext_t *pContext )
 {
     MkTaskParam_t *pParam;  /* パラメータ */
 
     /* 初期化 */
-    pParam = ( MkTaskParam_t * ) context.genReg.esi;
+    pParam = ( MkTaskParam_t * ) pContext->genReg.esi;
 
     DEBUG_LOG_TRC( "%s(): start. pParam=%p", __func__, pParam );
 
@@ -434,6 +441,39 @@ static void HdlInt( uint32_t        intNo,
 }
 
 
+/******************************************************************************/
+/**
+ * @brief           システムコールハンドラ
+ * @details         レジスタ渡し形式のタスクID取得システムコールを処理する。
+ *                  - 出力: ESI=タスクID
+ *
+ * @param[in]       no    システムコール番号
+ * @param[in,out]   *pReg 汎用レジスタ
+ */
+/******************************************************************************/
+static void HdlSys( uint32_t     no,
+                    IA32Pushad_t *pReg )
+{
+    MkTaskParam_t param;    /* パラメータ */
+
+    /* パラメータ初期化 */
+    param.funcId = MK_TASK_FUNCID_GET_ID;
+    param.ret    = MK_RET_FAILURE;
+    param.err    = MK_ERR_NONE;
+    param.taskId = MK_TASKID_NULL;
+
+    /* タスクID取得 */
+    DoGetId( &param );
+
+    /* 戻り値設定 */
+    pReg->eax = param.ret;
+    pReg->ebx = param.err;
+    pReg->esi = param.taskId;
+
+    return;
+}
+
+
 /******************************************************************************/
 /**
  * @brief       カーネルスタック設定
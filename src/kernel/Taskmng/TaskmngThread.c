@@ -1,8 +1,8 @@
 /******************************************************************************/
 /*                                                                            */
 /* src/kernel/Taskmng/TaskmngThread.c                                         */
-/*                                                                 2024/06/16 */
-/* Copyright (C) 2019-2024 Mochi.                                             */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2019-2026 Mochi.                                             */
 /*                                                                            */
 /******************************************************************************/
 /******************************************************************************/
@@ -57,7 +57,7 @@ static ThreadInfo_t *AllocThreadInfo( ProcInfo_t *pProcInfo );
 static void DoCreate( MkThreadParam_t *pParam );
 /* 割込みハンドラ */
 static void HdlInt( uint32_t        intNo,
-                    IntmngContext_t context );
+                    IntmngContext_t *pContext );
 
 
 /******************************************************************************/
@@ -468,17 +468,17 @@ static void DoCreate( MkThreadParam_t *pParam )
  * @brief       割込みハンドラ
  * @details     機能IDから該当する機能を呼び出す。
  *
- * @param[in]   intNo   割込み番号
- * @param[in]   context 割込み発生時コンテキスト
+ * @param[in]   intNo     割込み番号
+ * @param[in]   *pContext 割込み発生時コンテキスト
  */
 /******************************************************************************/
 static void HdlInt( uint32_t        intNo,
-                    IntmngContext_t context )
+                    IntmngContext_t *pContext )
 {
     MkThreadParam_t *pParam;    /* パラメータ */
 
     /* 初期化 */
-    pParam = ( MkThreadParam_t * ) context.genReg.esi;
+    pParam = ( MkThreadParam_t * ) pContext->genReg.esi;
 
     DEBUG_LOG_TRC( "%s(): start. pParam=%p", __func__, pParam );
 
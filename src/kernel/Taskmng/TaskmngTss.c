@@ -1,8 +1,8 @@
 /******************************************************************************/
 /*                                                                            */
 /* src/kernel/Taskmng/TaskmngTss.c                                            */
-/*                                                                 2024/06/16 */
-/* Copyright (C) 2017-2024 Mochi.                                             */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2017-2026 Mochi.                                             */
 /*                                                                            */
 /******************************************************************************/
 /******************************************************************************/
@@ -40,6 +40,25 @@
 static IA32Tss_t gTss;
 
 
+/******************************************************************************/
+/* グローバル関数定義                                                         */
+/******************************************************************************/
+/******************************************************************************/
+/**
+ * @brief       ESP0格納先アドレス取得
+ * @details     TSSのESP0フィールドのアドレスを取得する。ESP0フィールドはタス
+ *              ク切替え毎に実行中タスクのカーネルスタックに更新される為、
+ *              SYSENTER命令の入口はこのアドレスからカーネルスタックを取得する。
+ *
+ * @return      ESP0フィールドのアドレスを返す。
+ */
+/******************************************************************************/
+uint32_t *TaskmngTssGetEsp0Addr( void )
+{
+    return &( gTss.esp0 );
+}
+
+
 /******************************************************************************/
 /* モジュール内グローバル関数定義                                             */
 /******************************************************************************/
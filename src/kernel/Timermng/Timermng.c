@@ -1,8 +1,8 @@
 /******************************************************************************/
 /*                                                                            */
 /* src/kernel/Timermng/Timermng.c                                             */
-/*                                                                 2024/06/16 */
-/* Copyright (C) 2016-2024 Mochi.                                             */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2016-2026 Mochi.                                             */
 /*                                                                            */
 /******************************************************************************/
 /******************************************************************************/
@@ -16,7 +16,9 @@
 #include <Debug.h>
 
 /* 内部モジュールヘッダ */
+#include "TimermngClock.h"
 #include "TimermngCtrl.h"
+#include "TimermngLapic.h"
 #include "TimermngPit.h"
 
 
@@ -46,6 +48,12 @@ void TimermngInit( void )
     /* PIT管理サブモジュール初期化 */
     TimermngPitInit();
 
+    /* 時刻管理サブモジュール初期化 */
+    TimermngClockInit();
+
+    /* LAPICタイマ管理サブモジュール初期化 */
+    TimermngLapicInit();
+
     DEBUG_LOG_TRC( "%s() end.", __func__ );
 
     return;
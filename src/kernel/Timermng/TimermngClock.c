@@ -0,0 +1,419 @@
+/******************************************************************************/
+/*                                                                            */
+/* src/kernel/Timermng/TimermngClock.c                                        */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2026 Mochi.                                                  */
+/*                                                                            */
+/******************************************************************************/
+/******************************************************************************/
+/* インクルード                                                               */
+/******************************************************************************/
+/* 標準ヘッダ */
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+/* 共通ヘッダ */
+#include <hardware/I8254/I8254.h>
+#include <hardware/IA32/IA32.h>
+#include <hardware/IA32/IA32Instruction.h>
+#include <hardware/MC146818/MC146818.h>
+
+/* 外部モジュールヘッダ */
+#include <Cmn.h>
+#include <Debug.h>
+#include <Memmng.h>
+
+/* 内部モジュールヘッダ */
+#include "TimermngClock.h"
+
+
+/******************************************************************************/
+/* 定義                                                                       */
+/******************************************************************************/
+/* モジュールID */
+#define _MODULE_ID_ CMN_MODULE_TIMERMNG_CLOCK
+
+/** 校正時間[us] */
+#define CALIB_USEC   ( 50000 )
+
+/** 校正用PIT（カウンタ2）カウンタ設定値 */
+#define CALIB_CYCLE  ( I8254_CLOCK / ( 1000000 / CALIB_USEC ) )
+
+/** 1秒当たりのナノ秒数 */
+#define NSEC_PER_SEC ( 1000000000ULL )
+
+/** 1日当たりの秒数 */
+#define SEC_PER_DAY  ( 86400 )
+
+/** RTC年レジスタ基準年 */
+#define RTC_BASE_YEAR ( 2000 )
+
+/** RTC時刻型 */
+typedef struct {
+    uint8_t sec;        /**< 秒 */
+    uint8_t min;        /**< 分 */
+    uint8_t hour;       /**< 時 */
+    uint8_t day;        /**< 日 */
+    uint8_t month;      /**< 月 */
+    uint8_t year;       /**< 年 */
+} rtcTime_t;
+
+
+/******************************************************************************/
+/* ローカル関数宣言                                                           */
+/******************************************************************************/
+/* TSC校正 */
+static uint64_t Calibrate( void );
+
+/* 経過日数計算 */
+static uint32_t GetDays( uint32_t year,
+                         uint32_t month,
+                         uint32_t day    );
+
+/* RTC時刻取得 */
+static uint64_t GetRtcSec( void );
+
+/* RTCレジスタ読込み */
+static uint8_t ReadRtc( uint8_t reg );
+
+/* RTC時刻読込み */
+static void ReadRtcTime( rtcTime_t *pTime );
+
+
+/******************************************************************************/
+/* 変数定義                                                                   */
+/******************************************************************************/
+/** TSC周波数[Hz](0:無効) */
+static uint64_t gTscHz;
+
+/** 単調増加時刻0時TSC値 */
+static uint64_t gTscBase;
+
+
+/******************************************************************************/
+/* グローバル関数定義                                                         */
+/******************************************************************************/
+/******************************************************************************/
+/**
+ * @brief       単調増加時刻取得
+ * @details     時刻管理初期化時を0とする単調増加時刻をTSCから計算する。TSCが
+ *              無効な場合は0を返す。
+ *
+ * @return      単調増加時刻[ns]を返す。
+ */
+/******************************************************************************/
+uint64_t TimermngClockGetNsec( void )
+{
+    uint64_t tsc;   /* TSC増分 */
+
+    /* 初期化 */
+    tsc = 0;
+
+    /* TSC有効判定 */
+    if ( gTscHz == 0 ) {
+        /* 無効 */
+
+        return 0;
+    }
+
+    /* TSC増分取得 */
+    tsc = IA32InstructionRdtsc() - gTscBase;
+
+    return ( tsc / gTscHz ) * NSEC_PER_SEC +
+           ( ( tsc % gTscHz ) * NSEC_PER_SEC ) / gTscHz;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       TSC周波数取得
+ * @details     起動時にPITで校正したTSC周波数を取得する。
+ *
+ * @return      TSC周波数[Hz]を返す。
+ * @retval      0     TSC無効
+ * @retval      0以外 TSC周波数[Hz]
+ */
+/******************************************************************************/
+uint64_t TimermngClockGetTscHz( void )
+{
+    return gTscHz;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       時刻管理初期化
+ * @details     TSCが使用可能な場合はPITでTSC周波数を校正し、RTCから実時刻を
+ *              読み込んで、単調増加時刻と実時刻の基準値を共有ページに設定す
+ *              る。RTCはUTCで、秒単位の精度とする。
+ */
+/******************************************************************************/
+void TimermngClockInit( void )
+{
+    uint32_t eax;       /* CPUID結果EAX          */
+    uint32_t ebx;       /* CPUID結果EBX          */
+    uint32_t ecx;       /* CPUID結果ECX          */
+    uint32_t edx;       /* CPUID結果EDX          */
+    uint64_t sec;       /* 実時刻[s]             */
+    uint64_t tscBase;   /* 単調増加時刻0時TSC値  */
+
+    /* 初期化 */
+    eax      = 0;
+    ebx      = 0;
+    ecx      = 0;
+    edx      = 0;
+    sec      = 0;
+    tscBase  = 0;
+    gTscHz   = 0;
+    gTscBase = 0;
+
+    DEBUG_LOG_TRC( "%s() start.", __func__ );
+
+    /* CPUID取得 */
+    IA32InstructionCpuid( 1, &eax, &ebx, &ecx, &edx );
+
+    /* TSC実装判定 */
+    if ( ( edx & IA32_CPUID_1_EDX_TSC ) != 0 ) {
+        /* 実装 */
+
+        /* TSC校正 */
+        gTscHz = Calibrate() * ( 1000000 / CALIB_USEC );
+    }
+
+    /* RTC時刻取得 */
+    sec = GetRtcSec();
+
+    /* TSC有効判定 */
+    if ( gTscHz != 0 ) {
+        /* 有効 */
+
+        tscBase  = IA32InstructionRdtsc();
+        gTscBase = tscBase;
+    }
+
+    /* 共有ページ時刻情報設定 */
+    MemmngShareSetClock( gTscHz, tscBase, sec * NSEC_PER_SEC );
+
+    DEBUG_LOG_INF(
+        "clock: tscHz=%u realSec=%u",
+        ( uint32_t ) gTscHz,
+        ( uint32_t ) sec
+    );
+
+    DEBUG_LOG_TRC( "%s() end.", __func__ );
+
+    return;
+}
+
+
+/******************************************************************************/
+/* ローカル関数定義                                                           */
+/******************************************************************************/
+/******************************************************************************/
+/**
+ * @brief       TSC校正
+ * @details     PIT（カウンタ2）をモード0でCALIB_USEC間カウントさせ、その間の
+ *              TSC増分を計測する。
+ *
+ * @return      CALIB_USEC間のTSC増分を返す。
+ */
+/******************************************************************************/
+static uint64_t Calibrate( void )
+{
+    uint8_t  value; /* ポート値  */
+    uint64_t tsc;   /* 開始TSC値 */
+
+    /* 初期化 */
+    value = 0;
+    tsc   = 0;
+
+    /* カウンタ2ゲート有効化(スピーカ出力無効) */
+    IA32InstructionInByte( &value, I8254_PORT_NMISC );
+    value = ( value & ~I8254_NMISC_SPKR ) | I8254_NMISC_GATE2;
+    IA32InstructionOutByte( I8254_PORT_NMISC, value );
+
+    /* PIT（カウンタ2）設定 */
+    IA32InstructionOutByte( I8254_PORT_CTRLW,
+                            ( I8254_CTRLW_SC_CNTR2 |
+                              I8254_CTRLW_RW_BOTH  |
+                              I8254_CTRLW_M_MODE0  |
+                              I8254_CTRLW_BCD_BIN    ) );
+    IA32InstructionOutByte( I8254_PORT_CNTR2, I8254_CNTR_LOW(  CALIB_CYCLE ) );
+
+    /* 計測開始 */
+    tsc = IA32InstructionRdtsc();
+    IA32InstructionOutByte( I8254_PORT_CNTR2, I8254_CNTR_HIGH( CALIB_CYCLE ) );
+
+    /* カウンタ2出力待ち */
+    do {
+        IA32InstructionInByte( &value, I8254_PORT_NMISC );
+    } while ( ( value & I8254_NMISC_OUT2 ) == 0 );
+
+    return IA32InstructionRdtsc() - tsc;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       経過日数計算
+ * @details     1970年1月1日から指定した日付までの経過日数を計算する。
+ *
+ * @param[in]   year  年(1970以上)
+ * @param[in]   month 月(1-12)
+ * @param[in]   day   日(1-31)
+ *
+ * @return      経過日数を返す。
+ */
+/******************************************************************************/
+static uint32_t GetDays( uint32_t year,
+                         uint32_t month,
+                         uint32_t day    )
+{
+    uint32_t era;   /* 400年周期       */
+    uint32_t yoe;   /* 周期内年        */
+    uint32_t doy;   /* 3月起点年内日数 */
+    uint32_t doe;   /* 周期内日数      */
+
+    /* 3月起点の年に変換 */
+    if ( month <= 2 ) {
+        year--;
+    }
+
+    /* 初期化 */
+    era = year / 400;
+    yoe = year - era * 400;
+    doy = ( 153 * ( ( month > 2 ) ? ( month - 3 ) : ( month + 9 ) ) + 2 ) / 5 +
+          day - 1;
+    doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+
+    /* 0000年3月1日から1970年1月1日までの日数を減算 */
+    return era * 146097 + doe - 719468;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       RTC時刻取得
+ * @details     RTCの時刻を読み込み、1970年1月1日からの経過秒数に変換する。更
+ *              新中の値を読まない様、同じ値を2回連続で読み込むまで繰り返す。
+ *
+ * @return      経過秒数を返す。
+ */
+/******************************************************************************/
+static uint64_t GetRtcSec( void )
+{
+    bool      pm;       /* PMフラグ             */
+    uint8_t   regB;     /* ステータスレジスタB  */
+    rtcTime_t time;     /* RTC時刻              */
+    rtcTime_t prev;     /* 前回RTC時刻          */
+
+    /* 初期化 */
+    pm   = false;
+    regB = 0;
+
+    /* RTC時刻読込み */
+    ReadRtcTime( &time );
+
+    /* 一致するまで繰り返し */
+    do {
+        prev = time;
+        ReadRtcTime( &time );
+    } while ( ( time.sec   != prev.sec   ) ||
+              ( time.min   != prev.min   ) ||
+              ( time.hour  != prev.hour  ) ||
+              ( time.day   != prev.day   ) ||
+              ( time.month != prev.month ) ||
+              ( time.year  != prev.year  )    );
+
+    /* ステータスレジスタB読込み */
+    regB = ReadRtc( MC146818_REG_B );
+
+    /* PMフラグ取得 */
+    pm         = ( ( time.hour & MC146818_HOUR_PM ) != 0 );
+    time.hour &= ~MC146818_HOUR_PM;
+
+    /* 形式判定 */
+    if ( ( regB & MC146818_B_DM ) == 0 ) {
+        /* BCD形式 */
+
+        time.sec   = MC146818_BCD_TO_BIN( time.sec   );
+        time.min   = MC146818_BCD_TO_BIN( time.min   );
+        time.hour  = MC146818_BCD_TO_BIN( time.hour  );
+        time.day   = MC146818_BCD_TO_BIN( time.day   );
+        time.month = MC146818_BCD_TO_BIN( time.month );
+        time.year  = MC146818_BCD_TO_BIN( time.year  );
+    }
+
+    /* 時間表記判定 */
+    if ( ( regB & MC146818_B_24H ) == 0 ) {
+        /* 12時間表記 */
+
+        time.hour %= 12;
+
+        /* PM判定 */
+        if ( pm != false ) {
+            /* PM */
+
+            time.hour += 12;
+        }
+    }
+
+    return ( uint64_t ) GetDays( RTC_BASE_YEAR + time.year,
+                                 time.month,
+                                 time.day                   ) * SEC_PER_DAY +
+           time.hour * 3600 + time.min * 60 + time.sec;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       RTCレジスタ読込み
+ * @details     指定したRTCレジスタの値を読み込む。
+ *
+ * @param[in]   reg レジスタ番号
+ *
+ * @return      レジスタ値を返す。
+ */
+/******************************************************************************/
+static uint8_t ReadRtc( uint8_t reg )
+{
+    uint8_t value;  /* レジスタ値 */
+
+    /* 初期化 */
+    value = 0;
+
+    /* レジスタ読込み */
+    IA32InstructionOutByte( MC146818_PORT_INDEX, reg );
+    IA32InstructionInByte( &value, MC146818_PORT_DATA );
+
+    return value;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       RTC時刻読込み
+ * @details     RTCの更新完了を待ってから時刻レジスタを読み込む。
+ *
+ * @param[out]  *pTime RTC時刻
+ */
+/******************************************************************************/
+static void ReadRtcTime( rtcTime_t *pTime )
+{
+    /* 更新完了待ち */
+    while ( ( ReadRtc( MC146818_REG_A ) & MC146818_A_UIP ) != 0 );
+
+    /* 時刻レジスタ読込み */
+    pTime->sec   = ReadRtc( MC146818_REG_SEC   );
+    pTime->min   = ReadRtc( MC146818_REG_MIN   );
+    pTime->hour  = ReadRtc( MC146818_REG_HOUR  );
+    pTime->day   = ReadRtc( MC146818_REG_DAY   );
+    pTime->month = ReadRtc( MC146818_REG_MONTH );
+    pTime->year  = ReadRtc( MC146818_REG_YEAR  );
+
+    return;
+}
+
+
+/******************************************************************************/
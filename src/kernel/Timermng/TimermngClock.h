@@ -0,0 +1,31 @@
+/******************************************************************************/
+/*                                                                            */
+/* src/kernel/Timermng/TimermngClock.h                                        */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2026 Mochi.                                                  */
+/*                                                                            */
+/******************************************************************************/
+#ifndef TIMERMNG_CLOCK_H
+#define TIMERMNG_CLOCK_H
+/******************************************************************************/
+/* インクルード                                                               */
+/******************************************************************************/
+/* 標準ヘッダ */
+#include <stdint.h>
+
+
+/******************************************************************************/
+/* グローバル関数プロトタイプ宣言                                             */
+/******************************************************************************/
+/* 単調増加時刻取得 */
+extern uint64_t TimermngClockGetNsec( void );
+
+/* TSC周波数取得 */
+extern uint64_t TimermngClockGetTscHz( void );
+
+/* 時刻管理初期化 */
+extern void TimermngClockInit( void );
+
+
+/******************************************************************************/
+#endif
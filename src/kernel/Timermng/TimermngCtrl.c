@@ -1,8 +1,8 @@
 /******************************************************************************/
 /*                                                                            */
 /* src/kernel/Timermng/TimermngCtrl.c                                         */
-/*                                                                 2024/06/16 */
-/* Copyright (C) 2018-2024 Mochi.                                             */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2018-2026 Mochi.                                             */
 /*                                                                            */
 /******************************************************************************/
 /******************************************************************************/
@@ -14,19 +14,32 @@
 #include <stdint.h>
 
 /* ライブラリヘッダ */
+#include <MLib/MLibDynamicArray.h>
 #include <MLib/MLibList.h>
+#include <MLib/MLibUtil.h>
 
 /* カーネルヘッダ */
 #include <kernel/config.h>
+#include <kernel/syscall.h>
+#include <kernel/sysstat.h>
 #include <kernel/timer.h>
 
+/* 共通ヘッダ */
+#include <hardware/IA32/IA32Instruction.h>
+
 /* 外部モジュールヘッダ */
 #include <Cmn.h>
 #include <Debug.h>
 #include <Intmng.h>
+#include <Itcctrl.h>
 #include <Taskmng.h>
 #include <Timermng.h>
 
+/* 内部モジュールヘッダ */
+#include "TimermngClock.h"
+#include "TimermngCtrl.h"
+#include "TimermngLapic.h"
+
 
 /******************************************************************************/
 /* 定義                                                                       */
@@ -34,28 +47,104 @@
 /* モジュール */
 #define _MODULE_ID_ CMN_MODULE_TIMERMNG_CTRL
 
+/** tick当たりマイクロ秒 */
+#define USEC_PER_TICK ( 1000000 / MK_CONFIG_TICK_HZ )
+
+/** tick当たりナノ秒 */
+#define NSEC_PER_TICK ( 1000000000ULL / MK_CONFIG_TICK_HZ )
+
+/** マイクロ秒当たりナノ秒 */
+#define NSEC_PER_USEC ( 1000 )
+
+/** タイマ情報テーブルチャンクサイズ */
+#define TIMERTBL_CHUNK_SIZE ( 256 )
+
+/* タイマホイール定義 */
+#define WHEEL_BITS      ( 6 )                       /**< 階層毎ビット数 */
+#define WHEEL_SLOT_NUM  ( 1 << WHEEL_BITS )         /**< 階層毎スロット数 */
+#define WHEEL_SLOT_MASK ( WHEEL_SLOT_NUM - 1 )      /**< スロットマスク */
+#define WHEEL_LEVEL_NUM ( 4 )                       /**< 階層数         */
+#define WHEEL_RANGE     \
+    ( ( uint64_t ) 1 << ( WHEEL_BITS * WHEEL_LEVEL_NUM ) ) /**< 全階層範囲 */
+
+/** 階層範囲 */
+#define WHEEL_LEVEL_RANGE( _LEVEL ) \
+    ( ( uint64_t ) 1 << ( WHEEL_BITS * ( ( _LEVEL ) + 1 ) ) )
+
+/** tick切り上げ */
+#define TICK_CEIL( _USEC )                                  \
+    ( ( ( _USEC ) / USEC_PER_TICK ) +                       \
+      ( ( ( ( _USEC ) % USEC_PER_TICK ) != 0 ) ? 1 : 0 )    )
+
+/** スロットインデックス */
+#define WHEEL_SLOT( _TICK, _LEVEL ) \
+    ( ( uint32_t ) ( ( _TICK ) >> ( WHEEL_BITS * ( _LEVEL ) ) ) & \
+      WHEEL_SLOT_MASK                                              )
+
 /** タイマ情報型 */
 typedef struct {
-    MLibListNode_t listInfo;    /**< リンクリスト情報     */
-    uint32_t       timerId;     /**< タイマID             */
-    uint32_t       remain;      /**< 残タイマ値           */
-    uint32_t       tick;        /**< 設定タイマ値         */
-    uint32_t       type;        /**< タイマ種別           */
-    TimermngFunc_t pFunc;       /**< コールバック関数     */
-    void           *pArg;       /**< コールバック関数引数 */
-    MkTaskId_t     taskId;      /**< タスクID             */
+    MLibListNode_t listInfo;    /**< リンクリスト情報       */
+    MLibList_t     *pList;      /**< 挿入先リスト           */
+    uint32_t       timerId;     /**< タイマID               */
+    uint32_t       usec;        /**< 設定時間[us]           */
+    uint32_t       slack;       /**< スラック[us]           */
+    uint32_t       skip;        /**< 満了見逃し回数         */
+    uint64_t       expire;      /**< 満了tick               */
+    uint64_t       wheel;       /**< タイマホイール挿入tick */
+    uint64_t       deadline;    /**< 満了TSC値              */
+    uint64_t       latest;      /**< 満了TSC値上限          */
+    uint32_t       type;        /**< タイマ種別             */
+    TimermngFunc_t pFunc;       /**< コールバック関数       */
+    void           *pArg;       /**< コールバック関数引数   */
+    MkTaskId_t     taskId;      /**< タスクID               */
 } TimerInfo_t;
 
 
 /******************************************************************************/
 /* ローカル関数宣言                                                           */
 /******************************************************************************/
+/* タイマホイール挿入 */
+static void Add( TimerInfo_t *pTimerInfo );
+
+/* 高分解能タイマ情報リスト挿入 */
+static void AddHres( TimerInfo_t *pTimerInfo );
+
+/* スラック適用 */
+static uint64_t ApplySlack( uint64_t expire,
+                            uint64_t latest  );
+
+/* タイマ設定 */
+static void Arm( TimerInfo_t *pTimerInfo );
+
+/* LAPICタイマ再設定 */
+static void ArmHres( void );
+
+/* タイマホイール繰り下げ */
+static void Cascade( uint32_t level,
+                     uint32_t slot   );
+
+/* 満了タイマ処理 */
+static void Expire( void );
+
+/* タイマ情報解放 */
+static void Free( TimerInfo_t *pTimerInfo );
+
+/* タイマ情報取得 */
+static TimerInfo_t *GetInfo( uint32_t timerId );
+
 /* 割込みハンドラ */
 static void HdlInt( uint32_t        intNo,
-                    IntmngContext_t context );
+                    IntmngContext_t *pContext );
+
+/* システムコールハンドラ */
+static void HdlSys( uint32_t     no,
+                    IA32Pushad_t *pReg );
 
-/* 使用中タイマ情報リスト設定 */
-static void Set( TimerInfo_t *pTimerInfo );
+/* 高分解能タイマ満了判定 */
+static void RunHres( uint64_t now );
+
+/* タスクスラック設定 */
+static void SetSlack( MkTimerParam_t *pParam );
 
 /* スリープ */
 static void Sleep( MkTimerParam_t *pParam );
@@ -64,26 +153,81 @@ static void Sleep( MkTimerParam_t *pParam );
 static void SleepTimeout( uint32_t timerId,
                           void     *pArg    );
 
-/* 未使用タイマ情報リスト設定 */
-static void Unset( TimerInfo_t *pTimerInfo );
+/* 時刻指定スリープ */
+static void SleepUntil( MkTimerParam_t *pParam );
+
+/* ユーザタイマ開始 */
+static void Start( MkTimerParam_t *pParam );
+
+/* ユーザタイマ停止 */
+static void Stop( MkTimerParam_t *pParam );
+
+/* ユーザタイマ満了(メッセージ) */
+static void UserTimeoutMsg( uint32_t timerId,
+                            void     *pArg    );
+
+/* ユーザタイマ満了(通知) */
+static void UserTimeoutNtf( uint32_t timerId,
+                            void     *pArg    );
 
 
 /******************************************************************************/
 /* グローバル変数宣言                                                         */
 /******************************************************************************/
-/** 未使用タイマ情報リスト */
-static MLibList_t gUnusedList;
+/** タイマ情報テーブル */
+static MLibDynamicArray_t gTimerTbl;
 
-/** 使用中タイマ情報リスト */
-static MLibList_t gUsedList;
+/** タイマホイール */
+static MLibList_t gWheel[ WHEEL_LEVEL_NUM ][ WHEEL_SLOT_NUM ];
 
-/** タイマ情報テーブル */
-static TimerInfo_t gTimerInfoTbl[ TIMERMNG_TIMERID_NUM ];
+/** 高分解能タイマ情報リスト */
+static MLibList_t gHresList;
+
+/** 満了タイマ情報リスト */
+static MLibList_t gExpiredList;
+
+/** 次処理tick */
+static uint64_t gNow;
+
+/** プロセスタイプ毎スラック初期値[us] */
+static const uint32_t gSlackTbl[ TASKMNG_PROC_TYPE_USER + 1 ] = {
+    0,                                  /* カーネル */
+    MK_CONFIG_TIMER_SLACK_DRIVER,       /* ドライバ */
+    MK_CONFIG_TIMER_SLACK_SERVER,       /* サーバ   */
+    MK_CONFIG_TIMER_SLACK_USER          /* ユーザ   */
+};
+
+/** タスク毎スラック[us] */
+static uint32_t gTaskSlackTbl[ MK_TASKID_NUM ];
+
+#ifdef INTMNG_STAT_ENABLE
+/** タイマ合体統計 */
+static MkTimerStat_t gStat;
+#endif
 
 
 /******************************************************************************/
 /* モジュール外向けグローバル関数定義                                         */
 /******************************************************************************/
+#ifdef INTMNG_STAT_ENABLE
+/******************************************************************************/
+/**
+ * @brief       タイマ合体統計取得
+ * @details     タイマ合体統計をコピーする。
+ *
+ * @param[out]  *pStat 統計格納先
+ */
+/******************************************************************************/
+void TimermngCtrlGetStat( MkTimerStat_t *pStat )
+{
+    /* 統計コピー */
+    MLibUtilCopyMemory( pStat, &gStat, sizeof ( MkTimerStat_t ) );
+
+    return;
+}
+#endif
+
+
 /******************************************************************************/
 /**
  * @brief       タスクID取得
@@ -92,20 +236,38 @@ static TimerInfo_t gTimerInfoTbl[ TIMERMNG_TIMERID_NUM ];
  * @param[in]   timerId タイマID
  *
  * @return      タスクIDを返す。
+ * @retval      MK_TASKID_NULL     タイマ未設定
+ * @retval      MK_TASKID_NULL以外 タスクID
  */
 /******************************************************************************/
 MkTaskId_t TimermngCtrlGetTaskId( uint32_t timerId )
 {
-    return gTimerInfoTbl[ timerId ].taskId;
+    TimerInfo_t *pTimerInfo;    /* タイマ情報 */
+
+    /* タイマ情報取得 */
+    pTimerInfo = GetInfo( timerId );
+
+    /* 取得結果判定 */
+    if ( pTimerInfo == NULL ) {
+        /* 失敗 */
+
+        return MK_TASKID_NULL;
+    }
+
+    return pTimerInfo->taskId;
 }
 
 
 /******************************************************************************/
 /**
  * @brief       タイマ設定
- * @details     指定したタイマ値でタイマを設定する。
+ * @details     指定した時間でタイマを設定する。高分解能タイマが有効な場合は
+ *              マイクロ秒単位で満了し、無効な場合はtick単位に切り上げて満了す
+ *              る。スラックは設定したタスクがシステムコールで指定した値、未指
+ *              定の場合はプロセスタイプ毎の初期値とし、満了はスラックの範囲内
+ *              で他のタイマの満了とまとめる事がある。
  *
- * @param[in]   tick  タイマ値
+ * @param[in]   usec  時間[us]
  * @param[in]   type  タイマ種別
  *                  - TIMERMNG_TYPE_ONESHOT ワンショットタイマ
  *                  - TIMERMNG_TYPE_REPEAT  繰り返しタイマ
@@ -117,12 +279,29 @@ MkTaskId_t TimermngCtrlGetTaskId( uint32_t timerId )
  * @retval      TIMERMNG_TIMERID_NULL以外 タイマ設定成功(タイマID)
  */
 /******************************************************************************/
-uint32_t TimermngCtrlSet( uint32_t       tick,
+uint32_t TimermngCtrlSet( uint32_t       usec,
                           uint32_t       type,
                           TimermngFunc_t pFunc,
                           void           *pArg  )
 {
-    TimerInfo_t *pTimerInfo;
+    uint8_t     procType;       /* プロセスタイプ          */
+    uint32_t    slack;          /* スラック[us]            */
+    uint32_t    timerId;        /* タイマID                */
+    uint32_t    tscPerUsec;     /* マイクロ秒当たりTSC増分 */
+    MkTaskId_t  taskId;         /* タスクID                */
+    MLibErr_t   errMLib;        /* MLIBエラー要因          */
+    MLibRet_t   retMLib;        /* MLIB戻り値              */
+    TimerInfo_t *pTimerInfo;    /* タイマ情報              */
+
+    /* 初期化 */
+    procType   = TASKMNG_PROC_TYPE_KERNEL;
+    slack      = 0;
+    timerId    = TIMERMNG_TIMERID_NULL;
+    tscPerUsec = TimermngLapicGetTscPerUsec();
+    taskId     = TaskmngSchedGetTaskId();
+    errMLib    = MLIB_ERR_NONE;
+    retMLib    = MLIB_RET_FAILURE;
+    pTimerInfo = NULL;
 
     /* タイマ種別チェック */
     if ( ( type != TIMERMNG_TYPE_ONESHOT ) &&
@@ -139,77 +318,175 @@ uint32_t TimermngCtrlSet( uint32_t       tick,
         return TIMERMNG_TIMERID_NULL;
     }
 
-    /* 未使用タイマ情報取得 */
-    pTimerInfo = ( TimerInfo_t * ) MLibListRemoveTail( &gUnusedList );
+    /* 繰り返し周期判定 */
+    if ( ( type == TIMERMNG_TYPE_REPEAT ) && ( usec == 0 ) ) {
+        /* 周期無し */
 
-    /* 取得結果判定 */
-    if ( pTimerInfo == NULL ) {
+        /* 1tick周期 */
+        usec = USEC_PER_TICK;
+    }
+
+    /* タイマ情報割当 */
+    retMLib = MLibDynamicArrayAlloc( &gTimerTbl,
+                                     ( uint_t *  ) &timerId,
+                                     ( void   ** ) &pTimerInfo,
+                                     &errMLib                   );
+
+    /* 割当結果判定 */
+    if ( retMLib != MLIB_RET_SUCCESS ) {
         /* 失敗 */
 
         return TIMERMNG_TIMERID_NULL;
     }
 
+    /* プロセスタイプ取得 */
+    procType = TaskmngTaskGetType( taskId );
+
+    /* プロセスタイプ判定 */
+    if ( procType > TASKMNG_PROC_TYPE_USER ) {
+        /* 範囲外 */
+
+        procType = TASKMNG_PROC_TYPE_USER;
+    }
+
+    /* スラック取得 */
+    slack = gTaskSlackTbl[ taskId ];
+
+    /* スラック判定 */
+    if ( slack == MK_TIMER_SLACK_DEFAULT ) {
+        /* 未指定 */
+
+        slack = gSlackTbl[ procType ];
+    }
+
     /* タイマ情報設定 */
-    pTimerInfo->remain = tick;
-    pTimerInfo->tick   = tick;
-    pTimerInfo->type   = type;
-    pTimerInfo->pFunc  = pFunc;
-    pTimerInfo->pArg   = pArg;
-    pTimerInfo->taskId = TaskmngSchedGetTaskId();
+    pTimerInfo->pList    = NULL;
+    pTimerInfo->timerId  = timerId;
+    pTimerInfo->usec     = usec;
+    pTimerInfo->slack    = slack;
+    pTimerInfo->skip     = 0;
+    pTimerInfo->expire   = gNow + TICK_CEIL( usec );
+    pTimerInfo->wheel    = pTimerInfo->expire;
+    pTimerInfo->deadline = IA32InstructionRdtsc() +
+                           ( uint64_t ) usec * tscPerUsec;
+    pTimerInfo->latest   = pTimerInfo->deadline +
+                           ( uint64_t ) pTimerInfo->slack * tscPerUsec;
+    pTimerInfo->type     = type;
+    pTimerInfo->pFunc    = pFunc;
+    pTimerInfo->pArg     = pArg;
+    pTimerInfo->taskId   = taskId;
 
-    /* 使用中タイマ情報リスト設定 */
-    Set( pTimerInfo );
+    /* タイマ設定 */
+    Arm( pTimerInfo );
 
-    return pTimerInfo->timerId;
+    return timerId;
 }
 
 
 /******************************************************************************/
 /**
- * @brief       タイマ解除
- * @details     指定したタイマIDのタイマ設定を解除する。
+ * @brief       タイマスラック設定
+ * @details     指定したタイマIDのタイマのスラックを設定し、設定中のタイマを新
+ *              しいスラックで再設定する。満了を遅らせられないタイマはスラック
+ *              を0にする。
+ *
+ * @param[in]   timerId タイマID
+ * @param[in]   slack   スラック[us]
  */
 /******************************************************************************/
-void TimermngCtrlUnset( uint32_t timerId )
+void TimermngCtrlSetSlack( uint32_t timerId,
+                           uint32_t slack    )
 {
-    TimerInfo_t *pNext;
-    TimerInfo_t *pTimerInfo;
+    MLibList_t  *pList;         /* 挿入先リスト */
+    TimerInfo_t *pTimerInfo;    /* タイマ情報   */
 
-    /* タイマIDチェック */
-    if ( timerId > TIMERMNG_TIMERID_MAX ) {
-        /* 不正 */
+    /* 初期化 */
+    pList      = NULL;
+    pTimerInfo = GetInfo( timerId );
+
+    /* 取得結果判定 */
+    if ( pTimerInfo == NULL ) {
+        /* 失敗 */
 
         return;
     }
 
-    pTimerInfo = &gTimerInfoTbl[ timerId ];
+    /* スラック設定 */
+    pTimerInfo->slack  = slack;
+    pTimerInfo->latest = pTimerInfo->deadline +
+                         ( uint64_t ) slack * TimermngLapicGetTscPerUsec();
+    pList              = pTimerInfo->pList;
 
-    /* タイマ情報使用中チェック */
-    if ( pTimerInfo->pFunc == NULL ) {
-        /* 未使用 */
+    /* 挿入先リスト判定 */
+    if ( ( pList == NULL ) || ( pList == &gExpiredList ) ) {
+        /* 満了済 */
 
+        /* 次回の設定から適用する */
         return;
     }
 
-    /* 次タイマ情報取得 */
-    pNext = ( TimerInfo_t * )
-        MLibListGetNextNode( &gUsedList,
-                             ( MLibListNode_t * ) pTimerInfo );
+    /* タイマ再設定 */
+    ( void ) MLibListRemove( pList, ( MLibListNode_t * ) pTimerInfo );
+    Arm( pTimerInfo );
+
+    /* 挿入先リスト判定 */
+    if ( pList == &gHresList ) {
+        /* 高分解能タイマ情報リスト */
+
+        /* LAPICタイマ再設定 */
+        ArmHres();
+    }
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       タイマ解除
+ * @details     指定したタイマIDのタイマ設定を解除する。タイマ情報は挿入先リ
+ *              ストから直接削除する。高分解能タイマ情報リストから削除した場合
+ *              はLAPICタイマを再設定する。
+ */
+/******************************************************************************/
+void TimermngCtrlUnset( uint32_t timerId )
+{
+    MLibList_t  *pList;         /* 挿入先リスト */
+    TimerInfo_t *pTimerInfo;    /* タイマ情報   */
+
+    /* 初期化 */
+    pList      = NULL;
+    pTimerInfo = GetInfo( timerId );
 
     /* 取得結果判定 */
-    if ( pNext != NULL ) {
-        /* 次タイマ情報有り */
+    if ( pTimerInfo == NULL ) {
+        /* 失敗 */
+
+        return;
+    }
 
-        /* 次タイマ情報設定 */
-        pNext->remain += pTimerInfo->remain;
+    /* 挿入先リスト判定 */
+    if ( pTimerInfo->pList == NULL ) {
+        /* ワンショットタイマのコールバック関数実行中 */
+
+        /* コールバック関数実行後に解放する */
+        return;
     }
 
-    /* 使用中タイマ情報リストから削除 */
-    ( void ) MLibListRemove( &gUsedList,
-                             ( MLibListNode_t * ) pTimerInfo );
+    /* リストから削除 */
+    pList = pTimerInfo->pList;
+    ( void ) MLibListRemove( pList, ( MLibListNode_t * ) pTimerInfo );
 
-    /* 未使用タイマ情報リスト設定 */
-    Unset( pTimerInfo );
+    /* タイマ情報解放 */
+    Free( pTimerInfo );
+
+    /* 挿入先リスト判定 */
+    if ( pList == &gHresList ) {
+        /* 高分解能タイマ情報リスト */
+
+        /* LAPICタイマ再設定 */
+        ArmHres();
+    }
 
     return;
 }
@@ -226,89 +503,201 @@ void TimermngCtrlUnset( uint32_t timerId )
 /******************************************************************************/
 void CtrlInit( void )
 {
-    uint32_t index;
-
-    /* タイマ情報リスト初期化 */
-    ( void ) MLibListInit( &gUnusedList );
-    ( void ) MLibListInit( &gUsedList   );
+    uint32_t level; /* 階層       */
+    uint32_t slot;  /* スロット   */
+    uint32_t idx;   /* タスクID   */
+
+    /* タイマ情報テーブル初期化 */
+    MLibDynamicArrayInit( &gTimerTbl,
+                          TIMERTBL_CHUNK_SIZE,
+                          sizeof ( TimerInfo_t ),
+                          TIMERMNG_TIMERID_NUM,
+                          NULL                   );
+
+    /* 階層毎に繰り返し */
+    for ( level = 0; level < WHEEL_LEVEL_NUM; level++ ) {
+        /* スロット毎に繰り返し */
+        for ( slot = 0; slot < WHEEL_SLOT_NUM; slot++ ) {
+            /* タイマホイール初期化 */
+            ( void ) MLibListInit( &gWheel[ level ][ slot ] );
+        }
+    }
 
-    /* タイマ情報テーブルエントリ毎に繰り返し */
-    for ( index  = TIMERMNG_TIMERID_MIN;
-          index <= TIMERMNG_TIMERID_MAX;
-          index++                        ) {
+    /* 高分解能・満了タイマ情報リスト初期化 */
+    ( void ) MLibListInit( &gHresList    );
+    ( void ) MLibListInit( &gExpiredList );
 
-        /* 初期化 */
-        gTimerInfoTbl[ index ].timerId = index;
+    /* 次処理tick初期化 */
+    gNow = 0;
 
-        /* 未使用タイマ情報リスト設定 */
-        Unset( &gTimerInfoTbl[ index ] );
+    /* タスクID毎に繰り返し */
+    for ( idx = 0; idx < MK_TASKID_NUM; idx++ ) {
+        /* タスク毎スラック初期化 */
+        gTaskSlackTbl[ idx ] = MK_TIMER_SLACK_DEFAULT;
     }
 
+#ifdef INTMNG_STAT_ENABLE
+    /* タイマ合体統計初期化 */
+    MLibUtilSetMemory8( &gStat, 0, sizeof ( gStat ) );
+#endif
+
     /* 割込みハンドラ設定 */
     IntmngHdlSet( MK_CONFIG_INTNO_TIMER,        /* 割込み番号     */
                   HdlInt,                       /* 割込みハンドラ */
                   IA32_DESCRIPTOR_DPL_3  );     /* 特権レベル     */
 
+    /* システムコールハンドラ設定 */
+    IntmngSysSet( MK_SYSCALL_TIMER_SLEEP,     HdlSys );
+    IntmngSysSet( MK_SYSCALL_TIMER_SET_SLACK, HdlSys );
+    IntmngSysSet( MK_SYSCALL_TIMER_START,     HdlSys );
+    IntmngSysSet( MK_SYSCALL_TIMER_STOP,      HdlSys );
+
 }
 
 
 /******************************************************************************/
 /**
  * @brief       タイマ制御実行
- * @details     使用中タイマ情報リストの先頭エントリを取り出し、残タイマ値をデ
- *              クリメントする。残タイマ値が0になった場合はタイムアウト処理を行
- *              う。
+ * @details     タイマホイールを1tick進める。第0階層のスロットが一巡した場合
+ *              は上位階層の該当スロットを下位階層へ繰り下げる。第0階層の現在
+ *              スロットのタイマ情報の内、満了したタイマ情報を満了タイマ情報
+ *              リストに移動してタイムアウト処理を行う。高分解能タイマが有効な
+ *              場合、未満了のタイマ情報は満了TSC値上限が次のtick以降であれば
+ *              次のtickに繰り延べ、それ以外は高分解能タイマ情報リストに移動す
+ *              る。また、高分解能タイマ情報リストの満了したタイマも合わせて処
+ *              理する。
  */
 /******************************************************************************/
 void CtrlRun( void )
 {
-    TimerInfo_t *pTimerInfo; /* タイマ情報 */
+    uint32_t    level;          /* 階層                    */
+    uint32_t    slot;           /* スロット                */
+    uint32_t    tscPerUsec;     /* マイクロ秒当たりTSC増分 */
+    uint64_t    now;            /* 現在TSC値               */
+    MLibList_t  *pList;         /* スロット                */
+    TimerInfo_t *pTimerInfo;    /* タイマ情報              */
 
-    /* 先頭エントリ取得 */
-    pTimerInfo = ( TimerInfo_t * ) MLibListGetNextNode( &gUsedList, NULL );
+    /* 初期化 */
+    level      = 1;
+    slot       = WHEEL_SLOT( gNow, 0 );
+    tscPerUsec = TimermngLapicGetTscPerUsec();
+    now        = IA32InstructionRdtsc();
+    pList      = &gWheel[ 0 ][ slot ];
+    pTimerInfo = NULL;
+
+    /* 下位階層一巡毎に繰り返し */
+    while ( ( slot == 0 ) && ( level < WHEEL_LEVEL_NUM ) ) {
+        /* スロットインデックス取得 */
+        slot = WHEEL_SLOT( gNow, level );
+
+        /* タイマホイール繰り下げ */
+        Cascade( level, slot );
+
+        level++;
+    }
 
-    /* 取得結果判定 */
-    if ( pTimerInfo == NULL ) {
-        /* エントリ無し */
+    /* 次処理tick更新 */
+    gNow++;
 
-        return;
+    /* 現在スロットのタイマ情報毎に繰り返し */
+    while ( true ) {
+        /* タイマ情報取出し */
+        pTimerInfo = ( TimerInfo_t * ) MLibListRemoveHead( pList );
+
+        /* 取出し結果判定 */
+        if ( pTimerInfo == NULL ) {
+            /* タイマ情報無し */
+
+            break;
+        }
+
+        /* 満了判定 */
+        if ( ( tscPerUsec           != 0   ) &&
+             ( pTimerInfo->deadline >  now )    ) {
+            /* 未満了 */
+
+            /* 満了TSC値上限判定 */
+            if ( pTimerInfo->latest >=
+                 ( now + ( uint64_t ) USEC_PER_TICK * tscPerUsec ) ) {
+                /* 次のtick以降 */
+
+                /* 次のtickに繰延べ */
+                pTimerInfo->wheel = gNow;
+                Add( pTimerInfo );
+
+#ifdef INTMNG_STAT_ENABLE
+                gStat.defer++;
+#endif
+
+            } else {
+                /* 次のtickより前 */
+
+                /* 高分解能タイマ情報リスト挿入 */
+                AddHres( pTimerInfo );
+            }
+
+            continue;
+        }
+
+        /* 満了タイマ情報リスト挿入 */
+        ( void ) MLibListInsertTail( &gExpiredList,
+                                     ( MLibListNode_t * ) pTimerInfo );
+        pTimerInfo->pList = &gExpiredList;
     }
 
-    /* タイムアウト判定 */
-    if ( pTimerInfo->remain != 0 ) {
-        /* タイムアウトでない */
+    /* 高分解能タイマ有効判定 */
+    if ( tscPerUsec != 0 ) {
+        /* 有効 */
+
+        /* 高分解能タイマ満了判定 */
+        RunHres( now );
+    }
 
-        /* 残タイマ値減算 */
-        pTimerInfo->remain--;
+#ifdef INTMNG_STAT_ENABLE
+    /* 満了タイマ有無判定 */
+    if ( MLibListGetNextNode( &gExpiredList, NULL ) != NULL ) {
+        /* 有り */
 
-        return;
+        gStat.tickWakeup++;
     }
+#endif
 
-    /* 使用中タイマ情報リストから削除 */
-    ( void ) MLibListRemoveHead( &gUsedList );
+    /* 満了タイマ処理 */
+    Expire();
 
-    /* タイマ種別判定 */
-    if ( pTimerInfo->type == TIMERMNG_TYPE_ONESHOT ) {
-        /* ワンショットタイマ */
+    return;
+}
 
-        /* コールバック関数呼出し */
-        ( pTimerInfo->pFunc )( pTimerInfo->timerId, pTimerInfo->pArg );
 
-        /* 未使用タイマ情報リスト設定 */
-        Unset( pTimerInfo );
+/******************************************************************************/
+/**
+ * @brief       高分解能タイマ制御実行
+ * @details     高分解能タイマ情報リストの満了したタイマ情報を満了タイマ情報リ
+ *              ストに移動し、次に満了するタイマでLAPICタイマを設定した後にタ
+ *              イムアウト処理を行う。
+ */
+/******************************************************************************/
+void CtrlRunHres( void )
+{
+    /* 高分解能タイマ満了判定 */
+    RunHres( IA32InstructionRdtsc() );
 
-    } else if ( pTimerInfo->type == TIMERMNG_TYPE_REPEAT ) {
-        /* 繰り返しタイマ */
+#ifdef INTMNG_STAT_ENABLE
+    /* 満了タイマ有無判定 */
+    if ( MLibListGetNextNode( &gExpiredList, NULL ) != NULL ) {
+        /* 有り */
 
-        /* 残タイマ値設定 */
-        pTimerInfo->remain = pTimerInfo->tick;
+        gStat.hresWakeup++;
 
-        /* 使用中タイマ情報リスト設定 */
-        Set( pTimerInfo );
+    } else {
+        /* 無し */
 
-        /* コールバック関数呼出し */
-        ( pTimerInfo->pFunc )( pTimerInfo->timerId, pTimerInfo->pArg );
+        gStat.hresSpurious++;
     }
+#endif
+
+    /* 満了タイマ処理 */
+    Expire();
 
     return;
 }
@@ -319,152 +708,212 @@ void CtrlRun( void )
 /******************************************************************************/
 /******************************************************************************/
 /**
- * @brief       割込みハンドラ
- * @details     機能IDから該当する機能を呼び出す。
+ * @brief       タイマホイール挿入
+ * @details     挿入tickまでの残tick数から階層を決定し、挿入tickに対応するス
+ *              ロットにタイマ情報を挿入する。最上位階層の範囲を超える場合は最
+ *              上位階層の末尾スロットに挿入し、繰り下げ時に再挿入する。
  *
- * @param[in]   intNo   割込み番号
- * @param[in]   context 割込み発生時コンテキスト
+ * @param[in]   *pTimerInfo タイマ情報
  */
 /******************************************************************************/
-static void HdlInt( uint32_t        intNo,
-                    IntmngContext_t context )
+static void Add( TimerInfo_t *pTimerInfo )
 {
-    MkTimerParam_t *pParam;    /* パラメータ   */
+    uint32_t level;     /* 階層     */
+    uint64_t expire;    /* 挿入tick */
 
     /* 初期化 */
-    pParam = ( MkTimerParam_t * ) context.genReg.esi;
+    level  = 0;
+    expire = pTimerInfo->wheel;
 
-    /* パラメータチェック */
-    if ( pParam == NULL ) {
-        /* 不正 */
+    /* 挿入tick判定 */
+    if ( expire < gNow ) {
+        /* 超過済 */
 
-        return;
-    }
+        expire = gNow;
 
-    /* 機能ID判定 */
-    switch ( pParam->funcId ) {
-        case MK_TIMER_FUNCID_SLEEP:
-            /* スリープ */
-            Sleep( pParam );
-            break;
+    } else if ( ( expire - gNow ) >= WHEEL_RANGE ) {
+        /* 最上位階層範囲外 */
 
-        default:
-            /* 不正 */
+        expire = gNow + WHEEL_RANGE - 1;
+    }
 
-            /* アウトプットパラメータ設定 */
-            pParam->ret = MK_RET_FAILURE;
-            pParam->err = MK_ERR_PARAM;
+    /* 階層毎に繰り返し */
+    while ( ( expire - gNow ) >= WHEEL_LEVEL_RANGE( level ) ) {
+        level++;
     }
 
+    /* スロット挿入 */
+    pTimerInfo->pList = &gWheel[ level ][ WHEEL_SLOT( expire, level ) ];
+    ( void ) MLibListInsertTail( pTimerInfo->pList,
+                                 ( MLibListNode_t * ) pTimerInfo );
+
     return;
 }
 
 
 /******************************************************************************/
 /**
- * @brief       使用中タイマ情報リスト設定
- * @details     タイマ情報を使用中タイマ情報リストの適切な位置に挿入する。
+ * @brief       高分解能タイマ情報リスト挿入
+ * @details     タイマ情報を満了TSC値上限の昇順となる位置に高分解能タイマ情報
+ *              リストに挿入する。先頭に挿入した場合は満了TSC値上限でLAPICタ
+ *              イマを設定する。高分解能タイマ情報リストには1tick以内に満了す
+ *              るタイマ情報のみを挿入する為、リストは短い。
  *
  * @param[in]   *pTimerInfo タイマ情報
  */
 /******************************************************************************/
-static void Set( TimerInfo_t *pTimerInfo )
+static void AddHres( TimerInfo_t *pTimerInfo )
 {
-    TimerInfo_t *pNext;
-    TimerInfo_t *pPrev;
+    TimerInfo_t *pPrev; /* 前タイマ情報 */
+    TimerInfo_t *pNext; /* 次タイマ情報 */
 
     /* 初期化 */
-    pNext = NULL;
     pPrev = NULL;
+    pNext = NULL;
 
-    /* 使用中タイマ情報エントリ毎に繰り返し */
+    /* タイマ情報毎に繰り返し */
     while ( true ) {
-        /* タイマ情報エントリ取得 */
+        /* 次タイマ情報取得 */
         pNext = ( TimerInfo_t * )
-            MLibListGetNextNode( &gUsedList,
-                                 ( MLibListNode_t * ) pPrev );
-
-        /* 取得結果判定 */
-        if ( pNext == NULL ) {
-            /* 次エントリ無し */
+            MLibListGetNextNode( &gHresList, ( MLibListNode_t * ) pPrev );
 
-            /* 挿入 */
-            ( void ) MLibListInsertNext(
-                        &gUsedList,
-                        ( MLibListNode_t * ) pPrev,
-                        ( MLibListNode_t * ) pTimerInfo );
+        /* 挿入位置判定 */
+        if ( ( pNext         == NULL               ) ||
+             ( pNext->latest >  pTimerInfo->latest )    ) {
+            /* 挿入位置 */
 
-            return;
+            break;
         }
 
-        /* 次エントリと残タイマ値比較 */
-        if ( pTimerInfo->remain < pNext->remain ) {
-            /* 次エントリより短い */
+        pPrev = pNext;
+    }
 
-            /* 挿入 */
-            ( void ) MLibListInsertNext(
-                        &gUsedList,
-                        ( MLibListNode_t * ) pPrev,
-                        ( MLibListNode_t * ) pTimerInfo );
+    /* 挿入 */
+    ( void ) MLibListInsertNext( &gHresList,
+                                 ( MLibListNode_t * ) pPrev,
+                                 ( MLibListNode_t * ) pTimerInfo );
+    pTimerInfo->pList = &gHresList;
 
-            /* 次エントリ残タイマ値減算 */
-            pNext->remain -= pTimerInfo->remain;
+    /* 挿入位置判定 */
+    if ( pPrev == NULL ) {
+        /* 先頭 */
 
-            return;
+        /* LAPICタイマ設定 */
+        TimermngLapicArm( pTimerInfo->latest );
+    }
 
-        } else {
-            /* 次エントリより長い */
+    return;
+}
 
-            /* 残タイマ値減算 */
-            pTimerInfo->remain -= pNext->remain;
-        }
 
-        pPrev = pNext;
+/******************************************************************************/
+/**
+ * @brief       スラック適用
+ * @details     満了tickから満了tick上限までの範囲で、下位ビットが最も多く0と
+ *              なるtickを求める。異なるタイマの満了tickを同じtickに揃え、満了
+ *              処理をまとめる。
+ *
+ * @param[in]   expire 満了tick
+ * @param[in]   latest 満了tick上限
+ *
+ * @return      挿入tickを返す。
+ */
+/******************************************************************************/
+static uint64_t ApplySlack( uint64_t expire,
+                            uint64_t latest  )
+{
+    uint64_t mask;  /* マスク */
+
+    /* 初期化 */
+    mask = expire ^ latest;
+
+    /* 範囲判定 */
+    if ( latest <= expire ) {
+        /* 範囲無し */
+
+        return expire;
     }
 
-    return;
+    /* 最上位の異なるビットより下位のビットマスク作成 */
+    mask |= mask >> 1;
+    mask |= mask >> 2;
+    mask |= mask >> 4;
+    mask |= mask >> 8;
+    mask |= mask >> 16;
+    mask |= mask >> 32;
+    mask >>= 1;
+
+    return latest & ~mask;
 }
 
 
 /******************************************************************************/
 /**
- * @brief           スリープ
- * @details         指定した時間の間タスクをスリープ状態にする。
+ * @brief       タイマ設定
+ * @details     高分解能タイマが無効な場合は満了tickでタイマホイールに挿入す
+ *              る。有効な場合、満了TSC値まで1tick未満であれば高分解能タイマ
+ *              情報リストに挿入し、1tick以上であれば満了TSC値より前に処理さ
+ *              れるtickでタイマホイールに挿入する。タイマホイールに挿入する
+ *              tickはスラックの範囲内で揃える。
  *
- * @param[in,out]   *pParam パラメータ
+ * @param[in]   *pTimerInfo タイマ情報
  */
 /******************************************************************************/
-static void Sleep( MkTimerParam_t *pParam )
+static void Arm( TimerInfo_t *pTimerInfo )
 {
-    uint32_t tick;
-    uint32_t timerId;
+    uint32_t tscPerUsec;    /* マイクロ秒当たりTSC増分 */
+    uint64_t now;           /* 現在TSC値               */
+    uint64_t remain;        /* 残時間[us]              */
+    uint64_t limit;         /* 上限までの残時間[us]    */
 
-    /* tick変換 */
-    tick = pParam->usec / ( 1000000 / MK_CONFIG_TICK_HZ );
+    /* 初期化 */
+    tscPerUsec = TimermngLapicGetTscPerUsec();
+    now        = 0;
+    remain     = 0;
+    limit      = 0;
+
+    /* 高分解能タイマ有効判定 */
+    if ( tscPerUsec == 0 ) {
+        /* 無効 */
+
+        /* タイマホイール挿入 */
+        pTimerInfo->wheel =
+            ApplySlack( pTimerInfo->expire,
+                        pTimerInfo->expire +
+                        pTimerInfo->slack / USEC_PER_TICK );
+        Add( pTimerInfo );
 
-    /* タイマ設定 */
-    timerId = TimermngCtrlSet( tick, TIMERMNG_TYPE_ONESHOT, SleepTimeout, NULL );
+        return;
+    }
 
-    /* タイマ設定結果判定 */
-    if ( timerId == TIMERMNG_TIMERID_NULL ) {
-        /* 失敗 */
+    /* 現在TSC値取得 */
+    now = IA32InstructionRdtsc();
 
-        /* アウトプットパラメータ設定 */
-        pParam->ret = MK_RET_FAILURE;
-        pParam->err = MK_ERR_NO_RESOURCE;
+    /* 満了判定 */
+    if ( pTimerInfo->deadline > now ) {
+        /* 未満了 */
 
-        return;
+        /* 残時間計算 */
+        remain = ( pTimerInfo->deadline - now ) / tscPerUsec;
+        limit  = ( pTimerInfo->latest   - now ) / tscPerUsec;
     }
 
-    /* スケジュール停止 */
-    TaskmngSchedStop( gTimerInfoTbl[ timerId ].taskId );
+    /* 残時間判定 */
+    if ( remain < USEC_PER_TICK ) {
+        /* 1tick未満 */
 
-    /* スケジューラ実行 */
-    TaskmngSchedExec();
+        /* 高分解能タイマ情報リスト挿入 */
+        AddHres( pTimerInfo );
 
-    /* アウトプットパラメータ設定 */
-    pParam->ret = MK_RET_SUCCESS;
-    pParam->err = MK_ERR_NONE;
+    } else {
+        /* 1tick以上 */
+
+        /* タイマホイール挿入 */
+        pTimerInfo->wheel =
+            ApplySlack( gNow + remain / USEC_PER_TICK - 1,
+                        gNow + limit  / USEC_PER_TICK - 1  );
+        Add( pTimerInfo );
+    }
 
     return;
 }
@@ -472,21 +921,32 @@ static void Sleep( MkTimerParam_t *pParam )
 
 /******************************************************************************/
 /**
- * @brief       スリープタイムアウト
- * @details     タスクのスケジューリングを再開する。
- *
- * @param[in]   timerId タイマID
- * @param[in]   *pArg   スリープ引数
+ * @brief       LAPICタイマ再設定
+ * @details     高分解能タイマ情報リストの先頭のタイマ情報の満了TSC値上限で
+ *              LAPICタイマを設定する。タイマ情報が無い場合はLAPICタイマを停
+ *              止する。
  */
 /******************************************************************************/
-static void SleepTimeout( uint32_t timerId,
-                          void     *pArg    )
+static void ArmHres( void )
 {
-    /* スケジュール開始 */
-    TaskmngSchedStart( gTimerInfoTbl[ timerId ].taskId );
+    TimerInfo_t *pTimerInfo;    /* タイマ情報 */
 
-    /* スケジューラ実行 */
-    TaskmngSchedExec();
+    /* 先頭タイマ情報取得 */
+    pTimerInfo = ( TimerInfo_t * ) MLibListGetNextNode( &gHresList, NULL );
+
+    /* タイマ情報有無判定 */
+    if ( pTimerInfo == NULL ) {
+        /* 無し */
+
+        /* LAPICタイマ停止 */
+        TimermngLapicStop();
+
+    } else {
+        /* 有り */
+
+        /* LAPICタイマ設定 */
+        TimermngLapicArm( pTimerInfo->latest );
+    }
 
     return;
 }
@@ -494,26 +954,850 @@ static void SleepTimeout( uint32_t timerId,
 
 /******************************************************************************/
 /**
- * @brief       未使用タイマ情報リスト設定
- * @details     タイマ情報を初期化し、未使用タイマ情報リストに挿入する。
+ * @brief       タイマホイール繰り下げ
+ * @details     指定した階層のスロットに挿入されている全タイマ情報を取り出し、
+ *              現在のtickを基準にタイマホイールに再挿入する。
  *
- * @param[in]   *pTimerInfo タイマ情報
+ * @param[in]   level 階層
+ * @param[in]   slot  スロットインデックス
  */
 /******************************************************************************/
-static void Unset( TimerInfo_t *pTimerInfo )
+static void Cascade( uint32_t level,
+                     uint32_t slot   )
 {
+    TimerInfo_t *pTimerInfo;    /* タイマ情報 */
 
-    /* タイマ情報初期化 */
-    pTimerInfo->remain = 0;
-    pTimerInfo->tick   = 0;
-    pTimerInfo->type   = TIMERMNG_TYPE_ONESHOT;
-    pTimerInfo->pFunc  = NULL;
-    pTimerInfo->pArg   = NULL;
-    pTimerInfo->taskId = MK_TASKID_NULL;
-
-    /* 未使用タイマ情報リスト追加 */
-    ( void ) MLibListInsertTail( &gUnusedList,
-                                 ( MLibListNode_t * ) pTimerInfo );
+    /* タイマ情報毎に繰り返し */
+    while ( true ) {
+        /* タイマ情報取出し */
+        pTimerInfo = ( TimerInfo_t * )
+            MLibListRemoveHead( &gWheel[ level ][ slot ] );
+
+        /* 取出し結果判定 */
+        if ( pTimerInfo == NULL ) {
+            /* タイマ情報無し */
+
+            break;
+        }
+
+        /* タイマホイール挿入 */
+        Add( pTimerInfo );
+    }
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       満了タイマ処理
+ * @details     満了タイマ情報リストのタイマ情報毎にコールバック関数を呼び出
+ *              す。ワンショットタイマはコールバック関数呼出し後に解放し、繰
+ *              り返しタイマは前回の満了時刻を基準に再設定する。処理遅延によ
+ *              り次の満了時刻も経過している場合は、見逃した周期を飛ばして現
+ *              在時刻以降に再設定し、飛ばした回数を満了見逃し回数としてコー
+ *              ルバック関数に引き渡す。コールバック
+ *              関数はタスク切替えを行わない為、満了タイマは全て本関数内で処
+ *              理し、スケジューラは呼出し元の割込みハンドラで1回だけ実行す
+ *              る。
+ */
+/******************************************************************************/
+static void Expire( void )
+{
+    uint32_t    tick;           /* 周期[tick]              */
+    uint32_t    tscPerUsec;     /* マイクロ秒当たりTSC増分 */
+    uint64_t    now;            /* 現在TSC値               */
+    uint64_t    period;         /* 周期[TSC]               */
+#ifdef INTMNG_STAT_ENABLE
+    uint32_t    num;            /* 満了タイマ数            */
+#endif
+    TimerInfo_t *pTimerInfo;    /* タイマ情報              */
+
+    /* 初期化 */
+    tick       = 0;
+    tscPerUsec = TimermngLapicGetTscPerUsec();
+    now        = 0;
+    period     = 0;
+#ifdef INTMNG_STAT_ENABLE
+    num        = 0;
+#endif
+    pTimerInfo = NULL;
+
+    /* 満了タイマ情報毎に繰り返し */
+    while ( true ) {
+        /* タイマ情報取出し */
+        pTimerInfo = ( TimerInfo_t * ) MLibListRemoveHead( &gExpiredList );
+
+        /* 取出し結果判定 */
+        if ( pTimerInfo == NULL ) {
+            /* タイマ情報無し */
+
+            break;
+        }
+
+        pTimerInfo->pList = NULL;
+
+#ifdef INTMNG_STAT_ENABLE
+        num++;
+#endif
+
+        /* タイマ種別判定 */
+        if ( pTimerInfo->type == TIMERMNG_TYPE_ONESHOT ) {
+            /* ワンショットタイマ */
+
+            /* コールバック関数呼出し */
+            ( pTimerInfo->pFunc )( pTimerInfo->timerId, pTimerInfo->pArg );
+
+            /* タイマ情報解放 */
+            Free( pTimerInfo );
+
+        } else {
+            /* 繰り返しタイマ */
+
+            /* 満了時刻設定 */
+            tick                  = TICK_CEIL( pTimerInfo->usec );
+            period                = ( uint64_t ) pTimerInfo->usec * tscPerUsec;
+            pTimerInfo->skip      = 0;
+            pTimerInfo->expire   += tick;
+            pTimerInfo->deadline += period;
+
+            /* 高分解能タイマ有効判定 */
+            if ( tscPerUsec != 0 ) {
+                /* 有効 */
+
+                now = IA32InstructionRdtsc();
+
+                /* 満了時刻経過判定 */
+                if ( pTimerInfo->deadline <= now ) {
+                    /* 経過済 */
+
+                    pTimerInfo->skip =
+                        ( uint32_t ) ( ( now - pTimerInfo->deadline ) /
+                                       period                         ) + 1;
+                }
+
+            } else {
+                /* 無効 */
+
+                /* 満了時刻経過判定 */
+                if ( pTimerInfo->expire < gNow ) {
+                    /* 経過済 */
+
+                    pTimerInfo->skip =
+                        ( uint32_t ) ( ( gNow - pTimerInfo->expire +
+                                         tick - 1                   ) / tick );
+                }
+            }
+
+            /* 見逃し周期スキップ */
+            pTimerInfo->expire   += ( uint64_t ) tick   * pTimerInfo->skip;
+            pTimerInfo->deadline += period * pTimerInfo->skip;
+            pTimerInfo->latest    = pTimerInfo->deadline +
+                                    ( uint64_t ) pTimerInfo->slack * tscPerUsec;
+
+            /* タイマ設定 */
+            Arm( pTimerInfo );
+
+            /* コールバック関数呼出し */
+            ( pTimerInfo->pFunc )( pTimerInfo->timerId, pTimerInfo->pArg );
+        }
+    }
+
+#ifdef INTMNG_STAT_ENABLE
+    /* 満了タイマ数判定 */
+    if ( num != 0 ) {
+        /* 有り */
+
+        gStat.expire   += num;
+        gStat.coalesce += num - 1;
+    }
+#endif
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       タイマ情報解放
+ * @details     タイマ情報を初期化し、タイマ情報テーブルに返却する。
+ *
+ * @param[in]   *pTimerInfo タイマ情報
+ */
+/******************************************************************************/
+static void Free( TimerInfo_t *pTimerInfo )
+{
+    MLibErr_t errMLib;  /* MLIBエラー要因 */
+
+    /* 初期化 */
+    errMLib = MLIB_ERR_NONE;
+
+    /* タイマ情報初期化 */
+    pTimerInfo->pList    = NULL;
+    pTimerInfo->usec     = 0;
+    pTimerInfo->slack    = 0;
+    pTimerInfo->skip     = 0;
+    pTimerInfo->expire   = 0;
+    pTimerInfo->wheel    = 0;
+    pTimerInfo->deadline = 0;
+    pTimerInfo->latest   = 0;
+    pTimerInfo->type     = TIMERMNG_TYPE_ONESHOT;
+    pTimerInfo->pFunc    = NULL;
+    pTimerInfo->pArg     = NULL;
+    pTimerInfo->taskId   = MK_TASKID_NULL;
+
+    /* タイマ情報解放 */
+    ( void ) MLibDynamicArrayFree( &gTimerTbl,
+                                   ( uint_t ) pTimerInfo->timerId,
+                                   &errMLib                        );
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       タイマ情報取得
+ * @details     タイマIDに該当する使用中のタイマ情報を取得する。
+ *
+ * @param[in]   timerId タイマID
+ *
+ * @return      タイマ情報を返す。
+ * @retval      NULL     該当無し
+ * @retval      NULL以外 タイマ情報
+ */
+/******************************************************************************/
+static TimerInfo_t *GetInfo( uint32_t timerId )
+{
+    MLibErr_t   errMLib;        /* MLIBエラー要因 */
+    MLibRet_t   retMLib;        /* MLIB戻り値     */
+    TimerInfo_t *pTimerInfo;    /* タイマ情報     */
+
+    /* 初期化 */
+    errMLib    = MLIB_ERR_NONE;
+    retMLib    = MLIB_RET_FAILURE;
+    pTimerInfo = NULL;
+
+    /* タイマIDチェック */
+    if ( timerId > TIMERMNG_TIMERID_MAX ) {
+        /* 不正 */
+
+        return NULL;
+    }
+
+    /* タイマ情報取得 */
+    retMLib = MLibDynamicArrayGet( &gTimerTbl,
+                                   ( uint_t  ) timerId,
+                                   ( void ** ) &pTimerInfo,
+                                   &errMLib                 );
+
+    /* 取得結果判定 */
+    if ( ( retMLib           != MLIB_RET_SUCCESS ) ||
+         ( pTimerInfo->pFunc == NULL             )    ) {
+        /* 未使用 */
+
+        return NULL;
+    }
+
+    return pTimerInfo;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       割込みハンドラ
+ * @details     機能IDから該当する機能を呼び出す。
+ *
+ * @param[in]   intNo     割込み番号
+ * @param[in]   *pContext 割込み発生時コンテキスト
+ */
+/******************************************************************************/
+static void HdlInt( uint32_t        intNo,
+                    IntmngContext_t *pContext )
+{
+    MkTimerParam_t *pParam;    /* パラメータ   */
+
+    /* 初期化 */
+    pParam = ( MkTimerParam_t * ) pContext->genReg.esi;
+
+    /* パラメータチェック */
+    if ( pParam == NULL ) {
+        /* 不正 */
+
+        return;
+    }
+
+    /* 機能ID判定 */
+    switch ( pParam->funcId ) {
+        case MK_TIMER_FUNCID_SLEEP:
+            /* スリープ */
+            Sleep( pParam );
+            break;
+
+        case MK_TIMER_FUNCID_SLEEP_UNTIL:
+            /* 時刻指定スリープ */
+            SleepUntil( pParam );
+            break;
+
+        case MK_TIMER_FUNCID_START:
+            /* ユーザタイマ開始 */
+            Start( pParam );
+            break;
+
+        case MK_TIMER_FUNCID_STOP:
+            /* ユーザタイマ停止 */
+            Stop( pParam );
+            break;
+
+        default:
+            /* 不正 */
+
+            /* アウトプットパラメータ設定 */
+            pParam->ret = MK_RET_FAILURE;
+            pParam->err = MK_ERR_PARAM;
+    }
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief           システムコールハンドラ
+ * @details         レジスタ渡し形式のタイマシステムコールを処理する。システム
+ *                  コールリングからも呼び出される。
+ *                  - MK_SYSCALL_TIMER_SLEEP
+ *                      - 入力: EBX=スリープ時間[us]
+ *                  - MK_SYSCALL_TIMER_SET_SLACK
+ *                      - 入力: EBX=スラック[us](MK_TIMER_SLACK_DEFAULT:既定値)
+ *                  - MK_SYSCALL_TIMER_START
+ *                      - 入力: EBX=タイマ値[us],
+ *                              ESI=モード値(MK_TIMER_REG_MODE),
+ *                              EDI=通知ビット
+ *                      - 出力: ESI=タイマID
+ *                  - MK_SYSCALL_TIMER_STOP
+ *                      - 入力: EBX=タイマID
+ *
+ * @param[in]       no    システムコール番号
+ * @param[in,out]   *pReg 汎用レジスタ
+ */
+/******************************************************************************/
+static void HdlSys( uint32_t     no,
+                    IA32Pushad_t *pReg )
+{
+    MkTimerParam_t param;   /* パラメータ */
+
+    /* パラメータ設定 */
+    param.ret = MK_RET_FAILURE;
+    param.err = MK_ERR_NONE;
+
+    /* システムコール番号判定 */
+    if ( no == MK_SYSCALL_TIMER_SLEEP ) {
+        /* スリープ */
+
+        param.funcId = MK_TIMER_FUNCID_SLEEP;
+        param.usec   = pReg->ebx;
+        Sleep( &param );
+
+    } else if ( no == MK_SYSCALL_TIMER_SET_SLACK ) {
+        /* タスクスラック設定 */
+
+        param.usec = pReg->ebx;
+        SetSlack( &param );
+
+    } else if ( no == MK_SYSCALL_TIMER_START ) {
+        /* ユーザタイマ開始 */
+
+        param.funcId = MK_TIMER_FUNCID_START;
+        param.usec   = pReg->ebx;
+        param.type   = MK_TIMER_REG_TYPE( pReg->esi );
+        param.notify = MK_TIMER_REG_NOTIFY( pReg->esi );
+        param.bits   = pReg->edi;
+        Start( &param );
+
+        /* 出力値設定 */
+        pReg->esi = param.timerId;
+
+    } else if ( no == MK_SYSCALL_TIMER_STOP ) {
+        /* ユーザタイマ停止 */
+
+        param.funcId  = MK_TIMER_FUNCID_STOP;
+        param.timerId = pReg->ebx;
+        Stop( &param );
+
+    } else {
+        /* 不正 */
+
+        param.err = MK_ERR_PARAM;
+    }
+
+    /* 戻り値設定 */
+    pReg->eax = param.ret;
+    pReg->ebx = param.err;
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       高分解能タイマ満了判定
+ * @details     高分解能タイマ情報リストの満了TSC値を経過したタイマ情報を全て
+ *              満了タイマ情報リストに移動し、LAPICタイマを再設定する。リスト
+ *              は満了TSC値上限の順である為、満了TSC値上限前のタイマもまとめて
+ *              満了させる。
+ *
+ * @param[in]   now 現在TSC値
+ */
+/******************************************************************************/
+static void RunHres( uint64_t now )
+{
+    TimerInfo_t *pTimerInfo;    /* タイマ情報   */
+    TimerInfo_t *pNext;         /* 次タイマ情報 */
+
+    /* 初期化 */
+    pTimerInfo = NULL;
+    pNext      = ( TimerInfo_t * ) MLibListGetNextNode( &gHresList, NULL );
+
+    /* タイマ情報毎に繰り返し */
+    while ( pNext != NULL ) {
+        /* 次タイマ情報取得 */
+        pTimerInfo = pNext;
+        pNext      = ( TimerInfo_t * )
+            MLibListGetNextNode( &gHresList, ( MLibListNode_t * ) pTimerInfo );
+
+        /* 満了判定 */
+        if ( pTimerInfo->deadline > now ) {
+            /* 未満了 */
+
+            continue;
+        }
+
+        /* 満了タイマ情報リスト移動 */
+        ( void ) MLibListRemove( &gHresList, ( MLibListNode_t * ) pTimerInfo );
+        ( void ) MLibListInsertTail( &gExpiredList,
+                                     ( MLibListNode_t * ) pTimerInfo );
+        pTimerInfo->pList = &gExpiredList;
+    }
+
+    /* LAPICタイマ再設定 */
+    ArmHres();
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief           タスクスラック設定
+ * @details         呼出し元タスクがこれ以降に設定するタイマのスラックを設定す
+ *                  る。MK_TIMER_SLACK_DEFAULTを指定した場合はプロセスタイプ毎
+ *                  の初期値に戻す。設定済みのタイマには影響しない。
+ *
+ * @param[in,out]   *pParam パラメータ
+ */
+/******************************************************************************/
+static void SetSlack( MkTimerParam_t *pParam )
+{
+    /* スラック設定 */
+    gTaskSlackTbl[ TaskmngSchedGetTaskId() ] = pParam->usec;
+
+    /* 戻り値設定 */
+    pParam->ret = MK_RET_SUCCESS;
+    pParam->err = MK_ERR_NONE;
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief           スリープ
+ * @details         指定した時間の間タスクをスリープ状態にする。
+ *
+ * @param[in,out]   *pParam パラメータ
+ */
+/******************************************************************************/
+static void Sleep( MkTimerParam_t *pParam )
+{
+    uint32_t timerId;
+
+    /* タイマ設定 */
+    timerId = TimermngCtrlSet( pParam->usec,
+                               TIMERMNG_TYPE_ONESHOT,
+                               SleepTimeout,
+                               NULL                   );
+
+    /* タイマ設定結果判定 */
+    if ( timerId == TIMERMNG_TIMERID_NULL ) {
+        /* 失敗 */
+
+        /* アウトプットパラメータ設定 */
+        pParam->ret = MK_RET_FAILURE;
+        pParam->err = MK_ERR_NO_RESOURCE;
+
+        return;
+    }
+
+    /* スケジュール停止 */
+    TaskmngSchedStop( TimermngCtrlGetTaskId( timerId ) );
+
+    /* スケジューラ実行 */
+    TaskmngSchedExec();
+
+    /* アウトプットパラメータ設定 */
+    pParam->ret = MK_RET_SUCCESS;
+    pParam->err = MK_ERR_NONE;
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       スリープタイムアウト
+ * @details     タスクのスケジューリングを再開する。
+ *
+ * @param[in]   timerId タイマID
+ * @param[in]   *pArg   スリープ引数
+ */
+/******************************************************************************/
+static void SleepTimeout( uint32_t timerId,
+                          void     *pArg    )
+{
+    /* スケジュール開始 */
+    TaskmngSchedStart( TimermngCtrlGetTaskId( timerId ) );
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief           時刻指定スリープ
+ * @details         単調増加時刻が指定した時刻に達するまでタスクをスリープ状態に
+ *                  する。指定時刻を経過済みの場合はスリープしない。スリープ時
+ *                  間は呼出し時に計算する為、周期処理の満了時刻がスリープ処理
+ *                  の遅延で後ろにずれない。TSCが無効な場合はtickカウンタから単
+ *                  調増加時刻を求める。
+ *
+ * @param[in,out]   *pParam パラメータ
+ */
+/******************************************************************************/
+static void SleepUntil( MkTimerParam_t *pParam )
+{
+    uint64_t now;   /* 現在単調増加時刻[ns] */
+    uint64_t usec;  /* スリープ時間[us]     */
+
+    /* 初期化 */
+    now  = 0;
+    usec = 0;
+
+    /* 満了まで繰り返し */
+    while ( true ) {
+        /* TSC有効判定 */
+        if ( TimermngClockGetTscHz() != 0 ) {
+            /* 有効 */
+
+            now = TimermngClockGetNsec();
+
+        } else {
+            /* 無効 */
+
+            now = gNow * NSEC_PER_TICK;
+        }
+
+        /* 満了判定 */
+        if ( now >= pParam->nsec ) {
+            /* 満了 */
+
+            break;
+        }
+
+        /* スリープ時間計算(切り上げ) */
+        usec = ( pParam->nsec - now + NSEC_PER_USEC - 1 ) / NSEC_PER_USEC;
+
+        /* スリープ時間上限判定 */
+        if ( usec > UINT32_MAX ) {
+            /* 上限超過 */
+
+            /* 分割してスリープする */
+            usec = UINT32_MAX;
+        }
+
+        /* スリープ */
+        pParam->usec = ( uint32_t ) usec;
+        Sleep( pParam );
+
+        /* スリープ結果判定 */
+        if ( pParam->ret != MK_RET_SUCCESS ) {
+            /* 失敗 */
+
+            return;
+        }
+    }
+
+    /* アウトプットパラメータ設定 */
+    pParam->ret = MK_RET_SUCCESS;
+    pParam->err = MK_ERR_NONE;
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief           ユーザタイマ開始
+ * @details         呼出し元タスクのタイマを開始する。満了時は指定した方法で呼
+ *                  出し元タスクに満了を通知する。
+ *                  - MK_TIMER_NOTIFY_NTF 指定した通知ビットを通知する。
+ *                  - MK_TIMER_NOTIFY_MSG タイマ満了メッセージを送信する。
+ *                  繰り返しタイマの周期は1tick以上とする。1tick未満の周期は満
+ *                  了処理がCPUを占有する為、受け付けない。
+ *
+ * @param[in,out]   *pParam パラメータ
+ */
+/******************************************************************************/
+static void Start( MkTimerParam_t *pParam )
+{
+    uint32_t       type;        /* タイマ種別       */
+    uint32_t       timerId;     /* タイマID         */
+    TimermngFunc_t pFunc;       /* コールバック関数 */
+    void           *pArg;       /* コールバック引数 */
+
+    /* 初期化 */
+    type    = TIMERMNG_TYPE_ONESHOT;
+    timerId = TIMERMNG_TIMERID_NULL;
+    pFunc   = NULL;
+    pArg    = NULL;
+
+    /* アウトプットパラメータ初期化 */
+    pParam->ret     = MK_RET_FAILURE;
+    pParam->timerId = TIMERMNG_TIMERID_NULL;
+
+    /* タイマ種別判定 */
+    if ( pParam->type == MK_TIMER_TYPE_ONESHOT ) {
+        /* ワンショット */
+
+        type = TIMERMNG_TYPE_ONESHOT;
+
+    } else if ( pParam->type == MK_TIMER_TYPE_REPEAT ) {
+        /* 繰り返し */
+
+        /* 周期判定 */
+        if ( pParam->usec < USEC_PER_TICK ) {
+            /* 1tick未満 */
+
+            pParam->err = MK_ERR_PARAM;
+
+            return;
+        }
+
+        type = TIMERMNG_TYPE_REPEAT;
+
+    } else {
+        /* 不正 */
+
+        pParam->err = MK_ERR_PARAM;
+
+        return;
+    }
+
+    /* 満了通知方法判定 */
+    if ( ( pParam->notify == MK_TIMER_NOTIFY_NTF ) &&
+         ( pParam->bits   != 0                   )    ) {
+        /* 通知 */
+
+        pFunc = UserTimeoutNtf;
+        pArg  = ( void * ) pParam->bits;
+
+    } else if ( pParam->notify == MK_TIMER_NOTIFY_MSG ) {
+        /* メッセージ */
+
+        /* コールバック引数は未送信満了回数とする */
+        pFunc = UserTimeoutMsg;
+        pArg  = NULL;
+
+    } else {
+        /* 不正 */
+
+        pParam->err = MK_ERR_PARAM;
+
+        return;
+    }
+
+    /* タイマ設定 */
+    timerId = TimermngCtrlSet( pParam->usec, type, pFunc, pArg );
+
+    /* タイマ設定結果判定 */
+    if ( timerId == TIMERMNG_TIMERID_NULL ) {
+        /* 失敗 */
+
+        pParam->err = MK_ERR_NO_RESOURCE;
+
+        return;
+    }
+
+    /* アウトプットパラメータ設定 */
+    pParam->ret     = MK_RET_SUCCESS;
+    pParam->err     = MK_ERR_NONE;
+    pParam->timerId = timerId;
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief           ユーザタイマ停止
+ * @details         呼出し元タスクが開始したユーザタイマを停止する。
+ *
+ * @param[in,out]   *pParam パラメータ
+ */
+/******************************************************************************/
+static void Stop( MkTimerParam_t *pParam )
+{
+    TimerInfo_t *pTimerInfo;    /* タイマ情報 */
+
+    /* 初期化 */
+    pTimerInfo = GetInfo( pParam->timerId );
+
+    /* アウトプットパラメータ初期化 */
+    pParam->ret = MK_RET_FAILURE;
+
+    /* タイマ情報判定 */
+    if ( ( pTimerInfo == NULL                      ) ||
+         ( ( pTimerInfo->pFunc != UserTimeoutMsg ) &&
+           ( pTimerInfo->pFunc != UserTimeoutNtf )    ) ) {
+        /* ユーザタイマでない */
+
+        pParam->err = MK_ERR_NO_EXIST;
+
+        return;
+    }
+
+    /* タイマ所有判定 */
+    if ( pTimerInfo->taskId != TaskmngSchedGetTaskId() ) {
+        /* 他タスクのタイマ */
+
+        pParam->err = MK_ERR_UNAUTHORIZED;
+
+        return;
+    }
+
+    /* タイマ解除 */
+    TimermngCtrlUnset( pParam->timerId );
+
+    /* アウトプットパラメータ設定 */
+    pParam->ret = MK_RET_SUCCESS;
+    pParam->err = MK_ERR_NONE;
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       ユーザタイマ満了(メッセージ)
+ * @details     タイマを開始したタスクにタイマ満了メッセージを送信する。メッセ
+ *              ージキューが満杯等で送信できなかった場合は未送信満了回数を加算
+ *              し、次回送信時に通知する。処理遅延により見逃した満了回数も未送
+ *              信満了回数に含めて通知する。タスクが存在しない場合はタイマを解
+ *              除する。
+ *
+ * @param[in]   timerId タイマID
+ * @param[in]   *pArg   未送信満了回数
+ */
+/******************************************************************************/
+static void UserTimeoutMsg( uint32_t timerId,
+                            void     *pArg    )
+{
+    bool         exist;         /* タスク存在確認結果   */
+    MkErr_t      err;           /* エラー要因           */
+    CmnRet_t     ret;           /* 関数戻り値           */
+    MkTimerMsg_t msg;           /* タイマ満了メッセージ */
+    TimerInfo_t  *pTimerInfo;   /* タイマ情報           */
+
+    /* 初期化 */
+    exist      = false;
+    err        = MK_ERR_NONE;
+    ret        = CMN_FAILURE;
+    pTimerInfo = GetInfo( timerId );
+
+    /* タスク存在確認 */
+    exist = TaskmngTaskCheckExist( pTimerInfo->taskId );
+
+    /* 確認結果判定 */
+    if ( exist == false ) {
+        /* 存在しない */
+
+        /* タイマ解除 */
+        TimermngCtrlUnset( timerId );
+
+        return;
+    }
+
+    /* タイマ満了メッセージ設定 */
+    msg.timerId = timerId;
+    msg.overrun = ( uint32_t ) pArg + pTimerInfo->skip;
+
+    /* カーネルメッセージ送信 */
+    ret = ItcctrlMsgSendKernel( pTimerInfo->taskId,
+                                &msg,
+                                sizeof ( msg ),
+                                &err                );
+
+    /* 送信結果判定 */
+    if ( ret == CMN_SUCCESS ) {
+        /* 成功 */
+
+        pTimerInfo->pArg = NULL;
+
+    } else {
+        /* 失敗 */
+
+        pTimerInfo->pArg = ( void * ) ( msg.overrun + 1 );
+    }
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       ユーザタイマ満了(通知)
+ * @details     タイマを開始したタスクに通知ビットを通知する。未読の通知は合成
+ *              される。タスクが存在しない場合はタイマを解除する。
+ *
+ * @param[in]   timerId タイマID
+ * @param[in]   *pArg   通知ビット
+ */
+/******************************************************************************/
+static void UserTimeoutNtf( uint32_t timerId,
+                            void     *pArg    )
+{
+    bool       exist;   /* タスク存在確認結果 */
+    MkTaskId_t taskId;  /* タスクID           */
+
+    /* 初期化 */
+    exist  = false;
+    taskId = TimermngCtrlGetTaskId( timerId );
+
+    /* タスク存在確認 */
+    exist = TaskmngTaskCheckExist( taskId );
+
+    /* 確認結果判定 */
+    if ( exist == false ) {
+        /* 存在しない */
+
+        /* タイマ解除 */
+        TimermngCtrlUnset( timerId );
+
+        return;
+    }
+
+    /* カーネル通知送信 */
+    ItcctrlNtfSendKernel( taskId, ( uint32_t ) pArg );
 
     return;
 }
@@ -1,8 +1,8 @@
 /******************************************************************************/
 /*                                                                            */
 /* src/kernel/Timermng/TimermngCtrl.h                                         */
-/*                                                                 2021/11/27 */
-/* Copyright (C) 2018-2021 Mochi.                                             */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2018-2026 Mochi.                                             */
 /*                                                                            */
 /******************************************************************************/
 #ifndef TIMERMNG_CTRL_H
@@ -16,6 +16,9 @@ extern void CtrlInit( void );
 /* タイマ制御実行 */
 extern void CtrlRun( void );
 
+/* 高分解能タイマ制御実行 */
+extern void CtrlRunHres( void );
+
 
 /******************************************************************************/
 #endif
@@ -0,0 +1,352 @@
+/******************************************************************************/
+/*                                                                            */
+/* src/kernel/Timermng/TimermngLapic.c                                        */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2026 Mochi.                                                  */
+/*                                                                            */
+/******************************************************************************/
+/******************************************************************************/
+/* インクルード                                                               */
+/******************************************************************************/
+/* 標準ヘッダ */
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+/* 共通ヘッダ */
+#include <hardware/IA32/IA32.h>
+#include <hardware/IA32/IA32Instruction.h>
+
+/* 外部モジュールヘッダ */
+#include <Cmn.h>
+#include <Debug.h>
+#include <Intmng.h>
+#include <Taskmng.h>
+#include <Timermng.h>
+
+/* 内部モジュールヘッダ */
+#include "TimermngClock.h"
+#include "TimermngCtrl.h"
+#include "TimermngLapic.h"
+
+
+/******************************************************************************/
+/* 定義                                                                       */
+/******************************************************************************/
+/* モジュールID */
+#define _MODULE_ID_ CMN_MODULE_TIMERMNG_LAPIC
+
+/** 校正回数[回/s](校正時間10ms) */
+#define CALIB_PER_SEC ( 100 )
+
+/** LAPICタイマ管理テーブル型 */
+typedef struct {
+    uint32_t mode;          /**< タイマモード                        */
+    uint32_t tscPerUsec;    /**< マイクロ秒当たりTSC増分(0:無効)     */
+    uint64_t tscCalib;      /**< 校正時間当たりTSC増分               */
+    uint64_t lapicCalib;    /**< 校正時間当たりLAPICタイマカウント数 */
+} lapicTbl_t;
+
+
+/******************************************************************************/
+/* ローカル関数宣言                                                           */
+/******************************************************************************/
+/* 校正 */
+static void Calibrate( uint64_t tscHz );
+
+/* 割込みハンドラ */
+static void HdlInt( uint32_t        intNo,
+                    IntmngContext_t *pContext );
+
+
+/******************************************************************************/
+/* 変数定義                                                                   */
+/******************************************************************************/
+/** LAPICタイマ管理テーブル */
+static lapicTbl_t gLapicTbl;
+
+
+/******************************************************************************/
+/* グローバル関数定義                                                         */
+/******************************************************************************/
+/******************************************************************************/
+/**
+ * @brief       LAPICタイマ設定
+ * @details     指定したTSC値で割込みが発生するようLAPICタイマを設定する。TSC
+ *              デッドラインモードはTSC値をそのまま設定し、ワンショットモード
+ *              は現在のTSC値との差分を校正値でカウント数に換算して設定する。
+ *              既に経過したTSC値を指定した場合は直ちに割込みが発生する。
+ *
+ * @param[in]   deadline 割込み発生TSC値
+ */
+/******************************************************************************/
+void TimermngLapicArm( uint64_t deadline )
+{
+    uint64_t now;   /* 現在TSC値 */
+    uint64_t count; /* カウント数 */
+
+    /* 初期化 */
+    now   = 0;
+    count = 1;
+
+    /* 有効判定 */
+    if ( gLapicTbl.tscPerUsec == 0 ) {
+        /* 無効 */
+
+        return;
+    }
+
+    /* タイマモード判定 */
+    if ( gLapicTbl.mode == INTMNG_APIC_TIMER_DEADLINE ) {
+        /* TSCデッドライン */
+
+        /* デッドライン設定 */
+        IA32InstructionWrmsr( IA32_MSR_TSC_DEADLINE, deadline );
+
+        return;
+    }
+
+    /* 現在TSC値取得 */
+    now = IA32InstructionRdtsc();
+
+    /* 経過判定 */
+    if ( deadline > now ) {
+        /* 未経過 */
+
+        /* カウント数換算 */
+        count = ( deadline - now ) * gLapicTbl.lapicCalib /
+                gLapicTbl.tscCalib;
+
+        /* カウント数判定 */
+        if ( count == 0 ) {
+            /* 下限未満 */
+
+            count = 1;
+
+        } else if ( count > UINT32_MAX ) {
+            /* 上限超過 */
+
+            count = UINT32_MAX;
+        }
+    }
+
+    /* タイマ開始 */
+    IntmngApicTimerStart( ( uint32_t ) count );
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       マイクロ秒当たりTSC増分取得
+ * @details     起動時に校正したマイクロ秒当たりのTSC増分を取得する。
+ *
+ * @return      マイクロ秒当たりTSC増分を返す。
+ * @retval      0     LAPICタイマ無効
+ * @retval      0以外 マイクロ秒当たりTSC増分
+ */
+/******************************************************************************/
+uint32_t TimermngLapicGetTscPerUsec( void )
+{
+    return gLapicTbl.tscPerUsec;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       LAPICタイマ管理初期化
+ * @details     TSCとローカルAPICが使用可能な場合、高分解能タイマを有効化す
+ *              る。TSCデッドラインモードに対応する場合はTSCデッドラインモー
+ *              ドを、対応しない場合はワンショットモードを使用し、LAPICタイマ
+ *              を校正済みのTSCで校正する。
+ */
+/******************************************************************************/
+void TimermngLapicInit( void )
+{
+    CmnRet_t ret;   /* 戻り値       */
+    uint32_t eax;   /* CPUID結果EAX */
+    uint32_t ebx;   /* CPUID結果EBX */
+    uint32_t ecx;   /* CPUID結果ECX */
+    uint32_t edx;   /* CPUID結果EDX */
+    uint64_t tscHz; /* TSC周波数    */
+
+    /* 初期化 */
+    ret   = CMN_FAILURE;
+    eax   = 0;
+    ebx   = 0;
+    ecx   = 0;
+    edx   = 0;
+    tscHz = TimermngClockGetTscHz();
+
+    DEBUG_LOG_TRC( "%s() start.", __func__ );
+
+    /* LAPICタイマ管理テーブル初期化 */
+    gLapicTbl.mode       = INTMNG_APIC_TIMER_ONESHOT;
+    gLapicTbl.tscPerUsec = 0;
+    gLapicTbl.tscCalib   = 0;
+    gLapicTbl.lapicCalib = 0;
+
+    /* TSC有効判定 */
+    if ( tscHz < 1000000 ) {
+        /* 無効 */
+
+        DEBUG_LOG_TRC( "%s() end. no TSC.", __func__ );
+        return;
+    }
+
+    /* CPUID取得 */
+    IA32InstructionCpuid( 1, &eax, &ebx, &ecx, &edx );
+
+    /* TSCデッドラインモード対応判定 */
+    if ( ( ecx & IA32_CPUID_1_ECX_TSCDL ) != 0 ) {
+        /* 対応 */
+
+        gLapicTbl.mode = INTMNG_APIC_TIMER_DEADLINE;
+    }
+
+    /* LAPICタイマ初期化 */
+    ret = IntmngApicTimerInit( gLapicTbl.mode );
+
+    /* 初期化結果判定 */
+    if ( ret != CMN_SUCCESS ) {
+        /* 失敗 */
+
+        DEBUG_LOG_TRC( "%s() end. no local APIC.", __func__ );
+        return;
+    }
+
+    /* 割込みハンドラ設定 */
+    IntmngHdlSet( INTMNG_LAPIC_TIMER_VCTR,      /* 割込み番号     */
+                  HdlInt,                       /* 割込みハンドラ */
+                  IA32_DESCRIPTOR_DPL_0   );    /* 特権レベル     */
+
+    /* タイマモード判定 */
+    if ( gLapicTbl.mode == INTMNG_APIC_TIMER_ONESHOT ) {
+        /* ワンショット */
+
+        /* 校正 */
+        Calibrate( tscHz );
+
+        /* 校正結果判定 */
+        if ( gLapicTbl.lapicCalib == 0 ) {
+            /* 失敗 */
+
+            DEBUG_LOG_TRC( "%s() end. calibration failed.", __func__ );
+            return;
+        }
+    }
+
+    /* 有効化 */
+    gLapicTbl.tscPerUsec = ( uint32_t ) ( tscHz / 1000000 );
+
+    DEBUG_LOG_INF(
+        "LAPIC timer: mode=%u tscPerUsec=%u lapicCalib=%u",
+        gLapicTbl.mode,
+        gLapicTbl.tscPerUsec,
+        ( uint32_t ) gLapicTbl.lapicCalib
+    );
+
+    DEBUG_LOG_TRC( "%s() end.", __func__ );
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       LAPICタイマ停止
+ * @details     設定中のLAPICタイマを解除する。満了待ちのタイマが無くなった場
+ *              合に不要な割込みを発生させない為に使用する。
+ */
+/******************************************************************************/
+void TimermngLapicStop( void )
+{
+    /* 有効判定 */
+    if ( gLapicTbl.tscPerUsec == 0 ) {
+        /* 無効 */
+
+        return;
+    }
+
+    /* タイマモード判定 */
+    if ( gLapicTbl.mode == INTMNG_APIC_TIMER_DEADLINE ) {
+        /* TSCデッドライン */
+
+        /* デッドライン解除 */
+        IA32InstructionWrmsr( IA32_MSR_TSC_DEADLINE, 0 );
+
+    } else {
+        /* ワンショット */
+
+        /* タイマ停止 */
+        IntmngApicTimerStart( 0 );
+    }
+
+    return;
+}
+
+
+/******************************************************************************/
+/* ローカル関数定義                                                           */
+/******************************************************************************/
+/******************************************************************************/
+/**
+ * @brief       校正
+ * @details     LAPICタイマを最大カウント数で開始し、校正済みTSCで10ms経過す
+ *              るまでの間のLAPICタイマカウント数を計測する。
+ *
+ * @param[in]   tscHz TSC周波数[Hz]
+ */
+/******************************************************************************/
+static void Calibrate( uint64_t tscHz )
+{
+    uint64_t tsc;   /* 開始TSC値 */
+
+    /* 初期化 */
+    tsc = 0;
+
+    /* 計測開始 */
+    IntmngApicTimerStart( UINT32_MAX );
+    tsc = IA32InstructionRdtsc();
+
+    /* 校正時間経過待ち */
+    while ( ( IA32InstructionRdtsc() - tsc ) < ( tscHz / CALIB_PER_SEC ) );
+
+    /* 計測終了 */
+    gLapicTbl.tscCalib   = IA32InstructionRdtsc() - tsc;
+    gLapicTbl.lapicCalib = UINT32_MAX - IntmngApicTimerGetCount();
+
+    /* タイマ停止 */
+    IntmngApicTimerStart( 0 );
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       割込みハンドラ
+ * @details     LAPICタイマ割込みのEOIを通知し、高分解能タイマを処理する。
+ *
+ * @param[in]   intNo     割込み番号
+ * @param[in]   *pContext 割込み発生時コンテキスト情報(未使用)
+ */
+/******************************************************************************/
+static void HdlInt( uint32_t        intNo,
+                    IntmngContext_t *pContext )
+{
+    /* 割込み処理終了通知 */
+    IntmngApicEoi();
+
+    /* 高分解能タイマ制御実行 */
+    CtrlRunHres();
+
+    /* スケジューラ実行 */
+    TaskmngSchedExec();
+
+    return;
+}
+
+
+/******************************************************************************/
@@ -0,0 +1,34 @@
+/******************************************************************************/
+/*                                                                            */
+/* src/kernel/Timermng/TimermngLapic.h                                        */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2026 Mochi.                                                  */
+/*                                                                            */
+/******************************************************************************/
+#ifndef TIMERMNG_LAPIC_H
+#define TIMERMNG_LAPIC_H
+/******************************************************************************/
+/* インクルード                                                               */
+/******************************************************************************/
+/* 標準ヘッダ */
+#include <stdint.h>
+
+
+/******************************************************************************/
+/* グローバル関数プロトタイプ宣言                                             */
+/******************************************************************************/
+/* LAPICタイマ設定 */
+extern void TimermngLapicArm( uint64_t deadline );
+
+/* マイクロ秒当たりTSC増分取得 */
+extern uint32_t TimermngLapicGetTscPerUsec( void );
+
+/* LAPICタイマ管理初期化 */
+extern void TimermngLapicInit( void );
+
+/* LAPICタイマ停止 */
+extern void TimermngLapicStop( void );
+
+
+/******************************************************************************/
+#endif
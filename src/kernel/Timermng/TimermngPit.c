@@ -1,8 +1,8 @@
 /******************************************************************************/
 /*                                                                            */
 /* src/kernel/Timermng/TimermngPit.c                                          */
-/*                                                                 2024/06/16 */
-/* Copyright (C) 2016-2024 Mochi.                                             */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2016-2026 Mochi.                                             */
 /*                                                                            */
 /******************************************************************************/
 /******************************************************************************/
@@ -22,6 +22,7 @@
 #include <Cmn.h>
 #include <Debug.h>
 #include <Intmng.h>
+#include <Memmng.h>
 #include <Taskmng.h>
 #include <Timermng.h>
 
@@ -47,18 +48,21 @@
  * @brief       PIT割込みハンドラ
  * @details     PITからの割込み処理を行う。
  *
- * @param[in]   intNo   割込み番号
- * @param[in]   context 割込み発生時コンテキスト情報(未使用)
+ * @param[in]   intNo     割込み番号
+ * @param[in]   *pContext 割込み発生時コンテキスト情報(未使用)
  */
 /******************************************************************************/
 void TimermngPitHdlInt( uint32_t        intNo,
-                        IntmngContext_t context )
+                        IntmngContext_t *pContext )
 {
     /* デバッグトレースログ出力 *//*
     DEBUG_LOG( "%s() start. intNo=%#x", __func__, intNo );*/
 
     /* 割込み処理終了通知 */
-    IntmngPicEoi( I8259A_IRQ0 );
+    IntmngIrqEoi( I8259A_IRQ0 );
+
+    /* 共有ページtick更新 */
+    MemmngShareUpdateTick();
 
     /* タイマ制御実行 */
     CtrlRun();
@@ -98,7 +102,7 @@ void TimermngPitInit( void )
                   IA32_DESCRIPTOR_DPL_0               );    /* 特権レベル     */
 
     /* 割込み許可設定 */
-    IntmngPicAllowIrq( I8259A_IRQ0 );
+    IntmngIrqAllow( I8259A_IRQ0 );
 
     DEBUG_LOG_TRC( "%s() end.", __func__ );
 
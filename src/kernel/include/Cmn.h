@@ -1,8 +1,8 @@
 /******************************************************************************/
 /*                                                                            */
 /* src/kernel/include/Cmn.h                                                   */
-/*                                                                 2023/01/04 */
-/* Copyright (C) 2017-2023 Mochi.                                             */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2017-2026 Mochi.                                             */
 /*                                                                            */
 /******************************************************************************/
 #ifndef CMN_H
@@ -40,6 +40,7 @@
 #define CMN_MODULE_MEMMNG_IO      ( 0x0308 )/**< メモリ管理(I/O)              */
 #define CMN_MODULE_MEMMNG_VIRT    ( 0x0309 )/**< メモリ管理(仮想)             */
 #define CMN_MODULE_MEMMNG_HEAP    ( 0x030A )/**< メモリ管理(ヒープ)           */
+#define CMN_MODULE_MEMMNG_SHARE   ( 0x030B )/**< メモリ管理(共有ページ)       */
 #define CMN_MODULE_TASKMNG_MAIN   ( 0x0401 )/**< タスク管理(メイン)           */
 #define CMN_MODULE_TASKMNG_TSS    ( 0x0402 )/**< タスク管理(TSS)              */
 #define CMN_MODULE_TASKMNG_SCHED  ( 0x0403 )/**< タスク管理(スケジューラ)     */
@@ -53,17 +54,27 @@
 #define CMN_MODULE_INTMNG_IDT     ( 0x0503 )/**< 割込み管理(IDT)              */
 #define CMN_MODULE_INTMNG_HDL     ( 0x0504 )/**< 割込み管理(ハンドラ)         */
 #define CMN_MODULE_INTMNG_CTRL    ( 0x0505 )/**< 割込み管理(ハードウェア)     */
+#define CMN_MODULE_INTMNG_SYS     ( 0x0506 )/**< 割込み管理(システムコール)   */
+#define CMN_MODULE_INTMNG_STAT    ( 0x0507 )/**< 割込み管理(統計)             */
+#define CMN_MODULE_INTMNG_APIC    ( 0x0508 )/**< 割込み管理(APIC)             */
+#define CMN_MODULE_INTMNG_IRQ     ( 0x0509 )/**< 割込み管理(IRQ)              */
 #define CMN_MODULE_TIMERMNG_MAIN  ( 0x0601 )/**< タイマ管理(メイン)           */
 #define CMN_MODULE_TIMERMNG_CTRL  ( 0x0602 )/**< タイマ管理(制御)             */
 #define CMN_MODULE_TIMERMNG_PIT   ( 0x0603 )/**< タイマ管理(PIT)              */
+#define CMN_MODULE_TIMERMNG_LAPIC ( 0x0604 )/**< タイマ管理(LAPICタイマ)      */
+#define CMN_MODULE_TIMERMNG_CLOCK ( 0x0605 )/**< タイマ管理(時刻)             */
 #define CMN_MODULE_ITCCTRL_MAIN   ( 0x0701 )/**< タスク間通信制御(メイン)     */
 #define CMN_MODULE_ITCCTRL_MSG    ( 0x0702 )/**< タスク間通信制御(メッセージ) */
+#define CMN_MODULE_ITCCTRL_EVENT  ( 0x0703 )/**< タスク間通信制御(イベント)   */
+#define CMN_MODULE_ITCCTRL_NTF    ( 0x0704 )/**< タスク間通信制御(通知)       */
+#define CMN_MODULE_ITCCTRL_PUB    ( 0x0705 )/**< タスク間通信制御(出版購読)   */
+#define CMN_MODULE_ITCCTRL_EP     ( 0x0706 )/**< タスク間通信制御(EP)         */
 #define CMN_MODULE_IOCTRL_MAIN    ( 0x0801 )/**< 入出力制御(メイン)           */
 #define CMN_MODULE_IOCTRL_PORT    ( 0x0802 )/**< 入出力制御(ポート)           */
 #define CMN_MODULE_IOCTRL_MEM     ( 0x0803 )/**< 入出力制御(I/Oメモリ)        */
 
 /** モジュール・サブモジュール数 */
-#define CMN_MODULE_NUM           ( 35 )
+#define CMN_MODULE_NUM           ( 44 )
 
 /** 処理結果構造体 */
 typedef int32_t CmnRet_t;
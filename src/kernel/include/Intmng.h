@@ -1,8 +1,8 @@
 /******************************************************************************/
 /*                                                                            */
 /* src/kernel/include/Intmng.h                                                */
-/*                                                                 2021/11/27 */
-/* Copyright (C) 2018-2021 Mochi.                                             */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2018-2026 Mochi.                                             */
 /*                                                                            */
 /******************************************************************************/
 #ifndef INTMNG_H
@@ -11,12 +11,19 @@
 /* インクルード                                                               */
 /******************************************************************************/
 /* 標準ヘッダ */
+#include <stdbool.h>
 #include <stdint.h>
 
+/* カーネルヘッダ */
+#include <kernel/types.h>
+
 /* 共通ヘッダ */
 #include <hardware/IA32/IA32.h>
 #include <hardware/IA32/IA32Descriptor.h>
 
+/* 外部モジュールヘッダ */
+#include <Cmn.h>
+
 
 /******************************************************************************/
 /* 定義                                                                       */
@@ -28,6 +35,31 @@
 
 /** PICベクタ番号ベース */
 #define INTMNG_PIC_VCTR_BASE ( 0x20 )
+/** 拡張IRQベクタ番号ベース */
+#define INTMNG_EXT_VCTR_BASE ( 0x40 )
+/** ローカルAPICタイマベクタ番号 */
+#define INTMNG_LAPIC_TIMER_VCTR ( 0xFE )
+/** スプリアス割込みベクタ番号 */
+#define INTMNG_SPURIOUS_VCTR ( 0xFF )
+
+/* ローカルAPICタイマモード定義 */
+#define INTMNG_APIC_TIMER_ONESHOT  ( 0 )    /**< ワンショット    */
+#define INTMNG_APIC_TIMER_DEADLINE ( 1 )    /**< TSCデッドライン */
+
+/* IRQ番号定義 */
+#define INTMNG_IRQ_ISA_NUM   ( 16 )     /**< ISA IRQ数          */
+#define INTMNG_IRQ_NUM       ( 24 )     /**< IRQ数              */
+
+/** IRQ番号→割込み番号変換 */
+#define INTMNG_IRQ_TO_INTNO( _IRQNO )                                   \
+    ( ( ( _IRQNO ) < INTMNG_IRQ_ISA_NUM )                            ?  \
+      ( INTMNG_PIC_VCTR_BASE + ( _IRQNO )                          ) :  \
+      ( INTMNG_EXT_VCTR_BASE + ( _IRQNO ) - INTMNG_IRQ_ISA_NUM     )    )
+/** 割込み番号→IRQ番号変換 */
+#define INTMNG_INTNO_TO_IRQ( _INTNO )                                   \
+    ( ( ( _INTNO ) < INTMNG_EXT_VCTR_BASE )                          ?  \
+      ( ( _INTNO ) - INTMNG_PIC_VCTR_BASE                          ) :  \
+      ( ( _INTNO ) - INTMNG_EXT_VCTR_BASE + INTMNG_IRQ_ISA_NUM     )    )
 
 /** セグメントレジスタ情報 */
 typedef struct {
@@ -41,13 +73,18 @@ typedef struct {
 typedef struct {
     IA32Pushad_t    genReg;     /**< 汎用レジスタ       */
     IntmngSegReg_t  segReg;     /**< セグメントレジスタ */
+    uint32_t        intNo;      /**< 割込み番号         */
     IA32ErrCode_t   errCode;    /**< エラーコード       */
     IA32IretdInfo_t iretdInfo;  /**< 割込みリターン情報 */
 } IntmngContext_t;
 
 /** 割込みハンドラ関数型 */
 typedef void ( *IntmngHdl_t )( uint32_t        intNo,
-                               IntmngContext_t context );
+                               IntmngContext_t *pContext );
+
+/** システムコールハンドラ関数型 */
+typedef void ( *IntmngSysHdl_t )( uint32_t     no,
+                                  IA32Pushad_t *pReg );
 
 
 /******************************************************************************/
@@ -59,6 +96,27 @@ typedef void ( *IntmngHdl_t )( uint32_t        intNo,
 /* 割込み管理初期化 */
 extern void IntmngInit( void );
 
+/*--------------*/
+/* IntmngApic.c */
+/*--------------*/
+/* APIC割込みEOI通知 */
+extern void IntmngApicEoi( void );
+
+/* ローカルAPICタイマカウント取得 */
+extern uint32_t IntmngApicTimerGetCount( void );
+
+/* ローカルAPICタイマ初期化 */
+extern CmnRet_t IntmngApicTimerInit( uint32_t mode );
+
+/* ローカルAPICタイマ開始 */
+extern void IntmngApicTimerStart( uint32_t count );
+
+/*--------------*/
+/* IntmngCtrl.c */
+/*--------------*/
+/* 割込み発生IRQリスト取得 */
+extern uint32_t IntmngCtrlGetIntList( MkTaskId_t taskId );
+
 /*-------------*/
 /* IntmngHdl.c */
 /*-------------*/
@@ -68,22 +126,41 @@ extern void IntmngHdlSet( uint32_t    intNo,
                           uint8_t     level  );
 
 /*-------------*/
-/* IntmngPic.c */
+/* IntmngIrq.c */
 /*-------------*/
-/* PIC割込み許可 */
-extern void IntmngPicAllowIrq( uint8_t irqNo );
+/* IRQ割込み許可 */
+extern void IntmngIrqAllow( uint8_t irqNo );
 
-/* PIC割込み拒否 */
-extern void IntmngPicDenyIrq( uint8_t irqNo );
+/* IRQ割込み処理完了 */
+extern void IntmngIrqComplete( uint8_t irqNo );
 
-/* PIC割込み無効化 */
-extern void IntmngPicDisable( void );
+/* IRQ割込み処理委譲 */
+extern void IntmngIrqDefer( uint8_t irqNo );
 
-/* PIC割込み有効化 */
-extern void IntmngPicEnable( void );
+/* IRQ割込み拒否 */
+extern void IntmngIrqDeny( uint8_t irqNo );
 
-/* PIC割込みEOI通知 */
-extern void IntmngPicEoi( uint8_t irqNo );
+/* IRQ割込み無効化 */
+extern void IntmngIrqDisable( void );
+
+/* IRQ割込み有効化 */
+extern void IntmngIrqEnable( void );
+
+/* IRQ割込みEOI通知 */
+extern void IntmngIrqEoi( uint8_t irqNo );
+
+/* IRQ数取得 */
+extern uint8_t IntmngIrqGetNum( void );
+
+/* IRQレベルトリガ判定 */
+extern bool IntmngIrqIsLevel( uint8_t irqNo );
+
+/*-------------*/
+/* IntmngSys.c */
+/*-------------*/
+/* システムコールハンドラ設定 */
+extern void IntmngSysSet( uint32_t       no,
+                          IntmngSysHdl_t func );
 
 
 /******************************************************************************/
@@ -1,12 +1,27 @@
 /******************************************************************************/
 /*                                                                            */
 /* src/kernel/include/Itcctrl.h                                               */
-/*                                                                 2021/11/27 */
-/* Copyright (C) 2018-2021 Mochi.                                             */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2018-2026 Mochi.                                             */
 /*                                                                            */
 /******************************************************************************/
 #ifndef ITCCTRL_H
 #define ITCCTRL_H
+/******************************************************************************/
+/* インクルード                                                               */
+/******************************************************************************/
+/* 標準ヘッダ */
+#include <stddef.h>
+#include <stdint.h>
+
+/* カーネルヘッダ */
+#include <kernel/event.h>
+#include <kernel/types.h>
+
+/* 外部モジュールヘッダ */
+#include <Cmn.h>
+
+
 /******************************************************************************/
 /* グローバル関数プロトタイプ宣言                                             */
 /******************************************************************************/
@@ -16,6 +31,29 @@
 /* タスク間通信制御初期化 */
 extern void ItcctrlInit( void );
 
+/*----------------*/
+/* ItcctrlEvent.c */
+/*----------------*/
+/* イベント通知 */
+extern void ItcctrlEventNotify( MkTaskId_t taskId,
+                                uint32_t   event   );
+
+/*--------------*/
+/* ItcctrlMsg.c */
+/*--------------*/
+/* カーネルメッセージ送信 */
+extern CmnRet_t ItcctrlMsgSendKernel( MkTaskId_t dst,
+                                      const void *pMsg,
+                                      size_t     size,
+                                      MkErr_t    *pErr );
+
+/*--------------*/
+/* ItcctrlNtf.c */
+/*--------------*/
+/* カーネル通知送信 */
+extern void ItcctrlNtfSendKernel( MkTaskId_t dst,
+                                  uint32_t   bits );
+
 
 /******************************************************************************/
 #endif
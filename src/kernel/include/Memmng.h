@@ -1,8 +1,8 @@
 /******************************************************************************/
 /*                                                                            */
 /* src/kernel/include/Memmng.h                                                */
-/*                                                                 2024/08/10 */
-/* Copyright (C) 2016-2024 Mochi.                                             */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2016-2026 Mochi.                                             */
 /*                                                                            */
 /******************************************************************************/
 #ifndef MEMMNG_H
@@ -166,6 +166,28 @@ extern void *MemmngPhysAlloc( size_t size );
 /* 物理メモリ領域解放 */
 extern CmnRet_t MemmngPhysFree( void *pAddr );
 
+/*---------------*/
+/* MemmngShare.c */
+/*---------------*/
+/* 共有ページ割込み発生回数加算 */
+extern void MemmngShareAddInt( uint32_t idx,
+                               uint8_t  irqNo );
+/* 共有ページ割込み発生回数取得 */
+extern uint32_t MemmngShareGetInt( uint32_t idx,
+                                   uint8_t  irqNo );
+/* 共有ページ割込み状態割当て */
+extern void MemmngShareSetInt( uint32_t   idx,
+                               MkTaskId_t taskId );
+/* 共有ページ時刻情報設定 */
+extern void MemmngShareSetClock( uint64_t tscHz,
+                                 uint64_t tscBase,
+                                 uint64_t realBase );
+/* 共有ページ実行中タスク設定 */
+extern void MemmngShareSetTask( MkTaskId_t taskId,
+                                MkPid_t    pid     );
+/* 共有ページtick更新 */
+extern void MemmngShareUpdateTick( void );
+
 /*--------------*/
 /* MemmngSgmt.c */
 /*--------------*/
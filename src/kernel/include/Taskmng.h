@@ -1,8 +1,8 @@
 /******************************************************************************/
 /*                                                                            */
 /* src/kernel/include/Taskmng.h                                               */
-/*                                                                 2021/05/22 */
-/* Copyright (C) 2018-2021 Mochi.                                             */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2018-2026 Mochi.                                             */
 /*                                                                            */
 /******************************************************************************/
 #ifndef TASKMNG_H
@@ -49,6 +49,10 @@ extern void TaskmngInit( void );
 /*----------------*/
 /* スケジューラ実行 */
 extern void TaskmngSchedExec( void );
+#ifdef INTMNG_STAT_ENABLE
+/* タスクスイッチ時TSC値取得 */
+extern uint64_t TaskmngSchedGetSwitchTsc( void );
+#endif
 /* タスクID取得 */
 extern MkTaskId_t TaskmngSchedGetTaskId( void );
 /* スケジュール開始 */
@@ -75,6 +79,12 @@ extern uint8_t TaskmngTaskGetType( MkTaskId_t taskId );
 extern uint8_t TaskmngTaskGetTypeDiff( MkTaskId_t taskId1,
                                        MkTaskId_t taskId2  );
 
+/*--------------*/
+/* TaskmngTss.c */
+/*--------------*/
+/* ESP0格納先アドレス取得 */
+extern uint32_t *TaskmngTssGetEsp0Addr( void );
+
 
 /******************************************************************************/
 #endif
@@ -1,8 +1,8 @@
 /******************************************************************************/
 /*                                                                            */
 /* src/kernel/include/Timermng.h                                              */
-/*                                                                 2021/11/27 */
-/* Copyright (C) 2018-2021 Mochi.                                             */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2018-2026 Mochi.                                             */
 /*                                                                            */
 /******************************************************************************/
 #ifndef TIMERMNG_H
@@ -14,6 +14,7 @@
 #include <stdint.h>
 
 /* カーネルヘッダ */
+#include <kernel/sysstat.h>
 #include <kernel/types.h>
 
 /* 外部モジュールヘッダ */
@@ -24,8 +25,8 @@
 /* 定義                                                                       */
 /******************************************************************************/
 /* タイマID */
-#define TIMERMNG_TIMERID_MIN  (    0 )                      /**< タイマID最小値 */
-#define TIMERMNG_TIMERID_MAX  ( 1023 )                      /**< タイマID最大値 */
+#define TIMERMNG_TIMERID_MIN  (     0 )                     /**< タイマID最小値 */
+#define TIMERMNG_TIMERID_MAX  ( 65535 )                     /**< タイマID最大値 */
 #define TIMERMNG_TIMERID_NUM  ( TIMERMNG_TIMERID_MAX + 1 )  /**< タイマID数     */
 #define TIMERMNG_TIMERID_NULL ( TIMERMNG_TIMERID_NUM     )  /**< 無効タイマID   */
 
@@ -33,7 +34,13 @@
 #define TIMERMNG_TYPE_ONESHOT ( 0 )     /**< ワンショットタイマ種別 */
 #define TIMERMNG_TYPE_REPEAT  ( 1 )     /**< 繰り返しタイマ種別     */
 
-/** タイマコールバック関数型 */
+/**
+ * タイマコールバック関数型
+ *
+ * タイマ割込み処理中に満了タイマ毎に呼び出す。スケジューラは同一割込みで満了
+ * した全タイマのコールバック関数呼出し後に割込みハンドラが実行する為、コール
+ * バック関数内ではTaskmngSchedExec()を呼び出さない。
+ */
 typedef void ( *TimermngFunc_t )( uint32_t timerId, void *pArg );
 
 
@@ -50,6 +57,11 @@ extern void TimermngInit( void );
 /*----------------*/
 /* TimermngCtrl.c */
 /*----------------*/
+#ifdef INTMNG_STAT_ENABLE
+/* タイマ合体統計取得 */
+extern void TimermngCtrlGetStat( MkTimerStat_t *pStat );
+#endif
+
 /* タスクID取得 */
 extern MkTaskId_t TimermngCtrlGetTaskId( uint32_t timerId );
 
@@ -59,6 +71,10 @@ extern uint32_t TimermngCtrlSet( uint32_t       usec,
                                  TimermngFunc_t pFunc,
                                  void           *pArg  );
 
+/* タイマスラック設定 */
+extern void TimermngCtrlSetSlack( uint32_t timerId,
+                                  uint32_t slack    );
+
 /* タイマ解除 */
 extern void TimermngCtrlUnset( uint32_t timerId );
 
@@ -68,7 +84,7 @@ extern void TimermngCtrlUnset( uint32_t timerId );
 /*---------------*/
 /* PIT割込みハンドラ */
 extern void TimermngPitHdlInt( uint32_t        intNo,
-                               IntmngContext_t context );
+                               IntmngContext_t *pContext );
 
 
 /******************************************************************************/
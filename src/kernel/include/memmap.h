@@ -1,8 +1,8 @@
 /******************************************************************************/
 /*                                                                            */
 /* src/kernel/include/memmap.h                                                */
-/*                                                                 2024/07/21 */
-/* Copyright (C) 2023-2024 Mochi.                                             */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2023-2026 Mochi.                                             */
 /*                                                                            */
 /******************************************************************************/
 #ifndef MEMMAP_H
@@ -12,6 +12,7 @@
 /******************************************************************************/
 /* カーネルヘッダ */
 #include <kernel/kernel.h>
+#include <kernel/sharedpage.h>
 
 
 /******************************************************************************/
@@ -39,32 +40,36 @@
 /*--------------------------*/
 /* 仮想メモリマップアドレス */
 /*--------------------------*/
-#define MEMMAP_VADDR_BOOTDATA     ( 0x00000000 )    /**< ブートデータ仮想アドレス          */
-#define MEMMAP_VADDR_KERNEL       ( MK_ADDR_ENTRY ) /**< カーネル領域仮想アドレス          */
-#define MEMMAP_VADDR_KERNEL_STACK ( 0x3EFFBFFC )    /**< カーネルスタック仮想アドレス      */
-#define MEMMAP_VADDR_KERNEL_PD1   ( 0x3EFFC000 )    /**< ページディレクトリch1仮想アドレス */
-#define MEMMAP_VADDR_KERNEL_PT1   ( 0x3EFFD000 )    /**< ページテーブルch1仮想アドレス     */
-#define MEMMAP_VADDR_KERNEL_PD2   ( 0x3EFFE000 )    /**< ページディレクトリch2仮想アドレス */
-#define MEMMAP_VADDR_KERNEL_PT2   ( 0x3EFFF000 )    /**< ページテーブルch2仮想アドレス     */
-#define MEMMAP_VADDR_KERNEL_CTRL1 ( 0x3F000000 )    /**< メモリ制御領域ch1仮想アドレス     */
-#define MEMMAP_VADDR_KERNEL_CTRL2 ( 0x3F800000 )    /**< メモリ制御領域ch2仮想アドレス     */
-#define MEMMAP_VADDR_USER         ( 0x40000000 )    /**< ユーザ領域仮想アドレス            */
-#define MEMMAP_VADDR_USER_STACK   ( 0xBFFF8000 )    /**< ユーザスタック仮想アドレス        */
+#define MEMMAP_VADDR_BOOTDATA     ( 0x00000000 )         /**< ブートデータ仮想アドレス          */
+#define MEMMAP_VADDR_KERNEL       ( MK_ADDR_ENTRY )      /**< カーネル領域仮想アドレス          */
+#define MEMMAP_VADDR_KERNEL_APIC  ( 0x3EFF0000 )         /**< APICレジスタ仮想アドレス          */
+#define MEMMAP_VADDR_KERNEL_STACK ( 0x3EFFBFFC )         /**< カーネルスタック仮想アドレス      */
+#define MEMMAP_VADDR_KERNEL_PD1   ( 0x3EFFC000 )         /**< ページディレクトリch1仮想アドレス */
+#define MEMMAP_VADDR_KERNEL_PT1   ( 0x3EFFD000 )         /**< ページテーブルch1仮想アドレス     */
+#define MEMMAP_VADDR_KERNEL_PD2   ( 0x3EFFE000 )         /**< ページディレクトリch2仮想アドレス */
+#define MEMMAP_VADDR_KERNEL_PT2   ( 0x3EFFF000 )         /**< ページテーブルch2仮想アドレス     */
+#define MEMMAP_VADDR_KERNEL_CTRL1 ( 0x3F000000 )         /**< メモリ制御領域ch1仮想アドレス     */
+#define MEMMAP_VADDR_KERNEL_CTRL2 ( 0x3F800000 )         /**< メモリ制御領域ch2仮想アドレス     */
+#define MEMMAP_VADDR_USER         ( 0x40000000 )         /**< ユーザ領域仮想アドレス            */
+#define MEMMAP_VADDR_USER_SHARED  ( MK_SHAREDPAGE_ADDR ) /**< 共有ページ仮想アドレス            */
+#define MEMMAP_VADDR_USER_STACK   ( 0xBFFF8000 )         /**< ユーザスタック仮想アドレス        */
 
 /*------------------------*/
 /* 仮想メモリマップサイズ */
 /*------------------------*/
-#define MEMMAP_VSIZE_BOOTDATA     ( 0x00100000 )    /**< ブートデータ仮想サイズ          */
-#define MEMMAP_VSIZE_KERNEL       ( 0x3FF00000 )    /**< カーネル領域仮想サイズ          */
-#define MEMMAP_VSIZE_KERNEL_STACK ( 0x00002000 )    /**< カーネルスタック仮想サイズ      */
-#define MEMMAP_VSIZE_KERNEL_PD1   ( 0x00001000 )    /**< ページディレクトリch1仮想サイズ */
-#define MEMMAP_VSIZE_KERNEL_PT1   ( 0x00001000 )    /**< ページテーブルch1仮想サイズ     */
-#define MEMMAP_VSIZE_KERNEL_PD2   ( 0x00001000 )    /**< ページディレクトリch2仮想サイズ */
-#define MEMMAP_VSIZE_KERNEL_PT2   ( 0x00001000 )    /**< ページテーブルch2仮想サイズ     */
-#define MEMMAP_VSIZE_KERNEL_CTRL1 ( 0x00800000 )    /**< メモリ制御領域ch1仮想サイズ     */
-#define MEMMAP_VSIZE_KERNEL_CTRL2 ( 0x00800000 )    /**< メモリ制御領域ch2仮想サイズ     */
-#define MEMMAP_VSIZE_USER         ( 0x80000000 )    /**< ユーザ領域仮想サイズ            */
-#define MEMMAP_VSIZE_USER_STACK   ( 0x00008000 )    /**< ユーザスタック仮想アドレス      */
+#define MEMMAP_VSIZE_BOOTDATA     ( 0x00100000 )         /**< ブートデータ仮想サイズ          */
+#define MEMMAP_VSIZE_KERNEL       ( 0x3FF00000 )         /**< カーネル領域仮想サイズ          */
+#define MEMMAP_VSIZE_KERNEL_APIC  ( 0x00008000 )         /**< APICレジスタ仮想サイズ          */
+#define MEMMAP_VSIZE_KERNEL_STACK ( 0x00002000 )         /**< カーネルスタック仮想サイズ      */
+#define MEMMAP_VSIZE_KERNEL_PD1   ( 0x00001000 )         /**< ページディレクトリch1仮想サイズ */
+#define MEMMAP_VSIZE_KERNEL_PT1   ( 0x00001000 )         /**< ページテーブルch1仮想サイズ     */
+#define MEMMAP_VSIZE_KERNEL_PD2   ( 0x00001000 )         /**< ページディレクトリch2仮想サイズ */
+#define MEMMAP_VSIZE_KERNEL_PT2   ( 0x00001000 )         /**< ページテーブルch2仮想サイズ     */
+#define MEMMAP_VSIZE_KERNEL_CTRL1 ( 0x00800000 )         /**< メモリ制御領域ch1仮想サイズ     */
+#define MEMMAP_VSIZE_KERNEL_CTRL2 ( 0x00800000 )         /**< メモリ制御領域ch2仮想サイズ     */
+#define MEMMAP_VSIZE_USER         ( 0x80000000 )         /**< ユーザ領域仮想サイズ            */
+#define MEMMAP_VSIZE_USER_SHARED  ( MK_SHAREDPAGE_SIZE ) /**< 共有ページ仮想サイズ            */
+#define MEMMAP_VSIZE_USER_STACK   ( 0x00008000 )         /**< ユーザスタック仮想アドレス      */
 
 
 /******************************************************************************/
@@ -0,0 +1,268 @@
+/******************************************************************************/
+/*                                                                            */
+/* src/lib/libmk/LibMkEp.c                                                    */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2026 Mochi.                                                  */
+/*                                                                            */
+/******************************************************************************/
+/******************************************************************************/
+/* インクルード                                                               */
+/******************************************************************************/
+/* 標準ヘッダ */
+#include <stddef.h>
+#include <stdint.h>
+
+/* ライブラリヘッダ */
+#include <MLib/MLib.h>
+
+/* カーネルヘッダ */
+#include <kernel/endpoint.h>
+#include <kernel/message.h>
+
+/* モジュールヘッダ */
+#include "LibMkSys.h"
+
+
+/******************************************************************************/
+/* グローバル関数宣言                                                         */
+/******************************************************************************/
+/******************************************************************************/
+/**
+ * @brief       エンドポイント生成
+ * @details     メッセージ受信用のエンドポイントを生成する。生成したエンドポ
+ *              イントは自プロセスが所有し、自プロセス内の全てのスレッドから受
+ *              信できる。
+ *
+ * @param[out]  *pEpId エンドポイントID
+ * @param[out]  *pErr  エラー内容
+ *                  - MK_ERR_NONE        エラー無し
+ *                  - MK_ERR_NO_RESOURCE リソース不足
+ *
+ * @return      処理結果を返す。
+ * @retval      MK_RET_SUCCESS 成功
+ * @retval      MK_RET_FAILURE 失敗
+ */
+/******************************************************************************/
+MkRet_t LibMkEpCreate( MkEpId_t *pEpId,
+                       MkErr_t  *pErr   )
+{
+    volatile MkEpParam_t param;
+
+    /* パラメータ設定 */
+    param.funcId = MK_EP_FUNCID_CREATE;
+    param.ret    = MK_RET_FAILURE;
+    param.err    = MK_ERR_NONE;
+    param.epId   = MK_EPID_NULL;
+
+    /* カーネルコール */
+    LibMkSysCallParam( MK_SYSCALL_EP, &param );
+
+    /* エラー内容設定 */
+    MLIB_SET_IFNOT_NULL( pErr, param.err );
+
+    /* エンドポイントID設定 */
+    MLIB_SET_IFNOT_NULL( pEpId, param.epId );
+
+    return param.ret;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       エンドポイント削除
+ * @details     自プロセスが所有するエンドポイントを削除する。未受信のメッセ
+ *              ージは破棄され、受信待ち中のスレッドはMK_ERR_NO_EXISTで受信に
+ *              失敗する。
+ *
+ * @param[in]   epId  エンドポイントID
+ * @param[out]  *pErr エラー内容
+ *                  - MK_ERR_NONE         エラー無し
+ *                  - MK_ERR_NO_EXIST     存在しないエンドポイント
+ *                  - MK_ERR_UNAUTHORIZED 所有プロセスでない
+ *
+ * @return      処理結果を返す。
+ * @retval      MK_RET_SUCCESS 成功
+ * @retval      MK_RET_FAILURE 失敗
+ */
+/******************************************************************************/
+MkRet_t LibMkEpDelete( MkEpId_t epId,
+                       MkErr_t  *pErr )
+{
+    volatile MkEpParam_t param;
+
+    /* パラメータ設定 */
+    param.funcId = MK_EP_FUNCID_DELETE;
+    param.ret    = MK_RET_FAILURE;
+    param.err    = MK_ERR_NONE;
+    param.epId   = epId;
+
+    /* カーネルコール */
+    LibMkSysCallParam( MK_SYSCALL_EP, &param );
+
+    /* エラー内容設定 */
+    MLIB_SET_IFNOT_NULL( pErr, param.err );
+
+    return param.ret;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       エンドポイントキュー統計取得
+ * @details     自プロセスが所有するエンドポイントのキュー統計を取得する。
+ *
+ * @param[in]   epId   エンドポイントID
+ * @param[out]  *pStat キュー統計格納先
+ * @param[out]  *pErr  エラー内容
+ *                  - MK_ERR_NONE         エラー無し
+ *                  - MK_ERR_PARAM        パラメータ不正
+ *                  - MK_ERR_NO_EXIST     存在しないエンドポイント
+ *                  - MK_ERR_UNAUTHORIZED 所有プロセスでない
+ *
+ * @return      処理結果を返す。
+ * @retval      MK_RET_SUCCESS 成功
+ * @retval      MK_RET_FAILURE 失敗
+ */
+/******************************************************************************/
+MkRet_t LibMkEpGetStat( MkEpId_t         epId,
+                        MkMsgQueueStat_t *pStat,
+                        MkErr_t          *pErr   )
+{
+    volatile MkEpParam_t param;
+
+    /* パラメータ設定 */
+    param.funcId = MK_EP_FUNCID_GET_STAT;
+    param.ret    = MK_RET_FAILURE;
+    param.err    = MK_ERR_NONE;
+    param.epId   = epId;
+    param.pStat  = pStat;
+
+    /* カーネルコール */
+    __asm__ __volatile__ ( "mov esi, %0\n"
+                           "int %1"
+                           :
+                           : "a" ( &param      ),
+                             "i" ( MK_EP_INTNO )
+                           : "esi"                );
+
+    /* エラー内容設定 */
+    MLIB_SET_IFNOT_NULL( pErr, param.err );
+
+    return param.ret;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       エンドポイントメッセージ受信
+ * @details     エンドポイントからメッセージを受信する。メッセージが無い場合は
+ *              受信するまで待ち合わせる。複数スレッドが受信待ちの場合は、先に
+ *              受信待ちとなったスレッドからメッセージを受け取る。
+ *
+ * @param[in]   epId        エンドポイントID
+ * @param[in]   *pBuffer    受信バッファ
+ * @param[in]   bufferSize  受信バッファサイズ
+ * @param[out]  *pSrcTaskId 送信元タスクID
+ * @param[out]  *pRecvSize  受信メッセージサイズ
+ * @param[in]   timeout     タイムアウト時間[us]
+ *                  - 0     タイムアウト無し
+ *                  - 0以外 タイムアウト時間
+ * @param[out]  *pErr       エラー内容
+ *                  - MK_ERR_NONE         エラー無し
+ *                  - MK_ERR_NO_EXIST     存在しないエンドポイント
+ *                  - MK_ERR_UNAUTHORIZED 所有プロセスでない
+ *                  - MK_ERR_NO_RESOURCE  リソース不足
+ *                  - MK_ERR_TIMEOUT      タイムアウト
+ *
+ * @return      処理結果を返す。
+ * @retval      MK_RET_SUCCESS 成功
+ * @retval      MK_RET_FAILURE 失敗
+ */
+/******************************************************************************/
+MkRet_t LibMkEpReceive( MkEpId_t   epId,
+                        void       *pBuffer,
+                        size_t     bufferSize,
+                        MkTaskId_t *pSrcTaskId,
+                        size_t     *pRecvSize,
+                        uint32_t   timeout,
+                        MkErr_t    *pErr        )
+{
+    volatile MkEpParam_t param;
+
+    /* パラメータ設定 */
+    param.funcId     = MK_EP_FUNCID_RECEIVE;
+    param.ret        = MK_RET_FAILURE;
+    param.err        = MK_ERR_NONE;
+    param.epId       = epId;
+    param.src        = MK_TASKID_NULL;
+    param.pMsg       = pBuffer;
+    param.bufferSize = bufferSize;
+    param.size       = 0;
+    param.timeout    = timeout;
+
+    /* カーネルコール */
+    LibMkSysCallParam( MK_SYSCALL_EP, &param );
+
+    /* エラー内容設定 */
+    MLIB_SET_IFNOT_NULL( pErr, param.err );
+
+    /* 送信元タスクID設定 */
+    MLIB_SET_IFNOT_NULL( pSrcTaskId, param.src );
+
+    /* 受信メッセージサイズ設定 */
+    MLIB_SET_IFNOT_NULL( pRecvSize, param.size );
+
+    return param.ret;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       エンドポイントメッセージ送信
+ * @details     エンドポイントにメッセージを送信する。受信待ちのスレッドが有る
+ *              場合は直接引き渡す。送信はブロックせず、キューの最大メッセージ
+ *              数または最大サイズを超える場合は失敗する。
+ *
+ * @param[in]   epId  エンドポイントID
+ * @param[in]   *pMsg 送信メッセージ
+ * @param[in]   size  送信メッセージサイズ
+ * @param[out]  *pErr エラー内容
+ *                  - MK_ERR_NONE         エラー無し
+ *                  - MK_ERR_PARAM        パラメータ不正
+ *                  - MK_ERR_NO_EXIST     存在しないエンドポイント
+ *                  - MK_ERR_UNAUTHORIZED 非隣接プロセスタイプ
+ *                  - MK_ERR_QUEUE_FULL   キュー満杯
+ *                  - MK_ERR_SIZE_OVER    キューサイズ上限超過
+ *                  - MK_ERR_NO_MEMORY    メモリ不足
+ *
+ * @return      処理結果を返す。
+ * @retval      MK_RET_SUCCESS 成功
+ * @retval      MK_RET_FAILURE 失敗
+ */
+/******************************************************************************/
+MkRet_t LibMkEpSend( MkEpId_t epId,
+                     void     *pMsg,
+                     size_t   size,
+                     MkErr_t  *pErr )
+{
+    volatile MkEpParam_t param;
+
+    /* パラメータ設定 */
+    param.funcId = MK_EP_FUNCID_SEND;
+    param.ret    = MK_RET_FAILURE;
+    param.err    = MK_ERR_NONE;
+    param.epId   = epId;
+    param.pMsg   = pMsg;
+    param.size   = size;
+
+    /* カーネルコール */
+    LibMkSysCallParam( MK_SYSCALL_EP, &param );
+
+    /* エラー内容設定 */
+    MLIB_SET_IFNOT_NULL( pErr, param.err );
+
+    return param.ret;
+}
+
+
+/******************************************************************************/
@@ -0,0 +1,110 @@
+/******************************************************************************/
+/*                                                                            */
+/* src/lib/libmk/LibMkEvent.c                                                 */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2026 Mochi.                                                  */
+/*                                                                            */
+/******************************************************************************/
+/******************************************************************************/
+/* インクルード                                                               */
+/******************************************************************************/
+/* 標準ヘッダ */
+#include <stdint.h>
+
+/* ライブラリヘッダ */
+#include <MLib/MLib.h>
+
+/* カーネルヘッダ */
+#include <kernel/event.h>
+
+/* モジュールヘッダ */
+#include "LibMkSys.h"
+
+
+/******************************************************************************/
+/* グローバル関数宣言                                                         */
+/******************************************************************************/
+/******************************************************************************/
+/**
+ * @brief       イベント待ち合わせ
+ * @details     指定したイベントのいずれかが発生するまで待ち合わせ、発生したイ
+ *              ベントを返す。イベントは消費しないため、メッセージ受信やハード
+ *              ウェア割込み待ち合わせは発生イベントに応じて別途呼び出す。
+ *
+ * @param[in]   events     待ち合わせイベント
+ *                  - MK_EVENT_MSG   メッセージ受信
+ *                  - MK_EVENT_INT   ハードウェア割込み
+ *                  - MK_EVENT_TIMER タイマ満了
+ *                  - MK_EVENT_NTF   通知
+ * @param[in]   *pSrc      受信待ち送信元タスクIDリスト
+ * @param[in]   srcNum     受信待ち送信元タスク数
+ *                  - 0     全てのタスク
+ *                  - 0以外 タスク指定(MK_EVENT_SRC_NUM以下)
+ * @param[in]   timeout    タイマ満了時間[us]
+ * @param[out]  *pOccurred 発生イベント
+ * @param[out]  *pIntList  割込み発生IRQリスト
+ * @param[out]  *pErr      エラー内容
+ *                  - MK_ERR_NONE        エラー無し
+ *                  - MK_ERR_PARAM       パラメータ不正
+ *                  - MK_ERR_NO_RESOURCE リソース不足
+ *
+ * @return      処理結果を返す。
+ * @retval      MK_RET_SUCCESS 成功
+ * @retval      MK_RET_FAILURE 失敗
+ */
+/******************************************************************************/
+MkRet_t LibMkEventWait( uint32_t   events,
+                        MkTaskId_t *pSrc,
+                        uint32_t   srcNum,
+                        uint32_t   timeout,
+                        uint32_t   *pOccurred,
+                        uint32_t   *pIntList,
+                        MkErr_t    *pErr       )
+{
+    uint32_t                idx;
+    volatile MkEventParam_t param;
+
+    /* 引数チェック */
+    if ( (   srcNum >  MK_EVENT_SRC_NUM         ) ||
+         ( ( srcNum != 0 ) && ( pSrc == NULL ) )    ) {
+        /* 不正 */
+
+        /* エラー内容設定 */
+        MLIB_SET_IFNOT_NULL( pErr, MK_ERR_PARAM );
+
+        return MK_RET_FAILURE;
+    }
+
+    /* パラメータ設定 */
+    param.funcId   = MK_EVENT_FUNCID_WAIT;
+    param.ret      = MK_RET_FAILURE;
+    param.err      = MK_ERR_NONE;
+    param.events   = events;
+    param.srcNum   = srcNum;
+    param.timeout  = timeout;
+    param.occurred = 0;
+    param.intList  = 0;
+
+    /* 送信元タスクID毎に繰り返す */
+    for ( idx = 0; idx < srcNum; idx++ ) {
+        /* 送信元タスクID設定 */
+        param.src[ idx ] = pSrc[ idx ];
+    }
+
+    /* カーネルコール */
+    LibMkSysCallParam( MK_SYSCALL_EVENT, &param );
+
+    /* エラー内容設定 */
+    MLIB_SET_IFNOT_NULL( pErr, param.err );
+
+    /* 発生イベント設定 */
+    MLIB_SET_IFNOT_NULL( pOccurred, param.occurred );
+
+    /* 割込み発生IRQリスト設定 */
+    MLIB_SET_IFNOT_NULL( pIntList, param.intList );
+
+    return param.ret;
+}
+
+
+/******************************************************************************/
@@ -1,8 +1,8 @@
 /******************************************************************************/
 /*                                                                            */
 /* src/lib/libmk/LibMkInt.c                                                   */
-/*                                                                 2019/08/30 */
-/* Copyright (C) 2018-2019 Mochi.                                             */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2018-2026 Mochi.                                             */
 /*                                                                            */
 /******************************************************************************/
 /******************************************************************************/
@@ -17,15 +17,87 @@
 /* カーネルヘッダ */
 #include <kernel/interrupt.h>
 
+/* モジュールヘッダ */
+#include "LibMkSys.h"
+
+
+/******************************************************************************/
+/* 定義                                                                       */
+/******************************************************************************/
+/** 確認済み割込み情報型 */
+typedef struct {
+    MkTaskId_t taskId;                  /**< タスクID         */
+    uint32_t   seen[ MK_INT_IRQ_NUM ];  /**< 確認済み発生回数 */
+} seenInfo_t;
+
+
+/******************************************************************************/
+/* ローカル関数宣言                                                           */
+/******************************************************************************/
+/* 確認済み発生回数取得 */
+static uint32_t *GetSeen( uint32_t *pIdx );
+/* 共有ページ割込み確認 */
+static uint32_t PollSharedPage( uint32_t idx,
+                                uint32_t *pSeen );
+
+
+/******************************************************************************/
+/* 変数定義                                                                   */
+/******************************************************************************/
+/** 確認済み割込み情報(共有ページ割込み状態と1対1) */
+static seenInfo_t gSeenInfo[ MK_SHAREDPAGE_INT_NUM ];
+
 
 /******************************************************************************/
 /* グローバル関数宣言                                                         */
 /******************************************************************************/
+/******************************************************************************/
+/**
+ * @brief       ハードウェア割込みクレーム
+ * @details     指定したIRQ番号のハードウェア割込みを自タスクのデバイスで発生
+ *              したものとして処理完了を通知する。IRQを共有する他タスクの処理
+ *              完了を待たずに次の割込みを可能にする。
+ *
+ * @param[in]   irqNo IRQ番号
+ * @param[out]  *pErr エラー内容
+ *                  - MK_ERR_NONE         エラー無し
+ *                  - MK_ERR_PARAM        パラメータ不正
+ *                  - MK_ERR_UNAUTHORIZED 権限無し
+ *
+ * @return      処理結果を返す。
+ * @retval      MK_RET_SUCCESS 成功
+ * @retval      MK_RET_FAILURE 失敗
+ */
+/******************************************************************************/
+MkRet_t LibMkIntClaim( uint8_t irqNo,
+                       MkErr_t *pErr  )
+{
+    MkRet_t  ret;   /* 戻り値        */
+    uint32_t ebx;   /* EBXレジスタ値 */
+    uint32_t esi;   /* ESIレジスタ値 */
+    uint32_t edi;   /* EDIレジスタ値 */
+
+    /* 初期化 */
+    ret = MK_RET_FAILURE;
+    ebx = irqNo;
+    esi = MK_INT_COMPLETE_CLAIM;
+    edi = 0;
+
+    /* カーネルコール */
+    ret = LibMkSysCall( MK_SYSCALL_INT_COMPLETE, &ebx, &esi, &edi );
+
+    /* エラー設定 */
+    MLIB_SET_IFNOT_NULL( pErr, ebx );
+
+    return ret;
+}
+
+
 /******************************************************************************/
 /**
  * @brief       ハードウェア割込み処理完了
- * @details     指定したIRQ番号のハードウェア割込み処理の完了を通知し、次の割込
- *              みを可能にする。
+ * @details     指定したIRQ番号のハードウェア割込み処理の完了を通知する。IRQを
+ *              共有する全タスクが処理完了した時点で次の割込みを可能にする。
  *
  * @param[in]   irqNo IRQ番号
  *                  - LIBMK_INT_IRQ1  IRQ1番
@@ -54,26 +126,24 @@
 MkRet_t LibMkIntComplete( uint8_t irqNo,
                           MkErr_t *pErr  )
 {
-    volatile MkIntParam_t param;
+    MkRet_t  ret;   /* 戻り値        */
+    uint32_t ebx;   /* EBXレジスタ値 */
+    uint32_t esi;   /* ESIレジスタ値 */
+    uint32_t edi;   /* EDIレジスタ値 */
 
-    /* パラメータ設定 */
-    param.funcId = MK_INT_FUNCID_COMPLETE;
-    param.ret    = MK_RET_FAILURE;
-    param.err    = MK_ERR_NONE;
-    param.irqNo  = irqNo;
+    /* 初期化 */
+    ret = MK_RET_FAILURE;
+    ebx = irqNo;
+    esi = 0;
+    edi = 0;
 
     /* カーネルコール */
-    __asm__ __volatile__ ( "mov esi, %0\n"
-                           "int %1"
-                           :
-                           : "a" ( &param       ),
-                             "i" ( MK_INT_INTNO )
-                           : "esi"                 );
+    ret = LibMkSysCall( MK_SYSCALL_INT_COMPLETE, &ebx, &esi, &edi );
 
     /* エラー設定 */
-    MLIB_SET_IFNOT_NULL( pErr, param.err );
+    MLIB_SET_IFNOT_NULL( pErr, ebx );
 
-    return param.ret;
+    return ret;
 }
 
 
@@ -118,12 +188,7 @@ MkRet_t MkIntDisable( uint8_t irqNo,
     param.irqNo  = irqNo;
 
     /* カーネルコール */
-    __asm__ __volatile__ ( "mov esi, %0\n"
-                           "int %1"
-                           :
-                           : "a" ( &param       ),
-                             "i" ( MK_INT_INTNO )
-                           : "esi"                 );
+    LibMkSysCallParam( MK_SYSCALL_INT, &param );
 
     /* エラー設定 */
     MLIB_SET_IFNOT_NULL( pErr, param.err );
@@ -173,12 +238,124 @@ MkRet_t LibMkIntEnable( uint8_t irqNo,
     param.irqNo  = irqNo;
 
     /* カーネルコール */
-    __asm__ __volatile__ ( "mov esi, %0\n"
-                           "int %1"
-                           :
-                           : "a" ( &param       ),
-                             "i" ( MK_INT_INTNO )
-                           : "esi"                 );
+    LibMkSysCallParam( MK_SYSCALL_INT, &param );
+
+    /* エラー設定 */
+    MLIB_SET_IFNOT_NULL( pErr, param.err );
+
+    return param.ret;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       ハードウェア割込み確認
+ * @details     監視を開始しているハードウェア割込みの発生有無を、カーネルコー
+ *              ルを行わずに共有ページから確認する。前回の確認または待ち合わせ
+ *              以降に割込みが発生したIRQを割込み番号リストに設定する。割込み
+ *              合体条件は適用しない。割込み待ち合わせの前に繰り返し呼び出すこ
+ *              とで、割込み頻度が高い間はポーリングし、低い間はブロックする事
+ *              ができる。
+ *
+ * @param[out]  *pIntList 割込み番号リスト
+ *                  - 0     割込み未発生
+ *                  - 0以外 割込み発生IRQ
+ * @param[out]  *pErr     エラー内容
+ *                  - MK_ERR_NONE         エラー無し
+ *                  - MK_ERR_UNAUTHORIZED 権限無し(監視未開始)
+ *
+ * @return      処理結果を返す。
+ * @retval      MK_RET_SUCCESS 成功
+ * @retval      MK_RET_FAILURE 失敗
+ */
+/******************************************************************************/
+MkRet_t LibMkIntPoll( uint32_t *pIntList,
+                      MkErr_t  *pErr      )
+{
+    uint32_t idx;       /* 割込み状態インデックス */
+    uint32_t *pSeen;    /* 確認済み発生回数       */
+
+    /* 初期化 */
+    idx   = 0;
+    pSeen = GetSeen( &idx );
+
+    /* 取得結果判定 */
+    if ( pSeen == NULL ) {
+        /* 監視未開始 */
+
+        /* エラー設定 */
+        MLIB_SET_IFNOT_NULL( pErr, MK_ERR_UNAUTHORIZED );
+
+        return MK_RET_FAILURE;
+    }
+
+    /* 割込み番号リスト設定 */
+    MLIB_SET_IFNOT_NULL( pIntList, PollSharedPage( idx, pSeen ) );
+
+    /* エラー設定 */
+    MLIB_SET_IFNOT_NULL( pErr, MK_ERR_NONE );
+
+    return MK_RET_SUCCESS;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       ハードウェア割込み合体設定
+ * @details     指定したIRQ番号のハードウェア割込みの合体条件を設定する。割込
+ *              み待ち合わせは割込みがcount回発生するか、最初の割込み発生から
+ *              usecマイクロ秒経過した時点で解除される。countが1以下かつusec
+ *              が0の場合は割込み毎に解除する(既定)。レベルトリガ割込みは処理
+ *              完了まで再発生しない為、countが2以上の場合はusecの指定が必要
+ *              となる。
+ *
+ * @param[in]   irqNo IRQ番号
+ *                  - LIBMK_INT_IRQ1  IRQ1番
+ *                  - LIBMK_INT_IRQ3  IRQ3番
+ *                  - LIBMK_INT_IRQ4  IRQ4番
+ *                  - LIBMK_INT_IRQ5  IRQ5番
+ *                  - LIBMK_INT_IRQ6  IRQ6番
+ *                  - LIBMK_INT_IRQ7  IRQ7番
+ *                  - LIBMK_INT_IRQ9  IRQ9番
+ *                  - LIBMK_INT_IRQ10 IRQ10番
+ *                  - LIBMK_INT_IRQ11 IRQ11番
+ *                  - LIBMK_INT_IRQ12 IRQ12番
+ *                  - LIBMK_INT_IRQ13 IRQ13番
+ *                  - LIBMK_INT_IRQ14 IRQ14番
+ *                  - LIBMK_INT_IRQ15 IRQ15番
+ * @param[in]   count 合体割込み回数
+ *                  - 0     回数条件無し
+ *                  - 0以外 待ち合わせ解除割込み回数
+ * @param[in]   usec  合体待ち時間[us]
+ *                  - 0     時間条件無し
+ *                  - 0以外 待ち合わせ解除時間
+ * @param[out]  *pErr エラー内容
+ *                  - MK_ERR_NONE         エラー無し
+ *                  - MK_ERR_PARAM        パラメータ不正
+ *                  - MK_ERR_UNAUTHORIZED 権限無し
+ *
+ * @return      処理結果を返す。
+ * @retval      MK_RET_SUCCESS 成功
+ * @retval      MK_RET_FAILURE 失敗
+ */
+/******************************************************************************/
+MkRet_t LibMkIntSetCoalesce( uint8_t  irqNo,
+                             uint32_t count,
+                             uint32_t usec,
+                             MkErr_t  *pErr  )
+{
+    volatile MkIntParam_t param;
+
+    /* パラメータ設定 */
+    param.funcId = MK_INT_FUNCID_SET_COALESCE;
+    param.ret    = MK_RET_FAILURE;
+    param.err    = MK_ERR_NONE;
+    param.irqNo  = irqNo;
+    param.count  = count;
+    param.usec   = usec;
+
+    /* カーネルコール */
+    LibMkSysCallParam( MK_SYSCALL_INT, &param );
 
     /* エラー設定 */
     MLIB_SET_IFNOT_NULL( pErr, param.err );
@@ -190,7 +367,8 @@ MkRet_t LibMkIntEnable( uint8_t irqNo,
 /******************************************************************************/
 /**
  * @brief       ハードウェア割込み監視開始
- * @details     指定したIRQ番号のハードウェア割込みの監視を開始する。
+ * @details     指定したIRQ番号のハードウェア割込みの監視を開始する。IRQは複数
+ *              のドライバタスクで共有できる。
  *
  * @param[in]   irqNo IRQ番号
  *                  - LIBMK_INT_IRQ1  IRQ1番
@@ -211,6 +389,7 @@ MkRet_t LibMkIntEnable( uint8_t irqNo,
  *                  - MK_ERR_PARAM         パラメータ不正
  *                  - MK_ERR_UNAUTHORIZED  権限無し
  *                  - MK_ERR_ALREADY_START 監視開始済み
+ *                  - MK_ERR_NO_RESOURCE   リソース不足
  *
  * @return      処理結果を返す。
  * @retval      MK_RET_SUCCESS 成功
@@ -229,12 +408,7 @@ MkRet_t LibMkIntStartMonitoring( uint8_t irqNo,
     param.irqNo  = irqNo;
 
     /* カーネルコール */
-    __asm__ __volatile__ ( "mov esi, %0\n"
-                           "int %1"
-                           :
-                           : "a" ( &param       ),
-                             "i" ( MK_INT_INTNO )
-                           : "esi"                 );
+    LibMkSysCallParam( MK_SYSCALL_INT, &param );
 
     /* エラー設定 */
     MLIB_SET_IFNOT_NULL( pErr, param.err );
@@ -284,12 +458,7 @@ MkRet_t LibMkIntStopMonitoring( uint8_t irqNo,
     param.irqNo  = irqNo;
 
     /* カーネルコール */
-    __asm__ __volatile__ ( "mov esi, %0\n"
-                           "int %1"
-                           :
-                           : "a" ( &param       ),
-                             "i" ( MK_INT_INTNO )
-                           : "esi"                 );
+    LibMkSysCallParam( MK_SYSCALL_INT, &param );
 
     /* エラー設定 */
     MLIB_SET_IFNOT_NULL( pErr, param.err );
@@ -301,7 +470,9 @@ MkRet_t LibMkIntStopMonitoring( uint8_t irqNo,
 /******************************************************************************/
 /**
  * @brief       ハードウェア割込み待ち合わせ
- * @details     監視を開始しているハードウェア割込みの待ち合わせを行う。
+ * @details     監視を開始しているハードウェア割込みの待ち合わせを行う。共有ペ
+ *              ージで割込み発生を確認できた場合はカーネルコールを行わずに復帰
+ *              する。この場合は割込み合体条件を適用しない。
  *
  * @param[out]  *pIntList 割込み番号リスト
  * @param[out]  *pErr     エラー内容
@@ -317,21 +488,47 @@ MkRet_t LibMkIntStopMonitoring( uint8_t irqNo,
 MkRet_t LibMkIntWait( uint32_t *pIntList,
                       MkErr_t  *pErr      )
 {
-    volatile MkIntParam_t param;
+    uint32_t              idx;      /* 割込み状態インデックス */
+    uint32_t              list;     /* 割込み番号リスト       */
+    uint32_t              *pSeen;   /* 確認済み発生回数       */
+    volatile MkIntParam_t param;    /* パラメータ             */
+
+    /* 初期化 */
+    idx   = 0;
+    list  = 0;
+    pSeen = GetSeen( &idx );
+
+    /* 確認済み発生回数有無判定 */
+    if ( pSeen != NULL ) {
+        /* 有り */
+
+        /* 共有ページ割込み確認 */
+        list = PollSharedPage( idx, pSeen );
+
+        /* 割込み発生判定 */
+        if ( list != 0 ) {
+            /* 発生 */
+
+            /* 割込み番号リスト設定 */
+            MLIB_SET_IFNOT_NULL( pIntList, list );
+
+            /* エラー設定 */
+            MLIB_SET_IFNOT_NULL( pErr, MK_ERR_NONE );
+
+            return MK_RET_SUCCESS;
+        }
+    }
 
     /* パラメータ設定 */
     param.funcId = MK_INT_FUNCID_WAIT;
     param.ret    = MK_RET_FAILURE;
     param.err    = MK_ERR_NONE;
     param.flag   = 0;
+    param.pInfo  = NULL;
+    param.pSeen  = pSeen;
 
     /* カーネルコール */
-    __asm__ __volatile__ ( "mov esi, %0\n"
-                           "int %1"
-                           :
-                           : "a" ( &param       ),
-                             "i" ( MK_INT_INTNO )
-                           : "esi"                 );
+    LibMkSysCallParam( MK_SYSCALL_INT, &param );
 
     /* 割込み番号リスト設定 */
     MLIB_SET_IFNOT_NULL( pIntList, param.flag );
@@ -343,4 +540,153 @@ MkRet_t LibMkIntWait( uint32_t *pIntList,
 }
 
 
+/******************************************************************************/
+/**
+ * @brief       ハードウェア割込み待ち合わせ(発生情報取得)
+ * @details     監視を開始しているハードウェア割込みの待ち合わせを行い、割込み
+ *              番号リストに含まれるIRQ毎の前回待ち合わせ以降の割込み発生回数
+ *              と初回・最終割込み発生TSCを取得する。
+ *
+ * @param[out]  *pIntList 割込み番号リスト
+ * @param[out]  *pInfo    割込み発生情報(IRQ番号をインデックスとする
+ *                        MK_INT_IRQ_NUM個の配列)
+ *                  - NULL     取得しない
+ *                  - NULL以外 割込み番号リストに含まれるIRQのみ設定する
+ * @param[out]  *pErr     エラー内容
+ *                  - MK_ERR_NONE         エラー無し
+ *                  - MK_ERR_PARAM        パラメータ不正
+ *                  - MK_ERR_UNAUTHORIZED 権限無し
+ *
+ * @return      処理結果を返す。
+ * @retval      MK_RET_SUCCESS 成功
+ * @retval      MK_RET_FAILURE 失敗
+ */
+/******************************************************************************/
+MkRet_t LibMkIntWaitInfo( uint32_t    *pIntList,
+                          MkIntInfo_t *pInfo,
+                          MkErr_t     *pErr      )
+{
+    uint32_t              idx;      /* 割込み状態インデックス */
+    volatile MkIntParam_t param;    /* パラメータ             */
+
+    /* パラメータ設定 */
+    param.funcId = MK_INT_FUNCID_WAIT;
+    param.ret    = MK_RET_FAILURE;
+    param.err    = MK_ERR_NONE;
+    param.flag   = 0;
+    param.pInfo  = pInfo;
+    param.pSeen  = GetSeen( &idx );
+
+    /* カーネルコール */
+    LibMkSysCallParam( MK_SYSCALL_INT, &param );
+
+    /* 割込み番号リスト設定 */
+    MLIB_SET_IFNOT_NULL( pIntList, param.flag );
+
+    /* エラー設定 */
+    MLIB_SET_IFNOT_NULL( pErr, param.err );
+
+    return param.ret;
+}
+
+
+/******************************************************************************/
+/* ローカル関数定義                                                           */
+/******************************************************************************/
+/******************************************************************************/
+/**
+ * @brief       確認済み発生回数取得
+ * @details     共有ページから実行中タスクに割り当てられた割込み状態を検索し、
+ *              対応する確認済み発生回数を取得する。確認済み割込み情報が他タス
+ *              クの物である場合は初期化する。
+ *
+ * @param[out]  *pIdx 割込み状態インデックス
+ *
+ * @return      確認済み発生回数(MK_INT_IRQ_NUM個)を返す。
+ * @retval      NULL     割込み状態無し(監視未開始)
+ * @retval      NULL以外 確認済み発生回数
+ */
+/******************************************************************************/
+static uint32_t *GetSeen( uint32_t *pIdx )
+{
+    uint32_t                idx;    /* 割込み状態インデックス */
+    uint32_t                irqNo;  /* IRQ番号                */
+    MkTaskId_t              taskId; /* タスクID               */
+    volatile MkSharedPage_t *pPage; /* 共有ページ             */
+
+    /* 初期化 */
+    pPage  = LIBMK_SYS_PAGE;
+    taskId = pPage->taskId;
+
+    /* 割込み状態毎に繰り返す */
+    for ( idx = 0; idx < MK_SHAREDPAGE_INT_NUM; idx++ ) {
+        /* 割当て先判定 */
+        if ( pPage->intState[ idx ].taskId != taskId ) {
+            /* 他タスク */
+            continue;
+        }
+
+        /* 確認済み割込み情報判定 */
+        if ( gSeenInfo[ idx ].taskId != taskId ) {
+            /* 他タスク */
+
+            /* 確認済み割込み情報初期化 */
+            gSeenInfo[ idx ].taskId = taskId;
+
+            for ( irqNo = 0; irqNo < MK_INT_IRQ_NUM; irqNo++ ) {
+                gSeenInfo[ idx ].seen[ irqNo ] = 0;
+            }
+        }
+
+        *pIdx = idx;
+
+        return gSeenInfo[ idx ].seen;
+    }
+
+    return NULL;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       共有ページ割込み確認
+ * @details     共有ページの割込み発生回数と確認済み発生回数を比較し、割込みが
+ *              発生したIRQの確認済み発生回数を更新する。
+ *
+ * @param[in]   idx    割込み状態インデックス
+ * @param[in]   *pSeen 確認済み発生回数
+ *
+ * @return      割込み番号リストを返す。
+ */
+/******************************************************************************/
+static uint32_t PollSharedPage( uint32_t idx,
+                                uint32_t *pSeen )
+{
+    uint32_t                count;  /* 割込み発生回数   */
+    uint32_t                irqNo;  /* IRQ番号          */
+    uint32_t                list;   /* 割込み番号リスト */
+    volatile MkSharedPage_t *pPage; /* 共有ページ       */
+
+    /* 初期化 */
+    list  = 0;
+    pPage = LIBMK_SYS_PAGE;
+
+    /* IRQ毎に繰り返す */
+    for ( irqNo = 0; irqNo < MK_INT_IRQ_NUM; irqNo++ ) {
+        /* 割込み発生回数取得 */
+        count = pPage->intState[ idx ].count[ irqNo ];
+
+        /* 割込み発生判定 */
+        if ( count != pSeen[ irqNo ] ) {
+            /* 発生 */
+
+            list           |= ( 1 << irqNo );
+            pSeen[ irqNo ]  = count;
+        }
+    }
+
+    return list;
+}
+
+
 /******************************************************************************/
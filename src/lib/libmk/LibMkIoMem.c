@@ -1,8 +1,8 @@
 /******************************************************************************/
 /*                                                                            */
 /* src/lib/libmk/LibMkIoMem.c                                                 */
-/*                                                                 2019/07/27 */
-/* Copyright (C) 2018-2019 Mochi.                                             */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2018-2026 Mochi.                                             */
 /*                                                                            */
 /******************************************************************************/
 /******************************************************************************/
@@ -17,6 +17,9 @@
 /* カーネルヘッダ */
 #include <kernel/iomem.h>
 
+/* モジュールヘッダ */
+#include "LibMkSys.h"
+
 
 /******************************************************************************/
 /* グローバル関数宣言                                                         */
@@ -67,12 +70,7 @@ MkRet_t LibMkIoMemAlloc( void    *pIoAddr,
     param.pVirtAddr = NULL;
 
     /* カーネルコール */
-    __asm__ __volatile__ ( "mov esi, %0\n"
-                           "int %1"
-                           :
-                           : "a" ( &param         ),
-                             "i" ( MK_IOMEM_INTNO )
-                           : "esi"                   );
+    LibMkSysCallParam( MK_SYSCALL_IOMEM, &param );
 
     /* エラー内容設定 */
     MLIB_SET_IFNOT_NULL( pErr, param.err );
@@ -1,8 +1,8 @@
 /******************************************************************************/
 /*                                                                            */
 /* src/lib/libmk/LibMkIoPort.c                                                */
-/*                                                                 2025/04/06 */
-/* Copyright (C) 2018-2025 Mochi.                                             */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2018-2026 Mochi.                                             */
 /*                                                                            */
 /******************************************************************************/
 /******************************************************************************/
@@ -17,6 +17,9 @@
 /* カーネルヘッダ */
 #include <kernel/ioport.h>
 
+/* モジュールヘッダ */
+#include "LibMkSys.h"
+
 
 /******************************************************************************/
 /* グローバル関数宣言                                                         */
@@ -49,11 +52,7 @@ MkRet_t LibMkIoPortBulk( MkIoPortBulk_t *pData,
     param.pData  = pData;
 
     /* カーネルコール */
-    __asm__ __volatile__ ( "int %1"
-                           :
-                           : "S" ( &param          ),   /* input: esi */
-                             "i" ( MK_IOPORT_INTNO )
-                           : "memory"                 );
+    LibMkSysCallParam( MK_SYSCALL_IOPORT, &param );
 
     /* エラー内容設定 */
     MLIB_SET_IFNOT_NULL( pErr, param.err );
@@ -84,28 +83,24 @@ MkRet_t LibMkIoPortInByte( uint16_t portNo,
                            size_t   count,
                            MkErr_t  *pErr   )
 {
-    volatile MkIoPortParam_t param;
+    MkRet_t  ret;   /* 戻り値        */
+    uint32_t ebx;   /* EBXレジスタ値 */
+    uint32_t esi;   /* ESIレジスタ値 */
+    uint32_t edi;   /* EDIレジスタ値 */
 
-    /* パラメータ設定 */
-    param.funcId = MK_IOPORT_FUNCID_IN_BYTE;
-    param.ret    = MK_RET_FAILURE;
-    param.err    = MK_ERR_NONE;
-    param.portNo = portNo;
-    param.pData  = pData;
-    param.count  = count;
+    /* 初期化 */
+    ret = MK_RET_FAILURE;
+    ebx = portNo;
+    esi = ( uint32_t ) pData;
+    edi = count;
 
     /* カーネルコール */
-    __asm__ __volatile__ ( "mov esi, %0\n"
-                           "int %1"
-                           :
-                           : "a" ( &param          ),
-                             "i" ( MK_IOPORT_INTNO )
-                           : "esi"                    );
+    ret = LibMkSysCall( MK_SYSCALL_IOPORT_IN_BYTE, &ebx, &esi, &edi );
 
     /* エラー内容設定 */
-    MLIB_SET_IFNOT_NULL( pErr, param.err );
+    MLIB_SET_IFNOT_NULL( pErr, ebx );
 
-    return param.ret;
+    return ret;
 }
 
 
@@ -131,28 +126,24 @@ MkRet_t LibMkIoPortInDWord( uint16_t portNo,
                             size_t   count,
                             MkErr_t  *pErr   )
 {
-    volatile MkIoPortParam_t param;
+    MkRet_t  ret;   /* 戻り値        */
+    uint32_t ebx;   /* EBXレジスタ値 */
+    uint32_t esi;   /* ESIレジスタ値 */
+    uint32_t edi;   /* EDIレジスタ値 */
 
-    /* パラメータ設定 */
-    param.funcId = MK_IOPORT_FUNCID_IN_DWORD;
-    param.ret    = MK_RET_FAILURE;
-    param.err    = MK_ERR_NONE;
-    param.portNo = portNo;
-    param.pData  = pData;
-    param.count  = count;
+    /* 初期化 */
+    ret = MK_RET_FAILURE;
+    ebx = portNo;
+    esi = ( uint32_t ) pData;
+    edi = count;
 
     /* カーネルコール */
-    __asm__ __volatile__ ( "mov esi, %0\n"
-                           "int %1"
-                           :
-                           : "a" ( &param          ),
-                             "i" ( MK_IOPORT_INTNO )
-                           : "esi"                    );
+    ret = LibMkSysCall( MK_SYSCALL_IOPORT_IN_DWORD, &ebx, &esi, &edi );
 
     /* エラー内容設定 */
-    MLIB_SET_IFNOT_NULL( pErr, param.err );
+    MLIB_SET_IFNOT_NULL( pErr, ebx );
 
-    return param.ret;
+    return ret;
 }
 
 
@@ -178,28 +169,24 @@ MkRet_t LibMkIoPortInWord( uint16_t portNo,
                            size_t   count,
                            MkErr_t  *pErr   )
 {
-    volatile MkIoPortParam_t param;
+    MkRet_t  ret;   /* 戻り値        */
+    uint32_t ebx;   /* EBXレジスタ値 */
+    uint32_t esi;   /* ESIレジスタ値 */
+    uint32_t edi;   /* EDIレジスタ値 */
 
-    /* パラメータ設定 */
-    param.funcId = MK_IOPORT_FUNCID_IN_WORD;
-    param.ret    = MK_RET_FAILURE;
-    param.err    = MK_ERR_NONE;
-    param.portNo = portNo;
-    param.pData  = pData;
-    param.count  = count;
+    /* 初期化 */
+    ret = MK_RET_FAILURE;
+    ebx = portNo;
+    esi = ( uint32_t ) pData;
+    edi = count;
 
     /* カーネルコール */
-    __asm__ __volatile__ ( "mov esi, %0\n"
-                           "int %1"
-                           :
-                           : "a" ( &param          ),
-                             "i" ( MK_IOPORT_INTNO )
-                           : "esi"                    );
+    ret = LibMkSysCall( MK_SYSCALL_IOPORT_IN_WORD, &ebx, &esi, &edi );
 
     /* エラー内容設定 */
-    MLIB_SET_IFNOT_NULL( pErr, param.err );
+    MLIB_SET_IFNOT_NULL( pErr, ebx );
 
-    return param.ret;
+    return ret;
 }
 
 
@@ -225,28 +212,24 @@ MkRet_t LibMkIoPortOutByte( uint16_t portNo,
                             size_t   count,
                             MkErr_t  *pErr   )
 {
-    volatile MkIoPortParam_t param;
+    MkRet_t  ret;   /* 戻り値        */
+    uint32_t ebx;   /* EBXレジスタ値 */
+    uint32_t esi;   /* ESIレジスタ値 */
+    uint32_t edi;   /* EDIレジスタ値 */
 
-    /* パラメータ設定 */
-    param.funcId = MK_IOPORT_FUNCID_OUT_BYTE;
-    param.ret    = MK_RET_FAILURE;
-    param.err    = MK_ERR_NONE;
-    param.portNo = portNo;
-    param.pData  = pData;
-    param.count  = count;
+    /* 初期化 */
+    ret = MK_RET_FAILURE;
+    ebx = portNo;
+    esi = ( uint32_t ) pData;
+    edi = count;
 
     /* カーネルコール */
-    __asm__ __volatile__ ( "mov esi, %0\n"
-                           "int %1"
-                           :
-                           : "a" ( &param          ),
-                             "i" ( MK_IOPORT_INTNO )
-                           : "esi"                    );
+    ret = LibMkSysCall( MK_SYSCALL_IOPORT_OUT_BYTE, &ebx, &esi, &edi );
 
     /* エラー内容設定 */
-    MLIB_SET_IFNOT_NULL( pErr, param.err );
+    MLIB_SET_IFNOT_NULL( pErr, ebx );
 
-    return param.ret;
+    return ret;
 }
 
 
@@ -272,28 +255,24 @@ MkRet_t LibMkIoPortOutDWord( uint16_t portNo,
                              size_t   count,
                              MkErr_t  *pErr   )
 {
-    volatile MkIoPortParam_t param;
+    MkRet_t  ret;   /* 戻り値        */
+    uint32_t ebx;   /* EBXレジスタ値 */
+    uint32_t esi;   /* ESIレジスタ値 */
+    uint32_t edi;   /* EDIレジスタ値 */
 
-    /* パラメータ設定 */
-    param.funcId = MK_IOPORT_FUNCID_OUT_DWORD;
-    param.ret    = MK_RET_FAILURE;
-    param.err    = MK_ERR_NONE;
-    param.portNo = portNo;
-    param.pData  = pData;
-    param.count  = count;
+    /* 初期化 */
+    ret = MK_RET_FAILURE;
+    ebx = portNo;
+    esi = ( uint32_t ) pData;
+    edi = count;
 
     /* カーネルコール */
-    __asm__ __volatile__ ( "mov esi, %0\n"
-                           "int %1"
-                           :
-                           : "a" ( &param          ),
-                             "i" ( MK_IOPORT_INTNO )
-                           : "esi"                    );
+    ret = LibMkSysCall( MK_SYSCALL_IOPORT_OUT_DWORD, &ebx, &esi, &edi );
 
     /* エラー内容設定 */
-    MLIB_SET_IFNOT_NULL( pErr, param.err );
+    MLIB_SET_IFNOT_NULL( pErr, ebx );
 
-    return param.ret;
+    return ret;
 }
 
 
@@ -319,28 +298,24 @@ MkRet_t LibMkIoPortOutWord( uint16_t portNo,
                             size_t   count,
                             MkErr_t  *pErr   )
 {
-    volatile MkIoPortParam_t param;
+    MkRet_t  ret;   /* 戻り値        */
+    uint32_t ebx;   /* EBXレジスタ値 */
+    uint32_t esi;   /* ESIレジスタ値 */
+    uint32_t edi;   /* EDIレジスタ値 */
 
-    /* パラメータ設定 */
-    param.funcId = MK_IOPORT_FUNCID_OUT_WORD;
-    param.ret    = MK_RET_FAILURE;
-    param.err    = MK_ERR_NONE;
-    param.portNo = portNo;
-    param.pData  = pData;
-    param.count  = count;
+    /* 初期化 */
+    ret = MK_RET_FAILURE;
+    ebx = portNo;
+    esi = ( uint32_t ) pData;
+    edi = count;
 
     /* カーネルコール */
-    __asm__ __volatile__ ( "mov esi, %0\n"
-                           "int %1"
-                           :
-                           : "a" ( &param          ),
-                             "i" ( MK_IOPORT_INTNO )
-                           : "esi"                    );
+    ret = LibMkSysCall( MK_SYSCALL_IOPORT_OUT_WORD, &ebx, &esi, &edi );
 
     /* エラー内容設定 */
-    MLIB_SET_IFNOT_NULL( pErr, param.err );
+    MLIB_SET_IFNOT_NULL( pErr, ebx );
 
-    return param.ret;
+    return ret;
 }
 
 
@@ -1,8 +1,8 @@
 /******************************************************************************/
 /*                                                                            */
 /* src/lib/libmk/MkMsg.c                                                      */
-/*                                                                 2020/04/30 */
-/* Copyright (C) 2018-2020 Mochi.                                             */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2018-2026 Mochi.                                             */
 /*                                                                            */
 /******************************************************************************/
 /******************************************************************************/
@@ -17,10 +17,154 @@
 /* カーネルヘッダ */
 #include <kernel/message.h>
 
+/* モジュールヘッダ */
+#include "LibMkSys.h"
+
 
 /******************************************************************************/
 /* グローバル関数宣言                                                         */
 /******************************************************************************/
+/******************************************************************************/
+/**
+ * @brief       トラフィック統計ログ出力
+ * @details     カーネルが記録している送信元・送信先タスク組毎のトラフィック統
+ *              計をカーネルのデバッグログに出力する。
+ *
+ * @param[out]  *pErr エラー内容
+ *                  - MK_ERR_NONE エラー無し
+ *
+ * @return      処理結果を返す。
+ * @retval      MK_RET_SUCCESS 成功
+ * @retval      MK_RET_FAILURE 失敗
+ */
+/******************************************************************************/
+MkRet_t LibMkMsgDumpTraffic( MkErr_t *pErr )
+{
+    volatile MkMsgParam_t param;
+
+    /* パラメータ設定 */
+    param.funcId = MK_MSG_FUNCID_DUMP_TRAFFIC;
+    param.ret    = MK_RET_FAILURE;
+    param.err    = MK_ERR_NONE;
+
+    /* カーネルコール */
+    LibMkSysCallParam( MK_SYSCALL_MSG, &param );
+
+    /* エラー内容設定 */
+    MLIB_SET_IFNOT_NULL( pErr, param.err );
+
+    return param.ret;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       メッセージキュー統計取得
+ * @details     自タスクのメッセージキューの現在のメッセージ数とサイズ、最大記
+ *              録、上限、およびキュー満杯発生回数を取得する。
+ *
+ * @param[out]  *pStat メッセージキュー統計
+ * @param[out]  *pErr  エラー内容
+ *                  - MK_ERR_NONE  エラー無し
+ *                  - MK_ERR_PARAM パラメータ不正
+ *
+ * @return      処理結果を返す。
+ * @retval      MK_RET_SUCCESS 成功
+ * @retval      MK_RET_FAILURE 失敗
+ */
+/******************************************************************************/
+MkRet_t LibMkMsgGetQueueStat( MkMsgQueueStat_t *pStat,
+                              MkErr_t          *pErr   )
+{
+    volatile MkMsgParam_t param;
+
+    /* 引数チェック */
+    if ( pStat == NULL ) {
+        /* 不正 */
+
+        /* エラー内容設定 */
+        MLIB_SET_IFNOT_NULL( pErr, MK_ERR_PARAM );
+
+        return MK_RET_FAILURE;
+    }
+
+    /* パラメータ設定 */
+    param.funcId = MK_MSG_FUNCID_GET_STAT;
+    param.ret    = MK_RET_FAILURE;
+    param.err    = MK_ERR_NONE;
+    param.pStat  = pStat;
+
+    /* カーネルコール */
+    LibMkSysCallParam( MK_SYSCALL_MSG, &param );
+
+    /* エラー内容設定 */
+    MLIB_SET_IFNOT_NULL( pErr, param.err );
+
+    return param.ret;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief           トラフィック統計取得
+ * @details         カーネルが記録している送信元・送信先タスク組毎のメッセージ
+ *                  数、送信サイズ、ブロッキング/ノンブロッキング送信数、およ
+ *                  びキューイングから受信までのTSC差のスナップショットを取得
+ *                  する。
+ *
+ * @param[out]      *pBuffer 統計格納先
+ * @param[in,out]   *pNum    格納先エントリ数/取得エントリ数
+ * @param[out]      *pLost   記録不可回数
+ * @param[out]      *pErr    エラー内容
+ *                      - MK_ERR_NONE  エラー無し
+ *                      - MK_ERR_PARAM パラメータ不正
+ *
+ * @return          処理結果を返す。
+ * @retval          MK_RET_SUCCESS 成功
+ * @retval          MK_RET_FAILURE 失敗
+ */
+/******************************************************************************/
+MkRet_t LibMkMsgGetTraffic( MkMsgTraffic_t *pBuffer,
+                            uint32_t       *pNum,
+                            uint32_t       *pLost,
+                            MkErr_t        *pErr     )
+{
+    volatile MkMsgParam_t param;
+
+    /* 引数チェック */
+    if ( ( pBuffer == NULL ) || ( pNum == NULL ) ) {
+        /* 不正 */
+
+        /* エラー内容設定 */
+        MLIB_SET_IFNOT_NULL( pErr, MK_ERR_PARAM );
+
+        return MK_RET_FAILURE;
+    }
+
+    /* パラメータ設定 */
+    param.funcId          = MK_MSG_FUNCID_GET_TRAFFIC;
+    param.ret             = MK_RET_FAILURE;
+    param.err             = MK_ERR_NONE;
+    param.traffic.pBuffer = pBuffer;
+    param.traffic.num     = *pNum;
+    param.traffic.lost    = 0;
+
+    /* カーネルコール */
+    LibMkSysCallParam( MK_SYSCALL_MSG, &param );
+
+    /* エラー内容設定 */
+    MLIB_SET_IFNOT_NULL( pErr, param.err );
+
+    /* 取得エントリ数設定 */
+    *pNum = param.traffic.num;
+
+    /* 記録不可回数設定 */
+    MLIB_SET_IFNOT_NULL( pLost, param.traffic.lost );
+
+    return param.ret;
+}
+
+
 /******************************************************************************/
 /**
  * @brief       メッセージ受信
@@ -55,7 +199,17 @@ MkRet_t LibMkMsgReceive( MkTaskId_t recvTaskId,
                          uint32_t   timeout,
                          MkErr_t    *pErr        )
 {
-    volatile MkMsgParam_t param;
+    MkRet_t               ret;      /* 戻り値        */
+    uint32_t              ebx;      /* EBXレジスタ値 */
+    uint32_t              esi;      /* ESIレジスタ値 */
+    uint32_t              edi;      /* EDIレジスタ値 */
+    volatile MkMsgParam_t param;    /* パラメータ    */
+
+    /* 初期化 */
+    ret = MK_RET_FAILURE;
+    ebx = recvTaskId;
+    esi = ( uint32_t ) pBuffer;
+    edi = bufferSize;
 
     /* 引数チェック */
     if ( ( pBuffer == NULL ) && ( bufferSize != 0 ) ) {
@@ -67,6 +221,25 @@ MkRet_t LibMkMsgReceive( MkTaskId_t recvTaskId,
         return MK_RET_FAILURE;
     }
 
+    /* タイムアウト判定 */
+    if ( timeout == 0 ) {
+        /* タイムアウト無し */
+
+        /* カーネルコール */
+        ret = LibMkSysCall( MK_SYSCALL_MSG_RECEIVE, &ebx, &esi, &edi );
+
+        /* エラー内容設定 */
+        MLIB_SET_IFNOT_NULL( pErr, ebx );
+
+        /* 送信元タスクID設定 */
+        MLIB_SET_IFNOT_NULL( pSrcTaskId, esi );
+
+        /* 受信メッセージサイズ */
+        MLIB_SET_IFNOT_NULL( pRecvSize, edi );
+
+        return ret;
+    }
+
     /* パラメータ設定 */
     param.funcId          = MK_MSG_FUNCID_RECEIVE;
     param.ret             = MK_RET_FAILURE;
@@ -78,12 +251,7 @@ MkRet_t LibMkMsgReceive( MkTaskId_t recvTaskId,
     param.timeout         = timeout;
 
     /* カーネルコール */
-    __asm__ __volatile__ ( "mov esi, %0\n"
-                           "int %1"
-                           :
-                           : "a" ( &param       ),
-                             "i" ( MK_MSG_INTNO )
-                           : "esi"                 );
+    LibMkSysCallParam( MK_SYSCALL_MSG, &param );
 
     /* エラー内容設定 */
     MLIB_SET_IFNOT_NULL( pErr, param.err );
@@ -102,7 +270,8 @@ MkRet_t LibMkMsgReceive( MkTaskId_t recvTaskId,
 /**
  * @brief       メッセージ送信
  * @details     指定したタスクにメッセージを送信する。送信先タスクがメッセージ
- *              を受信するまで待ち合わせる。
+ *              を受信するまで待ち合わせる。送信先タスクのメッセージキューが満
+ *              杯の場合は空きができるまで待ち合わせる。
  *
  * @param[in]   dst   送信先タスク
  * @param[in]   *pMsg メッセージ
@@ -124,6 +293,71 @@ MkRet_t LibMkMsgSend( MkTaskId_t dst,
                       void       *pMsg,
                       size_t     size,
                       MkErr_t    *pErr   )
+{
+    MkRet_t  ret;   /* 戻り値        */
+    uint32_t ebx;   /* EBXレジスタ値 */
+    uint32_t esi;   /* ESIレジスタ値 */
+    uint32_t edi;   /* EDIレジスタ値 */
+
+    /* 初期化 */
+    ret = MK_RET_FAILURE;
+    ebx = dst;
+    esi = ( uint32_t ) pMsg;
+    edi = size;
+
+    /* 引数チェック */
+    if ( ( pMsg == NULL ) || ( size == 0 ) ) {
+        /* 不正 */
+
+        /* エラー内容設定 */
+        MLIB_SET_IFNOT_NULL( pErr, MK_ERR_PARAM );
+
+        return MK_RET_FAILURE;
+    }
+
+    /* カーネルコール */
+    ret = LibMkSysCall( MK_SYSCALL_MSG_SEND, &ebx, &esi, &edi );
+
+    /* エラー内容設定 */
+    MLIB_SET_IFNOT_NULL( pErr, ebx );
+
+    return ret;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       メッセージ送信(フラグ指定)
+ * @details     指定したタスクにフラグを指定してメッセージを送信する。緊急メッ
+ *              セージは送信先タスクで通常メッセージより先に受信される。ノンブ
+ *              ロッキング送信を指定しない場合は送信先タスクがメッセージを受信
+ *              するまで待ち合わせる。
+ *
+ * @param[in]   dst   送信先タスク
+ * @param[in]   *pMsg メッセージ
+ * @param[in]   size  サイズ
+ * @param[in]   flags 送信フラグ
+ *                  - MK_MSG_FLAG_URGENT 緊急メッセージ
+ *                  - MK_MSG_FLAG_NB     ノンブロッキング送信
+ * @param[out]  *pErr エラー内容
+ *                  - MK_ERR_NONE         エラー無し
+ *                  - MK_ERR_PARAM        パラメータ不正
+ *                  - MK_ERR_UNAUTHORIZED 非隣接プロセスタイプ
+ *                  - MK_ERR_SIZE_OVER    送信サイズ超過
+ *                  - MK_ERR_NO_EXIST     存在しないタスクID指定
+ *                  - MK_ERR_NO_MEMORY    メモリ不足
+ *                  - MK_ERR_QUEUE_FULL   送信先メッセージキュー満杯
+ *
+ * @return      処理結果を返す。
+ * @retval      MK_RET_SUCCESS 成功
+ * @retval      MK_RET_FAILURE 失敗
+ */
+/******************************************************************************/
+MkRet_t LibMkMsgSendEx( MkTaskId_t dst,
+                        void       *pMsg,
+                        size_t     size,
+                        uint32_t   flags,
+                        MkErr_t    *pErr  )
 {
     volatile MkMsgParam_t param;
 
@@ -138,20 +372,23 @@ MkRet_t LibMkMsgSend( MkTaskId_t dst,
     }
 
     /* パラメータ設定 */
-    param.funcId    = MK_MSG_FUNCID_SEND;
-    param.ret       = MK_RET_FAILURE;
-    param.err       = MK_ERR_NONE;
-    param.send.dst  = dst;
-    param.send.pMsg = pMsg;
-    param.send.size = size;
+    param.funcId     = MK_MSG_FUNCID_SEND;
+    param.ret        = MK_RET_FAILURE;
+    param.err        = MK_ERR_NONE;
+    param.send.dst   = dst;
+    param.send.pMsg  = pMsg;
+    param.send.size  = size;
+    param.send.flags = flags;
+
+    /* ノンブロッキング判定 */
+    if ( ( flags & MK_MSG_FLAG_NB ) != 0 ) {
+        /* ノンブロッキング */
+
+        param.funcId = MK_MSG_FUNCID_SEND_NB;
+    }
 
     /* カーネルコール */
-    __asm__ __volatile__ ( "mov esi, %0\n"
-                           "int %1"
-                           :
-                           : "a" ( &param       ),
-                             "i" ( MK_MSG_INTNO )
-                           : "esi"                 );
+    LibMkSysCallParam( MK_SYSCALL_MSG, &param );
 
     /* エラー内容設定 */
     MLIB_SET_IFNOT_NULL( pErr, param.err );
@@ -163,7 +400,8 @@ MkRet_t LibMkMsgSend( MkTaskId_t dst,
 /******************************************************************************/
 /**
  * @brief       メッセージ送信(ノンブロッキング)
- * @details     指定したタスクにメッセージを送信する。
+ * @details     指定したタスクにメッセージを送信する。送信先タスクのメッセージ
+ *              キューが満杯の場合は待ち合わせずに失敗する。
  *
  * @param[in]   dst   送信先タスク
  * @param[in]   *pMsg メッセージ
@@ -175,6 +413,7 @@ MkRet_t LibMkMsgSend( MkTaskId_t dst,
  *                  - MK_ERR_SIZE_OVER    送信サイズ超過
  *                  - MK_ERR_NO_EXIST     存在しないタスクID指定
  *                  - MK_ERR_NO_MEMORY    メモリ不足
+ *                  - MK_ERR_QUEUE_FULL   送信先メッセージキュー満杯
  *
  * @return      処理結果を返す。
  * @retval      MK_RET_SUCCESS 成功
@@ -186,7 +425,16 @@ MkRet_t LibMkMsgSendNB( MkTaskId_t dst,
                         size_t     size,
                         MkErr_t    *pErr  )
 {
-    volatile MkMsgParam_t param;
+    MkRet_t  ret;   /* 戻り値        */
+    uint32_t ebx;   /* EBXレジスタ値 */
+    uint32_t esi;   /* ESIレジスタ値 */
+    uint32_t edi;   /* EDIレジスタ値 */
+
+    /* 初期化 */
+    ret = MK_RET_FAILURE;
+    ebx = dst;
+    esi = ( uint32_t ) pMsg;
+    edi = size;
 
     /* 引数チェック */
     if ( ( pMsg == NULL ) || ( size == 0 ) ) {
@@ -198,21 +446,89 @@ MkRet_t LibMkMsgSendNB( MkTaskId_t dst,
         return MK_RET_FAILURE;
     }
 
+    /* カーネルコール */
+    ret = LibMkSysCall( MK_SYSCALL_MSG_SEND_NB, &ebx, &esi, &edi );
+
+    /* エラー内容設定 */
+    MLIB_SET_IFNOT_NULL( pErr, ebx );
+
+    return ret;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       メッセージキュー上限設定
+ * @details     自タスクのメッセージキューに滞留可能な最大メッセージ数と最大サ
+ *              イズ(メッセージサイズ合計)を設定する。
+ *
+ * @param[in]   num   最大メッセージ数
+ * @param[in]   size  最大サイズ(MK_MSG_SIZE_MAX以上)
+ * @param[out]  *pErr エラー内容
+ *                  - MK_ERR_NONE  エラー無し
+ *                  - MK_ERR_PARAM パラメータ不正
+ *
+ * @return      処理結果を返す。
+ * @retval      MK_RET_SUCCESS 成功
+ * @retval      MK_RET_FAILURE 失敗
+ */
+/******************************************************************************/
+MkRet_t LibMkMsgSetQueueLimit( uint32_t num,
+                               size_t   size,
+                               MkErr_t  *pErr )
+{
+    volatile MkMsgParam_t param;
+
+    /* パラメータ設定 */
+    param.funcId     = MK_MSG_FUNCID_SET_LIMIT;
+    param.ret        = MK_RET_FAILURE;
+    param.err        = MK_ERR_NONE;
+    param.limit.num  = num;
+    param.limit.size = size;
+
+    /* カーネルコール */
+    LibMkSysCallParam( MK_SYSCALL_MSG, &param );
+
+    /* エラー内容設定 */
+    MLIB_SET_IFNOT_NULL( pErr, param.err );
+
+    return param.ret;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       メッセージ受信モード設定
+ * @details     全てのタスクからのメッセージを受信する際のデキュー順序を設定す
+ *              る。送信元ラウンドロビンを設定した場合は、送信元タスク毎に順番
+ *              にメッセージを受信する。緊急メッセージは受信モードに関わらず通
+ *              常メッセージより先に受信する。
+ *
+ * @param[in]   mode  受信モード
+ *                  - MK_MSG_MODE_FIFO 到着順
+ *                  - MK_MSG_MODE_RR   送信元ラウンドロビン
+ * @param[out]  *pErr エラー内容
+ *                  - MK_ERR_NONE  エラー無し
+ *                  - MK_ERR_PARAM パラメータ不正
+ *
+ * @return      処理結果を返す。
+ * @retval      MK_RET_SUCCESS 成功
+ * @retval      MK_RET_FAILURE 失敗
+ */
+/******************************************************************************/
+MkRet_t LibMkMsgSetRecvMode( uint32_t mode,
+                             MkErr_t  *pErr )
+{
+    volatile MkMsgParam_t param;
+
     /* パラメータ設定 */
-    param.funcId    = MK_MSG_FUNCID_SEND_NB;
-    param.ret       = MK_RET_FAILURE;
-    param.err       = MK_ERR_NONE;
-    param.send.dst  = dst;
-    param.send.pMsg = pMsg;
-    param.send.size = size;
+    param.funcId = MK_MSG_FUNCID_SET_MODE;
+    param.ret    = MK_RET_FAILURE;
+    param.err    = MK_ERR_NONE;
+    param.mode   = mode;
 
     /* カーネルコール */
-    __asm__ __volatile__ ( "mov esi, %0\n"
-                           "int %1"
-                           :
-                           : "a" ( &param       ),
-                             "i" ( MK_MSG_INTNO )
-                           : "esi"                 );
+    LibMkSysCallParam( MK_SYSCALL_MSG, &param );
 
     /* エラー内容設定 */
     MLIB_SET_IFNOT_NULL( pErr, param.err );
@@ -0,0 +1,115 @@
+/******************************************************************************/
+/*                                                                            */
+/* src/lib/libmk/LibMkNtf.c                                                   */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2026 Mochi.                                                  */
+/*                                                                            */
+/******************************************************************************/
+/******************************************************************************/
+/* インクルード                                                               */
+/******************************************************************************/
+/* 標準ヘッダ */
+#include <stdint.h>
+
+/* ライブラリヘッダ */
+#include <MLib/MLib.h>
+
+/* カーネルヘッダ */
+#include <kernel/notify.h>
+
+/* モジュールヘッダ */
+#include "LibMkSys.h"
+
+
+/******************************************************************************/
+/* グローバル関数宣言                                                         */
+/******************************************************************************/
+/******************************************************************************/
+/**
+ * @brief       通知送信
+ * @details     指定したタスクの通知ビットに指定ビットを設定する。送信先タスク
+ *              が未読の通知ビットは合成される。
+ *
+ * @param[in]   dst   送信先タスクID
+ * @param[in]   bits  通知ビット
+ * @param[out]  *pErr エラー内容
+ *                  - MK_ERR_NONE         エラー無し
+ *                  - MK_ERR_PARAM        パラメータ不正
+ *                  - MK_ERR_UNAUTHORIZED 非隣接プロセスタイプ
+ *                  - MK_ERR_NO_EXIST     存在しないタスクID指定
+ *
+ * @return      処理結果を返す。
+ * @retval      MK_RET_SUCCESS 成功
+ * @retval      MK_RET_FAILURE 失敗
+ */
+/******************************************************************************/
+MkRet_t LibMkNtfSend( MkTaskId_t dst,
+                      uint32_t   bits,
+                      MkErr_t    *pErr )
+{
+    volatile MkNtfParam_t param;
+
+    /* パラメータ設定 */
+    param.funcId = MK_NTF_FUNCID_SEND;
+    param.ret    = MK_RET_FAILURE;
+    param.err    = MK_ERR_NONE;
+    param.dst    = dst;
+    param.bits   = bits;
+
+    /* カーネルコール */
+    LibMkSysCallParam( MK_SYSCALL_NTF, &param );
+
+    /* エラー内容設定 */
+    MLIB_SET_IFNOT_NULL( pErr, param.err );
+
+    return param.ret;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       通知待ち合わせ
+ * @details     通知ビットが設定されるまで待ち合わせ、通知ビットを取得する。取
+ *              得した通知ビットはクリアされる。
+ *
+ * @param[in]   timeout タイムアウト時間[us]
+ *                  - 0     タイムアウト無し
+ *                  - 0以外 タイムアウト時間
+ * @param[out]  *pBits  通知ビット
+ * @param[out]  *pErr   エラー内容
+ *                  - MK_ERR_NONE        エラー無し
+ *                  - MK_ERR_NO_RESOURCE リソース不足
+ *                  - MK_ERR_TIMEOUT     タイムアウト
+ *
+ * @return      処理結果を返す。
+ * @retval      MK_RET_SUCCESS 成功
+ * @retval      MK_RET_FAILURE 失敗
+ */
+/******************************************************************************/
+MkRet_t LibMkNtfWait( uint32_t timeout,
+                      uint32_t *pBits,
+                      MkErr_t  *pErr   )
+{
+    volatile MkNtfParam_t param;
+
+    /* パラメータ設定 */
+    param.funcId  = MK_NTF_FUNCID_WAIT;
+    param.ret     = MK_RET_FAILURE;
+    param.err     = MK_ERR_NONE;
+    param.bits    = 0;
+    param.timeout = timeout;
+
+    /* カーネルコール */
+    LibMkSysCallParam( MK_SYSCALL_NTF, &param );
+
+    /* エラー内容設定 */
+    MLIB_SET_IFNOT_NULL( pErr, param.err );
+
+    /* 通知ビット設定 */
+    MLIB_SET_IFNOT_NULL( pBits, param.bits );
+
+    return param.ret;
+}
+
+
+/******************************************************************************/
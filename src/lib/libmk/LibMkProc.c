@@ -1,8 +1,8 @@
 /******************************************************************************/
 /*                                                                            */
 /* src/lib/libmk/LibMkProc.c                                                  */
-/*                                                                 2021/10/25 */
-/* Copyright (C) 2018-2021 Mochi.                                             */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2018-2026 Mochi.                                             */
 /*                                                                            */
 /******************************************************************************/
 /******************************************************************************/
@@ -19,6 +19,9 @@
 #include <kernel/config.h>
 #include <kernel/proc.h>
 
+/* モジュールヘッダ */
+#include "LibMkSys.h"
+
 
 /******************************************************************************/
 /* グローバル関数宣言                                                         */
@@ -51,12 +54,7 @@ MkRet_t LibMkProcFork( MkPid_t *pPid,
     param.err        = MK_ERR_NONE;
 
     /* カーネルコール */
-    __asm__ __volatile__ ( "mov esi, %0\n"
-                           "int %1"
-                           :
-                           : "a" ( &param        ),
-                             "i" ( MK_PROC_INTNO )
-                           : "esi"                  );
+    LibMkSysCallParam( MK_SYSCALL_PROC, &param );
 
     /* エラー内容設定 */
     MLIB_SET_IFNOT_NULL( pErr, param.err );
@@ -68,6 +66,45 @@ MkRet_t LibMkProcFork( MkPid_t *pPid,
 }
 
 
+/******************************************************************************/
+/**
+ * @brief       プロセスID取得
+ * @details     関数を呼び出したプロセスのプロセスIDを取得する。プロセスIDは共
+ *              有ページから取得し、カーネルを呼び出さない。
+ *
+ * @param[out]  *pPid プロセスID
+ * @param[out]  *pErr エラー内容
+ *                  - MK_ERR_NONE  エラー無し
+ *                  - MK_ERR_PARAM パラメータ不正
+ *
+ * @return      取得結果を返す。
+ * @retval      MK_RET_SUCCESS 成功
+ * @retval      MK_RET_FAILURE 失敗
+ */
+/******************************************************************************/
+MkRet_t LibMkProcGetPid( MkPid_t *pPid,
+                         MkErr_t *pErr  )
+{
+    /* 引数チェック */
+    if ( pPid == NULL ) {
+        /* 不正 */
+
+        /* エラー内容設定 */
+        MLIB_SET_IFNOT_NULL( pErr, MK_ERR_PARAM );
+
+        return MK_RET_FAILURE;
+    }
+
+    /* プロセスID設定 */
+    *pPid = LIBMK_SYS_PAGE->pid;
+
+    /* エラー内容設定 */
+    MLIB_SET_IFNOT_NULL( pErr, MK_ERR_NONE );
+
+    return MK_RET_SUCCESS;
+}
+
+
 /******************************************************************************/
 /**
  * @brief       ブレイクポイント設定
@@ -98,12 +135,7 @@ MkRet_t LibMkProcSetBreakPoint( int32_t quantity,
     param.quantity    = quantity;
 
     /* カーネルコール */
-    __asm__ __volatile__ ( "mov esi, %0\n"
-                           "int %1"
-                           :
-                           : "a" ( &param        ),
-                             "i" ( MK_PROC_INTNO )
-                           : "esi"                  );
+    LibMkSysCallParam( MK_SYSCALL_PROC, &param );
 
     /* エラー内容設定 */
     MLIB_SET_IFNOT_NULL( pErr, param.err );
@@ -0,0 +1,156 @@
+/******************************************************************************/
+/*                                                                            */
+/* src/lib/libmk/LibMkPub.c                                                   */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2026 Mochi.                                                  */
+/*                                                                            */
+/******************************************************************************/
+/******************************************************************************/
+/* インクルード                                                               */
+/******************************************************************************/
+/* 標準ヘッダ */
+#include <stddef.h>
+#include <stdint.h>
+
+/* ライブラリヘッダ */
+#include <MLib/MLib.h>
+
+/* カーネルヘッダ */
+#include <kernel/pubsub.h>
+
+/* モジュールヘッダ */
+#include "LibMkSys.h"
+
+
+/******************************************************************************/
+/* グローバル関数宣言                                                         */
+/******************************************************************************/
+/******************************************************************************/
+/**
+ * @brief       出版
+ * @details     指定したグループの全購読タスク(自タスクを除く)にメッセージを
+ *              配信する。メッセージはカーネル内に一度だけコピーされ、各購読タ
+ *              スクはLibMkMsgReceive()で通常のメッセージとして受信する。メッ
+ *              セージキューが満杯の購読タスクへの配信はブロックせずに破棄され
+ *              る。プロセス階層が隣接しない購読タスクには配信されない。
+ *
+ * @param[in]   grpId グループID
+ * @param[in]   *pMsg メッセージ
+ * @param[in]   size  メッセージサイズ
+ * @param[out]  *pNum 配信数
+ * @param[out]  *pErr エラー内容
+ *                  - MK_ERR_NONE      エラー無し
+ *                  - MK_ERR_PARAM     パラメータ不正
+ *                  - MK_ERR_NO_MEMORY メモリ不足
+ *
+ * @return      処理結果を返す。
+ * @retval      MK_RET_SUCCESS 成功
+ * @retval      MK_RET_FAILURE 失敗
+ */
+/******************************************************************************/
+MkRet_t LibMkPubPublish( uint32_t grpId,
+                         void     *pMsg,
+                         size_t   size,
+                         uint32_t *pNum,
+                         MkErr_t  *pErr  )
+{
+    volatile MkPubParam_t param;
+
+    /* パラメータ設定 */
+    param.funcId = MK_PUB_FUNCID_PUBLISH;
+    param.ret    = MK_RET_FAILURE;
+    param.err    = MK_ERR_NONE;
+    param.grpId  = grpId;
+    param.pMsg   = pMsg;
+    param.size   = size;
+    param.num    = 0;
+
+    /* カーネルコール */
+    LibMkSysCallParam( MK_SYSCALL_PUB, &param );
+
+    /* エラー内容設定 */
+    MLIB_SET_IFNOT_NULL( pErr, param.err );
+
+    /* 配信数設定 */
+    MLIB_SET_IFNOT_NULL( pNum, param.num );
+
+    return param.ret;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       購読開始
+ * @details     自タスクを指定したグループの購読タスクとして登録する。
+ *
+ * @param[in]   grpId グループID
+ * @param[out]  *pErr エラー内容
+ *                  - MK_ERR_NONE        エラー無し
+ *                  - MK_ERR_PARAM       パラメータ不正
+ *                  - MK_ERR_REGISTERED  登録済み
+ *                  - MK_ERR_NO_RESOURCE リソース不足
+ *
+ * @return      処理結果を返す。
+ * @retval      MK_RET_SUCCESS 成功
+ * @retval      MK_RET_FAILURE 失敗
+ */
+/******************************************************************************/
+MkRet_t LibMkPubSubscribe( uint32_t grpId,
+                           MkErr_t  *pErr  )
+{
+    volatile MkPubParam_t param;
+
+    /* パラメータ設定 */
+    param.funcId = MK_PUB_FUNCID_SUBSCRIBE;
+    param.ret    = MK_RET_FAILURE;
+    param.err    = MK_ERR_NONE;
+    param.grpId  = grpId;
+
+    /* カーネルコール */
+    LibMkSysCallParam( MK_SYSCALL_PUB, &param );
+
+    /* エラー内容設定 */
+    MLIB_SET_IFNOT_NULL( pErr, param.err );
+
+    return param.ret;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       購読終了
+ * @details     自タスクを指定したグループの購読タスクから削除する。
+ *
+ * @param[in]   grpId グループID
+ * @param[out]  *pErr エラー内容
+ *                  - MK_ERR_NONE          エラー無し
+ *                  - MK_ERR_PARAM         パラメータ不正
+ *                  - MK_ERR_NO_REGISTERED 未登録
+ *
+ * @return      処理結果を返す。
+ * @retval      MK_RET_SUCCESS 成功
+ * @retval      MK_RET_FAILURE 失敗
+ */
+/******************************************************************************/
+MkRet_t LibMkPubUnsubscribe( uint32_t grpId,
+                             MkErr_t  *pErr  )
+{
+    volatile MkPubParam_t param;
+
+    /* パラメータ設定 */
+    param.funcId = MK_PUB_FUNCID_UNSUBSCRIBE;
+    param.ret    = MK_RET_FAILURE;
+    param.err    = MK_ERR_NONE;
+    param.grpId  = grpId;
+
+    /* カーネルコール */
+    LibMkSysCallParam( MK_SYSCALL_PUB, &param );
+
+    /* エラー内容設定 */
+    MLIB_SET_IFNOT_NULL( pErr, param.err );
+
+    return param.ret;
+}
+
+
+/******************************************************************************/
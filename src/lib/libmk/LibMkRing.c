@@ -0,0 +1,246 @@
+/******************************************************************************/
+/*                                                                            */
+/* src/lib/libmk/LibMkRing.c                                                  */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2026 Mochi.                                                  */
+/*                                                                            */
+/******************************************************************************/
+/******************************************************************************/
+/* インクルード                                                               */
+/******************************************************************************/
+/* 標準ヘッダ */
+#include <stdint.h>
+
+/* ライブラリヘッダ */
+#include <MLib/MLib.h>
+
+/* カーネルヘッダ */
+#include <kernel/ring.h>
+#include <kernel/syscall.h>
+
+/* モジュールヘッダ */
+#include "LibMkSys.h"
+
+
+/******************************************************************************/
+/* グローバル関数宣言                                                         */
+/******************************************************************************/
+/******************************************************************************/
+/**
+ * @brief       リング投入
+ * @details     投入キューに積まれたシステムコールをカーネルで一括処理し、結果
+ *              を完了キューに格納する。完了キューが満杯になった場合は残りの投
+ *              入キューエントリを処理せずに復帰する。ブロックし得るシステムコ
+ *              ールのエントリはMK_ERR_PARAMで完了する。
+ *
+ * @param[in]   *pRing システムコールリング
+ * @param[out]  *pNum  処理エントリ数
+ * @param[out]  *pErr  エラー内容
+ *                  - MK_ERR_NONE  エラー無し
+ *                  - MK_ERR_PARAM パラメータ不正
+ *
+ * @return      処理結果を返す。
+ * @retval      MK_RET_SUCCESS 成功
+ * @retval      MK_RET_FAILURE 失敗
+ */
+/******************************************************************************/
+MkRet_t LibMkRingEnter( MkRing_t *pRing,
+                        uint32_t *pNum,
+                        MkErr_t  *pErr   )
+{
+    MkRet_t  ret;   /* 戻り値        */
+    uint32_t ebx;   /* EBXレジスタ値 */
+    uint32_t esi;   /* ESIレジスタ値 */
+    uint32_t edi;   /* EDIレジスタ値 */
+
+    /* 初期化 */
+    ret = MK_RET_FAILURE;
+    ebx = ( uint32_t ) pRing;
+    esi = 0;
+    edi = 0;
+
+    /* カーネルコール */
+    ret = LibMkSysCall( MK_SYSCALL_RING_ENTER, &ebx, &esi, &edi );
+
+    /* エラー内容設定 */
+    MLIB_SET_IFNOT_NULL( pErr, ebx );
+
+    /* 処理エントリ数設定 */
+    MLIB_SET_IFNOT_NULL( pNum, esi );
+
+    return ret;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       リング初期化
+ * @details     システムコールリングの投入キューと完了キューを空にする。
+ *
+ * @param[in]   *pRing システムコールリング
+ * @param[out]  *pErr  エラー内容
+ *                  - MK_ERR_NONE  エラー無し
+ *                  - MK_ERR_PARAM パラメータ不正
+ *
+ * @return      処理結果を返す。
+ * @retval      MK_RET_SUCCESS 成功
+ * @retval      MK_RET_FAILURE 失敗
+ */
+/******************************************************************************/
+MkRet_t LibMkRingInit( MkRing_t *pRing,
+                       MkErr_t  *pErr   )
+{
+    /* 引数チェック */
+    if ( pRing == NULL ) {
+        /* 不正 */
+
+        /* エラー内容設定 */
+        MLIB_SET_IFNOT_NULL( pErr, MK_ERR_PARAM );
+
+        return MK_RET_FAILURE;
+    }
+
+    /* インデックス初期化 */
+    pRing->sqHead = 0;
+    pRing->sqTail = 0;
+    pRing->cqHead = 0;
+    pRing->cqTail = 0;
+
+    /* エラー内容設定 */
+    MLIB_SET_IFNOT_NULL( pErr, MK_ERR_NONE );
+
+    return MK_RET_SUCCESS;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       完了キュー取出し
+ * @details     完了キューの先頭エントリを取り出す。
+ *
+ * @param[in]   *pRing システムコールリング
+ * @param[out]  *pCqe  完了キューエントリ
+ * @param[out]  *pErr  エラー内容
+ *                  - MK_ERR_NONE     エラー無し
+ *                  - MK_ERR_PARAM    パラメータ不正
+ *                  - MK_ERR_NO_EXIST 完了エントリ無し
+ *
+ * @return      処理結果を返す。
+ * @retval      MK_RET_SUCCESS 成功
+ * @retval      MK_RET_FAILURE 失敗
+ */
+/******************************************************************************/
+MkRet_t LibMkRingPop( MkRing_t    *pRing,
+                      MkRingCqe_t *pCqe,
+                      MkErr_t     *pErr   )
+{
+    volatile MkRingCqe_t *pEntry;   /* 完了キューエントリ */
+
+    /* 引数チェック */
+    if ( ( pRing == NULL ) || ( pCqe == NULL ) ) {
+        /* 不正 */
+
+        /* エラー内容設定 */
+        MLIB_SET_IFNOT_NULL( pErr, MK_ERR_PARAM );
+
+        return MK_RET_FAILURE;
+    }
+
+    /* 完了キューエントリ有無判定 */
+    if ( pRing->cqHead == pRing->cqTail ) {
+        /* 無し */
+
+        /* エラー内容設定 */
+        MLIB_SET_IFNOT_NULL( pErr, MK_ERR_NO_EXIST );
+
+        return MK_RET_FAILURE;
+    }
+
+    /* エントリ取出し */
+    pEntry         = &( pRing->cq[ pRing->cqHead & MK_RING_MASK ] );
+    pCqe->userData = pEntry->userData;
+    pCqe->ret      = pEntry->ret;
+    pCqe->err      = pEntry->err;
+    pCqe->value    = pEntry->value;
+
+    /* 完了キュー先頭更新 */
+    pRing->cqHead++;
+
+    /* エラー内容設定 */
+    MLIB_SET_IFNOT_NULL( pErr, MK_ERR_NONE );
+
+    return MK_RET_SUCCESS;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       投入キュー追加
+ * @details     レジスタ渡し形式のシステムコールを投入キューに追加する。追加し
+ *              たシステムコールはLibMkRingEnter()の呼出し時に処理する。
+ *
+ * @param[in]   *pRing   システムコールリング
+ * @param[in]   no       システムコール番号
+ * @param[in]   arg1     引数1(EBX)
+ * @param[in]   arg2     引数2(ESI)
+ * @param[in]   arg3     引数3(EDI)
+ * @param[in]   userData ユーザデータ
+ * @param[out]  *pErr    エラー内容
+ *                  - MK_ERR_NONE       エラー無し
+ *                  - MK_ERR_PARAM      パラメータ不正
+ *                  - MK_ERR_QUEUE_FULL 投入キュー満杯
+ *
+ * @return      処理結果を返す。
+ * @retval      MK_RET_SUCCESS 成功
+ * @retval      MK_RET_FAILURE 失敗
+ */
+/******************************************************************************/
+MkRet_t LibMkRingPush( MkRing_t *pRing,
+                       uint32_t no,
+                       uint32_t arg1,
+                       uint32_t arg2,
+                       uint32_t arg3,
+                       uint32_t userData,
+                       MkErr_t  *pErr     )
+{
+    volatile MkRingSqe_t *pEntry;   /* 投入キューエントリ */
+
+    /* 引数チェック */
+    if ( pRing == NULL ) {
+        /* 不正 */
+
+        /* エラー内容設定 */
+        MLIB_SET_IFNOT_NULL( pErr, MK_ERR_PARAM );
+
+        return MK_RET_FAILURE;
+    }
+
+    /* 投入キュー空き有無判定 */
+    if ( ( pRing->sqTail - pRing->sqHead ) >= MK_RING_ENTRY_NUM ) {
+        /* 空き無し */
+
+        /* エラー内容設定 */
+        MLIB_SET_IFNOT_NULL( pErr, MK_ERR_QUEUE_FULL );
+
+        return MK_RET_FAILURE;
+    }
+
+    /* エントリ設定 */
+    pEntry           = &( pRing->sq[ pRing->sqTail & MK_RING_MASK ] );
+    pEntry->no       = no;
+    pEntry->userData = userData;
+    pEntry->arg[ 0 ] = arg1;
+    pEntry->arg[ 1 ] = arg2;
+    pEntry->arg[ 2 ] = arg3;
+
+    /* 投入キュー末尾更新 */
+    pRing->sqTail++;
+
+    /* エラー内容設定 */
+    MLIB_SET_IFNOT_NULL( pErr, MK_ERR_NONE );
+
+    return MK_RET_SUCCESS;
+}
+
+
+/******************************************************************************/
@@ -0,0 +1,178 @@
+/******************************************************************************/
+/*                                                                            */
+/* src/lib/libmk/LibMkSys.c                                                   */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2026 Mochi.                                                  */
+/*                                                                            */
+/******************************************************************************/
+/******************************************************************************/
+/* インクルード                                                               */
+/******************************************************************************/
+/* 標準ヘッダ */
+#include <stdint.h>
+
+/* 共通ヘッダ */
+#include <hardware/IA32/IA32.h>
+#include <hardware/IA32/IA32Instruction.h>
+
+/* モジュールヘッダ */
+#include "LibMkSys.h"
+
+
+/******************************************************************************/
+/* グローバル変数定義                                                         */
+/******************************************************************************/
+/** カーネルコール方式 */
+uint32_t gLibMkSysType = LIBMK_SYS_TYPE_UNKNOWN;
+
+
+/******************************************************************************/
+/* グローバル関数定義                                                         */
+/******************************************************************************/
+/******************************************************************************/
+/**
+ * @brief           システムコール
+ * @details         システムコール番号をEAXレジスタに、引数をEBX, ESI, EDIレジ
+ *                  スタに設定してカーネルを呼び出し、カーネルが設定した出力値
+ *                  を各レジスタから取得する。CPUがSYSENTER/SYSEXIT命令をサポー
+ *                  トしている場合はSYSENTER命令で、サポートしていない場合はint
+ *                  命令でカーネルを呼び出す。SYSENTER命令では復帰先のESPをECX
+ *                  レジスタに、EIPをEDXレジスタに設定し、カーネルはSYSEXIT命令
+ *                  でここに復帰する。
+ *
+ * @param[in]       no    システムコール番号
+ * @param[in,out]   *pEbx EBXレジスタ値(入力:引数1, 出力:エラー内容)
+ * @param[in,out]   *pEsi ESIレジスタ値(入力:引数2, 出力:出力値1)
+ * @param[in,out]   *pEdi EDIレジスタ値(入力:引数3, 出力:出力値2)
+ *
+ * @return          EAXレジスタ値(処理結果)を返す。
+ */
+/******************************************************************************/
+MkRet_t LibMkSysCall( uint32_t no,
+                      uint32_t *pEbx,
+                      uint32_t *pEsi,
+                      uint32_t *pEdi  )
+{
+    uint32_t eax;   /* EAXレジスタ値 */
+    uint32_t ebx;   /* EBXレジスタ値 */
+    uint32_t esi;   /* ESIレジスタ値 */
+    uint32_t edi;   /* EDIレジスタ値 */
+
+    /* 初期化 */
+    eax = no;
+    ebx = *pEbx;
+    esi = *pEsi;
+    edi = *pEdi;
+
+    /* カーネルコール方式判定 */
+    if ( gLibMkSysType == LIBMK_SYS_TYPE_UNKNOWN ) {
+        /* 未判定 */
+        LibMkSysInit();
+    }
+
+    /* カーネルコール方式判定 */
+    if ( gLibMkSysType == LIBMK_SYS_TYPE_SYSENTER ) {
+        /* SYSENTER/SYSEXIT命令 */
+
+        __asm__ __volatile__ ( "mov  ecx, esp\n"
+                               "mov  edx, OFFSET 1f\n"
+                               "sysenter\n"
+                               "1:"
+                               : "+a" ( eax ),  /* in/out: eax */
+                                 "+b" ( ebx ),  /* in/out: ebx */
+                                 "+S" ( esi ),  /* in/out: esi */
+                                 "+D" ( edi )   /* in/out: edi */
+                               :
+                               : "ecx", "edx", "memory" );
+
+    } else {
+        /* int命令 */
+
+        __asm__ __volatile__ ( "int %4"
+                               : "+a" ( eax ),  /* in/out: eax */
+                                 "+b" ( ebx ),  /* in/out: ebx */
+                                 "+S" ( esi ),  /* in/out: esi */
+                                 "+D" ( edi )   /* in/out: edi */
+                               : "i"  ( MK_SYSCALL_INTNO )
+                               : "ecx", "edx", "memory" );
+    }
+
+    /* 出力値設定 */
+    *pEbx = ebx;
+    *pEsi = esi;
+    *pEdi = edi;
+
+    return ( MkRet_t ) eax;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       パラメータ渡し形式システムコール
+ * @details     パラメータのアドレスをESIレジスタに設定してシステムコールを呼
+ *              び出す。処理結果はパラメータに設定される。
+ *
+ * @param[in]   no      システムコール番号
+ * @param[in]   *pParam パラメータ
+ */
+/******************************************************************************/
+void LibMkSysCallParam( uint32_t      no,
+                        volatile void *pParam )
+{
+    uint32_t ebx;   /* EBXレジスタ値 */
+    uint32_t esi;   /* ESIレジスタ値 */
+    uint32_t edi;   /* EDIレジスタ値 */
+
+    /* 初期化 */
+    ebx = 0;
+    esi = ( uint32_t ) pParam;
+    edi = 0;
+
+    /* システムコール */
+    ( void ) LibMkSysCall( no, &ebx, &esi, &edi );
+
+    return;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       カーネルコール方式初期化
+ * @details     CPUがSYSENTER/SYSEXIT命令をサポートしているか判定し、カーネル
+ *              コール方式を決定する。カーネルはサポートしている場合に必ず
+ *              SYSENTER命令の入口を設定する為、判定結果は一致する。
+ */
+/******************************************************************************/
+void LibMkSysInit( void )
+{
+    uint32_t eax;   /* CPUID EAX出力値 */
+    uint32_t ebx;   /* CPUID EBX出力値 */
+    uint32_t ecx;   /* CPUID ECX出力値 */
+    uint32_t edx;   /* CPUID EDX出力値 */
+
+    /* 初期化 */
+    eax = 0;
+    ebx = 0;
+    ecx = 0;
+    edx = 0;
+
+    /* CPUID取得 */
+    IA32InstructionCpuid( 1, &eax, &ebx, &ecx, &edx );
+
+    /* SYSENTER/SYSEXIT命令サポート判定 */
+    if ( ( edx & IA32_CPUID_1_EDX_SEP ) != 0 ) {
+        /* サポート */
+
+        gLibMkSysType = LIBMK_SYS_TYPE_SYSENTER;
+
+    } else {
+        /* 未サポート */
+
+        gLibMkSysType = LIBMK_SYS_TYPE_INT;
+    }
+
+    return;
+}
+
+
+/******************************************************************************/
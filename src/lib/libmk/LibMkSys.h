@@ -0,0 +1,58 @@
+/******************************************************************************/
+/*                                                                            */
+/* src/lib/libmk/LibMkSys.h                                                   */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2026 Mochi.                                                  */
+/*                                                                            */
+/******************************************************************************/
+#ifndef LIBMK_SYS_H
+#define LIBMK_SYS_H
+/******************************************************************************/
+/* インクルード                                                               */
+/******************************************************************************/
+/* 標準ヘッダ */
+#include <stdint.h>
+
+/* カーネルヘッダ */
+#include <kernel/sharedpage.h>
+#include <kernel/syscall.h>
+#include <kernel/types.h>
+
+
+/******************************************************************************/
+/* 定義                                                                       */
+/******************************************************************************/
+/* カーネルコール方式 */
+#define LIBMK_SYS_TYPE_UNKNOWN  ( 0 )   /**< 未判定               */
+#define LIBMK_SYS_TYPE_INT      ( 1 )   /**< int命令              */
+#define LIBMK_SYS_TYPE_SYSENTER ( 2 )   /**< SYSENTER/SYSEXIT命令 */
+
+/** 共有ページ */
+#define LIBMK_SYS_PAGE \
+    ( ( volatile MkSharedPage_t * ) MK_SHAREDPAGE_ADDR )
+
+
+/******************************************************************************/
+/* グローバル変数宣言                                                         */
+/******************************************************************************/
+/** カーネルコール方式 */
+extern uint32_t gLibMkSysType;
+
+
+/******************************************************************************/
+/* グローバル関数宣言                                                         */
+/******************************************************************************/
+/* システムコール */
+extern MkRet_t LibMkSysCall( uint32_t no,
+                             uint32_t *pEbx,
+                             uint32_t *pEsi,
+                             uint32_t *pEdi  );
+/* パラメータ渡し形式システムコール */
+extern void LibMkSysCallParam( uint32_t      no,
+                               volatile void *pParam );
+/* カーネルコール方式初期化 */
+extern void LibMkSysInit( void );
+
+
+/******************************************************************************/
+#endif
@@ -0,0 +1,197 @@
+/******************************************************************************/
+/*                                                                            */
+/* src/lib/libmk/LibMkSysStat.c                                               */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2026 Mochi.                                                  */
+/*                                                                            */
+/******************************************************************************/
+/******************************************************************************/
+/* インクルード                                                               */
+/******************************************************************************/
+/* 標準ヘッダ */
+#include <stdint.h>
+
+/* ライブラリヘッダ */
+#include <MLib/MLib.h>
+
+/* カーネルヘッダ */
+#include <kernel/syscall.h>
+#include <kernel/sysstat.h>
+
+/* モジュールヘッダ */
+#include "LibMkSys.h"
+
+
+/******************************************************************************/
+/* グローバル関数宣言                                                         */
+/******************************************************************************/
+/******************************************************************************/
+/**
+ * @brief       システムコール統計ログ出力
+ * @details     カーネルが記録したシステムコール統計と割込み遅延統計をカーネル
+ *              ログに出力する。停止前に呼び出すことで実行期間全体の統計を残
+ *              す。
+ *
+ * @param[out]  *pErr エラー内容
+ *                  - MK_ERR_NONE  エラー無し
+ *                  - MK_ERR_PARAM 統計無効
+ *
+ * @return      処理結果を返す。
+ * @retval      MK_RET_SUCCESS 成功
+ * @retval      MK_RET_FAILURE 失敗
+ */
+/******************************************************************************/
+MkRet_t LibMkSysStatDump( MkErr_t *pErr )
+{
+    MkRet_t  ret;   /* 戻り値        */
+    uint32_t ebx;   /* EBXレジスタ値 */
+    uint32_t esi;   /* ESIレジスタ値 */
+    uint32_t edi;   /* EDIレジスタ値 */
+
+    /* 初期化 */
+    ret = MK_RET_FAILURE;
+    ebx = 0;
+    esi = 0;
+    edi = 0;
+
+    /* カーネルコール */
+    ret = LibMkSysCall( MK_SYSCALL_SYSSTAT_DUMP, &ebx, &esi, &edi );
+
+    /* エラー内容設定 */
+    MLIB_SET_IFNOT_NULL( pErr, ebx );
+
+    return ret;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       システムコール統計取得
+ * @details     指定したシステムコール番号と機能IDの呼出し回数と処理時間ヒスト
+ *              グラムを、プロセスタイプ毎(MK_PROC_TYPE_KERNEL～
+ *              MK_PROC_TYPE_USERの順)に取得する。
+ *
+ * @param[in]   no     システムコール番号
+ * @param[in]   funcId 機能ID
+ *                  - 0     機能ID無し
+ *                  - 0以外 MK_SYSSTAT_FUNCID_NUM未満
+ * @param[out]  *pStat 統計格納先(MK_SYSSTAT_PROCTYPE_NUM個)
+ * @param[out]  *pErr  エラー内容
+ *                  - MK_ERR_NONE  エラー無し
+ *                  - MK_ERR_PARAM パラメータ不正または統計無効
+ *
+ * @return      処理結果を返す。
+ * @retval      MK_RET_SUCCESS 成功
+ * @retval      MK_RET_FAILURE 失敗
+ */
+/******************************************************************************/
+MkRet_t LibMkSysStatGet( uint32_t    no,
+                         uint32_t    funcId,
+                         MkSysStat_t *pStat,
+                         MkErr_t     *pErr   )
+{
+    MkRet_t  ret;   /* 戻り値        */
+    uint32_t ebx;   /* EBXレジスタ値 */
+    uint32_t esi;   /* ESIレジスタ値 */
+    uint32_t edi;   /* EDIレジスタ値 */
+
+    /* 初期化 */
+    ret = MK_RET_FAILURE;
+    ebx = no;
+    esi = funcId;
+    edi = ( uint32_t ) pStat;
+
+    /* カーネルコール */
+    ret = LibMkSysCall( MK_SYSCALL_SYSSTAT_GET, &ebx, &esi, &edi );
+
+    /* エラー内容設定 */
+    MLIB_SET_IFNOT_NULL( pErr, ebx );
+
+    return ret;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       割込み遅延統計取得
+ * @details     指定したIRQ番号のハードウェア割込み発生から、割込み待ち合わせ
+ *              中のドライバタスクがユーザモードに復帰するまでの遅延統計を、区
+ *              間毎(MK_INTSTAT_STAGE_WAKE～MK_INTSTAT_STAGE_TOTALの順)に取得
+ *              する。
+ *
+ * @param[in]   irqNo  IRQ番号
+ * @param[out]  *pStat 統計格納先(MK_INTSTAT_STAGE_NUM個)
+ * @param[out]  *pErr  エラー内容
+ *                  - MK_ERR_NONE  エラー無し
+ *                  - MK_ERR_PARAM パラメータ不正または統計無効
+ *
+ * @return      処理結果を返す。
+ * @retval      MK_RET_SUCCESS 成功
+ * @retval      MK_RET_FAILURE 失敗
+ */
+/******************************************************************************/
+MkRet_t LibMkSysStatGetInt( uint8_t     irqNo,
+                            MkIntStat_t *pStat,
+                            MkErr_t     *pErr   )
+{
+    MkRet_t  ret;   /* 戻り値        */
+    uint32_t ebx;   /* EBXレジスタ値 */
+    uint32_t esi;   /* ESIレジスタ値 */
+    uint32_t edi;   /* EDIレジスタ値 */
+
+    /* 初期化 */
+    ret = MK_RET_FAILURE;
+    ebx = irqNo;
+    esi = 0;
+    edi = ( uint32_t ) pStat;
+
+    /* カーネルコール */
+    ret = LibMkSysCall( MK_SYSCALL_INTSTAT_GET, &ebx, &esi, &edi );
+
+    /* エラー内容設定 */
+    MLIB_SET_IFNOT_NULL( pErr, ebx );
+
+    return ret;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       タイマ合体統計取得
+ * @details     タイマのスラックによる満了処理の合体状況を取得する。
+ *
+ * @param[out]  *pStat 統計格納先
+ * @param[out]  *pErr  エラー内容
+ *                  - MK_ERR_NONE  エラー無し
+ *                  - MK_ERR_PARAM パラメータ不正または統計無効
+ *
+ * @return      処理結果を返す。
+ * @retval      MK_RET_SUCCESS 成功
+ * @retval      MK_RET_FAILURE 失敗
+ */
+/******************************************************************************/
+MkRet_t LibMkSysStatGetTimer( MkTimerStat_t *pStat,
+                              MkErr_t       *pErr   )
+{
+    MkRet_t  ret;   /* 戻り値        */
+    uint32_t ebx;   /* EBXレジスタ値 */
+    uint32_t esi;   /* ESIレジスタ値 */
+    uint32_t edi;   /* EDIレジスタ値 */
+
+    /* 初期化 */
+    ret = MK_RET_FAILURE;
+    ebx = 0;
+    esi = 0;
+    edi = ( uint32_t ) pStat;
+
+    /* カーネルコール */
+    ret = LibMkSysCall( MK_SYSCALL_TIMERSTAT_GET, &ebx, &esi, &edi );
+
+    /* エラー内容設定 */
+    MLIB_SET_IFNOT_NULL( pErr, ebx );
+
+    return ret;
+}
+
+
+/******************************************************************************/
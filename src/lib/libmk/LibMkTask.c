@@ -1,8 +1,8 @@
 /******************************************************************************/
 /*                                                                            */
 /* src/lib/libmk/LibMkTask.c                                                  */
-/*                                                                 2019/08/28 */
-/* Copyright (C) 2019 Mochi.                                                  */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2019-2026 Mochi.                                             */
 /*                                                                            */
 /******************************************************************************/
 /******************************************************************************/
@@ -17,6 +17,9 @@
 /* カーネルヘッダ */
 #include <kernel/task.h>
 
+/* モジュールヘッダ */
+#include "LibMkSys.h"
+
 
 /******************************************************************************/
 /* グローバル関数宣言                                                         */
@@ -25,7 +28,8 @@
 /**
  * @brief       タスクID取得
  * @details     関数を呼び出したタスクのタスクIDを引数*pTaskIdに設定する。取得
- *              に失敗した場合はエラー内容をpErrに設定する。
+ *              に失敗した場合はエラー内容をpErrに設定する。タスクIDは共有ペー
+ *              ジから取得し、カーネルを呼び出さない。
  *
  * @param[in]   *pTaskId タスクID
  * @param[out]  *pErr    エラー内容
@@ -40,8 +44,6 @@
 MkRet_t LibMkTaskGetId( MkTaskId_t *pTaskId,
                         MkErr_t    *pErr     )
 {
-    volatile MkTaskParam_t param;   /* パラメータ */
-
     /* 引数チェック */
     if ( pTaskId == NULL ) {
         /* 不正 */
@@ -52,27 +54,13 @@ MkRet_t LibMkTaskGetId( MkTaskId_t *pTaskId,
         return MK_RET_FAILURE;
     }
 
-    /* パラメータ設定 */
-    param.funcId    = MK_TASK_FUNCID_GET_ID;
-    param.ret       = MK_RET_FAILURE;
-    param.err       = MK_ERR_NONE;
-    param.taskId    = MK_TASKID_NULL;
-
-    /* カーネルコール */
-    __asm__ __volatile__ ( "mov esi, %0\n"
-                           "int %1"
-                           :
-                           : "a" ( &param        ),
-                             "i" ( MK_TASK_INTNO )
-                           : "esi"                  );
+    /* タスクID設定 */
+    *pTaskId = LIBMK_SYS_PAGE->taskId;
 
     /* エラー内容設定 */
-    MLIB_SET_IFNOT_NULL( pErr, param.err );
-
-    /* タスクID設定 */
-    *pTaskId = param.taskId;
+    MLIB_SET_IFNOT_NULL( pErr, MK_ERR_NONE );
 
-    return param.ret;
+    return MK_RET_SUCCESS;
 }
 
 
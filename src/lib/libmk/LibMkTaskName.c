@@ -1,8 +1,8 @@
 /******************************************************************************/
 /*                                                                            */
 /* src/lib/libmk/LibMkTaskName.c                                              */
-/*                                                                 2019/07/28 */
-/* Copyright (C) 2018-2019 Mochi.                                             */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2018-2026 Mochi.                                             */
 /*                                                                            */
 /******************************************************************************/
 /******************************************************************************/
@@ -17,6 +17,9 @@
 /* カーネルヘッダ */
 #include <kernel/taskname.h>
 
+/* モジュールヘッダ */
+#include "LibMkSys.h"
+
 
 /******************************************************************************/
 /* グローバル関数宣言                                                         */
@@ -65,12 +68,7 @@ MkRet_t LibMkTaskNameGet( char       *pTaskName,
     param.pTaskName = pTaskName;
 
     /* カーネルコール */
-    __asm__ __volatile__ ( "mov esi, %0\n"
-                           "int %1"
-                           :
-                           : "a" ( &param            ),
-                             "i" ( MK_TASKNAME_INTNO )
-                           : "esi"                      );
+    LibMkSysCallParam( MK_SYSCALL_TASKNAME, &param );
 
     /* エラー内容設定 */
     MLIB_SET_IFNOT_NULL( pErr, param.err );
@@ -124,12 +122,7 @@ MkRet_t LibMkTaskNameRegister( char    *pTaskName,
     param.pTaskName = pTaskName;
 
     /* カーネルコール */
-    __asm__ __volatile__ ( "mov esi, %0\n"
-                           "int %1"
-                           :
-                           : "a" ( &param            ),
-                             "i" ( MK_TASKNAME_INTNO )
-                           : "esi"                      );
+    LibMkSysCallParam( MK_SYSCALL_TASKNAME, &param );
 
     /* エラー内容設定 */
     MLIB_SET_IFNOT_NULL( pErr, param.err );
@@ -166,12 +159,7 @@ MkRet_t LibMkTaskNameUnregister( MkErr_t *pErr )
     param.pTaskName = NULL;
 
     /* カーネルコール */
-    __asm__ __volatile__ ( "mov esi, %0\n"
-                           "int %1"
-                           :
-                           : "a" ( &param            ),
-                             "i" ( MK_TASKNAME_INTNO )
-                           : "esi"                      );
+    LibMkSysCallParam( MK_SYSCALL_TASKNAME, &param );
 
     /* エラー内容設定 */
     MLIB_SET_IFNOT_NULL( pErr, param.err );
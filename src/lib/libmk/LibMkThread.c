@@ -1,8 +1,8 @@
 /******************************************************************************/
 /*                                                                            */
 /* src/lib/libmk/LibMkThread.c                                                */
-/*                                                                 2019/08/28 */
-/* Copyright (C) 2019 Mochi.                                                  */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2019-2026 Mochi.                                             */
 /*                                                                            */
 /******************************************************************************/
 /******************************************************************************/
@@ -20,6 +20,9 @@
 #include <kernel/types.h>
 #include <kernel/thread.h>
 
+/* モジュールヘッダ */
+#include "LibMkSys.h"
+
 
 /******************************************************************************/
 /* グローバル関数宣言                                                         */
@@ -63,12 +66,7 @@ MkRet_t LibMkThreadCreate( MkThreadFunc_t pFunc,
     param.stackSize  = stackSize;
 
     /* カーネルコール */
-    __asm__ __volatile__ ( "mov esi, %0\n"
-                           "int %1"
-                           :
-                           : "a" ( &param          ),
-                             "i" ( MK_THREAD_INTNO )
-                           : "esi"                    );
+    LibMkSysCallParam( MK_SYSCALL_THREAD, &param );
 
     /* エラー内容設定 */
     MLIB_SET_IFNOT_NULL( pErr, param.err );
@@ -1,8 +1,8 @@
 /******************************************************************************/
 /*                                                                            */
 /* src/lib/libmk/LibMkTimer.c                                                 */
-/*                                                                 2019/07/28 */
-/* Copyright (C) 2018-2019 Mochi.                                             */
+/*                                                                 2026/10/18 */
+/* Copyright (C) 2018-2026 Mochi.                                             */
 /*                                                                            */
 /******************************************************************************/
 /******************************************************************************/
@@ -15,12 +15,220 @@
 #include <MLib/MLib.h>
 
 /* カーネルヘッダ */
+#include <kernel/sharedpage.h>
 #include <kernel/timer.h>
 
+/* 共通ヘッダ */
+#include <hardware/IA32/IA32Instruction.h>
+
+/* モジュールヘッダ */
+#include "LibMkSys.h"
+
+
+/******************************************************************************/
+/* 定義                                                                       */
+/******************************************************************************/
+/** 1秒当たりのナノ秒数 */
+#define NSEC_PER_SEC ( 1000000000ULL )
+
+/** 時刻情報型 */
+typedef struct {
+    uint32_t tickHz;    /**< tick周波数[Hz]               */
+    uint64_t tick;      /**< tickカウンタ                 */
+    uint64_t tscHz;     /**< TSC周波数[Hz](0:無効)        */
+    uint64_t tscBase;   /**< 単調増加時刻0時のTSC値       */
+    uint64_t realBase;  /**< 単調増加時刻0時の実時刻[ns]  */
+} timeInfo_t;
+
+
+/******************************************************************************/
+/* ローカル関数宣言                                                           */
+/******************************************************************************/
+/* 単調増加時刻計算 */
+static uint64_t CalcNsec( timeInfo_t *pInfo );
+
+/* 時刻情報読込み */
+static void ReadTime( timeInfo_t *pInfo );
+
+
+/******************************************************************************/
+/* グローバル関数定義                                                         */
+/******************************************************************************/
+/******************************************************************************/
+/**
+ * @brief       単調増加時刻取得
+ * @details     起動からの経過時間をナノ秒単位で取得する。共有ページの時刻情報
+ *              とTSC値から時刻を求め、カーネルを呼び出さない。TSCが無効の場
+ *              合はtickの粒度となる。
+ *
+ * @param[out]  *pNsec 経過時間[ns]
+ * @param[out]  *pErr  エラー内容
+ *                  - MK_ERR_NONE  エラー無し
+ *                  - MK_ERR_PARAM パラメータ不正
+ *
+ * @return      処理結果を返す。
+ * @retval      MK_RET_SUCCESS 成功
+ * @retval      MK_RET_FAILURE 失敗
+ */
+/******************************************************************************/
+MkRet_t LibMkTimerGetNsec( uint64_t *pNsec,
+                           MkErr_t  *pErr   )
+{
+    timeInfo_t info;    /* 時刻情報 */
+
+    /* 引数チェック */
+    if ( pNsec == NULL ) {
+        /* 不正 */
+
+        /* エラー内容設定 */
+        MLIB_SET_IFNOT_NULL( pErr, MK_ERR_PARAM );
+
+        return MK_RET_FAILURE;
+    }
+
+    /* 時刻情報読込み */
+    ReadTime( &info );
+
+    /* 単調増加時刻計算 */
+    *pNsec = CalcNsec( &info );
+
+    /* エラー内容設定 */
+    MLIB_SET_IFNOT_NULL( pErr, MK_ERR_NONE );
+
+    return MK_RET_SUCCESS;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       実時刻取得
+ * @details     1970年1月1日(UTC)からの経過時間をナノ秒単位で取得する。単調増
+ *              加時刻に起動時にRTCから読み込んだ実時刻を加算して求め、カーネ
+ *              ルを呼び出さない。実時刻の精度は秒単位とする。
+ *
+ * @param[out]  *pNsec 経過時間[ns]
+ * @param[out]  *pErr  エラー内容
+ *                  - MK_ERR_NONE  エラー無し
+ *                  - MK_ERR_PARAM パラメータ不正
+ *
+ * @return      処理結果を返す。
+ * @retval      MK_RET_SUCCESS 成功
+ * @retval      MK_RET_FAILURE 失敗
+ */
+/******************************************************************************/
+MkRet_t LibMkTimerGetRealNsec( uint64_t *pNsec,
+                               MkErr_t  *pErr   )
+{
+    timeInfo_t info;    /* 時刻情報 */
+
+    /* 引数チェック */
+    if ( pNsec == NULL ) {
+        /* 不正 */
+
+        /* エラー内容設定 */
+        MLIB_SET_IFNOT_NULL( pErr, MK_ERR_PARAM );
+
+        return MK_RET_FAILURE;
+    }
+
+    /* 時刻情報読込み */
+    ReadTime( &info );
+
+    /* 実時刻計算 */
+    *pNsec = info.realBase + CalcNsec( &info );
+
+    /* エラー内容設定 */
+    MLIB_SET_IFNOT_NULL( pErr, MK_ERR_NONE );
+
+    return MK_RET_SUCCESS;
+}
+
 
 /******************************************************************************/
-/* グローバル関数宣言                                                         */
+/**
+ * @brief       tickカウンタ取得
+ * @details     起動からのtick数を共有ページから取得する。カーネルは呼び出さな
+ *              い。
+ *
+ * @param[out]  *pTick tickカウンタ
+ * @param[out]  *pErr  エラー内容
+ *                  - MK_ERR_NONE  エラー無し
+ *                  - MK_ERR_PARAM パラメータ不正
+ *
+ * @return      処理結果を返す。
+ * @retval      MK_RET_SUCCESS 成功
+ * @retval      MK_RET_FAILURE 失敗
+ */
 /******************************************************************************/
+MkRet_t LibMkTimerGetTick( uint64_t *pTick,
+                           MkErr_t  *pErr   )
+{
+    timeInfo_t info;    /* 時刻情報 */
+
+    /* 引数チェック */
+    if ( pTick == NULL ) {
+        /* 不正 */
+
+        /* エラー内容設定 */
+        MLIB_SET_IFNOT_NULL( pErr, MK_ERR_PARAM );
+
+        return MK_RET_FAILURE;
+    }
+
+    /* 時刻情報読込み */
+    ReadTime( &info );
+    *pTick = info.tick;
+
+    /* エラー内容設定 */
+    MLIB_SET_IFNOT_NULL( pErr, MK_ERR_NONE );
+
+    return MK_RET_SUCCESS;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       スラック設定
+ * @details     呼出し元スレッドがこれ以降に設定するタイマ(スリープ、受信タイ
+ *              ムアウト等)のスラックを設定する。スラックはタイマ満了を遅らせ
+ *              て他のタイマの満了とまとめる事を許す時間で、プロセスタイプ毎の
+ *              既定値より小さくすると満了の遅れを抑えられる。
+ *
+ * @param[in]   usec  スラック(マイクロ秒)
+ *                  - MK_TIMER_SLACK_DEFAULT     プロセスタイプ毎の既定値
+ *                  - MK_TIMER_SLACK_DEFAULT以外 スラック
+ * @param[out]  *pErr エラー内容
+ *                  - MK_ERR_NONE エラー無し
+ *
+ * @return      処理結果を返す。
+ * @retval      MK_RET_SUCCESS 成功
+ * @retval      MK_RET_FAILURE 失敗
+ */
+/******************************************************************************/
+MkRet_t LibMkTimerSetSlack( uint32_t usec,
+                            MkErr_t  *pErr )
+{
+    MkRet_t  ret;   /* 戻り値        */
+    uint32_t ebx;   /* EBXレジスタ値 */
+    uint32_t esi;   /* ESIレジスタ値 */
+    uint32_t edi;   /* EDIレジスタ値 */
+
+    /* 初期化 */
+    ret = MK_RET_FAILURE;
+    ebx = usec;
+    esi = 0;
+    edi = 0;
+
+    /* カーネルコール */
+    ret = LibMkSysCall( MK_SYSCALL_TIMER_SET_SLACK, &ebx, &esi, &edi );
+
+    /* エラー内容設定 */
+    MLIB_SET_IFNOT_NULL( pErr, ebx );
+
+    return ret;
+}
+
+
 /******************************************************************************/
 /**
  * @brief       スリープ
@@ -35,28 +243,65 @@
  * @retval      MK_RET_SUCCESS 成功
  * @retval      MK_RET_FAILURE 失敗
  *
- * @attention   カーネルのtick時間よりも短いスリープ時間を設定した場合、tick時
- *              間に丸められる。
+ * @attention   高分解能タイマが無効の場合、カーネルのtick時間よりも短いスリー
+ *              プ時間はtick時間に丸められる。
  */
 /******************************************************************************/
 MkRet_t LibMkTimerSleep( uint32_t usec,
                          MkErr_t  *pErr )
+{
+    MkRet_t  ret;   /* 戻り値        */
+    uint32_t ebx;   /* EBXレジスタ値 */
+    uint32_t esi;   /* ESIレジスタ値 */
+    uint32_t edi;   /* EDIレジスタ値 */
+
+    /* 初期化 */
+    ret = MK_RET_FAILURE;
+    ebx = usec;
+    esi = 0;
+    edi = 0;
+
+    /* カーネルコール */
+    ret = LibMkSysCall( MK_SYSCALL_TIMER_SLEEP, &ebx, &esi, &edi );
+
+    /* エラー内容設定 */
+    MLIB_SET_IFNOT_NULL( pErr, ebx );
+
+    return ret;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       時刻指定スリープ
+ * @details     単調増加時刻が指定した時刻に達するまでスリープする。指定時刻を
+ *              経過済みの場合は直ちに戻る。前回の満了時刻に周期を加算した時刻
+ *              を指定する事で、処理時間によって周期がずれない周期処理を行え
+ *              る。
+ *
+ * @param[in]   nsec  満了時刻(単調増加時刻[ns])
+ * @param[out]  *pErr エラー内容
+ *                  - MK_ERR_NONE        エラー無し
+ *                  - MK_ERR_NO_RESOURCE リソース不足
+ *
+ * @return      処理結果を返す。
+ * @retval      MK_RET_SUCCESS 成功
+ * @retval      MK_RET_FAILURE 失敗
+ */
+/******************************************************************************/
+MkRet_t LibMkTimerSleepUntil( uint64_t nsec,
+                              MkErr_t  *pErr )
 {
     volatile MkTimerParam_t param;
 
     /* パラメータ設定 */
-    param.funcId = MK_TIMER_FUNCID_SLEEP;
+    param.funcId = MK_TIMER_FUNCID_SLEEP_UNTIL;
     param.ret    = MK_RET_FAILURE;
     param.err    = MK_ERR_NONE;
-    param.usec   = usec;
+    param.nsec   = nsec;
 
     /* カーネルコール */
-    __asm__ __volatile__ ( "mov esi, %0\n"
-                           "int %1"
-                           :
-                           : "a" ( &param         ),
-                             "i" ( MK_TIMER_INTNO )
-                           : "esi"                   );
+    LibMkSysCallParam( MK_SYSCALL_TIMER, &param );
 
     /* エラー内容設定 */
     MLIB_SET_IFNOT_NULL( pErr, param.err );
@@ -65,4 +310,178 @@ MkRet_t LibMkTimerSleep( uint32_t usec,
 }
 
 
+/******************************************************************************/
+/**
+ * @brief       タイマ開始
+ * @details     指定した時間で満了するタイマを開始する。満了時は指定した方法で
+ *              自タスクに満了を通知する。
+ *              - MK_TIMER_NOTIFY_NTF 通知ビットbitsを通知する。
+ *              - MK_TIMER_NOTIFY_MSG 自タスクを送信元とするタイマ満了メッセ
+ *                                    ージ(MkTimerMsg_t)を送信する。
+ *              繰り返しタイマの周期は1tick(1000000/MK_CONFIG_TICK_HZマイクロ
+ *              秒)以上を指定する。
+ *
+ * @param[in]   usec      タイマ値(マイクロ秒)
+ * @param[in]   type      タイマ種別
+ *                  - MK_TIMER_TYPE_ONESHOT ワンショット
+ *                  - MK_TIMER_TYPE_REPEAT  繰り返し
+ * @param[in]   notify    満了通知方法
+ *                  - MK_TIMER_NOTIFY_NTF 通知
+ *                  - MK_TIMER_NOTIFY_MSG メッセージ
+ * @param[in]   bits      通知ビット(MK_TIMER_NOTIFY_NTF時)
+ * @param[out]  *pTimerId タイマID
+ * @param[out]  *pErr     エラー内容
+ *                  - MK_ERR_NONE        エラー無し
+ *                  - MK_ERR_PARAM       パラメータ不正
+ *                  - MK_ERR_NO_RESOURCE リソース不足
+ *
+ * @return      処理結果を返す。
+ * @retval      MK_RET_SUCCESS 成功
+ * @retval      MK_RET_FAILURE 失敗
+ */
+/******************************************************************************/
+MkRet_t LibMkTimerStart( uint32_t usec,
+                         uint32_t type,
+                         uint32_t notify,
+                         uint32_t bits,
+                         uint32_t *pTimerId,
+                         MkErr_t  *pErr      )
+{
+    MkRet_t  ret;   /* 戻り値        */
+    uint32_t ebx;   /* EBXレジスタ値 */
+    uint32_t esi;   /* ESIレジスタ値 */
+    uint32_t edi;   /* EDIレジスタ値 */
+
+    /* 初期化 */
+    ret = MK_RET_FAILURE;
+    ebx = usec;
+    esi = MK_TIMER_REG_MODE( type, notify );
+    edi = bits;
+
+    /* カーネルコール */
+    ret = LibMkSysCall( MK_SYSCALL_TIMER_START, &ebx, &esi, &edi );
+
+    /* エラー内容設定 */
+    MLIB_SET_IFNOT_NULL( pErr, ebx );
+
+    /* タイマID設定 */
+    MLIB_SET_IFNOT_NULL( pTimerId, esi );
+
+    return ret;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       タイマ停止
+ * @details     自タスクが開始したタイマを停止する。
+ *
+ * @param[in]   timerId タイマID
+ * @param[out]  *pErr   エラー内容
+ *                  - MK_ERR_NONE         エラー無し
+ *                  - MK_ERR_NO_EXIST     存在しないタイマID指定
+ *                  - MK_ERR_UNAUTHORIZED 他タスクのタイマ指定
+ *
+ * @return      処理結果を返す。
+ * @retval      MK_RET_SUCCESS 成功
+ * @retval      MK_RET_FAILURE 失敗
+ */
+/******************************************************************************/
+MkRet_t LibMkTimerStop( uint32_t timerId,
+                        MkErr_t  *pErr    )
+{
+    MkRet_t  ret;   /* 戻り値        */
+    uint32_t ebx;   /* EBXレジスタ値 */
+    uint32_t esi;   /* ESIレジスタ値 */
+    uint32_t edi;   /* EDIレジスタ値 */
+
+    /* 初期化 */
+    ret = MK_RET_FAILURE;
+    ebx = timerId;
+    esi = 0;
+    edi = 0;
+
+    /* カーネルコール */
+    ret = LibMkSysCall( MK_SYSCALL_TIMER_STOP, &ebx, &esi, &edi );
+
+    /* エラー内容設定 */
+    MLIB_SET_IFNOT_NULL( pErr, ebx );
+
+    return ret;
+}
+
+
+/******************************************************************************/
+/* ローカル関数定義                                                           */
+/******************************************************************************/
+/******************************************************************************/
+/**
+ * @brief       単調増加時刻計算
+ * @details     時刻情報から単調増加時刻を計算する。TSCが有効な場合はTSC値か
+ *              ら、無効な場合はtickカウンタから計算する。
+ *
+ * @param[in]   *pInfo 時刻情報
+ *
+ * @return      単調増加時刻[ns]を返す。
+ */
+/******************************************************************************/
+static uint64_t CalcNsec( timeInfo_t *pInfo )
+{
+    uint64_t tscDiff;   /* TSC増分 */
+
+    /* 初期化 */
+    tscDiff = 0;
+
+    /* TSC有効判定 */
+    if ( pInfo->tscHz == 0 ) {
+        /* 無効 */
+
+        return pInfo->tick * ( NSEC_PER_SEC / pInfo->tickHz );
+    }
+
+    /* TSC増分取得 */
+    tscDiff = IA32InstructionRdtsc() - pInfo->tscBase;
+
+    /* 秒と秒未満に分けて換算(桁溢れ防止) */
+    return ( tscDiff / pInfo->tscHz ) * NSEC_PER_SEC +
+           ( tscDiff % pInfo->tscHz ) * NSEC_PER_SEC / pInfo->tscHz;
+}
+
+
+/******************************************************************************/
+/**
+ * @brief       時刻情報読込み
+ * @details     共有ページのtick情報と時刻情報を読み込む。カーネルが更新中の場
+ *              合、または読込み中に更新された場合は読み直す。
+ *
+ * @param[out]  *pInfo 時刻情報
+ */
+/******************************************************************************/
+static void ReadTime( timeInfo_t *pInfo )
+{
+    uint32_t                seq;    /* 更新シーケンス番号 */
+    volatile MkSharedPage_t *pPage; /* 共有ページ         */
+
+    /* 初期化 */
+    seq   = 0;
+    pPage = LIBMK_SYS_PAGE;
+
+    do {
+        /* 更新シーケンス番号取得 */
+        seq = pPage->seq;
+
+        /* 時刻情報取得 */
+        pInfo->tickHz   = pPage->tickHz;
+        pInfo->tick     = pPage->tick;
+        pInfo->tscHz    = pPage->tscHz;
+        pInfo->tscBase  = pPage->tscBase;
+        pInfo->realBase = pPage->realBase;
+
+    /* 更新判定 */
+    } while ( ( ( seq & 1 ) != 0 ) || ( seq != pPage->seq ) );
+
+    return;
+}
+
+
 /******************************************************************************/